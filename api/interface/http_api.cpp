@@ -78,6 +78,23 @@
 #include "rpc_create_transaction.h"
 #include "ca/block_helper.h"
 #include "common/global_data.h"
+#include "common/peer_score.h"
+#include "ca/tx_mempool.h"
+#include "ca/spendable_utxo_index.h"
+#include "ca/tx_ingest_pipeline.h"
+#include "ca/failed_transaction_cache.h"
+#include "utils/tx_lifecycle_tracer.h"
+#include "mpt/trie_node_cache.h"
+#include "contract/precompiles_cache.hpp"
+#include "ca/sync_pipeline.h"
+#include "ca/block_preverify.h"
+#include "ca/header_first_sync.h"
+#include "ca/sum_tree_sync.h"
+#include "ca/snapshot_sync.h"
+#include "db/state_snapshot.h"
+#include "ca/compact_block_relay.h"
+#include "utils/ed25519_batch.h"
+#include "utils/verified_signature_cache.h"
 
 #define VALIDATE_PARSINREQUEST                                             \
     std::string ParseRet = req_t._parseFromJson(req.body);            \
@@ -164,6 +181,10 @@ void subscribeToHttpCallbacks() {
     HttpServer::RegisterCallback("/printhundredhash", _ApiPrintHundredSumHash);
     HttpServer::RegisterCallback("/printblock", _ApiPrintAllBlocks);
     HttpServer::RegisterCallback("/SystemInfo", systemInfo);
+    HttpServer::RegisterCallback("/metrics", _ApiMetrics);
+    HttpServer::RegisterCallback("/peerScores", _ApiPeerScores);
+    HttpServer::RegisterCallback("/txLifecycle", _ApiTxLifecycle);
+    HttpServer::RegisterCallback("/txLifecycleTrace", _ApiTxLifecycleTrace);
 
     //vote ===========================================
     HttpServer::RegisterCallback("/printVoteInfo", _ApiPrintVoteInfo);
@@ -1277,6 +1298,7 @@ void sendApiMessageRequest(const Request &req, Response &res)
     type = (TxHelper::vrfAgentType)std::stoi(req_t.txType);
     std::string txHash = Getsha256hash(tx.SerializeAsString());
     ack_t.txHash = addHexPrefix(txHash);
+    MagicSingleton<TxLifecycleTracer>::GetInstance()->Record(TxTraceStage::kRpcReceipt, txHash);
     int ret = SendMessage(tx, height, info, type);
     DEBUGLOG("*** rpc send tx hash: {}", txHash);
     if(ret!= 0)
@@ -2401,6 +2423,295 @@ void getRequesterIp(const Request &req, Response & res){
 }
 
 
+void _ApiMetrics(const Request &req, Response &res)
+{
+    nlohmann::json metrics;
+
+    auto trieStats = MagicSingleton<TrieNodeCache>::GetInstance()->GetStats();
+    auto& trie = metrics["mptNodeCache"];
+    trie["hits"] = trieStats.hits;
+    trie["misses"] = trieStats.misses;
+    trie["hitRate"] = trieStats.hits + trieStats.misses == 0 ? 0.0 : (double)trieStats.hits / (trieStats.hits + trieStats.misses);
+    trie["inserts"] = trieStats.inserts;
+    trie["evictions"] = trieStats.evictions;
+    trie["entries"] = trieStats.entries;
+    trie["bytes"] = trieStats.bytes;
+    trie["capacityBytes"] = trieStats.capacityBytes;
+
+    const std::vector<std::pair<std::string, evmone::state::PrecompileId>> precompiles = {
+        {"ecrecover", evmone::state::PrecompileId::ecrecover},
+        {"expmod", evmone::state::PrecompileId::expmod},
+        {"ecpairing", evmone::state::PrecompileId::ecpairing},
+        {"blake2bf", evmone::state::PrecompileId::blake2bf},
+    };
+    for (const auto& [name, id] : precompiles)
+    {
+        auto stats = evmone::state::precompile_cache().stats(id);
+        auto& item = metrics["precompileCache"][name];
+        item["hits"] = stats.hits;
+        item["misses"] = stats.misses;
+        item["evictions"] = stats.evictions;
+        item["entries"] = stats.entries;
+        item["bytes"] = stats.bytes;
+    }
+
+    auto syncStats = MagicSingleton<SyncPipeline>::GetInstance()->GetStats();
+    auto& sync = metrics["syncPipeline"];
+    sync["runs"] = syncStats.runs;
+    sync["window"] = syncStats.window;
+    sync["downloadedBlocks"] = syncStats.downloadedBlocks;
+    sync["verifiedBlocks"] = syncStats.verifiedBlocks;
+    sync["savedBlocks"] = syncStats.savedBlocks;
+    sync["timeouts"] = syncStats.timeouts;
+    sync["retries"] = syncStats.retries;
+    sync["downloadBlocksPerSec"] = syncStats.downloadBlocksPerSec;
+    sync["verifyBlocksPerSec"] = syncStats.verifyBlocksPerSec;
+    sync["saveBlocksPerSec"] = syncStats.saveBlocksPerSec;
+
+    auto headerFirstStats = MagicSingleton<HeaderFirstSync>::GetInstance()->GetStats();
+    auto& headerFirst = metrics["headerFirstSync"];
+    headerFirst["runs"] = headerFirstStats.runs;
+    headerFirst["fallbacks"] = headerFirstStats.fallbacks;
+    headerFirst["agreedBlocks"] = headerFirstStats.agreedBlocks;
+    headerFirst["disputedSummaries"] = headerFirstStats.disputedSummaries;
+    headerFirst["fetchedBlocks"] = headerFirstStats.fetchedBlocks;
+    headerFirst["rejectedBodies"] = headerFirstStats.rejectedBodies;
+
+    auto sumTreeStats = MagicSingleton<SumTreeSync>::GetInstance()->GetStats();
+    auto& sumTree = metrics["sumTreeSync"];
+    sumTree["searches"] = sumTreeStats.searches;
+    sumTree["divergencesFound"] = sumTreeStats.divergencesFound;
+    sumTree["rounds"] = sumTreeStats.rounds;
+    sumTree["failures"] = sumTreeStats.failures;
+    sumTree["lastDivergentHeight"] = sumTreeStats.lastDivergentHeight;
+
+    auto& requestWaits = metrics["requestWaits"];
+    for (const auto& [protocol, waitStats] : dataMgrPtr.GetWaitStats())
+    {
+        uint64_t ended = waitStats.quorumReached + waitStats.timedOut + waitStats.cancelled + waitStats.unreachable;
+        auto& wait = requestWaits[protocol];
+        wait["requests"] = waitStats.requests;
+        wait["quorumReached"] = waitStats.quorumReached;
+        wait["timedOut"] = waitStats.timedOut;
+        wait["cancelled"] = waitStats.cancelled;
+        wait["unreachable"] = waitStats.unreachable;
+        wait["responses"] = waitStats.responses;
+        wait["avgLatencyMs"] = ended == 0 ? 0 : waitStats.totalLatencyMs / ended;
+        wait["maxLatencyMs"] = waitStats.maxLatencyMs;
+    }
+
+    auto producerStats = MagicSingleton<StateSnapshot>::GetInstance()->GetStats();
+    auto snapshotSyncStats = MagicSingleton<SnapshotSync>::GetInstance()->GetStats();
+    auto& snapshot = metrics["stateSnapshot"];
+    snapshot["produced"] = producerStats.produced;
+    snapshot["discarded"] = producerStats.discarded;
+    snapshot["lastProducedHeight"] = producerStats.lastProducedHeight;
+    snapshot["servedChunks"] = producerStats.servedChunks;
+    snapshot["syncRuns"] = snapshotSyncStats.runs;
+    snapshot["syncFailures"] = snapshotSyncStats.failures;
+    snapshot["imports"] = producerStats.imports;
+    snapshot["lastImportedHeight"] = producerStats.lastImportedHeight;
+    snapshot["importedKeys"] = producerStats.importedKeys;
+    snapshot["rejectedChunks"] = producerStats.rejectedChunks;
+    snapshot["downloadedChunks"] = snapshotSyncStats.downloadedChunks;
+    snapshot["chunkRetries"] = snapshotSyncStats.chunkRetries;
+    snapshot["downloadedBytes"] = snapshotSyncStats.downloadedBytes;
+
+    auto compactStats = MagicSingleton<CompactBlockRelay>::GetInstance()->GetStats();
+    auto& compact = metrics["compactBlockRelay"];
+    compact["compactSent"] = compactStats.compactSent;
+    compact["fullSentToOlderPeers"] = compactStats.fullSentToOlderPeers;
+    compact["compactReceived"] = compactStats.compactReceived;
+    compact["reconstructedLocally"] = compactStats.reconstructedLocally;
+    compact["reconstructedAfterRequest"] = compactStats.reconstructedAfterRequest;
+    compact["fullBlockFallbacks"] = compactStats.fullBlockFallbacks;
+    compact["expired"] = compactStats.expired;
+    compact["txHitRate"] = compactStats.txsRequired == 0 ? 0.0 : (double)compactStats.txsFromPool / compactStats.txsRequired;
+    compact["bytesSaved"] = compactStats.bytesSaved;
+    compact["bytesSavedPerBlock"] = compactStats.blocksCompleted == 0 ? 0 : compactStats.bytesSaved / (int64_t)compactStats.blocksCompleted;
+
+    auto preVerifyStats = MagicSingleton<BlockPreVerifier>::GetInstance()->GetStats();
+    auto& preVerify = metrics["blockPreVerify"];
+    preVerify["verifiedBlocks"] = preVerifyStats.verifiedBlocks;
+    preVerify["rejectedBlocks"] = preVerifyStats.rejectedBlocks;
+    preVerify["cachedLookups"] = preVerifyStats.cachedLookups;
+    preVerify["consensusSignMismatches"] = preVerifyStats.consensusSignMismatches;
+
+    auto pubKeyStats = MagicSingleton<Ed25519PubKeyCache>::GetInstance()->GetStats();
+    auto& pubKeyCache = metrics["ed25519PubKeyCache"];
+    pubKeyCache["hits"] = pubKeyStats.hits;
+    pubKeyCache["misses"] = pubKeyStats.misses;
+    pubKeyCache["entries"] = pubKeyStats.entries;
+
+    auto verifiedSignStats = MagicSingleton<VerifiedSignatureCache>::GetInstance()->GetStats();
+    auto& verifiedSigns = metrics["verifiedSignatureCache"];
+    verifiedSigns["lookups"] = verifiedSignStats.lookups;
+    verifiedSigns["hits"] = verifiedSignStats.hits;
+    verifiedSigns["inserts"] = verifiedSignStats.inserts;
+    verifiedSigns["entries"] = verifiedSignStats.entries;
+    verifiedSigns["hitRate"] = verifiedSignStats.lookups == 0 ? 0.0 : static_cast<double>(verifiedSignStats.hits) / verifiedSignStats.lookups;
+
+    auto peerScoreStats = MagicSingleton<PeerScore>::GetInstance()->GetStats();
+    auto& peerScores = metrics["peerScores"];
+    peerScores["peers"] = peerScoreStats.peers.size();
+    peerScores["selections"] = peerScoreStats.selections;
+    peerScores["explored"] = peerScoreStats.explored;
+    peerScores["hedges"] = peerScoreStats.hedges;
+
+    auto mempoolStats = MagicSingleton<TxMempool>::GetInstance()->GetStats();
+    auto& mempool = metrics["txMempool"];
+    mempool["count"] = mempoolStats.count;
+    mempool["bytes"] = mempoolStats.bytes;
+    mempool["added"] = mempoolStats.added;
+    mempool["duplicates"] = mempoolStats.duplicates;
+    mempool["rejectedFull"] = mempoolStats.rejectedFull;
+    mempool["evicted"] = mempoolStats.evicted;
+    mempool["expired"] = mempoolStats.expired;
+    mempool["removed"] = mempoolStats.removed;
+    mempool["oldestAgeMs"] = mempoolStats.oldestAgeMs;
+    auto ageHistogram = [](const TxMempoolAgeHistogram& ages) {
+        nlohmann::json buckets = nlohmann::json::array();
+        for (size_t i = 0; i < ages.size(); ++i)
+        {
+            nlohmann::json bucket;
+            bucket["le"] = i < kTxMempoolAgeBucketsMs.size() ? nlohmann::json(kTxMempoolAgeBucketsMs[i]) : nlohmann::json("inf");
+            bucket["count"] = ages[i];
+            buckets.push_back(bucket);
+        }
+        return buckets;
+    };
+    mempool["packagedAgeMs"] = ageHistogram(mempoolStats.packagedAgeMs);
+    mempool["droppedAgeMs"] = ageHistogram(mempoolStats.droppedAgeMs);
+
+    auto utxoIndexStats = MagicSingleton<SpendableUtxoIndex>::GetInstance()->GetStats();
+    auto& utxoIndex = metrics["spendableUtxoIndex"];
+    utxoIndex["accounts"] = utxoIndexStats.accounts;
+    utxoIndex["reservedUtxos"] = utxoIndexStats.reservedUtxos;
+    utxoIndex["hits"] = utxoIndexStats.hits;
+    utxoIndex["loads"] = utxoIndexStats.loads;
+    utxoIndex["invalidations"] = utxoIndexStats.invalidations;
+    utxoIndex["expiredReservations"] = utxoIndexStats.expiredReservations;
+
+    auto ingestStats = MagicSingleton<TxIngestPipeline>::GetInstance()->GetStats();
+    auto stageStats = [](const TxIngestStageStats &stage) {
+        nlohmann::json value;
+        value["passed"] = stage.passed;
+        value["dropped"] = stage.dropped;
+        value["busyMicros"] = stage.busyMicros;
+        return value;
+    };
+    auto& ingest = metrics["txIngest"];
+    ingest["dedup"] = stageStats(ingestStats.dedup);
+    ingest["syntax"] = stageStats(ingestStats.syntax);
+    ingest["signature"] = stageStats(ingestStats.signature);
+    ingest["utxo"] = stageStats(ingestStats.utxo);
+    ingest["admit"] = stageStats(ingestStats.admit);
+    ingest["queued"] = ingestStats.queued;
+    ingest["inFlight"] = ingestStats.inFlight;
+    ingest["queueFull"] = ingestStats.queueFull;
+    ingest["utxoMisses"] = ingestStats.utxoMisses;
+    ingest["dedupFilterPositives"] = ingestStats.dedupFilterPositives;
+    ingest["dedupFalsePositiveRate"] = ingestStats.dedupFalsePositiveRate;
+
+    auto rejectedStats = MagicSingleton<RejectedTxFilter>::GetInstance()->GetStats();
+    auto& rejected = metrics["rejectedTxFilter"];
+    rejected["rejected"] = rejectedStats.rejected;
+    rejected["checked"] = rejectedStats.checked;
+    rejected["dropped"] = rejectedStats.dropped;
+    rejected["remembered"] = rejectedStats.remembered;
+    rejected["memoryBytes"] = rejectedStats.memoryBytes;
+    rejected["falsePositiveRate"] = rejectedStats.falsePositiveRate;
+
+    res.set_content(metrics.dump(4), "application/json");
+}
+
+void _ApiPeerScores(const Request &req, Response &res)
+{
+    std::string protocolFilter;
+    if (req.has_param("protocol"))
+    {
+        protocolFilter = req.get_param_value("protocol");
+    }
+
+    auto peerScoreStats = MagicSingleton<PeerScore>::GetInstance()->GetStats();
+    nlohmann::json scores;
+    scores["selections"] = peerScoreStats.selections;
+    scores["explored"] = peerScoreStats.explored;
+    scores["hedges"] = peerScoreStats.hedges;
+    auto& peers = scores["peers"];
+    peers = nlohmann::json::object();
+    for (const auto& [peer, protocols] : peerScoreStats.peers)
+    {
+        for (const auto& [protocol, stats] : protocols)
+        {
+            if (!protocolFilter.empty() && protocol != protocolFilter)
+            {
+                continue;
+            }
+            auto& item = peers[peer][protocol];
+            item["successes"] = stats.successes;
+            item["failures"] = stats.failures;
+            item["failureRate"] = stats.failureRate;
+            item["latencyMs"] = stats.latencyMs;
+            item["p95LatencyMs"] = stats.p95LatencyMs;
+            item["bytesPerSec"] = stats.bytesPerSec;
+            item["bytes"] = stats.bytes;
+            item["score"] = stats.score;
+        }
+    }
+    res.set_content(scores.dump(4), "application/json");
+}
+
+void _ApiTxLifecycle(const Request &req, Response &res)
+{
+    auto tracer = MagicSingleton<TxLifecycleTracer>::GetInstance();
+    auto tracerStats = tracer->GetStats();
+    auto latency = [](const TxTracePercentiles &percentiles) {
+        nlohmann::json value;
+        value["count"] = percentiles.count;
+        value["p50Us"] = percentiles.p50;
+        value["p90Us"] = percentiles.p90;
+        value["p99Us"] = percentiles.p99;
+        value["maxUs"] = percentiles.max;
+        return value;
+    };
+
+    nlohmann::json lifecycle;
+    lifecycle["recorded"] = tracerStats.recorded;
+    lifecycle["sampleEvery"] = tracerStats.sampleEvery;
+    lifecycle["threads"] = tracerStats.threads;
+    lifecycle["transactions"] = tracerStats.transactions;
+    auto& stages = lifecycle["stages"];
+    stages = nlohmann::json::array();
+    for (const auto& summary : tracer->Summarize())
+    {
+        nlohmann::json stage;
+        stage["stage"] = TxTraceStageName(summary.stage);
+        stage["sinceFirst"] = latency(summary.sinceFirst);
+        stage["sincePrevious"] = latency(summary.sincePrevious);
+        stages.push_back(stage);
+    }
+    res.set_content(lifecycle.dump(4), "application/json");
+}
+
+void _ApiTxLifecycleTrace(const Request &req, Response &res)
+{
+    size_t limit = 1000;
+    if (req.has_param("limit"))
+    {
+        try
+        {
+            limit = std::stoul(req.get_param_value("limit"));
+        }
+        catch (const std::exception &)
+        {
+            res.set_content("invalid limit", "text/plain");
+            return;
+        }
+    }
+    res.set_content(MagicSingleton<TxLifecycleTracer>::GetInstance()->ExportChromeTrace(limit), "application/json");
+}
+
 void _ApiPrintCalc1000SumHash(const Request &req,Response &res)
 {
     int startHeight = 1000;
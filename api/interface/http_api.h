@@ -191,6 +191,30 @@ void _ApiPrintHundredSumHash(const Request & req, Response & res);
 void _ApiPrintCalc1000SumHash(const Request &req,Response &res);
 void _ApiPrintAllBlocks(const Request &req,Response &res);
 void systemInfo(const Request &req, Response &res);
+/**
+ * @brief  Dump runtime cache and pipeline counters as json
+ * @param  req: 
+ * @param  res: 
+ */
+void _ApiMetrics(const Request &req, Response &res);
+/**
+ * @brief  Per peer and per protocol latency, throughput and failure scores as json, optionally for one protocol
+ * @param  req: 
+ * @param  res: 
+ */
+void _ApiPeerScores(const Request &req, Response &res);
+/**
+ * @brief  Latency percentiles of the traced transaction stages as json
+ * @param  req: 
+ * @param  res: 
+ */
+void _ApiTxLifecycle(const Request &req, Response &res);
+/**
+ * @brief  Recent traced transactions in the Chrome trace event format, at most limit of them
+ * @param  req: 
+ * @param  res: 
+ */
+void _ApiTxLifecycleTrace(const Request &req, Response &res);
 
 //vote==============================
 void _ApiPrintVoteInfo(const Request &req,Response &res);
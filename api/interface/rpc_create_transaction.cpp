@@ -10,6 +10,7 @@
 #include "ca/transaction.h"
 #include "ca/block_helper.h"
 #include "ca/double_spend_cache.h"
+#include "ca/spendable_utxo_index.h"
 #include "ca/block_helper.h"
 #include "ca/test.h"
 #include <nlohmann/json.hpp>
@@ -18,6 +19,7 @@
 #include "utils/time_util.h"
 #include "utils/string_util.h"
 #include "utils/bench_mark.h"
+#include "utils/tx_lifecycle_tracer.h"
 #include "utils/account_manager.h"
 #include "utils/magic_singleton.h"
 #include "utils/contract_utils.h"
@@ -166,10 +168,7 @@ void createOrReplaceTransaction(const std::vector<TxHelper::TransTable> txAsset,
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({i.fromAddr[0], i.assetType});
-
-		ret = TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(i.fromAddr[0], i.assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 
 		if (ret != 0)
 		{
@@ -308,9 +307,7 @@ void createOrReplaceTransaction(const std::vector<TxHelper::TransTable> txAsset,
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ackT->code = -14;
@@ -526,9 +523,7 @@ void stakeTransactionUpdater(const std::string & fromAddr, uint64_t stakeAmount,
 	//  Find utxo
 	uint64_t total = 0;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
-	std::multimap<std::string, std::string> fromAddr_assetType;
-	fromAddr_assetType.insert({fromAddr, assetType});
-	ret =TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+	ret = FindSpendableUtxo(fromAddr, assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		ack_t->code = -10;
@@ -679,9 +674,7 @@ void stakeTransactionUpdater(const std::string & fromAddr, uint64_t stakeAmount,
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ack_t->code = -17;
@@ -851,9 +844,7 @@ void ReplaceCreateUnstakeTransaction(const std::string& fromAddr, const std::str
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 	//  The number of utxos to be searched here needs to be reduced by 1 \
 	because a VIN to be redeem is from the pledged utxo, so just look for 99
-	std::multimap<std::string, std::string> fromAddr_assetType;
-	fromAddr_assetType.insert(std::make_pair(fromAddr, assetType));
-	ret = TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo); 
+	ret = FindSpendableUtxo(fromAddr, assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		ack_t->code = -4;
@@ -1019,9 +1010,7 @@ void ReplaceCreateUnstakeTransaction(const std::string& fromAddr, const std::str
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ack_t->code = -11;
@@ -1219,9 +1208,7 @@ void ReplaceCreateDelegatingTransaction(const std::string & fromAddr,const std::
 	uint64_t expend = delegateAmount;
 
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
-	std::multimap<std::string, std::string>	fromAddr_assetType;
-	fromAddr_assetType.insert(std::make_pair(fromAddr, assetType));
-	ret = TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+	ret = FindSpendableUtxo(fromAddr, assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 	    ackT->code = -8;
@@ -1367,9 +1354,7 @@ void ReplaceCreateDelegatingTransaction(const std::string & fromAddr,const std::
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ackT->code = -14;
@@ -1547,10 +1532,8 @@ void ReplaceCreateUndelegatingTransaction(const std::string& fromAddr,const std:
 	//  Find utxo
 	uint64_t total = 0;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
-	std::multimap<std::string, std::string> fromAddr_assetType;
-	fromAddr_assetType.insert(std::make_pair(fromAddr, assetType));
 	//  The utxo quantity sought here needs to be reduced by 1
-	ret =TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo); 
+	ret = FindSpendableUtxo(fromAddr, assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		ackT->message = "FindUtxo failed The error code is " + std::to_string(ret-300);
@@ -1702,9 +1685,7 @@ void ReplaceCreateUndelegatingTransaction(const std::string& fromAddr,const std:
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ackT->code = -12;
@@ -1945,9 +1926,7 @@ void updateTransactionRequest(const std::string &addr, std::string assetType,std
 
 	uint64_t total = 0;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
-	std::multimap<std::string, std::string> fromAddr_assetType;
-	fromAddr_assetType.insert(std::make_pair(addr, assetType));
-	ret = TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo);
+	ret = FindSpendableUtxo(addr, assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{	
 		ackT->code = -11;	
@@ -2148,9 +2127,7 @@ void updateTransactionRequest(const std::string &addr, std::string assetType,std
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ackT->code = -19;
@@ -2284,6 +2261,7 @@ int SendMessage(CTransaction & outTx,int height,Vrf &info,TxHelper::vrfAgentType
     txMsgInfo->set_txutxoheight(txUtxoLocalHeight);
 	auto msg = std::make_shared<TxMsgReq>(txMsg);
 	std::string defaultAddr = MagicSingleton<AccountManager>::GetInstance()->GetDefaultAddr();
+	MagicSingleton<TxLifecycleTracer>::GetInstance()->Record(TxTraceStage::kBroadcast, outTx.hash());
 	if (type == TxHelper::vrfAgentType::vrfAgentType_vrf && outTx.identity() != defaultAddr)
 	{
 		ret = DropShippingTransaction(msg, outTx,outTx.identity());
@@ -2380,9 +2358,7 @@ void ReplaceCreateLockTransaction(const std::string & fromAddr, uint64_t lockAmo
 	//  Find utxo
 	uint64_t total = 0;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
-	std::multimap<std::string, std::string> fromAddr_assetType;
-	fromAddr_assetType.insert({fromAddr, assetType});
-	ret = TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+	ret = FindSpendableUtxo(fromAddr, assetType, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		ack_t->message = "FindUtxo failed! The error code is " + std::to_string(ret-200);
@@ -2528,9 +2504,7 @@ void ReplaceCreateLockTransaction(const std::string & fromAddr, uint64_t lockAmo
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ERRORLOG(RED "FindUtxo failed! The error code is {}." RESET, ret);
@@ -2712,9 +2686,7 @@ void ReplaceCreateUnLockTransaction(const std::string& fromAddr, const std::stri
 	//  The number of utxos to be searched here needs to be reduced by 1 \
 	because a VIN to be redeem is from the pledged utxo, so just look for 99
 
-	std::multimap<std::string, std::string> fromAddr_assetType;
-	fromAddr_assetType.insert(std::make_pair(fromAddr, assetType));
-	ret = TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo); 
+	ret = FindSpendableUtxo(fromAddr, assetType, TxHelper::MAX_VIN_SIZE - 1, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		ackT->message="FindUtxo failed! The error code is " + std::to_string(ret-300);
@@ -2871,9 +2843,7 @@ void ReplaceCreateUnLockTransaction(const std::string& fromAddr, const std::stri
 		uint64_t total = 0;
 		std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 		
-		std::multimap<std::string, std::string> fromAddr_assetType;
-		fromAddr_assetType.insert({gasTrade.first,gasTrade.second});
-		ret = TxHelper::FindUtxo(fromAddr_assetType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+		ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 		if (ret != 0)
 		{
 			ERRORLOG(RED "FindUtxo failed! The error code is {}." RESET, ret);
@@ -3055,9 +3025,7 @@ void ReplaceCreateProposalTransaction(const std::string& fromAddr, const std::pa
 	uint64_t total = 0;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> allsetOutUtxos;
-	std::multimap<std::string, std::string> fromAddr_currencyType;
-	fromAddr_currencyType.insert({gasTrade.first,gasTrade.second});
-	ret = TxHelper::FindUtxo(fromAddr_currencyType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+	ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		std::string strError = "FindUtxo failed! The error code is " + std::to_string(ret-300);
@@ -3324,9 +3292,7 @@ void ReplaceCreateRevokeProposalTransaction(const std::string& fromAddr, const s
 	uint64_t total = 0;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> allsetOutUtxos;
-	std::multimap<std::string, std::string> fromAddr_currencyType;
-	fromAddr_currencyType.insert({gasTrade.first,gasTrade.second});
-	ret = TxHelper::FindUtxo(fromAddr_currencyType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+	ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		std::string strError = "FindUtxo failed! The error code is " + std::to_string(ret-300);
@@ -3582,9 +3548,7 @@ void ReplaceCreateVoteTransaction(const std::string& fromAddr, const std::pair<s
 	uint64_t total = 0;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> outputUtxosSet;
 	std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> allsetOutUtxos;
-	std::multimap<std::string, std::string> fromAddr_currencyType;
-	fromAddr_currencyType.insert({gasTrade.first,gasTrade.second});
-	ret = TxHelper::FindUtxo(fromAddr_currencyType,TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
+	ret = FindSpendableUtxo(gasTrade.first, gasTrade.second, TxHelper::MAX_VIN_SIZE, total, outputUtxosSet, isFindUtxo);
 	if (ret != 0)
 	{
 		std::string strError = "FindUtxo failed! The error code is " + std::to_string(ret-300);
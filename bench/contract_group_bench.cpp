@@ -0,0 +1,196 @@
+/**
+ * *****************************************************************************
+ * @file        contract_group_bench.cpp
+ * @brief       Grouping of pending contract calls: pairwise dependency comparison against the union-find
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ca/contract_conflict_graph.h"
+
+namespace
+{
+    using Calls = std::vector<std::pair<std::string, std::vector<std::string>>>;
+
+    Calls MakeCalls(size_t callCount, size_t contractCount, size_t maxDependencies)
+    {
+        std::mt19937_64 random(42);
+        std::uniform_int_distribution<size_t> contract(0, contractCount - 1);
+        std::uniform_int_distribution<size_t> dependencies(1, maxDependencies);
+        Calls calls;
+        for (size_t i = 0; i < callCount; ++i)
+        {
+            std::vector<std::string> addresses;
+            for (size_t count = dependencies(random); count > 0; --count)
+            {
+                addresses.push_back("0x" + std::to_string(contract(random)));
+            }
+            calls.emplace_back(std::to_string(i), std::move(addresses));
+        }
+        return calls;
+    }
+
+    bool HasDuplicate(const std::vector<std::string> &vec1, const std::vector<std::string> &vec2)
+    {
+        std::unordered_set<std::string> depSet(vec1.begin(), vec1.end());
+        for (const auto &s : vec2)
+        {
+            if (depSet.count(s) > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // The grouping DependencyManager and packDispatch used before the union-find
+    size_t GroupPairwise(const Calls &calls)
+    {
+        std::unordered_map<std::string, std::vector<std::string>> hashDep(calls.begin(), calls.end());
+        std::vector<std::set<std::string>> res;
+        for (const auto &[key, values] : hashDep)
+        {
+            std::set<std::string> commonKeys{key};
+            for (const auto &[otherKey, otherValues] : hashDep)
+            {
+                if (key != otherKey && HasDuplicate(values, otherValues))
+                {
+                    commonKeys.insert(otherKey);
+                }
+            }
+            bool found = false;
+            for (auto &itemSet : res)
+            {
+                std::set<std::string> intersection;
+                std::set_intersection(itemSet.begin(), itemSet.end(), commonKeys.begin(), commonKeys.end(),
+                                      std::inserter(intersection, intersection.begin()));
+                if (!intersection.empty())
+                {
+                    itemSet.insert(commonKeys.begin(), commonKeys.end());
+                    found = true;
+                    break;
+                }
+            }
+            if (!found)
+            {
+                res.push_back(commonKeys);
+            }
+        }
+        return res.size();
+    }
+
+    template <typename F>
+    double Milliseconds(F &&run)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    void Report(const std::string &name, size_t calls, double ms, size_t groups)
+    {
+        std::cout << std::left << std::setw(32) << name << std::right << std::setw(8) << calls << " calls"
+                  << std::fixed << std::setprecision(2) << std::setw(12) << ms << " ms" << std::setw(10) << groups
+                  << " groups" << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    size_t callCount = 10000;
+    size_t contractCount = 20000;
+    size_t maxDependencies = 3;
+    size_t pairwiseCount = 2000;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        std::string arg = argv[i];
+        if (arg == "--calls")
+        {
+            callCount = std::max<size_t>(1, std::stoul(argv[i + 1]));
+        }
+        else if (arg == "--contracts")
+        {
+            contractCount = std::max<size_t>(1, std::stoul(argv[i + 1]));
+        }
+        else if (arg == "--dependencies")
+        {
+            maxDependencies = std::max<size_t>(1, std::stoul(argv[i + 1]));
+        }
+        else if (arg == "--pairwise")
+        {
+            pairwiseCount = std::stoul(argv[i + 1]);
+        }
+        else
+        {
+            std::cerr << "usage: contract_group_bench [--calls N] [--contracts N] [--dependencies N] [--pairwise N]" << std::endl;
+            return 1;
+        }
+    }
+
+    Calls calls = MakeCalls(callCount, contractCount, maxDependencies);
+
+    // Quadratic, so measured on the first calls only
+    if (pairwiseCount > 0)
+    {
+        Calls head(calls.begin(), calls.begin() + std::min(pairwiseCount, calls.size()));
+        size_t groups = 0;
+        double ms = Milliseconds([&]() { groups = GroupPairwise(head); });
+        Report("pairwise", head.size(), ms, groups);
+    }
+
+    ContractConflictGraph graph;
+    double addMs = Milliseconds([&]() {
+        for (const auto &[key, dependencies] : calls)
+        {
+            graph.Add(key, dependencies);
+        }
+    });
+    size_t groups = 0;
+    double groupMs = Milliseconds([&]() { groups = graph.Components().size(); });
+    Report("union-find, add", calls.size(), addMs, groups);
+    Report("union-find, group", calls.size(), groupMs, groups);
+
+    // Half the calls leave and come back, as when packaged calls are replaced by new ones
+    double churnMs = Milliseconds([&]() {
+        for (size_t i = 0; i < calls.size(); i += 2)
+        {
+            graph.Remove(calls[i].first);
+        }
+        for (size_t i = 0; i < calls.size(); i += 2)
+        {
+            graph.Add(calls[i].first, calls[i].second);
+        }
+        groups = graph.Components().size();
+    });
+    Report("union-find, churn and group", calls.size(), churnMs, groups);
+
+    // Every pairwise group lies within one connected component, so the components are never more
+    // numerous. They are fewer where the pairwise pass missed a chain through a later call.
+    if (pairwiseCount >= calls.size())
+    {
+        ContractConflictGraph check;
+        for (const auto &[key, dependencies] : calls)
+        {
+            check.Add(key, dependencies);
+        }
+        if (check.Components().size() > GroupPairwise(calls))
+        {
+            std::cerr << "union-find found more groups than the pairwise grouping" << std::endl;
+            return 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * *****************************************************************************
+ * @file        ed25519_bench.cpp
+ * @brief       Ed25519 verification throughput: per-signature parsing against the cached batch path
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+#include "utils/ed25519_batch.h"
+#include "utils/magic_singleton.h"
+#include "utils/verified_signature_cache.h"
+
+namespace
+{
+    struct Signer
+    {
+        EVP_PKEY *key = nullptr;
+        std::string pub;
+    };
+
+    Signer NewSigner()
+    {
+        Signer signer;
+        signer.key = EVP_PKEY_Q_keygen(nullptr, nullptr, "ED25519");
+        unsigned char *der = nullptr;
+        int len = i2d_PUBKEY(signer.key, &der);
+        signer.pub.assign(reinterpret_cast<char *>(der), len);
+        OPENSSL_free(der);
+        return signer;
+    }
+
+    std::string Sign(EVP_PKEY *key, const std::string &message)
+    {
+        EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+        size_t len = 64;
+        std::string signature(len, '\0');
+        EVP_DigestSignInit(ctx, nullptr, nullptr, nullptr, key);
+        EVP_DigestSign(ctx, reinterpret_cast<unsigned char *>(signature.data()), &len,
+                       reinterpret_cast<const unsigned char *>(message.data()), message.size());
+        EVP_MD_CTX_free(ctx);
+        signature.resize(len);
+        return signature;
+    }
+
+    // The verification path before the key cache: parse the key and build a context for every signature
+    bool VerifyUncached(const Ed25519VerifyItem &item)
+    {
+        const unsigned char *pkStr = reinterpret_cast<const unsigned char *>(item.pub.data());
+        EVP_PKEY *pkey = d2i_PUBKEY(nullptr, &pkStr, item.pub.size());
+        if (pkey == nullptr)
+        {
+            return false;
+        }
+        EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+        bool ok = EVP_DigestVerifyInit(ctx, nullptr, nullptr, nullptr, pkey) == 1
+                  && EVP_DigestVerify(ctx, reinterpret_cast<const unsigned char *>(item.signature.data()), item.signature.size(),
+                                      reinterpret_cast<const unsigned char *>(item.message.c_str()), strlen(item.message.c_str())) == 1;
+        EVP_MD_CTX_free(ctx);
+        EVP_PKEY_free(pkey);
+        return ok;
+    }
+
+    template <typename F>
+    double SignaturesPerSecond(size_t count, F &&run)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return count / elapsed.count();
+    }
+
+    void Report(const std::string &name, double rate, size_t threads)
+    {
+        std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(12) << rate << " sig/s" << std::setw(12) << rate / threads << " sig/s/core" << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    size_t signatureCount = 20000;
+    size_t signerCount = 256;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        std::string arg = argv[i];
+        if (arg == "--signatures")
+        {
+            signatureCount = std::stoul(argv[i + 1]);
+        }
+        else if (arg == "--signers")
+        {
+            signerCount = std::max<size_t>(1, std::stoul(argv[i + 1]));
+        }
+        else
+        {
+            std::cerr << "usage: ed25519_bench [--signatures N] [--signers N]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Signer> signers;
+    for (size_t i = 0; i < signerCount; ++i)
+    {
+        signers.push_back(NewSigner());
+    }
+    // Messages are sha256 hex digests in the chain, any 64 character string stands in for them
+    std::vector<Ed25519VerifyItem> items;
+    for (size_t i = 0; i < signatureCount; ++i)
+    {
+        const Signer &signer = signers[i % signers.size()];
+        std::string message = std::to_string(i);
+        message.insert(0, 64 - message.size(), 'a');
+        items.push_back({message, signer.pub, Sign(signer.key, message)});
+    }
+
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    size_t failures = 0;
+    std::vector<char> valid;
+
+    Report("per-signature", SignaturesPerSecond(items.size(), [&]() {
+        for (const auto &item : items)
+        {
+            failures += !VerifyUncached(item);
+        }
+    }), 1);
+    // Each batch run starts without verified signatures so it measures the curve work, the last run measures the cache
+    auto verifiedCache = MagicSingleton<VerifiedSignatureCache>::GetInstance();
+    verifiedCache->Clear();
+    Report("batch, 1 thread", SignaturesPerSecond(items.size(), [&]() { failures += ed25519BatchVerify(items, valid, 1); }), 1);
+    verifiedCache->Clear();
+    Report("batch, " + std::to_string(cores) + " threads",
+           SignaturesPerSecond(items.size(), [&]() { failures += ed25519BatchVerify(items, valid); }), cores);
+    Report("batch, already verified", SignaturesPerSecond(items.size(), [&]() { failures += ed25519BatchVerify(items, valid, 1); }), 1);
+
+    for (auto &signer : signers)
+    {
+        EVP_PKEY_free(signer.key);
+    }
+    if (failures != 0)
+    {
+        std::cerr << failures << " signatures failed to verify" << std::endl;
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,469 @@
+/**
+ * *****************************************************************************
+ * @file        evm_bench.cpp
+ * @brief       Offline EVM throughput benchmark over recorded contract transactions
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <evmc/evmc.hpp>
+#include <evmc/hex.hpp>
+#include <evmone/evmone.h>
+#if __has_include(<evmone/tracing.hpp>)
+#include <evmone/vm.hpp>
+#include <evmone/tracing.hpp>
+#define EVM_BENCH_HAS_TRACER 1
+#endif
+
+#include "ca/global.h"
+#include "ca/evm/evm_host.h"
+#include "ca/evm/contract_payload.h"
+#include "db/db_api.h"
+#include "utils/contract_utils.h"
+
+namespace
+{
+    /**
+     * Corpus layout:
+     * {
+     *   "contracts":    { "<address>": "<runtime code hex>" },
+     *   "transactions": [ { "hash", "kind": "deploy" | "call", "sender", "recipient", "input" } ]
+     * }
+     * Contracts only need to be listed when their deploy transaction is not part of the corpus.
+     */
+    struct CorpusTx
+    {
+        std::string hash;
+        bool deploy = false;
+        std::string sender;
+        std::string recipient;
+        evmc::bytes input;
+    };
+
+    struct Corpus
+    {
+        std::map<std::string, std::string> contracts;
+        std::vector<CorpusTx> transactions;
+    };
+
+    enum OpcodeClass
+    {
+        kArithmetic,
+        kBitwise,
+        kKeccak,
+        kEnvironment,
+        kStorage,
+        kMemoryFlow,
+        kStack,
+        kLog,
+        kSystem,
+        kOpcodeClassCount
+    };
+
+    const std::array<const char *, kOpcodeClassCount> kOpcodeClassNames = {
+        "arithmetic", "compare/bitwise", "keccak", "environment", "storage", "memory/flow", "push/dup/swap", "log", "call/create"};
+
+    OpcodeClass ClassifyOpcode(uint8_t op)
+    {
+        if (op < 0x10) return kArithmetic;
+        if (op < 0x20) return kBitwise;
+        if (op < 0x30) return kKeccak;
+        if (op < 0x50) return kEnvironment;
+        if (op == 0x54 || op == 0x55 || op == 0x5c || op == 0x5d) return kStorage;
+        if (op < 0x5f) return kMemoryFlow;
+        if (op < 0xa0) return kStack;
+        if (op < 0xb0) return kLog;
+        return kSystem;
+    }
+
+    struct BenchStats
+    {
+        uint64_t executed = 0;
+        uint64_t failed = 0;
+        uint64_t gasUsed = 0;
+        uint64_t storageReads = 0;
+        uint64_t storageWrites = 0;
+        std::array<uint64_t, kOpcodeClassCount> opcodeNanos{};
+        std::array<uint64_t, kOpcodeClassCount> opcodeCount{};
+    };
+
+#ifdef EVM_BENCH_HAS_TRACER
+    // Charges the wall time between two instruction starts to the earlier instruction's class
+    class OpcodeClassTracer : public evmone::Tracer
+    {
+    public:
+        explicit OpcodeClassTracer(BenchStats &stats) : _stats(stats) {}
+
+    private:
+        void on_execution_start(evmc_revision, const evmc_message &, evmc::bytes_view code) noexcept override
+        {
+            _frames.push_back({code, 0, false, {}});
+        }
+
+        void on_instruction_start(uint32_t pc, const intx::uint256 *, int, int64_t,
+                                  const evmone::ExecutionState &) noexcept override
+        {
+            auto now = std::chrono::steady_clock::now();
+            auto &frame = _frames.back();
+            charge(frame, now);
+            frame.op = frame.code[pc];
+            frame.started = true;
+            frame.start = now;
+        }
+
+        void on_execution_end(const evmc_result &) noexcept override
+        {
+            charge(_frames.back(), std::chrono::steady_clock::now());
+            _frames.pop_back();
+        }
+
+        struct Frame
+        {
+            evmc::bytes_view code;
+            uint8_t op;
+            bool started;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        void charge(Frame &frame, std::chrono::steady_clock::time_point now)
+        {
+            if (!frame.started)
+            {
+                return;
+            }
+            auto cls = ClassifyOpcode(frame.op);
+            _stats.opcodeNanos[cls] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - frame.start).count();
+            ++_stats.opcodeCount[cls];
+        }
+
+        BenchStats &_stats;
+        std::vector<Frame> _frames;
+    };
+#endif
+
+    // EvmHost whose state never leaves memory: contract code is preloaded into
+    // createdContract and storage lives in tries that are never committed.
+    class BenchHost : public EvmHost
+    {
+    public:
+        explicit BenchHost(BenchStats &stats) : _stats(stats)
+        {
+            nonceCache = 0;
+        }
+
+        evmc::bytes32 get_storage(const evmc::address &addr, const evmc::bytes32 &key) const noexcept override
+        {
+            ++_stats.storageReads;
+            return EvmHost::get_storage(addr, key);
+        }
+
+        evmc_storage_status set_storage(const evmc::address &addr, const evmc::bytes32 &key,
+                                        const evmc::bytes32 &value) noexcept override
+        {
+            ++_stats.storageWrites;
+            return EvmHost::set_storage(addr, key, value);
+        }
+
+        void AddContract(const std::string &address, const evmc::bytes &code)
+        {
+            auto evmAddr = evm_utils::convertStringToEvmAddress(address);
+            createdContract[address] = evmc::hex(code);
+            accounts[evmAddr].set_code(code);
+        }
+
+        void ResetTransaction()
+        {
+            coinTransfersInProgress.clear();
+            recorded_calls.clear();
+            callInputsRecorded.clear();
+            recorded_logs.clear();
+            recorded_account_accesses.clear();
+            output.clear();
+        }
+
+    private:
+        BenchStats &_stats;
+    };
+
+    // Host lookups key createdContract by checksum address, so the corpus is normalized on load
+    std::string NormalizeAddress(const std::string &address)
+    {
+        return evm_utils::evm_addr_to_string(evm_utils::convertStringToEvmAddress(address));
+    }
+
+    int LoadCorpus(const std::string &path, Corpus &corpus)
+    {
+        try
+        {
+            auto json = nlohmann::json::parse(std::ifstream{path});
+            if (json.contains("contracts"))
+            {
+                for (auto &[address, code] : json["contracts"].items())
+                {
+                    corpus.contracts[NormalizeAddress(address)] = code.get<std::string>();
+                }
+            }
+            for (auto &item : json["transactions"])
+            {
+                CorpusTx tx;
+                tx.hash = item.value("hash", "");
+                tx.deploy = item["kind"].get<std::string>() == "deploy";
+                tx.sender = NormalizeAddress(item["sender"].get<std::string>());
+                tx.recipient = NormalizeAddress(item["recipient"].get<std::string>());
+                auto input = evmc::from_hex(item["input"].get<std::string>());
+                if (!input.has_value())
+                {
+                    std::cerr << "bad input hex in tx " << tx.hash << std::endl;
+                    return -2;
+                }
+                tx.input = std::move(*input);
+                corpus.transactions.push_back(std::move(tx));
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "failed to load corpus " << path << ": " << e.what() << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    // Reads contract transactions out of a node database into a corpus file
+    int ExportCorpus(const std::string &dbPath, const std::string &outPath, const std::vector<std::string> &hashes)
+    {
+        if (!DBInit(dbPath))
+        {
+            std::cerr << "failed to open database " << dbPath << std::endl;
+            return -1;
+        }
+
+        nlohmann::json corpus;
+        corpus["contracts"] = nlohmann::json::object();
+        corpus["transactions"] = nlohmann::json::array();
+        DBReader dbReader;
+        for (const auto &hash : hashes)
+        {
+            std::string txRaw;
+            if (DBStatus::DB_SUCCESS != dbReader.getTransactionByHash(hash, txRaw))
+            {
+                std::cerr << "transaction not found: " << hash << std::endl;
+                continue;
+            }
+            CTransaction tx;
+            if (!tx.ParseFromString(txRaw))
+            {
+                std::cerr << "transaction parse failed: " << hash << std::endl;
+                continue;
+            }
+            ContractPayload payload;
+            if (contract_payload::Decode(tx, payload) != 0)
+            {
+                std::cerr << "not a contract transaction: " << hash << std::endl;
+                continue;
+            }
+
+            bool deploy = (global::ca::TxType)tx.txtype() == global::ca::TxType::kTransactionTypeDeploy;
+            nlohmann::json item;
+            item["hash"] = hash;
+            item["kind"] = deploy ? "deploy" : "call";
+            item["sender"] = payload.sender;
+            item["recipient"] = payload.recipient;
+            item["input"] = evmc::hex({reinterpret_cast<const uint8_t *>(payload.input.data()), payload.input.size()});
+            corpus["transactions"].push_back(item);
+
+            if (!deploy && !corpus["contracts"].contains(payload.recipient))
+            {
+                evmc::bytes code;
+                if (evm_utils::GetContractCode(payload.recipient, code) == 0)
+                {
+                    corpus["contracts"][payload.recipient] = evmc::hex(code);
+                }
+            }
+        }
+        destroyDatabase();
+
+        std::ofstream{outPath} << std::setw(2) << corpus << '\n';
+        std::cout << "exported " << corpus["transactions"].size() << " transactions to " << outPath << std::endl;
+        return 0;
+    }
+
+    int ReplayCorpus(const Corpus &corpus, evmc::VM &vm, BenchStats &stats)
+    {
+        constexpr int64_t kGasLimit = 30000000;
+
+        BenchHost host(stats);
+        for (const auto &[address, code] : corpus.contracts)
+        {
+            auto bytes = evmc::from_hex(code);
+            if (!bytes.has_value())
+            {
+                std::cerr << "bad code hex for contract " << address << std::endl;
+                return -1;
+            }
+            host.accounts[evm_utils::convertStringToEvmAddress(address)].CreateTrie("", address);
+            host.AddContract(address, *bytes);
+        }
+
+        for (const auto &tx : corpus.transactions)
+        {
+            host.ResetTransaction();
+
+            evmc_message msg{};
+            msg.kind = EVMC_CALL;
+            msg.gas = kGasLimit;
+            msg.sender = evm_utils::convertStringToEvmAddress(tx.sender);
+            msg.recipient = evm_utils::convertStringToEvmAddress(tx.recipient);
+            msg.code_address = msg.recipient;
+            host.tx_context.tx_origin = msg.sender;
+
+            evmc::bytes code;
+            if (tx.deploy)
+            {
+                code = tx.input;
+                host.accounts[msg.recipient].CreateTrie("", tx.recipient);
+            }
+            else
+            {
+                auto found = host.createdContract.find(tx.recipient);
+                if (found == host.createdContract.end())
+                {
+                    ++stats.failed;
+                    continue;
+                }
+                code = evmc::from_hex(found->second).value_or(evmc::bytes{});
+                msg.input_data = tx.input.data();
+                msg.input_size = tx.input.size();
+            }
+
+            auto result = vm.execute(host, EVMC_MAX_REVISION, msg, code.data(), code.size());
+            ++stats.executed;
+            stats.gasUsed += msg.gas - result.gas_left;
+            if (result.status_code != EVMC_SUCCESS)
+            {
+                ++stats.failed;
+                continue;
+            }
+            if (tx.deploy)
+            {
+                host.AddContract(tx.recipient, evmc::bytes{result.output_data, result.output_size});
+            }
+        }
+        return 0;
+    }
+
+    void Report(const BenchStats &stats, double seconds)
+    {
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "transactions:   " << stats.executed << " (" << stats.failed << " failed)" << std::endl;
+        std::cout << "elapsed:        " << seconds << " s" << std::endl;
+        std::cout << "throughput:     " << stats.executed / seconds << " tx/s" << std::endl;
+        std::cout << "gas:            " << stats.gasUsed / seconds << " gas/s" << std::endl;
+        std::cout << "storage reads:  " << stats.storageReads << std::endl;
+        std::cout << "storage writes: " << stats.storageWrites << std::endl;
+
+        uint64_t totalNanos = 0;
+        for (auto nanos : stats.opcodeNanos)
+        {
+            totalNanos += nanos;
+        }
+        if (totalNanos == 0)
+        {
+            return;
+        }
+        std::cout << "opcode classes:" << std::endl;
+        for (int i = 0; i < kOpcodeClassCount; ++i)
+        {
+            std::cout << "  " << std::left << std::setw(16) << kOpcodeClassNames[i] << std::right
+                      << std::setw(12) << stats.opcodeCount[i] << " ops "
+                      << std::setw(10) << stats.opcodeNanos[i] / 1e6 << " ms "
+                      << std::setw(6) << 100.0 * stats.opcodeNanos[i] / totalNanos << " %" << std::endl;
+        }
+    }
+
+    void Usage()
+    {
+        std::cout << "usage:" << std::endl
+                  << "  evm_bench run <corpus.json> [--iterations N] [--profile-opcodes]" << std::endl
+                  << "  evm_bench export <db path> <corpus.json> <tx hash>..." << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        Usage();
+        return 1;
+    }
+
+    std::string command = argv[1];
+    if (command == "export")
+    {
+        if (argc < 5)
+        {
+            Usage();
+            return 1;
+        }
+        return ExportCorpus(argv[2], argv[3], std::vector<std::string>(argv + 4, argv + argc)) == 0 ? 0 : 2;
+    }
+    if (command != "run")
+    {
+        Usage();
+        return 1;
+    }
+
+    int iterations = 1;
+    bool profileOpcodes = false;
+    for (int i = 3; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc)
+        {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--profile-opcodes")
+        {
+            profileOpcodes = true;
+        }
+    }
+
+    Corpus corpus;
+    if (LoadCorpus(argv[2], corpus) != 0)
+    {
+        return 2;
+    }
+
+    BenchStats stats;
+    evmc::VM vm{evmc_create_evmone()};
+    if (profileOpcodes)
+    {
+#ifdef EVM_BENCH_HAS_TRACER
+        static_cast<evmone::VM *>(vm.get_raw_pointer())->add_tracer(std::make_unique<OpcodeClassTracer>(stats));
+#else
+        std::cerr << "opcode profiling needs evmone tracing support" << std::endl;
+#endif
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        if (ReplayCorpus(corpus, vm, stats) != 0)
+        {
+            return 2;
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    Report(stats, elapsed.count());
+    return stats.failed == 0 ? 0 : 3;
+}
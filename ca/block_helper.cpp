@@ -8,7 +8,11 @@
 #include "ca/transaction_cache.h"
 #include "ca/double_spend_cache.h"
 #include "ca/sync_block.h"
+#include "ca/block_preverify.h"
+#include "ca/block_spend_index.h"
+#include "ca/compact_block_relay.h"
 #include "ca/resend_reconnect_node.h"
+#include "ca/spendable_utxo_index.h"
 
 #include "common.pb.h"
 #include "common/task_pool.h"
@@ -17,6 +21,7 @@
 #include "utils/account_manager.h"
 #include "utils/magic_singleton.h"
 #include "utils/bench_mark.h"
+#include "utils/tx_lifecycle_tracer.h"
 #include "utils/contract_utils.h"
 
 #include "db/db_api.h"
@@ -25,6 +30,22 @@
 #include "ca/evm/evm_manager.h"
 
 static global::ca::SaveType g_syncType = global::ca::SaveType::Unknow;
+// Spends of BlockHelper::broadcastBlocks, guarded by helperMutex
+static BlockSpendIndex broadcastSpends;
+
+// Run the stateless pre-verification of incoming blocks outside helperMutex
+static void preVerifyBatch(const std::map<uint64_t, std::set<CBlock, BlockComparator>> &blocks)
+{
+    std::vector<const CBlock *> batch;
+    for (const auto &[height, heightBlocks] : blocks)
+    {
+        for (const auto &block : heightBlocks)
+        {
+            batch.push_back(&block);
+        }
+    }
+    MagicSingleton<BlockPreVerifier>::GetInstance()->PreVerify(batch);
+}
 
 BlockHelper::BlockHelper() : missing_prehash(false){}
 
@@ -34,6 +55,24 @@ int getUtxoAndFindNode(uint32_t num, uint64_t chainHeight, const std::vector<std
     return SyncBlock::getSyncNodeSimplified(num, chainHeight, pledgeAddr, node_ids_to_send);
 }
 
+bool blockHashMatches(const CBlock &block)
+{
+    CBlock hashBlock = block;
+    hashBlock.clear_hash();
+    hashBlock.clear_sign();
+    return !block.hash().empty() && block.hash() == Getsha256hash(hashBlock.SerializeAsString());
+}
+
+bool blockMerkleMatches(const CBlock &block)
+{
+    return block.merkleroot() == ca_algorithm::calculateBlockMerkle(block);
+}
+
+bool blockMatchesHeader(const CBlock &block)
+{
+    return blockHashMatches(block) && blockMerkleMatches(block);
+}
+
 int sendBlockByUtxoRequest(const std::string &utxo)
 {
     if(!MagicSingleton<BlockHelper>::GetInstance()->getWhetherRunSendBlockByUtxoRequest())
@@ -89,7 +128,7 @@ int sendBlockByUtxoRequest(const std::string &utxo)
 
     std::string msgId;
     size_t sendNum = node_ids_to_send.size();
-    if (!dataMgrPtr.CreateWait(30, sendNum * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(30, sendNum * 0.8, msgId, "blockByUtxo"))
     {
         return -5;
     }
@@ -282,7 +321,7 @@ int sendBlockByHashRequest(const std::map<std::string, bool> &missingHashs)
 
     std::string msgId;
     size_t sendNum = node_ids_to_send.size();
-    if (!dataMgrPtr.CreateWait(30, sendNum * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(30, sendNum * 0.8, msgId, "blockByHash"))
     {
         return -5;
     }
@@ -402,7 +441,7 @@ int seekBlockByContractPreHashRequest(const std::string &blockHashToSeek, std::s
 
     std::string msgId;
     size_t sendNum = node_ids_to_send.size();
-    if (!dataMgrPtr.CreateWait(2, sendNum / 2, msgId))
+    if (!dataMgrPtr.CreateWait(2, sendNum / 2, msgId, "seekContractBlock"))
     {
         return -5;
     }
@@ -525,6 +564,12 @@ int BlockHelper::verifyFlowedBlockStatus(const CBlock& block, BlockStatus* block
 		return -9;
 	}
 
+    // A block still under consensus, its transactions let a later compact broadcast of it rebuild locally
+    if (msg != nullptr)
+    {
+        MagicSingleton<CompactBlockRelay>::GetInstance()->AddBlockTransactions(block);
+    }
+
 	std::string prev_header_str;
 	status = dbWriter.getBlockByBlockHash(block.prevhash(), prev_header_str);
 	if (status != DBStatus::DB_SUCCESS && status != DBStatus::DB_NOT_FOUND)
@@ -624,6 +669,11 @@ int BlockHelper::SaveBlock(const CBlock& block, global::ca::SaveType saveType, g
         ERRORLOG("PreSaveProcess ret : {}", ret);
         return -5;
     }
+    auto tracer = MagicSingleton<TxLifecycleTracer>::GetInstance();
+    for (const auto& tx : block.txs())
+    {
+        tracer->Record(TxTraceStage::kBlockVerify, tx.hash());
+    }
     DEBUGLOG("PreSaveProcess doubleSpendCheck ret:{}", ret);
     
     resetMissingPrehash();
@@ -673,6 +723,11 @@ int BlockHelper::SaveBlock(const CBlock& block, global::ca::SaveType saveType, g
 
     MagicSingleton<doubleSpendCache>::GetInstance()->Detection(block);
     MagicSingleton<ResendReconnectNode>::GetInstance()->RemoveResendBlock(block.hash());
+    MagicSingleton<SpendableUtxoIndex>::GetInstance()->Invalidate(block);
+    for (const auto& tx : block.txs())
+    {
+        tracer->Record(TxTraceStage::kCommit, tx.hash());
+    }
 
     INFOLOG("save block ret:{}:{}:{}", ret, blockHeight, blockHash);
     auto startTime = MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp();
@@ -1230,11 +1285,13 @@ int BlockHelper::RollbackBlocks()
             if (ret != 0)
             {
                 ERRORLOG("rollback hash {} fail, ret: ", sit->hash(), ret);
+                MagicSingleton<SpendableUtxoIndex>::GetInstance()->Clear();
                 return -1;
             }
             
         }
     }
+    MagicSingleton<SpendableUtxoIndex>::GetInstance()->Clear();
     return 0;
 }
 
@@ -1339,6 +1396,7 @@ void BlockHelper::Process()
         rollbackBlocks.clear();
         _syncBlocks.clear();
         broadcastBlocks.clear();
+        broadcastSpends.Clear();
         
         for(auto iter = doubleSpendBlocks.begin(); iter != doubleSpendBlocks.end();)
         {
@@ -1423,8 +1481,22 @@ void BlockHelper::Process()
         return;
     }
 
+    // Stateless checks of everything queued for this round run in parallel before the serialized saves
+    auto preVerifier = MagicSingleton<BlockPreVerifier>::GetInstance();
+    {
+        std::vector<const CBlock *> batch;
+        for (const auto &block : fastSyncBlocks) batch.push_back(&block);
+        for (const auto &block : _syncBlocks) batch.push_back(&block);
+        for (const auto &block : broadcastBlocks) batch.push_back(&block);
+        preVerifier->PreVerify(batch);
+    }
+
     for(const auto& block : fastSyncBlocks)
     {
+        if (preVerifier->Check(block) != 0)
+        {
+            continue;
+        }
         global::ca::blockMean obtain_mean = global::ca::blockMean::Normal;
         if (block.height() + 1 == nodeHeight)
         {
@@ -1469,6 +1541,10 @@ void BlockHelper::Process()
             return;
         }
 
+        if (preVerifier->Check(block) != 0)
+        {
+            continue;
+        }
         DEBUGLOG("chain height: {}, height: {}, sync type: {}", chainHeight, block.height(), g_syncType);
         DEBUGLOG("_syncBlocks SaveBlock Hash: {}, height: {}, PreHash:{}", block.hash().substr(0, 6), block.height(), block.prevhash().substr(0, 6));
         result = SaveBlock(block, g_syncType, global::ca::blockMean::Normal);
@@ -1480,6 +1556,10 @@ void BlockHelper::Process()
 
     for(const auto& block : broadcastBlocks)
     {
+        if (preVerifier->Check(block) != 0)
+        {
+            continue;
+        }
         std::string blockRaw;
         if (DBStatus::DB_SUCCESS == dbReader.getBlockByBlockHash(block.hash(), blockRaw))
         {
@@ -1644,29 +1724,30 @@ void BlockHelper::transactionStatusMessage(const CBlock &oldBlock, const CBlock
 {
     DEBUGLOG("AAAC transactionStatusMessage oldBlock:{}, newBlock:{}", oldBlock.hash().substr(0,6), newBlock.hash().substr(0,6));
     BlockStatus blockStatus;
-    for(const auto& tx1 : oldBlock.txs())
+    auto oldSpends = BlockSpendIndex::Build(oldBlock);
+    auto newSpends = BlockSpendIndex::Build(newBlock);
+    // Both sets are sorted by key, one walk finds every new transaction spending what the old block spends
+    std::set<int> conflictTxs;
+    auto oldIter = oldSpends.begin();
+    for(const auto& [key, txIndex] : newSpends)
     {
-        if(GetTransactionType(tx1) != kTransactionTypeTx)
+        while(oldIter != oldSpends.end() && oldIter->first < key)
         {
-            continue;
+            ++oldIter;
         }
-
-        for(const auto& tx2 : newBlock.txs())
+        if(oldIter != oldSpends.end() && oldIter->first == key)
         {
-            if(GetTransactionType(tx2) != kTransactionTypeTx)
-            {
-                continue;
-            }
-
-            if(Checker::CheckConflict(tx1, tx2) == true)
-            {
-                DEBUGLOG("AAAC transactionStatusMessage oldBlocktx1:{}, newBlocktx2:{}", tx1.hash().substr(0,10), tx2.hash().substr(0,10));
-                auto txStatus = blockStatus.add_txstatus();
-                txStatus->set_txhash(tx2.hash());
-                txStatus->set_status(global::ca::DoubleSpend::DoubleBlock);
-            }
+            conflictTxs.insert(txIndex);
         }
     }
+    for(int txIndex : conflictTxs)
+    {
+        const auto& tx2 = newBlock.txs(txIndex);
+        DEBUGLOG("AAAC transactionStatusMessage oldBlock:{}, newBlocktx2:{}", oldBlock.hash().substr(0,6), tx2.hash().substr(0,10));
+        auto txStatus = blockStatus.add_txstatus();
+        txStatus->set_txhash(tx2.hash());
+        txStatus->set_status(global::ca::DoubleSpend::DoubleBlock);
+    }
 
     std::string defaultAddr = MagicSingleton<AccountManager>::GetInstance()->GetDefaultAddr();
     blockStatus.set_blockhash(newBlock.hash());
@@ -1948,11 +2029,13 @@ void BlockHelper::AddBroadcastBlock(const CBlock& block, bool status)
     DEBUGLOG("Duplicate Block hash:{}, status:{}", block.hash().substr(0,6), status);
     _duplicateChecker[block.hash()] = {status, block.time()};
 
-    for (auto it = broadcastBlocks.begin(); it != broadcastBlocks.end(); ++it) 
+    // The pool index names the conflicting blocks, the pool is only walked to take the first of them in pool order
+    auto spends = BlockSpendIndex::Build(block);
+    auto conflictBlocks = broadcastSpends.Conflicts(spends);
+    for (auto it = broadcastBlocks.begin(); !conflictBlocks.empty() && it != broadcastBlocks.end(); ++it) 
     {
         auto &curr_block = *it;
-        bool ret = Checker::CheckConflict(curr_block, block);
-        if(ret)
+        if(conflictBlocks.count(curr_block.hash()))
         {
             if((curr_block.height() == block.height() && curr_block.time() <= block.time()) || (curr_block.height() < block.height()))
             {
@@ -1971,6 +2054,7 @@ void BlockHelper::AddBroadcastBlock(const CBlock& block, bool status)
                     MagicSingleton<TaskPool>::GetInstance()->commitCaTask(std::bind(&BlockHelper::transactionStatusMessage, this, block, curr_block));
                 }
                 INFOLOG("blockHash:{}, deleteBlockHash:{}", block.hash().substr(0,6), curr_block.hash().substr(0,6));
+                broadcastSpends.Remove(curr_block.hash());
                 it = broadcastBlocks.erase(it);
                 break;
             }
@@ -2014,9 +2098,9 @@ void BlockHelper::AddBroadcastBlock(const CBlock& block, bool status)
         if(DBStatus::DB_SUCCESS == prevHashStatus_)
         {
             INFOLOG("broadcastBlocks height:{}, hash:{}, status:{}", block.height(), block.hash().substr(0,6), status);
-            if(block.height() <= nodeSelfHeight + 1000)
+            if(block.height() <= nodeSelfHeight + 1000 && broadcastBlocks.insert(block).second)
             {
-                broadcastBlocks.insert(block);
+                broadcastSpends.Add(block.hash(), std::move(spends));
             }
         }
         else
@@ -2032,9 +2116,9 @@ void BlockHelper::AddBroadcastBlock(const CBlock& block, bool status)
             if(DBStatus::DB_SUCCESS == prevHashStatus_)
             {
                 INFOLOG("broadcastBlocks height:{}, hash:{}, status:{}", block.height(), block.hash().substr(0,6), status);
-                if(block.height() <= nodeSelfHeight + 1000)
+                if(block.height() <= nodeSelfHeight + 1000 && broadcastBlocks.insert(block).second)
                 {
-                    broadcastBlocks.insert(block);
+                    broadcastSpends.Add(block.hash(), std::move(spends));
                 }
             }
             else
@@ -2048,6 +2132,7 @@ void BlockHelper::AddBroadcastBlock(const CBlock& block, bool status)
 void BlockHelper::AddSyncBlock(const std::map<uint64_t, std::set<CBlock, BlockComparator>> &syncBlockData, global::ca::SaveType type)
 {
     DEBUGLOG("AddSyncBlock syncBlockData.size(): {}", syncBlockData.size());
+    preVerifyBatch(syncBlockData);
     std::lock_guard<std::mutex> lock(helperMutex);
     for(const auto&[key,value]:syncBlockData)
     {
@@ -2062,6 +2147,7 @@ void BlockHelper::AddSyncBlock(const std::map<uint64_t, std::set<CBlock, BlockCo
 
 void BlockHelper::AddFastSyncBlock(const std::map<uint64_t, std::set<CBlock, BlockComparator>> &syncBlockData, global::ca::SaveType type)
 {
+    preVerifyBatch(syncBlockData);
     std::lock_guard<std::mutex> lock(helperMutex);
     for (auto it = syncBlockData.begin(); it != syncBlockData.end(); ++it)
     {
@@ -2174,6 +2260,7 @@ void BlockHelper::RollbackTest()
             std::cin >> height;
             std::lock_guard<std::mutex> lock(helperMutex);
             auto ret = ca_algorithm::RollBackToHeight(height);
+            MagicSingleton<SpendableUtxoIndex>::GetInstance()->Clear();
             if (0 != ret)
             {
                 std::cout << std::endl
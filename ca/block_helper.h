@@ -461,6 +461,22 @@ int sendBlockByHashRequest(const std::map<std::string, bool> &missingHashs);
  */
 int seekBlockByContractPreHashRequest(const std::string &blockHashToSeek, std::string& contractBlockString);
 
+/**
+ * @brief       Whether the block hash is the hash of the block serialized without its hash and signatures
+ */
+bool blockHashMatches(const CBlock &block);
+
+/**
+ * @brief       Whether the merkle root of the block covers its transactions
+ */
+bool blockMerkleMatches(const CBlock &block);
+
+/**
+ * @brief       Whether the block hashes to its hash and its merkle root covers its transactions, the
+ *              check every path receiving blocks applies before trusting their contents
+ */
+bool blockMatchesHeader(const CBlock &block);
+
 
 
 
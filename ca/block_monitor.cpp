@@ -4,6 +4,7 @@
 #include "utils/vrf.hpp"
 #include "db/db_api.h"
 #include "transaction.h"
+#include "utils/tx_lifecycle_tracer.h"
 
 uint32_t BlockMonitor::_maxSendSize = 100;
 void BlockMonitor::transactionSuccessRateChecker()
@@ -111,6 +112,10 @@ int BlockMonitor::sendBroadcastAddBlockRequest(std::string strBlock, uint64_t bl
 	CBlock block;
     block.ParseFromString(strBlock);
 	MagicSingleton<BlockStorage>::GetInstance()->AddBlockStatus(block.hash(), block, cast_address);
+    for (const auto& tx : block.txs())
+    {
+        MagicSingleton<TxLifecycleTracer>::GetInstance()->Record(TxTraceStage::kBlockBroadcast, tx.hash());
+    }
 
 	DEBUGLOG("***********net broadcast time{}",MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp());
 	return 0;
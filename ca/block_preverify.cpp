@@ -0,0 +1,305 @@
+#include "ca/block_preverify.h"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+#include "ca/global.h"
+#include "ca/algorithm.h"
+#include "ca/block_helper.h"
+#include "include/logging.h"
+#include "utils/account_manager.h"
+
+namespace
+{
+    // One header or one transaction of a block in the batch
+    struct WorkItem
+    {
+        size_t block;
+        int tx;
+    };
+}
+
+int BlockPreVerifier::VerifyHash(const CBlock &block)
+{
+    if (block.hash().empty())
+    {
+        return -2;
+    }
+    if (!blockHashMatches(block))
+    {
+        return -3;
+    }
+    return 0;
+}
+
+int BlockPreVerifier::VerifyHeader(const CBlock &block, std::vector<Ed25519VerifyItem> &consensusSigns)
+{
+    // The hash first, every later outcome is then one of the bytes the hash commits to
+    int ret = VerifyHash(block);
+    if (ret != 0)
+    {
+        return ret;
+    }
+    if (block.version() != global::ca::kCurrentBlockVersion)
+    {
+        return -1;
+    }
+    if (!blockMerkleMatches(block))
+    {
+        return -4;
+    }
+
+    for (const auto &sign : block.sign())
+    {
+        consensusSigns.push_back({block.hash(), sign.pub(), sign.sign()});
+    }
+    return 0;
+}
+
+void BlockPreVerifier::CollectOwnerSigns(const CTransaction &tx, std::vector<Ed25519VerifyItem> &ownerSigns)
+{
+    for (const auto &utxo : tx.utxos())
+    {
+        for (const auto &vin : utxo.vin())
+        {
+            // Contract vins and genesis outputs carry no owner signature, the serial path decides on those
+            if (!vin.contractaddr().empty() || vin.vinsign().sign().empty() || vin.vinsign().pub().empty())
+            {
+                continue;
+            }
+            CTxInput copyVin = vin;
+            copyVin.clear_vinsign();
+            ownerSigns.push_back({Getsha256hash(copyVin.SerializeAsString()), vin.vinsign().pub(), vin.vinsign().sign()});
+        }
+
+        if (utxo.multisign_size() == 0)
+        {
+            continue;
+        }
+        CTxUtxos copyUtxo = utxo;
+        copyUtxo.clear_multisign();
+        std::string utxoHash = Getsha256hash(copyUtxo.SerializeAsString());
+        for (const auto &multiSign : utxo.multisign())
+        {
+            ownerSigns.push_back({utxoHash, multiSign.pub(), multiSign.sign()});
+        }
+    }
+}
+
+int BlockPreVerifier::VerifyTransaction(const CTransaction &tx, std::vector<Ed25519VerifyItem> &ownerSigns, std::vector<Ed25519VerifyItem> &consensusSigns)
+{
+    if (tx.hash() != ca_algorithm::calculateTransactionHash(tx))
+    {
+        return -11;
+    }
+
+    CollectOwnerSigns(tx, ownerSigns);
+    for (const auto &verifySign : tx.verifysign())
+    {
+        consensusSigns.push_back({tx.hash(), verifySign.pub(), verifySign.sign()});
+    }
+    return 0;
+}
+
+void BlockPreVerifier::PreVerify(const std::vector<const CBlock *> &blocks)
+{
+    std::vector<const CBlock *> pending;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto block : blocks)
+        {
+            if (_results.find(block->hash()) == _results.end()
+                && std::none_of(pending.begin(), pending.end(), [block](const CBlock *p){ return p->hash() == block->hash(); }))
+            {
+                pending.push_back(block);
+            }
+        }
+    }
+    if (pending.empty())
+    {
+        return;
+    }
+
+    std::vector<int> blockCodes;
+    verify(pending, blockCodes);
+    for (size_t i = 0; i < pending.size(); ++i)
+    {
+        remember(pending[i]->hash(), blockCodes[i]);
+    }
+}
+
+void BlockPreVerifier::verify(const std::vector<const CBlock *> &pending, std::vector<int> &blockCodes)
+{
+    // Headers and transactions of the whole batch are spread over the workers, so a single large block still fans out
+    std::vector<WorkItem> items;
+    for (size_t i = 0; i < pending.size(); ++i)
+    {
+        items.push_back({i, -1});
+        for (int j = 0; j < pending[i]->txs_size(); ++j)
+        {
+            items.push_back({i, j});
+        }
+    }
+
+    std::vector<int> codes(items.size(), 0);
+    std::vector<std::vector<Ed25519VerifyItem>> itemOwnerSigns(items.size());
+    std::vector<std::vector<Ed25519VerifyItem>> itemConsensusSigns(items.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t index = next++; index < items.size(); index = next++)
+        {
+            const auto &item = items[index];
+            const CBlock &block = *pending[item.block];
+            codes[index] = item.tx < 0 ? VerifyHeader(block, itemConsensusSigns[index])
+                                       : VerifyTransaction(block.txs(item.tx), itemOwnerSigns[index], itemConsensusSigns[index]);
+        }
+    };
+
+    size_t threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), items.size());
+    std::vector<std::future<void>> workers;
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto &future : workers)
+    {
+        future.wait();
+    }
+
+    blockCodes.assign(pending.size(), 0);
+    for (size_t index = 0; index < items.size(); ++index)
+    {
+        auto &code = blockCodes[items[index].block];
+        if (code == 0 && codes[index] != 0)
+        {
+            code = codes[index];
+        }
+    }
+
+    // Every signature of the batch goes through one verification pass, owner signatures first
+    std::vector<Ed25519VerifyItem> signs;
+    std::vector<size_t> signBlocks;
+    std::vector<char> signIsOwner;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        auto &source = pass == 0 ? itemOwnerSigns : itemConsensusSigns;
+        for (size_t index = 0; index < items.size(); ++index)
+        {
+            if (blockCodes[items[index].block] != 0)
+            {
+                continue;
+            }
+            for (auto &sign : source[index])
+            {
+                signs.push_back(std::move(sign));
+                signBlocks.push_back(items[index].block);
+                signIsOwner.push_back(pass == 0);
+            }
+        }
+    }
+
+    std::vector<char> valid;
+    ed25519BatchVerify(signs, valid);
+    std::vector<bool> blockConsensusOk(pending.size(), true);
+    for (size_t index = 0; index < signs.size(); ++index)
+    {
+        if (valid[index])
+        {
+            continue;
+        }
+        if (signIsOwner[index])
+        {
+            auto &code = blockCodes[signBlocks[index]];
+            if (code == 0)
+            {
+                code = -12;
+            }
+        }
+        else
+        {
+            blockConsensusOk[signBlocks[index]] = false;
+        }
+    }
+
+    for (size_t i = 0; i < pending.size(); ++i)
+    {
+        ++_verifiedBlocks;
+        if (blockCodes[i] != 0)
+        {
+            ++_rejectedBlocks;
+            ERRORLOG("block {} height {} failed pre-verification, ret:{}", pending[i]->hash().substr(0, 6), pending[i]->height(), blockCodes[i]);
+        }
+        else if (!blockConsensusOk[i])
+        {
+            // Consensus signatures are left to VerifyBlock, record the disagreement only
+            ++_consensusSignMismatches;
+            DEBUGLOG("block {} consensus signs did not verify against the block or transaction hash", pending[i]->hash().substr(0, 6));
+        }
+    }
+}
+
+bool BlockPreVerifier::Lookup(const std::string &blockHash, int &code)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _results.find(blockHash);
+    if (found == _results.end())
+    {
+        return false;
+    }
+    ++_cachedLookups;
+    code = found->second;
+    return true;
+}
+
+int BlockPreVerifier::Check(const CBlock &block)
+{
+    // Outcomes are kept by block hash and only hold for a block that hashes to it
+    int code = VerifyHash(block);
+    if (code != 0)
+    {
+        ++_verifiedBlocks;
+        ++_rejectedBlocks;
+        return code;
+    }
+    if (Lookup(block.hash(), code))
+    {
+        return code;
+    }
+
+    std::vector<int> blockCodes;
+    verify({&block}, blockCodes);
+    remember(block.hash(), blockCodes[0]);
+    return blockCodes[0];
+}
+
+BlockPreVerifier::Stats BlockPreVerifier::GetStats() const
+{
+    Stats stats;
+    stats.verifiedBlocks = _verifiedBlocks;
+    stats.rejectedBlocks = _rejectedBlocks;
+    stats.cachedLookups = _cachedLookups;
+    stats.consensusSignMismatches = _consensusSignMismatches;
+    return stats;
+}
+
+void BlockPreVerifier::remember(const std::string &blockHash, int code)
+{
+    // Without a matching hash the outcome belongs to whatever was sent, not to the block of that hash
+    if (code == -2 || code == -3)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_results.emplace(blockHash, code).second)
+    {
+        return;
+    }
+    _order.push_back(blockHash);
+    while (_order.size() > kMaxCachedResults)
+    {
+        _results.erase(_order.front());
+        _order.pop_front();
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * *****************************************************************************
+ * @file        block_preverify.h
+ * @brief       Parallel stateless pre-verification of incoming blocks
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_BLOCK_PREVERIFY_HEADER
+#define CA_BLOCK_PREVERIFY_HEADER
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "proto/block.pb.h"
+#include "utils/ed25519_batch.h"
+
+/**
+ * @brief       Runs the checks of a block that do not depend on chain state across
+ *              a batch of blocks in parallel and remembers the outcome by block hash.
+ *              BlockHelper consults the outcome before the serialized save path, so a
+ *              block that is malformed or carries a bad signature never takes the
+ *              save lock or breaks the height ordered save of the rest of a batch.
+ */
+class BlockPreVerifier
+{
+public:
+    struct Stats
+    {
+        uint64_t verifiedBlocks = 0;
+        uint64_t rejectedBlocks = 0;
+        uint64_t cachedLookups = 0;
+        uint64_t consensusSignMismatches = 0;
+    };
+
+    BlockPreVerifier() = default;
+    ~BlockPreVerifier() = default;
+    BlockPreVerifier(BlockPreVerifier &&) = delete;
+    BlockPreVerifier(const BlockPreVerifier &) = delete;
+    BlockPreVerifier &operator=(BlockPreVerifier &&) = delete;
+    BlockPreVerifier &operator=(const BlockPreVerifier &) = delete;
+
+    /**
+     * @brief       Pre-verify every block of the batch that has no cached outcome yet
+     *
+     * @param       blocks: blocks to check
+     */
+    void PreVerify(const std::vector<const CBlock *> &blocks);
+
+    /**
+     * @brief       Cached outcome of a pre-verified block
+     *
+     * @param       blockHash: block hash
+     * @param       code: 0 when every stateless check passed, negative check that failed otherwise
+     * @return      true    the block has been pre-verified
+     * @return      false   no outcome is cached
+     */
+    bool Lookup(const std::string &blockHash, int &code);
+
+    /**
+     * @brief       Check the block hash, then pre-verify the block unless cached, and report whether it
+     *              may enter the save path
+     *
+     * @param       block: block to check
+     * @return      int return 0 when the block passed
+     */
+    int Check(const CBlock &block);
+
+    Stats GetStats() const;
+
+    /**
+     * @brief       Check that the block hash is the hash of the block without its hash and signs
+     *
+     * @param       block: block to check
+     * @return      int return 0 success, -2 no hash, -3 hash mismatch
+     */
+    static int VerifyHash(const CBlock &block);
+
+    /**
+     * @brief       Stateless checks of the block header: hash, version and merkle root
+     *
+     * @param       block: block to check
+     * @param       consensusSigns: receives the block signs, which are expected to sign the block hash
+     * @return      int return 0 success
+     */
+    static int VerifyHeader(const CBlock &block, std::vector<Ed25519VerifyItem> &consensusSigns);
+
+    /**
+     * @brief       Stateless checks of one transaction: the hash, and collection of its signatures
+     *
+     * @param       tx: transaction to check
+     * @param       ownerSigns: receives the vin and utxo signatures, which must verify
+     * @param       consensusSigns: receives the verify signs, which are expected to sign the transaction hash
+     * @return      int return 0 success
+     */
+    static int VerifyTransaction(const CTransaction &tx, std::vector<Ed25519VerifyItem> &ownerSigns, std::vector<Ed25519VerifyItem> &consensusSigns);
+
+    /**
+     * @brief       Collect the vin and multisign signatures of a transaction with the message each one signs
+     *
+     * @param       tx: transaction
+     * @param       ownerSigns: receives the signatures
+     */
+    static void CollectOwnerSigns(const CTransaction &tx, std::vector<Ed25519VerifyItem> &ownerSigns);
+
+    static constexpr size_t kMaxCachedResults = 8192;
+
+private:
+    void verify(const std::vector<const CBlock *> &pending, std::vector<int> &blockCodes);
+    void remember(const std::string &blockHash, int code);
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, int> _results;
+    std::deque<std::string> _order;
+
+    std::atomic<uint64_t> _verifiedBlocks{0};
+    std::atomic<uint64_t> _rejectedBlocks{0};
+    std::atomic<uint64_t> _cachedLookups{0};
+    std::atomic<uint64_t> _consensusSignMismatches{0};
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "ca/block_spend_index.h"
+
+#include <algorithm>
+
+#include "ca/checker.h"
+#include "ca/transaction.h"
+
+BlockSpendIndex::SpendSet BlockSpendIndex::Build(const CBlock &block)
+{
+    SpendSet spends;
+    for (int i = 0; i < block.txs_size(); ++i)
+    {
+        const auto &tx = block.txs(i);
+        if (GetTransactionType(tx) != kTransactionTypeTx)
+        {
+            continue;
+        }
+        for (auto &key : Checker::SpendKeys(tx))
+        {
+            spends.emplace_back(std::move(key), i);
+        }
+    }
+    std::sort(spends.begin(), spends.end());
+    return spends;
+}
+
+bool BlockSpendIndex::Intersects(const SpendSet &first, const SpendSet &second, int *firstTxIndex)
+{
+    auto a = first.begin();
+    auto b = second.begin();
+    while (a != first.end() && b != second.end())
+    {
+        int order = a->first.compare(b->first);
+        if (order == 0)
+        {
+            if (firstTxIndex != nullptr)
+            {
+                *firstTxIndex = a->second;
+            }
+            return true;
+        }
+        order < 0 ? ++a : ++b;
+    }
+    return false;
+}
+
+void BlockSpendIndex::Add(const std::string &blockHash, SpendSet spends)
+{
+    Remove(blockHash);
+    for (const auto &spend : spends)
+    {
+        _spentBy[spend.first].push_back(blockHash);
+    }
+    _blocks.emplace(blockHash, std::move(spends));
+}
+
+void BlockSpendIndex::Remove(const std::string &blockHash)
+{
+    auto found = _blocks.find(blockHash);
+    if (found == _blocks.end())
+    {
+        return;
+    }
+    for (const auto &spend : found->second)
+    {
+        auto spent = _spentBy.find(spend.first);
+        if (spent == _spentBy.end())
+        {
+            continue;
+        }
+        auto &hashes = spent->second;
+        hashes.erase(std::remove(hashes.begin(), hashes.end(), blockHash), hashes.end());
+        if (hashes.empty())
+        {
+            _spentBy.erase(spent);
+        }
+    }
+    _blocks.erase(found);
+}
+
+void BlockSpendIndex::Clear()
+{
+    _spentBy.clear();
+    _blocks.clear();
+}
+
+std::set<std::string> BlockSpendIndex::Conflicts(const SpendSet &spends) const
+{
+    std::set<std::string> hashes;
+    for (const auto &spend : spends)
+    {
+        auto found = _spentBy.find(spend.first);
+        if (found != _spentBy.end())
+        {
+            hashes.insert(found->second.begin(), found->second.end());
+        }
+    }
+    return hashes;
+}
@@ -0,0 +1,74 @@
+/**
+ * *****************************************************************************
+ * @file        block_spend_index.h
+ * @brief       Sorted spend key sets of blocks and an index of the spends of a block pool
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_BLOCK_SPEND_INDEX_HEADER
+#define CA_BLOCK_SPEND_INDEX_HEADER
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "proto/block.pb.h"
+
+/**
+ * @brief       Two blocks conflict when a normal transaction of each spends the same output. The spend
+ *              keys of a block are derived once into a sorted set, so two blocks are compared with one
+ *              merge walk, and a pool of blocks keeps every key it spends in a hash index, so a new
+ *              block finds the pooled blocks it conflicts with by one lookup per key.
+ *              Not thread safe, the owner guards it with the lock of its pool.
+ */
+class BlockSpendIndex
+{
+public:
+    /**
+     * @brief       Spend keys of a block paired with the index of the spending transaction, sorted by key
+     */
+    using SpendSet = std::vector<std::pair<std::string, int>>;
+
+    BlockSpendIndex() = default;
+    ~BlockSpendIndex() = default;
+    BlockSpendIndex(BlockSpendIndex &&) = delete;
+    BlockSpendIndex(const BlockSpendIndex &) = delete;
+    BlockSpendIndex &operator=(BlockSpendIndex &&) = delete;
+    BlockSpendIndex &operator=(const BlockSpendIndex &) = delete;
+
+    /**
+     * @brief       Spend keys (see Checker::SpendKeys) of the normal transactions of the block
+     */
+    static SpendSet Build(const CBlock &block);
+
+    /**
+     * @brief       Whether the two sets share a spend key
+     *
+     * @param       first: spends of the first block
+     * @param       second: spends of the second block
+     * @param       firstTxIndex: set to the index of the conflicting transaction in the first block
+     */
+    static bool Intersects(const SpendSet &first, const SpendSet &second, int *firstTxIndex = nullptr);
+
+    /**
+     * @brief       Index the spends of a block entering the pool
+     */
+    void Add(const std::string &blockHash, SpendSet spends);
+
+    void Remove(const std::string &blockHash);
+    void Clear();
+
+    /**
+     * @brief       Hashes of the pooled blocks spending any of the keys
+     */
+    std::set<std::string> Conflicts(const SpendSet &spends) const;
+
+private:
+    std::unordered_map<std::string, std::vector<std::string>> _spentBy;
+    std::unordered_map<std::string, SpendSet> _blocks;
+};
+
+#endif
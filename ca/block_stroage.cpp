@@ -263,7 +263,7 @@ int get_prehash_find_node(uint32_t num, uint64_t seekHeight, const std::vector<s
     auto compareReserve = std::greater_equal<>();
     
     int ret = 0;
-    if ((ret = SyncBlock::get_sync_node_basic(num, seekHeight, discardComparisonFunc, compareReserve, pledgeAddr, node_ids_to_send)) != 0)
+    if ((ret = SyncBlock::get_sync_node_basic(num, seekHeight, discardComparisonFunc, compareReserve, pledgeAddr, node_ids_to_send, "seekPreHash")) != 0)
     {
         ERRORLOG("get seek node fail, ret:{}", ret);
         return -1;
@@ -315,7 +315,7 @@ RetType BlockStorage::seekPreHashByNode(
 {
     std::string msgId;
     uint64_t successCounter = 0;
-    if (!dataMgrPtr.CreateWait(10, node_ids_to_send.size() * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(10, node_ids_to_send.size() * 0.8, msgId, "seekPreHash"))
     {
         ERRORLOG("CreateWait fail!!!");
         return {"", 0};
@@ -140,7 +140,7 @@ int CheckBlocks::_ToCheck()
 
         std::string msgId;
         size_t sendNum = node_ids_to_send.size();
-        if (!dataMgrPtr.CreateWait(90, sendNum * 0.9, msgId))
+        if (!dataMgrPtr.CreateWait(90, sendNum * 0.9, msgId, "checkBlocks"))
         {
             return -5;
         }
@@ -311,7 +311,7 @@ int CheckBlocks::calculateByzantineSumHash(const std::vector<std::string> &node_
 
     double acceptance_rate = 0.9;
 
-    if (!dataMgrPtr.CreateWait(90, sendNum * acceptance_rate, msgId))
+    if (!dataMgrPtr.CreateWait(90, sendNum * acceptance_rate, msgId, "checkBlocksSumHash"))
     {
         return -1;
     }
@@ -1,4 +1,5 @@
 #include "ca/checker.h"
+#include "ca/block_spend_index.h"
 #include "utils/contract_utils.h"
 
 bool Checker::CheckConflict(const CTransaction &tx, const std::vector<TransactionEntity>  &cache)
@@ -35,25 +36,36 @@ bool Checker::CheckConflict(const CTransaction &tx, const std::set<CBlock, compa
     return false;
 }
 
-bool Checker::CheckConflict(const CBlock &block, const std::set<CBlock, compator::blockTimeAscending> &blocks, std::string* txHashRef)
+namespace
 {
-    for (const auto& currentBlock : blocks)
+    // The hash field of a transaction is the hash of the transaction without hash and verifysign
+    std::string conflictTxHash(const CBlock &block, int txIndex)
     {
-        if(txHashRef != NULL)
+        const auto &tx = block.txs(txIndex);
+        if(!tx.hash().empty())
         {
-            std::string txHash = "";
-            if(CheckConflict(currentBlock, block, &txHash) == true)
-            {
-                *txHashRef = txHash;
-                return true;
-            }
+            return tx.hash();
         }
-        else
+        CTransaction copyTx = tx;
+        copyTx.clear_verifysign();
+        return Getsha256hash(copyTx.SerializeAsString());
+    }
+}
+
+bool Checker::CheckConflict(const CBlock &block, const std::set<CBlock, compator::blockTimeAscending> &blocks, std::string* txHashRef)
+{
+    // The spends of the new block are derived once for all the blocks it is compared with
+    auto spends = BlockSpendIndex::Build(block);
+    for (const auto& currentBlock : blocks)
+    {
+        int txIndex = 0;
+        if(BlockSpendIndex::Intersects(BlockSpendIndex::Build(currentBlock), spends, &txIndex))
         {
-            if(CheckConflict(currentBlock, block) == true)
+            if(txHashRef != NULL)
             {
-                return true;
+                *txHashRef = conflictTxHash(currentBlock, txIndex);
             }
+            return true;
         }
     }
 
@@ -62,82 +74,55 @@ bool Checker::CheckConflict(const CBlock &block, const std::set<CBlock, compator
 
 bool Checker::CheckConflict(const CBlock &block1, const CBlock &block2, std::string* txHashRef)
 {
-    for(const auto& tx1 : block1.txs())
+    int txIndex = 0;
+    if(!BlockSpendIndex::Intersects(BlockSpendIndex::Build(block1), BlockSpendIndex::Build(block2), &txIndex))
     {
-        if(GetTransactionType(tx1) != kTransactionTypeTx)
-        {
-            continue;
-        }
-
-        for(const auto& tx2 : block2.txs())
-        {
-            if(GetTransactionType(tx2) != kTransactionTypeTx)
-            {
-                continue;
-            }
-
-            if(CheckConflict(tx1, tx2) == true)
-            {
-                if(txHashRef != NULL)
-                {
-                    CTransaction copyTx = tx1;
-                    copyTx.clear_hash();
-                    copyTx.clear_verifysign();
-                    *txHashRef = Getsha256hash(copyTx.SerializeAsString());
-                }
-                return true;
-            }
-        }
+        return false;
     }
-
-    return false;
+    if(txHashRef != NULL)
+    {
+        *txHashRef = conflictTxHash(block1, txIndex);
+    }
+    return true;
 }
 
 bool Checker::CheckConflict(const CTransaction &tx1, const CTransaction &tx2)
 {
-    std::vector<std::string> vec1;
-    for(const auto& utxo : tx1.utxos())
+    std::vector<std::string> vec1 = SpendKeys(tx1);
+    std::vector<std::string> vec2 = SpendKeys(tx2);
+
+    std::vector<std::string> vecIntersection;
+    std::sort(vec1.begin(), vec1.end());
+    std::sort(vec2.begin(), vec2.end());
+    std::set_intersection(vec1.begin(), vec1.end(), vec2.begin(), vec2.end(), std::back_inserter(vecIntersection));
+    return !vecIntersection.empty();
+}
+
+std::vector<std::string> Checker::SpendKeys(const CTransaction &tx)
+{
+    std::vector<std::string> keys;
+    for(const auto& utxo : tx.utxos())
     {
-        std::string currency = utxo.assettype();
+        const std::string &currency = utxo.assettype();
         for(const auto& vin : utxo.vin())
         {
-            for (auto & prevout : vin.prevout())
+            if(!vin.contractaddr().empty())
             {
-                if(!vin.contractaddr().empty()){
-                    DEBUGLOG("---- 1 utxo : {}", prevout.hash());
-                    vec1.push_back(prevout.hash());
-                }else{
-                    DEBUGLOG("---- 1 prevout_addr : {}",prevout.hash() + "_" + GenerateAddr(vin.vinsign().pub()));
-                    vec1.push_back(prevout.hash() + "_" + GenerateAddr(vin.vinsign().pub()) + "_" + currency);
+                for (auto & prevout : vin.prevout())
+                {
+                    keys.push_back(prevout.hash());
                 }
+                continue;
             }
-        }
-    }
-
-    std::vector<std::string> vec2;
-    for(const auto& utxo : tx2.utxos())
-    {
-        std::string currency = utxo.assettype();
-        for(const auto& vin : utxo.vin())
-        {
+            // Every prevout of a vin has the same owner, so the address is derived once per vin
+            std::string owner = GenerateAddr(vin.vinsign().pub());
             for (auto & prevout : vin.prevout())
             {
-                if(!vin.contractaddr().empty()){
-                    DEBUGLOG("---- 2 utxo : {}", prevout.hash());
-                    vec2.push_back(prevout.hash());
-                }else{
-                    DEBUGLOG("---- 2 prevout_addr : {}",prevout.hash() + "_" + GenerateAddr(vin.vinsign().pub()));
-                    vec2.push_back(prevout.hash() + "_" + GenerateAddr(vin.vinsign().pub()) + "_" + currency);
-                }
+                keys.push_back(prevout.hash() + "_" + owner + "_" + currency);
             }
         }
     }
-
-    std::vector<std::string> vecIntersection;
-    std::sort(vec1.begin(), vec1.end());
-    std::sort(vec2.begin(), vec2.end());
-    std::set_intersection(vec1.begin(), vec1.end(), vec2.begin(), vec2.end(), std::back_inserter(vecIntersection));
-    return !vecIntersection.empty();
+    return keys;
 }
 
 void Checker::CheckConflict(const CBlock &block, std::vector<CTransaction> &double_spent_transactions)
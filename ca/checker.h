@@ -73,6 +73,15 @@ namespace Checker
      */
     bool CheckConflict(const CTransaction &tx1, const CTransaction &tx2);
 
+    /**
+     * @brief       Keys of the outputs a transaction spends, two transactions conflict when they share one.
+     *              Contract inputs are keyed by the utxo alone, other inputs by utxo, owner and asset type.
+     * 
+     * @param       tx: 
+     * @return      std::vector<std::string> 
+     */
+    std::vector<std::string> SpendKeys(const CTransaction &tx);
+
     /**
      * @brief       
      * 
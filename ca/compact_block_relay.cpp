@@ -0,0 +1,536 @@
+#include "ca/compact_block_relay.h"
+
+#include <cstdlib>
+
+#include "ca/block_helper.h"
+#include "ca/transaction.h"
+#include "common/global.h"
+#include "common/task_pool.h"
+#include "include/logging.h"
+#include "net/api.h"
+#include "net/handle_event.h"
+#include "net/peer_node.h"
+#include "utils/account_manager.h"
+#include "utils/magic_singleton.h"
+#include "utils/string_util.h"
+#include "utils/time_util.h"
+#include "utils/util.h"
+
+namespace
+{
+    uint64_t nowSec()
+    {
+        return MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp() / 1000000;
+    }
+}
+
+uint64_t CompactBlockRelay::ShortId(const std::string &txHash)
+{
+    if (txHash.size() < 16)
+    {
+        return 0;
+    }
+    return std::strtoull(txHash.substr(0, 16).c_str(), nullptr, 16);
+}
+
+void CompactBlockRelay::AddTransaction(const CTransaction &tx)
+{
+    uint64_t shortId = ShortId(tx.hash());
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    auto found = _pool.find(shortId);
+    if (found != _pool.end())
+    {
+        // Two transactions sharing a short id cannot be told apart, both are left to the request path
+        if (found->second.hash() != tx.hash())
+        {
+            found->second.Clear();
+        }
+        return;
+    }
+    _pool.emplace(shortId, tx);
+    _poolOrder.push_back(shortId);
+    while (_poolOrder.size() > kPoolCapacity)
+    {
+        _pool.erase(_poolOrder.front());
+        _poolOrder.pop_front();
+    }
+}
+
+void CompactBlockRelay::AddBlockTransactions(const CBlock &block)
+{
+    for (const auto &tx : block.txs())
+    {
+        AddTransaction(tx);
+    }
+}
+
+bool CompactBlockRelay::SupportsCompact(const std::string &version)
+{
+    std::vector<std::string> parts;
+    StringUtil::SplitString(version, "_", parts);
+    if (parts.size() != 3)
+    {
+        return false;
+    }
+    std::vector<std::string> peerNumbers;
+    std::vector<std::string> minNumbers;
+    StringUtil::SplitString(parts[1], ".", peerNumbers);
+    StringUtil::SplitString(kMinPeerVersion, ".", minNumbers);
+    if (peerNumbers.size() != minNumbers.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < minNumbers.size(); ++i)
+    {
+        char *end = nullptr;
+        unsigned long peer = std::strtoul(peerNumbers[i].c_str(), &end, 10);
+        if (peerNumbers[i].empty() || *end != '\0')
+        {
+            return false;
+        }
+        unsigned long min = std::strtoul(minNumbers[i].c_str(), nullptr, 10);
+        if (peer != min)
+        {
+            return peer > min;
+        }
+    }
+    return true;
+}
+
+bool CompactBlockRelay::Send(const std::string &addr, const BuildBlockBroadcastMsg &msg)
+{
+    Node node;
+    if (!MagicSingleton<PeerNode>::GetInstance()->FindNode(addr, node) || !SupportsCompact(node.ver))
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.fullSentToOlderPeers;
+        return false;
+    }
+
+    CBlock block;
+    if (!block.ParseFromString(msg.blockraw()))
+    {
+        return false;
+    }
+
+    RecentBlock recent;
+    {
+        std::lock_guard<std::mutex> lock(_blocksMutex);
+        auto found = _recentBlocks.find(block.hash());
+        if (found != _recentBlocks.end() && !found->second.header.empty())
+        {
+            recent = found->second;
+        }
+    }
+    if (recent.header.empty())
+    {
+        recent.raw = msg.blockraw();
+        for (const auto &tx : block.txs())
+        {
+            recent.shortIds.push_back(ShortId(tx.hash()));
+        }
+        block.clear_txs();
+        recent.header = block.SerializeAsString();
+        rememberBlock(block.hash(), recent);
+    }
+
+    CompactBlockBroadcastMsg compact;
+    compact.set_version(msg.version());
+    compact.set_id(msg.id());
+    compact.set_header(recent.header);
+    for (uint64_t shortId : recent.shortIds)
+    {
+        compact.add_shortids(shortId);
+    }
+    compact.set_flag(msg.flag());
+    compact.set_type(msg.type());
+    for (const auto &castAddr : msg.castaddrs())
+    {
+        compact.add_castaddrs(castAddr);
+    }
+    net_com::SendMessage(addr, compact);
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    ++_stats.compactSent;
+    return true;
+}
+
+int CompactBlockRelay::HandleCompactBlock(const std::shared_ptr<CompactBlockBroadcastMsg> &msg, const MsgData &msgdata)
+{
+    if (0 != Util::IsVersionCompatible(msg->version()))
+    {
+        ERRORLOG("HandleCompactBlock IsVersionCompatible");
+        return -1;
+    }
+    CBlock header;
+    if (!header.ParseFromString(msg->header()) || header.txs_size() != 0 || header.hash().empty())
+    {
+        ERRORLOG("HandleCompactBlock header ParseFromString failed");
+        return -2;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.compactReceived;
+    }
+    dropExpired();
+
+    std::string blockHash = header.hash();
+    {
+        std::unique_lock<std::mutex> blocksLock(_blocksMutex);
+        auto found = _recentBlocks.find(blockHash);
+        if (found != _recentBlocks.end())
+        {
+            std::string blockRaw = found->second.raw;
+            blocksLock.unlock();
+            complete(blockHash, blockRaw, {{msg, msgdata}}, msg->ByteSizeLong());
+            return 0;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(_pendingMutex);
+    auto pendingIter = _pending.find(blockHash);
+    if (pendingIter != _pending.end())
+    {
+        auto &pending = pendingIter->second;
+        pending.waiters.push_back({msg, msgdata});
+        pending.transferBytes += msg->ByteSizeLong();
+        // The first sender has not answered in time, ask this one for the whole block
+        if (nowSec() - pending.requestedAt >= kRetryAfterSec)
+        {
+            pending.requestedAt = nowSec();
+            pending.wholeBlockRequested = true;
+            lock.unlock();
+            requestTxs(msgdata, blockHash, {});
+        }
+        return 0;
+    }
+
+    Pending pending;
+    pending.header = std::move(header);
+    pending.txs.resize(msg->shortids_size());
+    pending.present.assign(msg->shortids_size(), 0);
+    pending.waiters.push_back({msg, msgdata});
+    pending.transferBytes = msg->ByteSizeLong();
+    std::vector<uint32_t> missing;
+    for (int i = 0; i < msg->shortids_size(); ++i)
+    {
+        if (lookupTransaction(msg->shortids(i), pending.txs[i]))
+        {
+            pending.present[i] = 1;
+        }
+        else
+        {
+            missing.push_back(i);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> statsLock(_statsMutex);
+        _stats.txsRequired += msg->shortids_size();
+        _stats.txsFromPool += msg->shortids_size() - missing.size();
+    }
+
+    if (missing.empty())
+    {
+        std::string blockRaw;
+        if (rebuild(pending, blockRaw))
+        {
+            lock.unlock();
+            {
+                std::lock_guard<std::mutex> statsLock(_statsMutex);
+                ++_stats.reconstructedLocally;
+            }
+            complete(blockHash, blockRaw, std::move(pending.waiters), pending.transferBytes);
+            return 0;
+        }
+        DEBUGLOG("compact block {} does not rebuild from the pool, asking for the whole block", blockHash.substr(0, 6));
+        pending.wholeBlockRequested = true;
+    }
+    pending.requestedAt = nowSec();
+    bool wholeBlock = pending.wholeBlockRequested;
+    _pending.emplace(blockHash, std::move(pending));
+    lock.unlock();
+
+    requestTxs(msgdata, blockHash, wholeBlock ? std::vector<uint32_t>() : missing);
+    return 0;
+}
+
+int CompactBlockRelay::HandleGetBlockTxsRequest(const std::shared_ptr<GetBlockTxsReq> &msg, const MsgData &msgdata)
+{
+    if (0 != Util::IsVersionCompatible(msg->version()))
+    {
+        ERRORLOG("HandleGetBlockTxsRequest IsVersionCompatible");
+        return -1;
+    }
+    std::string blockRaw;
+    {
+        std::lock_guard<std::mutex> lock(_blocksMutex);
+        auto found = _recentBlocks.find(msg->blockhash());
+        if (found == _recentBlocks.end())
+        {
+            DEBUGLOG("block {} asked for is no longer cached", msg->blockhash().substr(0, 6));
+            return -2;
+        }
+        blockRaw = found->second.raw;
+    }
+
+    GetBlockTxsAck ack;
+    ack.set_version(global::GetVersion());
+    ack.set_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    ack.set_blockhash(msg->blockhash());
+    CBlock block;
+    if (!block.ParseFromString(blockRaw))
+    {
+        return -3;
+    }
+    bool wholeBlock = msg->indexes_size() == 0;
+    for (uint32_t index : msg->indexes())
+    {
+        if (index >= (uint32_t)block.txs_size())
+        {
+            wholeBlock = true;
+            break;
+        }
+        ack.add_indexes(index);
+        ack.add_txs(block.txs(index).SerializeAsString());
+    }
+    if (wholeBlock)
+    {
+        ack.clear_indexes();
+        ack.clear_txs();
+        ack.set_blockraw(blockRaw);
+    }
+    net_com::SendMessage(msgdata, ack, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+    return 0;
+}
+
+int CompactBlockRelay::HandleGetBlockTxsAcknowledge(const std::shared_ptr<GetBlockTxsAck> &msg, const MsgData &msgdata)
+{
+    if (0 != Util::IsVersionCompatible(msg->version()))
+    {
+        ERRORLOG("HandleGetBlockTxsAcknowledge IsVersionCompatible");
+        return -1;
+    }
+
+    std::unique_lock<std::mutex> lock(_pendingMutex);
+    auto found = _pending.find(msg->blockhash());
+    if (found == _pending.end())
+    {
+        return 0;
+    }
+    auto &pending = found->second;
+    pending.transferBytes += msg->ByteSizeLong();
+
+    if (!msg->blockraw().empty())
+    {
+        CBlock block;
+        if (!block.ParseFromString(msg->blockraw()) || block.hash() != msg->blockhash() || !blockMatchesHeader(block))
+        {
+            ERRORLOG("whole block {} from {} does not match its hash", msg->blockhash().substr(0, 6), msg->id());
+            return -2;
+        }
+        auto waiters = std::move(pending.waiters);
+        int64_t transferBytes = pending.transferBytes;
+        _pending.erase(found);
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> statsLock(_statsMutex);
+            ++_stats.fullBlockFallbacks;
+        }
+        complete(msg->blockhash(), msg->blockraw(), std::move(waiters), transferBytes);
+        return 0;
+    }
+
+    if (msg->indexes_size() != msg->txs_size())
+    {
+        return -3;
+    }
+    for (int i = 0; i < msg->indexes_size(); ++i)
+    {
+        uint32_t index = msg->indexes(i);
+        if (index >= pending.txs.size() || !pending.txs[index].ParseFromString(msg->txs(i)))
+        {
+            return -4;
+        }
+        pending.present[index] = 1;
+    }
+
+    std::string blockRaw;
+    if (!rebuild(pending, blockRaw))
+    {
+        if (pending.wholeBlockRequested)
+        {
+            return -5;
+        }
+        pending.wholeBlockRequested = true;
+        pending.requestedAt = nowSec();
+        lock.unlock();
+        requestTxs(msgdata, msg->blockhash(), {});
+        return 0;
+    }
+    auto waiters = std::move(pending.waiters);
+    int64_t transferBytes = pending.transferBytes;
+    _pending.erase(found);
+    lock.unlock();
+    {
+        std::lock_guard<std::mutex> statsLock(_statsMutex);
+        ++_stats.reconstructedAfterRequest;
+    }
+    complete(msg->blockhash(), blockRaw, std::move(waiters), transferBytes);
+    return 0;
+}
+
+CompactBlockRelayStats CompactBlockRelay::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+bool CompactBlockRelay::lookupTransaction(uint64_t shortId, CTransaction &tx)
+{
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    auto found = _pool.find(shortId);
+    if (found == _pool.end() || found->second.hash().empty())
+    {
+        return false;
+    }
+    tx = found->second;
+    return true;
+}
+
+bool CompactBlockRelay::rebuild(const Pending &pending, std::string &blockRaw)
+{
+    for (char present : pending.present)
+    {
+        if (!present)
+        {
+            return false;
+        }
+    }
+    CBlock block = pending.header;
+    for (const auto &tx : pending.txs)
+    {
+        *block.add_txs() = tx;
+    }
+    if (!blockMatchesHeader(block))
+    {
+        return false;
+    }
+    blockRaw = block.SerializeAsString();
+    return true;
+}
+
+void CompactBlockRelay::requestTxs(const MsgData &from, const std::string &blockHash, const std::vector<uint32_t> &indexes)
+{
+    GetBlockTxsReq req;
+    req.set_version(global::GetVersion());
+    req.set_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    req.set_blockhash(blockHash);
+    for (uint32_t index : indexes)
+    {
+        req.add_indexes(index);
+    }
+    net_com::SendMessage(from, req, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    auto found = _pending.find(blockHash);
+    if (found != _pending.end())
+    {
+        found->second.transferBytes += req.ByteSizeLong();
+    }
+}
+
+void CompactBlockRelay::complete(const std::string &blockHash, const std::string &blockRaw, std::vector<Waiter> waiters, int64_t transferBytes)
+{
+    RecentBlock recent;
+    recent.raw = blockRaw;
+    rememberBlock(blockHash, std::move(recent));
+
+    // Every sender of the compact block counts as a full broadcast the existing handlers would have seen
+    auto taskPool = MagicSingleton<TaskPool>::GetInstance();
+    for (const auto &waiter : waiters)
+    {
+        auto full = std::make_shared<BuildBlockBroadcastMsg>();
+        full->set_version(waiter.msg->version());
+        full->set_id(waiter.msg->id());
+        full->set_blockraw(blockRaw);
+        full->set_flag(waiter.msg->flag());
+        full->set_type(waiter.msg->type());
+        for (const auto &castAddr : waiter.msg->castaddrs())
+        {
+            full->add_castaddrs(castAddr);
+        }
+        taskPool->CommitSaveBlockJob([](const MessagePtr &msg, const MsgData &from) {
+            return handleBuildBlockBroadcastMessage(std::static_pointer_cast<BuildBlockBroadcastMsg>(msg), from);
+        }, full, waiter.from);
+        taskPool->commitBroadcastRequest([](const MessagePtr &msg, const MsgData &from) {
+            return HandleBroadcastMsg(std::static_pointer_cast<BuildBlockBroadcastMsg>(msg), from);
+        }, full, waiter.from);
+    }
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    ++_stats.blocksCompleted;
+    _stats.bytesSaved += (int64_t)(blockRaw.size() * waiters.size()) - transferBytes;
+}
+
+void CompactBlockRelay::rememberBlock(const std::string &blockHash, RecentBlock block)
+{
+    std::lock_guard<std::mutex> lock(_blocksMutex);
+    auto found = _recentBlocks.find(blockHash);
+    if (found != _recentBlocks.end())
+    {
+        if (found->second.header.empty())
+        {
+            found->second = std::move(block);
+        }
+        return;
+    }
+    _recentBlocks.emplace(blockHash, std::move(block));
+    _recentOrder.push_back(blockHash);
+    while (_recentOrder.size() > kRecentBlockCapacity)
+    {
+        _recentBlocks.erase(_recentOrder.front());
+        _recentOrder.pop_front();
+    }
+}
+
+void CompactBlockRelay::dropExpired()
+{
+    uint64_t now = nowSec();
+    uint64_t expired = 0;
+    {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        for (auto iter = _pending.begin(); iter != _pending.end();)
+        {
+            if (now - iter->second.requestedAt > kPendingTimeoutSec)
+            {
+                DEBUGLOG("compact block {} was never completed", iter->first.substr(0, 6));
+                iter = _pending.erase(iter);
+                ++expired;
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+    if (expired != 0)
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        _stats.expired += expired;
+    }
+}
+
+int handleCompactBlockBroadcastMessage(const std::shared_ptr<CompactBlockBroadcastMsg> &msg, const MsgData &msgdata)
+{
+    return MagicSingleton<CompactBlockRelay>::GetInstance()->HandleCompactBlock(msg, msgdata);
+}
+
+int handleGetBlockTxsRequest(const std::shared_ptr<GetBlockTxsReq> &msg, const MsgData &msgdata)
+{
+    return MagicSingleton<CompactBlockRelay>::GetInstance()->HandleGetBlockTxsRequest(msg, msgdata);
+}
+
+int handleGetBlockTxsAcknowledge(const std::shared_ptr<GetBlockTxsAck> &msg, const MsgData &msgdata)
+{
+    return MagicSingleton<CompactBlockRelay>::GetInstance()->HandleGetBlockTxsAcknowledge(msg, msgdata);
+}
@@ -0,0 +1,159 @@
+/**
+ * *****************************************************************************
+ * @file        compact_block_relay.h
+ * @brief       Block broadcast as header plus short transaction ids
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_COMPACT_BLOCK_RELAY_HEADER
+#define CA_COMPACT_BLOCK_RELAY_HEADER
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "net/msg_queue.h"
+#include "proto/block.pb.h"
+#include "proto/ca_protomsg.pb.h"
+#include "proto/transaction.pb.h"
+
+/**
+ * @brief       Counters of compact block relay
+ */
+struct CompactBlockRelayStats
+{
+    uint64_t compactSent = 0;
+    uint64_t fullSentToOlderPeers = 0;
+    uint64_t compactReceived = 0;
+    uint64_t reconstructedLocally = 0;
+    uint64_t reconstructedAfterRequest = 0;
+    uint64_t fullBlockFallbacks = 0;
+    uint64_t expired = 0;
+    uint64_t txsRequired = 0;
+    uint64_t txsFromPool = 0;
+    uint64_t blocksCompleted = 0;
+    int64_t bytesSaved = 0;
+};
+
+/**
+ * @brief       Sends BuildBlockBroadcastMsg as the block header plus the short ids of its
+ *              transactions to peers running kMinPeerVersion or later, older peers get the
+ *              full message. The receiver fills in the bodies from the transactions it has
+ *              already seen, asks the sender once for the ones it lacks and hands the rebuilt
+ *              block to the usual save and relay handlers. A block whose rebuilt merkle root or
+ *              hash does not match is requested whole from the sender.
+ */
+class CompactBlockRelay
+{
+public:
+    CompactBlockRelay() = default;
+    ~CompactBlockRelay() = default;
+    CompactBlockRelay(CompactBlockRelay &&) = delete;
+    CompactBlockRelay(const CompactBlockRelay &) = delete;
+    CompactBlockRelay &operator=(CompactBlockRelay &&) = delete;
+    CompactBlockRelay &operator=(const CompactBlockRelay &) = delete;
+
+    /**
+     * @brief       Remember a transaction so compact blocks holding it can be rebuilt locally
+     */
+    void AddTransaction(const CTransaction &tx);
+
+    /**
+     * @brief       Remember the transactions of a block seen during consensus
+     */
+    void AddBlockTransactions(const CBlock &block);
+
+    /**
+     * @brief       Send a block broadcast in compact form
+     *
+     * @param       addr: destination node
+     * @param       msg: full broadcast message
+     * @return      true    sent in compact form
+     * @return      false   the peer predates compact relay or the block could not be parsed,
+     *                      the caller sends the full message
+     */
+    bool Send(const std::string &addr, const BuildBlockBroadcastMsg &msg);
+
+    /**
+     * @brief       Whether the version a peer announced has the compact block handlers
+     *
+     * @param       version: version from the peer's node info, as "system_x.y.z_type"
+     */
+    static bool SupportsCompact(const std::string &version);
+
+    int HandleCompactBlock(const std::shared_ptr<CompactBlockBroadcastMsg> &msg, const MsgData &msgdata);
+    int HandleGetBlockTxsRequest(const std::shared_ptr<GetBlockTxsReq> &msg, const MsgData &msgdata);
+    int HandleGetBlockTxsAcknowledge(const std::shared_ptr<GetBlockTxsAck> &msg, const MsgData &msgdata);
+
+    CompactBlockRelayStats GetStats();
+
+    /**
+     * @brief       Short id of a transaction: the leading 8 bytes of its hash
+     */
+    static uint64_t ShortId(const std::string &txHash);
+
+    static constexpr size_t kPoolCapacity = 65536;
+    static constexpr size_t kRecentBlockCapacity = 64;
+    static constexpr uint64_t kRetryAfterSec = 3;
+    static constexpr uint64_t kPendingTimeoutSec = 30;
+    // First release with CompactBlockBroadcastMsg and GetBlockTxsReq/Ack
+    static constexpr const char *kMinPeerVersion = "0.0.1";
+
+private:
+    struct Waiter
+    {
+        std::shared_ptr<CompactBlockBroadcastMsg> msg;
+        MsgData from;
+    };
+
+    struct Pending
+    {
+        CBlock header;
+        std::vector<CTransaction> txs;
+        std::vector<char> present;
+        std::vector<Waiter> waiters;
+        uint64_t requestedAt = 0;
+        int64_t transferBytes = 0;
+        bool wholeBlockRequested = false;
+    };
+
+    struct RecentBlock
+    {
+        std::string raw;
+        std::string header;
+        std::vector<uint64_t> shortIds;
+    };
+
+    bool lookupTransaction(uint64_t shortId, CTransaction &tx);
+    bool rebuild(const Pending &pending, std::string &blockRaw);
+    void requestTxs(const MsgData &from, const std::string &blockHash, const std::vector<uint32_t> &indexes);
+    void complete(const std::string &blockHash, const std::string &blockRaw, std::vector<Waiter> waiters, int64_t transferBytes);
+    void rememberBlock(const std::string &blockHash, RecentBlock block);
+    void dropExpired();
+
+    std::mutex _poolMutex;
+    std::unordered_map<uint64_t, CTransaction> _pool;
+    std::deque<uint64_t> _poolOrder;
+
+    std::mutex _blocksMutex;
+    std::map<std::string, RecentBlock> _recentBlocks;
+    std::deque<std::string> _recentOrder;
+
+    std::mutex _pendingMutex;
+    std::map<std::string, Pending> _pending;
+
+    std::mutex _statsMutex;
+    CompactBlockRelayStats _stats;
+};
+
+int handleCompactBlockBroadcastMessage(const std::shared_ptr<CompactBlockBroadcastMsg> &msg, const MsgData &msgdata);
+int handleGetBlockTxsRequest(const std::shared_ptr<GetBlockTxsReq> &msg, const MsgData &msgdata);
+int handleGetBlockTxsAcknowledge(const std::shared_ptr<GetBlockTxsAck> &msg, const MsgData &msgdata);
+
+#endif
@@ -0,0 +1,131 @@
+#include "ca/contract_conflict_graph.h"
+
+#include <algorithm>
+
+void ContractConflictGraph::Add(const std::string &txKey, const std::vector<std::string> &dependencies)
+{
+    auto found = _txs.find(txKey);
+    if (found != _txs.end())
+    {
+        if (found->second.dependencies == dependencies)
+        {
+            return;
+        }
+        Remove(txKey);
+    }
+    Entry entry{newNode(), dependencies};
+    link(entry);
+    _txs.emplace(txKey, std::move(entry));
+}
+
+bool ContractConflictGraph::Remove(const std::string &txKey)
+{
+    if (_txs.erase(txKey) == 0)
+    {
+        return false;
+    }
+    ++_removed;
+    if (_removed >= kMinRebuild && _removed > _txs.size())
+    {
+        rebuild();
+    }
+    return true;
+}
+
+void ContractConflictGraph::Clear()
+{
+    _parent.clear();
+    _rank.clear();
+    _addressNodes.clear();
+    _txs.clear();
+    _removed = 0;
+}
+
+size_t ContractConflictGraph::Size() const
+{
+    return _txs.size();
+}
+
+std::vector<std::vector<std::string>> ContractConflictGraph::Components()
+{
+    std::unordered_map<uint32_t, size_t> groupOfRoot;
+    std::vector<std::vector<std::string>> groups;
+    for (const auto &[txKey, entry] : _txs)
+    {
+        auto [group, inserted] = groupOfRoot.emplace(find(entry.node), groups.size());
+        if (inserted)
+        {
+            groups.emplace_back();
+        }
+        groups[group->second].push_back(txKey);
+    }
+    for (auto &group : groups)
+    {
+        std::sort(group.begin(), group.end());
+    }
+    std::sort(groups.begin(), groups.end(), [](const auto &a, const auto &b) { return a.front() < b.front(); });
+    return groups;
+}
+
+uint32_t ContractConflictGraph::newNode()
+{
+    _parent.push_back(_parent.size());
+    _rank.push_back(0);
+    return _parent.back();
+}
+
+uint32_t ContractConflictGraph::find(uint32_t node)
+{
+    // Path halving keeps the trees flat without recursion
+    while (_parent[node] != node)
+    {
+        _parent[node] = _parent[_parent[node]];
+        node = _parent[node];
+    }
+    return node;
+}
+
+void ContractConflictGraph::unite(uint32_t a, uint32_t b)
+{
+    a = find(a);
+    b = find(b);
+    if (a == b)
+    {
+        return;
+    }
+    if (_rank[a] < _rank[b])
+    {
+        std::swap(a, b);
+    }
+    _parent[b] = a;
+    if (_rank[a] == _rank[b])
+    {
+        ++_rank[a];
+    }
+}
+
+void ContractConflictGraph::link(Entry &entry)
+{
+    for (const auto &address : entry.dependencies)
+    {
+        auto found = _addressNodes.find(address);
+        if (found == _addressNodes.end())
+        {
+            found = _addressNodes.emplace(address, newNode()).first;
+        }
+        unite(entry.node, found->second);
+    }
+}
+
+void ContractConflictGraph::rebuild()
+{
+    _parent.clear();
+    _rank.clear();
+    _addressNodes.clear();
+    _removed = 0;
+    for (auto &[_, entry] : _txs)
+    {
+        entry.node = newNode();
+        link(entry);
+    }
+}
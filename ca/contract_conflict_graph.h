@@ -0,0 +1,81 @@
+/**
+ * *****************************************************************************
+ * @file        contract_conflict_graph.h
+ * @brief       Incremental grouping of contract transactions that share dependencies
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_CONTRACT_CONFLICT_GRAPH_HEADER
+#define CA_CONTRACT_CONFLICT_GRAPH_HEADER
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief       Contract transactions and the contract addresses they depend on, joined in a union-find.
+ *              Each transaction is united with each of its addresses as it is added, so two transactions
+ *              sharing an address, directly or through others, end up in one group. Adding a transaction
+ *              costs its dependency count and grouping costs one find per transaction, instead of
+ *              comparing the dependencies of every pair of transactions.
+ *              A union cannot be undone, so a removed transaction may still join the groups it bridged
+ *              until the removals outnumber the live transactions and the graph is rebuilt. Groups may be
+ *              merged too eagerly for a while, never split too eagerly.
+ *              Not synchronized, the owner serializes access.
+ */
+class ContractConflictGraph
+{
+public:
+    ContractConflictGraph() = default;
+    ~ContractConflictGraph() = default;
+
+    /**
+     * @brief       Add a transaction, replacing its dependencies if it is already present
+     *
+     * @param       txKey: transaction key
+     * @param       dependencies: contract addresses the transaction depends on
+     */
+    void Add(const std::string &txKey, const std::vector<std::string> &dependencies);
+
+    /**
+     * @brief       Remove a transaction
+     *
+     * @return      true    it was present
+     * @return      false   it was not
+     */
+    bool Remove(const std::string &txKey);
+
+    void Clear();
+    size_t Size() const;
+
+    /**
+     * @brief       Transactions grouped by shared dependencies. Each group is sorted and the groups are
+     *              ordered by their first key, a transaction without dependencies is a group of its own.
+     */
+    std::vector<std::vector<std::string>> Components();
+
+    static constexpr size_t kMinRebuild = 1024;
+
+private:
+    struct Entry
+    {
+        uint32_t node;
+        std::vector<std::string> dependencies;
+    };
+
+    uint32_t newNode();
+    uint32_t find(uint32_t node);
+    void unite(uint32_t a, uint32_t b);
+    void link(Entry &entry);
+    void rebuild();
+
+    std::vector<uint32_t> _parent;
+    std::vector<uint32_t> _rank;
+    std::unordered_map<std::string, uint32_t> _addressNodes;
+    std::unordered_map<std::string, Entry> _txs;
+    size_t _removed = 0;
+};
+
+#endif
@@ -1,8 +1,16 @@
 #include "ca/dispatchtx.h"
+#include "ca/contract_conflict_graph.h"
 #include "include/logging.h"
 #include "net.pb.h"
 #include "net/peer_node.h"
 
+namespace
+{
+    // Groups of contract_dep_cache_, kept up to date as dependencies arrive and guarded by dep_mutex_.
+    // Held here rather than in DependencyManager so the class layout is unchanged.
+    ContractConflictGraph contractGroups;
+}
+
 ContractDispatcher::ContractDispatcher() = default;
 
 ContractDispatcher::~ContractDispatcher() = default;
@@ -26,6 +34,7 @@ void ContractDispatcher::SetTimeValue(const uint64_t& new_value) {
 void DependencyManager::AddContractInfo(const std::string& contract_hash, const std::vector<std::string>& dependent_contracts) {
     std::unique_lock<std::mutex> locker(dep_mutex_);
     contract_dep_cache_[contract_hash] = dependent_contracts;
+    contractGroups.Add(contract_hash, dependent_contracts);
 
     locker.unlock();
     BroadcastAddedDependency(contract_hash, dependent_contracts);
@@ -38,46 +47,20 @@ void DependencyManager::AddMessageRequest(const std::string& contract_hash, cons
 }
 
 std::vector<std::vector<TxMsgReq>> DependencyManager::GetDependentData() {
-    std::unique_lock<std::mutex> msg_lock(msg_mutex_);
-    const auto& msg_cache = contract_msg_cache_;
-    msg_lock.unlock();
-
     DEBUGLOG("Gathering dependent data");
-    std::vector<std::set<std::string>> grouped_deps;
+    std::vector<std::vector<std::string>> grouped_deps;
     {
         std::unique_lock<std::mutex> dep_lock(dep_mutex_);
-        for (const auto& [key, values] : contract_dep_cache_) {
-            std::set<std::string> common_keys{key};
-            for (const auto& [other_key, other_values] : contract_dep_cache_) {
-                if (key == other_key) continue;
-                if (HasDuplicate(values, other_values)) {
-                    common_keys.insert(other_key);
-                }
-            }
-            if (!common_keys.empty()) {
-                bool found = false;
-                for (auto& item_set : grouped_deps) {
-                    std::set<std::string> intersection;
-                    std::set_intersection(item_set.begin(), item_set.end(), common_keys.begin(), common_keys.end(),
-                                          std::inserter(intersection, intersection.begin()));
-                    if (!intersection.empty()) {
-                        item_set.insert(common_keys.begin(), common_keys.end());
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    grouped_deps.push_back(common_keys);
-                }
-            }
-        }
+        grouped_deps = contractGroups.Components();
     }
+
+    std::unique_lock<std::mutex> msg_lock(msg_mutex_);
     std::vector<std::vector<TxMsgReq>> grouped_msgs;
     for (const auto& hash_container : grouped_deps) {
         std::vector<TxMsgReq> msg_vec;
         for (const auto& hash : hash_container) {
-            auto it = msg_cache.find(hash);
-            if (it != msg_cache.end()) {
+            auto it = contract_msg_cache_.find(hash);
+            if (it != contract_msg_cache_.end()) {
                 msg_vec.push_back(it->second);
             }
         }
@@ -280,6 +263,7 @@ void TimerProcessor::ProcessingFunc() {
 void DependencyManager::ClearCaches() {
     std::scoped_lock lock(dep_mutex_, msg_mutex_);
     contract_dep_cache_.clear();
+    contractGroups.Clear();
     contract_msg_cache_.clear();
 }
 
@@ -1,96 +1,195 @@
 #include "ca/double_spend_cache.h"
 
-int doubleSpendCache::AddFromAddr(const std::pair<std::string,doubleSpendCache::doubleSpendSuccess> &usings)
+#include <array>
+#include <unordered_map>
+
+namespace
 {
-    std::unique_lock<std::mutex> lck(doubleSpendMutex);
-	auto it =  _pending.find(usings.first);
-	if(it != _pending.end())
+	const uint64_t kExpireTime = (uint64_t)1000000 * 30;
+	const size_t kWheelSlots = 64;
+
+	struct Spend
 	{
-		std::vector<std::string> usingUtxo(usings.second.utxoVector.begin(), usings.second.utxoVector.end());
-		std::vector<std::string> pendingUtxos(it->second.utxoVector.begin(), it->second.utxoVector.end());
-		std::sort(usingUtxo.begin(),usingUtxo.end());
-		std::sort(pendingUtxos.begin(),pendingUtxos.end());
+		std::string fromAddr;
+		uint64_t time;
+		std::vector<std::string> keys;
+	};
 
-		std::vector<std::string> vIntersection;
-		std::set_intersection(usingUtxo.begin(), usingUtxo.end(), pendingUtxos.begin(), pendingUtxos.end(), std::back_inserter(vIntersection));
+	// Utxos being spent by transactions submitted through the rpc, until their block is saved or kExpireTime
+	// passes. Every utxo is keyed by its from address so a conflict or a block input is one hash probe, and
+	// spends sit in a timing wheel slot of their expiry second so the periodic check only visits the slots
+	// that came due. Guarded by doubleSpendMutex of the singleton, kept out of the class so its layout stays
+	// the one the prebuilt libraries inline.
+	struct PendingSpends
+	{
+		// From address and utxo to the spend using it
+		std::unordered_map<std::string, uint64_t> spentBy;
+		std::unordered_map<uint64_t, Spend> spends;
+		// Spend ids by the second they expire in, modulo kWheelSlots
+		std::array<std::vector<uint64_t>, kWheelSlots> wheel;
+		uint64_t wheelSecond = 0;
+		uint64_t nextSpendId = 0;
 
-		for(auto & diff : vIntersection)
-		{
-			ERRORLOG("utxo:{} is using!",diff);
-			std::cout << "utxo:" << diff << "is using!\n";
-			return -1;
-		}
+		void insert(uint64_t spendId);
+		void erase(uint64_t spendId);
+		void advance(uint64_t nowSecond);
+	};
+	PendingSpends pendingSpends;
 
-	}else{
-		_pending.insert(usings);
+	std::string key(const std::string &fromAddr, const std::string &utxo)
+	{
+		return fromAddr + "|" + utxo;
 	}
-
-	return 0;
 }
 
-
-void doubleSpendCache::Remove(const uint64_t& txTimeKey)
+int doubleSpendCache::AddFromAddr(const std::pair<std::string,doubleSpendCache::doubleSpendSuccess> &usings)
 {
-
-	for(auto iter = _pending.begin(); iter != _pending.end();)
+    std::unique_lock<std::mutex> lck(doubleSpendMutex);
+	for(const auto & utxo : usings.second.utxoVector)
 	{
-		if (iter->second.time == txTimeKey)
+		if(pendingSpends.spentBy.find(key(usings.first, utxo)) != pendingSpends.spentBy.end())
 		{
-			iter = _pending.erase(iter);
+			ERRORLOG("utxo:{} is using!",utxo);
+			std::cout << "utxo:" << utxo << "is using!\n";
+			return -1;
 		}
-		else
+	}
+
+	uint64_t spendId = pendingSpends.nextSpendId++;
+	Spend & spend = pendingSpends.spends[spendId];
+	spend.fromAddr = usings.first;
+	spend.time = usings.second.time;
+	for(const auto & utxo : usings.second.utxoVector)
+	{
+		std::string utxoKey = key(usings.first, utxo);
+		if(pendingSpends.spentBy.emplace(utxoKey, spendId).second)
 		{
-			iter++;
+			spend.keys.push_back(std::move(utxoKey));
 		}
-	}  
-	
+	}
+	pendingSpends.insert(spendId);
+	return 0;
 }
 
-void doubleSpendCache::CheckLoop()
+
+void doubleSpendCache::Remove(const uint64_t& txTimeKey)
 {
-	std::unique_lock<std::mutex> lck(doubleSpendMutex);
 	std::vector<uint64_t> toRemove;
-	for(auto & item : _pending)
+	for(const auto & [spendId, spend] : pendingSpends.spends)
 	{
-	    const int64_t kTenSecond = (int64_t)1000000 * 30;
-		uint64_t time = MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp();
-		if(item.second.time + kTenSecond < time)
+		if (spend.time == txTimeKey)
 		{
-			toRemove.push_back(item.second.time);
+			toRemove.push_back(spendId);
 		}
 	}
-
-	for(auto & txTimeKey: toRemove)
+	for(auto spendId : toRemove)
 	{
-		Remove(txTimeKey);
+		pendingSpends.erase(spendId);
 	}
 }
 
+void doubleSpendCache::CheckLoop()
+{
+	std::unique_lock<std::mutex> lck(doubleSpendMutex);
+	pendingSpends.advance(MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp() / 1000000);
+}
+
 
 
 void doubleSpendCache::Detection(const CBlock & block)
 {
 	std::unique_lock<std::mutex> lck(doubleSpendMutex);
-	std::vector<uint64_t> toRemove;
+	if(pendingSpends.spends.empty())
+	{
+		return;
+	}
 	for(auto & tx : block.txs())
 	{	
 		for(const auto & utxo: tx.utxos())
 		{
-			if(!utxo.owner().empty())
+			if(utxo.owner().empty())
 			{
-			auto it = _pending.find(utxo.owner(0));
-			if(it != _pending.end() && tx.time() == it->second.time)
-			{	
-				toRemove.push_back(it->second.time);
-				DEBUGLOG("Remove pending txhash : {}",tx.hash());
-				break;
+				continue;
 			}
+			for(const auto & vin : utxo.vin())
+			{
+				for(const auto & prevout : vin.prevout())
+				{
+					auto it = pendingSpends.spentBy.find(key(utxo.owner(0), utxo.assettype() + "_" + prevout.hash()));
+					if(it == pendingSpends.spentBy.end())
+					{
+						continue;
+					}
+					auto spend = pendingSpends.spends.find(it->second);
+					if(spend != pendingSpends.spends.end() && tx.time() == spend->second.time)
+					{
+						DEBUGLOG("Remove pending txhash : {}",tx.hash());
+						pendingSpends.erase(it->second);
+					}
+				}
 			}
 		}
 	}
+}
+
+void PendingSpends::insert(uint64_t spendId)
+{
+	const Spend & spend = spends.at(spendId);
+	if(wheelSecond == 0)
+	{
+		wheelSecond = MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp() / 1000000;
+	}
+	// Past expiries go to the next slot and far ones to the last, where they are inserted again when due
+	uint64_t expireSecond = (spend.time + kExpireTime) / 1000000;
+	expireSecond = std::min(std::max(expireSecond, wheelSecond + 1), wheelSecond + kWheelSlots);
+	wheel[expireSecond % kWheelSlots].push_back(spendId);
+}
+
+void PendingSpends::erase(uint64_t spendId)
+{
+	auto found = spends.find(spendId);
+	if(found == spends.end())
+	{
+		return;
+	}
+	for(const auto & utxoKey : found->second.keys)
+	{
+		spentBy.erase(utxoKey);
+	}
+	// Its wheel entry is skipped when the slot comes due
+	spends.erase(found);
+}
 
-	for(auto & txTimeKey: toRemove)
+void PendingSpends::advance(uint64_t nowSecond)
+{
+	if(wheelSecond == 0 || nowSecond + kWheelSlots < wheelSecond)
 	{
-		Remove(txTimeKey);
+		wheelSecond = nowSecond;
+		return;
 	}
-}
\ No newline at end of file
+	// After a long pause every slot is due once
+	uint64_t second = std::max(wheelSecond, nowSecond > kWheelSlots ? nowSecond - kWheelSlots : 0);
+	while(second < nowSecond)
+	{
+		++second;
+		wheelSecond = second;
+		std::vector<uint64_t> due;
+		due.swap(wheel[second % kWheelSlots]);
+		for(auto spendId : due)
+		{
+			auto spend = spends.find(spendId);
+			if(spend == spends.end())
+			{
+				continue;
+			}
+			if(spend->second.time + kExpireTime < nowSecond * 1000000)
+			{
+				erase(spendId);
+			}
+			else
+			{
+				insert(spendId);
+			}
+		}
+	}
+}
@@ -0,0 +1,146 @@
+#include "contract_payload.h"
+
+#include <evmc/hex.hpp>
+#include <nlohmann/json.hpp>
+
+#include "evm_manager.h"
+#include "ca/global.h"
+#include "include/logging.h"
+#include "utils/account_manager.h"
+#include "utils/magic_singleton.h"
+
+namespace
+{
+    // The payload only depends on the transaction type and data, the claimed transaction hash is not trusted
+    std::string payloadKey(const CTransaction &transaction)
+    {
+        return Getsha256hash(std::to_string(transaction.txtype()) + "_" + transaction.data());
+    }
+}
+
+int contract_payload::Decode(const CTransaction &transaction, ContractPayload &payload)
+{
+    auto txType = (global::ca::TxType)transaction.txtype();
+    if (txType != global::ca::TxType::TX_TYPE_INVOKE_CONTRACT && txType != global::ca::TxType::kTransactionTypeDeploy)
+    {
+        return -3;
+    }
+
+    try
+    {
+        nlohmann::json dataJson = nlohmann::json::parse(transaction.data());
+        nlohmann::json txInfo = dataJson["TxInfo"].get<nlohmann::json>();
+
+        if (txInfo.find(Evmone::contractSenderKeyName_) != txInfo.end())
+        {
+            payload.sender = txInfo[Evmone::contractSenderKeyName_].get<std::string>();
+        }
+        if (txInfo.find(Evmone::contractDeployerKeyAlias) != txInfo.end())
+        {
+            payload.deployer = txInfo[Evmone::contractDeployerKeyAlias].get<std::string>();
+        }
+        auto vmType = txInfo[Evmone::contractVmKeyName].get<global::ca::VmType>();
+        payload.vmType = vmType;
+
+        auto input = evmc::from_hex(txInfo[Evmone::contract_input_key_name].get<std::string>());
+        if (!input.has_value())
+        {
+            ERRORLOG("contract input is not hex, tx {}", transaction.hash());
+            return -2;
+        }
+        payload.input.assign(reinterpret_cast<const char *>(input->data()), input->size());
+
+        if (txType == global::ca::TxType::TX_TYPE_INVOKE_CONTRACT)
+        {
+            if (txInfo.find("CallType") != txInfo.end())
+            {
+                payload.callType = txInfo["CallType"].get<std::string>();
+            }
+            if (txInfo.find("transmitFlowMessage") != txInfo.end())
+            {
+                payload.transmitFlowMessage = txInfo["transmitFlowMessage"].get<std::string>();
+            }
+            if (vmType == global::ca::VmType::EVM)
+            {
+                payload.transfer = txInfo[Evmone::contractTransferKeyLabel].get<uint64_t>();
+                payload.recipient = txInfo[Evmone::contractRecipientKeyNameStr].get<std::string>();
+            }
+        }
+        else
+        {
+            payload.recipient = txInfo[Evmone::contractRecipientKeyNameStr].get<std::string>();
+        }
+
+        payload.blockTimestamp = txInfo.value(Evmone::contract_block_timestamp_key_name, (int64_t)-1);
+        payload.blockPrevRandao = txInfo.value(Evmone::contractBlockPrevRandaoKey, (int64_t)-1);
+    }
+    catch (const std::exception &e)
+    {
+        ERRORLOG("json parse fail, tx {}: {}", transaction.hash(), e.what());
+        return -1;
+    }
+    return 0;
+}
+
+std::shared_ptr<const ContractPayload> contract_payload::Get(const CTransaction &transaction)
+{
+    if (auto found = MagicSingleton<ContractPayloadCache>::GetInstance()->Find(payloadKey(transaction)); found != nullptr)
+    {
+        return found;
+    }
+
+    auto payload = std::make_shared<ContractPayload>();
+    if (Decode(transaction, *payload) != 0)
+    {
+        return nullptr;
+    }
+    return payload;
+}
+
+std::shared_ptr<const ContractPayload> contract_payload::Remember(const CTransaction &transaction)
+{
+    auto cache = MagicSingleton<ContractPayloadCache>::GetInstance();
+    std::string key = payloadKey(transaction);
+    if (auto found = cache->Find(key); found != nullptr)
+    {
+        return found;
+    }
+
+    auto payload = std::make_shared<ContractPayload>();
+    if (Decode(transaction, *payload) != 0)
+    {
+        return nullptr;
+    }
+    cache->Add(key, payload);
+    return payload;
+}
+
+std::shared_ptr<const ContractPayload> ContractPayloadCache::Find(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _payloads.find(key);
+    if (found == _payloads.end())
+    {
+        return nullptr;
+    }
+    return found->second;
+}
+
+void ContractPayloadCache::Add(const std::string &key, const std::shared_ptr<const ContractPayload> &payload)
+{
+    if (key.empty())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_payloads.emplace(key, payload).second)
+    {
+        return;
+    }
+    _order.push_back(key);
+    while (_payloads.size() > kMaxEntries)
+    {
+        _payloads.erase(_order.front());
+        _order.pop_front();
+    }
+}
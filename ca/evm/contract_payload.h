@@ -0,0 +1,89 @@
+/**
+ * *****************************************************************************
+ * @file        contract_payload.h
+ * @brief       Contract transaction payload, decoded once per transaction
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_EVM_CONTRACT_PAYLOAD_HEADER
+#define CA_EVM_CONTRACT_PAYLOAD_HEADER
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "proto/transaction.pb.h"
+
+/**
+ * @brief       Fields of the json TxInfo a contract transaction carries in data()
+ */
+struct ContractPayload
+{
+    uint32_t vmType = 0;
+    std::string sender;
+    std::string recipient;
+    std::string deployer;
+    // Raw call data or deploy code, converted from hex
+    std::string input;
+    uint64_t transfer = 0;
+    std::string callType;
+    std::string transmitFlowMessage;
+    int64_t blockTimestamp = -1;
+    int64_t blockPrevRandao = -1;
+};
+
+namespace contract_payload
+{
+    /**
+     * @brief       Decode the json TxInfo of a contract transaction
+     *
+     * @param       transaction: contract transaction
+     * @param       payload: decoded payload
+     * @return      int 0 on success, negative on malformed payload
+     */
+    int Decode(const CTransaction &transaction, ContractPayload &payload);
+
+    /**
+     * @brief       The payload shared by Remember, else one decoded for this call only
+     *
+     * @param       transaction: contract transaction
+     * @return      decoded payload, nullptr if it cannot be decoded
+     */
+    std::shared_ptr<const ContractPayload> Get(const CTransaction &transaction);
+
+    /**
+     * @brief       Decode the payload and share it with later Get calls. Only for transactions that
+     *              passed verification.
+     *
+     * @param       transaction: verified contract transaction
+     * @return      decoded payload, nullptr if it cannot be decoded
+     */
+    std::shared_ptr<const ContractPayload> Remember(const CTransaction &transaction);
+}
+
+/**
+ * @brief       Bounded cache of decoded contract payloads. Keys are digests of the transaction type and
+ *              data computed locally, so a payload is only found for the bytes it was decoded from.
+ */
+class ContractPayloadCache
+{
+public:
+    ContractPayloadCache() = default;
+    ~ContractPayloadCache() = default;
+
+    std::shared_ptr<const ContractPayload> Find(const std::string &key);
+    void Add(const std::string &key, const std::shared_ptr<const ContractPayload> &payload);
+
+    static constexpr size_t kMaxEntries = 20000;
+
+private:
+    std::mutex _mutex;
+    std::list<std::string> _order;
+    std::unordered_map<std::string, std::shared_ptr<const ContractPayload>> _payloads;
+};
+
+#endif
@@ -10,6 +10,7 @@
 #include "utils/util.h"
 #include "transaction.h"
 #include "evm_manager.h"
+#include "contract_payload.h"
 #include <string>
 
 namespace
@@ -315,34 +316,24 @@ int64_t evmEnvironment::blockPrevRandaoCalculator(const std::string &from, const
 
 int64_t evmEnvironment::GetBlockTimestamp(const CTransaction &transaction)
 {
-    try
-    {
-        nlohmann::json dataJson = nlohmann::json::parse(transaction.data());
-        nlohmann::json txInfo = dataJson["TxInfo"].get<nlohmann::json>();
-
-        return txInfo[Evmone::contract_block_timestamp_key_name].get<int64_t>();
-    }
-    catch (...)
+    auto payload = contract_payload::Get(transaction);
+    if (payload == nullptr || payload->blockTimestamp < 0)
     {
         ERRORLOG("fail to get block timestamp from tx {}", transaction.hash())
         return -1;
     }
+    return payload->blockTimestamp;
 }
 
 int64_t evmEnvironment::get_block_prev_randao(const CTransaction &transaction)
 {
-    try
+    auto payload = contract_payload::Get(transaction);
+    if (payload == nullptr || payload->blockPrevRandao < 0)
     {
-        nlohmann::json dataJson = nlohmann::json::parse(transaction.data());
-        nlohmann::json txInfo = dataJson["TxInfo"].get<nlohmann::json>();
-
-        return txInfo[Evmone::contractBlockPrevRandaoKey].get<int64_t>();
-    }
-    catch (...)
-    {
-        ERRORLOG("fail to get block timestamp from tx {}", transaction.hash())
+        ERRORLOG("fail to get block prev randao from tx {}", transaction.hash())
         return -1;
     }
+    return payload->blockPrevRandao;
 }
 
 bool evmEnvironment::VerifyCoinbase(const CBlock &block, const std::string &coinbase)
@@ -354,16 +345,10 @@ bool evmEnvironment::VerifyCoinbase(const CBlock &block, const std::string &coin
 
 int64_t evmEnvironment::blockPrevRandaoCalculator(const CTransaction &transaction)
 {
-    std::string from;
-    try
-    {
-        nlohmann::json dataJson = nlohmann::json::parse(transaction.data());
-        nlohmann::json txInfo = dataJson["TxInfo"].get<nlohmann::json>();
-        from = txInfo[Evmone::contractSenderKeyName_].get<std::string>();
-    }
-    catch (const std::exception &e)
+    auto payload = contract_payload::Get(transaction);
+    if (payload == nullptr || payload->sender.empty())
     {
-        ERRORLOG("parse transaction data fail {}", e.what())
+        ERRORLOG("parse transaction data fail, tx {}", transaction.hash())
         return -1;
     }
 
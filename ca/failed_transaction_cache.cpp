@@ -2,6 +2,9 @@
 #include "db/db_api.h"
 #include "transaction.h"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
 #include "utils/tmp_log.h"
 #include "common/task_pool.h"
 #include "include/logging.h"
@@ -123,6 +126,93 @@ int failedTransactionCache::Add(uint64_t height, const TxMsgReq& msg)
 {
     DEBUGLOG("TTT NodelistHeight discontent, repeat commit tx ,NodeHeight:{}, txUtxoHeight:{}",height, msg.txmsginfo().txutxoheight());
     std::unique_lock<std::shared_mutex> lock(txPendingMutex);
+    size_t pending = 0;
+    for (const auto &[_, msgs] : _txPending)
+    {
+        pending += msgs.size();
+    }
+    if (pending >= kMaxPending)
+    {
+        DEBUGLOG("failed transaction cache full, drop tx at height:{}", height);
+        return -1;
+    }
     _txPending[height].push_back(msg);
 	return 0;
 }
+
+void RejectedTxFilter::Reject(std::string_view txBytes)
+{
+    if (txBytes.empty())
+    {
+        return;
+    }
+    _rejected.Insert(txBytes);
+    ++_rejectedCount;
+}
+
+bool RejectedTxFilter::ShouldDrop(const std::string &payload)
+{
+    std::string_view txBytes;
+    if (!FindTxBytes(payload, txBytes) || txBytes.empty())
+    {
+        return false;
+    }
+    ++_checked;
+    if (!_rejected.Contains(txBytes))
+    {
+        return false;
+    }
+    ++_dropped;
+    return true;
+}
+
+RejectedTxFilterStats RejectedTxFilter::GetStats()
+{
+    RejectedTxFilterStats stats;
+    stats.rejected = _rejectedCount;
+    stats.checked = _checked;
+    stats.dropped = _dropped;
+    stats.remembered = _rejected.Count();
+    stats.memoryBytes = _rejected.MemoryBytes();
+    stats.falsePositiveRate = _rejected.EstimatedFalsePositiveRate();
+    return stats;
+}
+
+bool RejectedTxFilter::FindTxBytes(std::string_view payload, std::string_view &txBytes)
+{
+    using google::protobuf::internal::WireFormatLite;
+    // TxMsgReq.txMsgInfo and TxMsgInfo.tx are both field 2
+    constexpr int kFieldNumber = 2;
+
+    std::string_view message = payload;
+    for (int depth = 0; depth < 2; ++depth)
+    {
+        google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t *>(message.data()), message.size());
+        bool found = false;
+        while (uint32_t tag = input.ReadTag())
+        {
+            if (WireFormatLite::GetTagFieldNumber(tag) == kFieldNumber
+                && WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+            {
+                uint32_t length = 0;
+                if (!input.ReadVarint32(&length) || length > message.size() - input.CurrentPosition())
+                {
+                    return false;
+                }
+                message = message.substr(input.CurrentPosition(), length);
+                found = true;
+                break;
+            }
+            if (!WireFormatLite::SkipField(&input, tag))
+            {
+                return false;
+            }
+        }
+        if (!found)
+        {
+            return false;
+        }
+    }
+    txBytes = message;
+    return true;
+}
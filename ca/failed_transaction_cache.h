@@ -9,11 +9,14 @@
 #ifndef TRAN_STORAGE
 #define TRAN_STORAGE
 
+#include <atomic>
 #include <map>
+#include <string_view>
 #include <unistd.h>
 #include <shared_mutex>
 
 #include "utils/timer.hpp"
+#include "utils/rotating_bloom_filter.h"
 #include "ca/txhelper.h"
 #include "ca/transaction_cache.h"
 #include "proto/transaction.pb.h"
@@ -34,13 +37,15 @@ public:
 
 public:
     /**
-     * @brief       
+     * @brief       Hold a transaction to resend once most peers reach its height
      * 
-     * @param       height: 
-     * @param       msg: 
-     * @return      int 
+     * @param       height: height the peers are waiting for
+     * @param       msg: transaction message
+     * @return      int return 0 success, -1 kMaxPending transactions are already held
      */
 	int Add(uint64_t height,const TxMsgReq& msg);
+
+    static constexpr size_t kMaxPending = 10000;
     
     /**
      * @brief       
@@ -73,4 +78,74 @@ private:
 	CTimer _timer;
 };
 
+/**
+ * @brief       Counters of the rejected transaction filter
+ */
+struct RejectedTxFilterStats
+{
+    uint64_t rejected = 0;
+    uint64_t checked = 0;
+    uint64_t dropped = 0;
+    size_t remembered = 0;
+    size_t memoryBytes = 0;
+    double falsePositiveRate = 0;
+};
+
+/**
+ * @brief       Transactions that failed a check that only depends on their bytes, kept in a rotating
+ *              bloom filter so the memory is fixed however many are sent. The dispatcher looks up the
+ *              transaction bytes of a TxMsgReq before the message is parsed, and drops a re-broadcast of
+ *              a rejected transaction without parsing or verifying it again. A transaction is remembered
+ *              for one to two generations of kSpanSec. Unrelated transactions are dropped at about the
+ *              reported false positive rate, the sender's resend after the next rotation goes through.
+ */
+class RejectedTxFilter
+{
+public:
+    RejectedTxFilter() = default;
+    ~RejectedTxFilter() = default;
+    RejectedTxFilter(RejectedTxFilter &&) = delete;
+    RejectedTxFilter(const RejectedTxFilter &) = delete;
+    RejectedTxFilter &operator=(RejectedTxFilter &&) = delete;
+    RejectedTxFilter &operator=(const RejectedTxFilter &) = delete;
+
+    /**
+     * @brief       Remember a rejected transaction
+     * 
+     * @param       txBytes: serialized transaction, as carried in TxMsgInfo.tx
+     */
+    void Reject(std::string_view txBytes);
+
+    /**
+     * @brief       Check a serialized TxMsgReq
+     * 
+     * @param       payload: serialized TxMsgReq
+     * @return      true    the transaction it carries was rejected, drop it
+     * @return      false   unknown, or the payload carries no transaction
+     */
+    bool ShouldDrop(const std::string &payload);
+
+    RejectedTxFilterStats GetStats();
+
+    /**
+     * @brief       Find TxMsgInfo.tx in a serialized TxMsgReq by walking the wire format
+     * 
+     * @param       payload: serialized TxMsgReq
+     * @param       txBytes: view into payload
+     * @return      true    found
+     * @return      false   absent or malformed
+     */
+    static bool FindTxBytes(std::string_view payload, std::string_view &txBytes);
+
+    static constexpr size_t kCapacity = 100000;
+    static constexpr double kFalsePositiveRate = 0.0001;
+    static constexpr uint64_t kSpanSec = 600;
+
+private:
+    RotatingBloomFilter _rejected{kCapacity, kFalsePositiveRate, std::chrono::seconds(kSpanSec)};
+    std::atomic<uint64_t> _rejectedCount{0};
+    std::atomic<uint64_t> _checked{0};
+    std::atomic<uint64_t> _dropped{0};
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,369 @@
+#include "ca/header_first_sync.h"
+
+#include <algorithm>
+#include <deque>
+#include <future>
+
+#include "ca/block_helper.h"
+#include "ca/sync_block.h"
+#include "db/db_api.h"
+#include "include/logging.h"
+#include "common/global_data.h"
+#include "utils/account_manager.h"
+
+namespace
+{
+    // Local blocks this far below the chain height are final, disagreeing with them needs the rollback path
+    const uint64_t kStableDepth = 10;
+
+    struct Chunk
+    {
+        std::vector<std::string> hashes;
+        uint32_t attempts = 0;
+    };
+
+    struct ChunkResult
+    {
+        std::vector<CBlock> blocks;
+        uint64_t rejected = 0;
+    };
+
+    bool isAgreed(size_t received, size_t hits)
+    {
+        if (received <= 10)
+        {
+            return SyncBlock::checkByzantineFault(received, hits);
+        }
+        return hits >= received * 0.66;
+    }
+}
+
+void HeaderFirstSync::MakeSummary(const CBlock &block, SyncBlockSummary &summary)
+{
+    summary.set_height(block.height());
+    summary.set_hash(block.hash());
+    summary.set_prev_hash(block.prevhash());
+    summary.set_merkle_root(block.merkleroot());
+    std::vector<std::string> signers;
+    for (const auto &sign : block.sign())
+    {
+        signers.push_back(sign.pub());
+    }
+    std::sort(signers.begin(), signers.end());
+    for (auto &signer : signers)
+    {
+        summary.add_signers(std::move(signer));
+    }
+}
+
+bool HeaderFirstSync::MatchesSummary(const CBlock &block, const SyncBlockSummary &summary)
+{
+    SyncBlockSummary own;
+    MakeSummary(block, own);
+    if (own.SerializeAsString() != summary.SerializeAsString())
+    {
+        return false;
+    }
+    return blockMatchesHeader(block);
+}
+
+int HeaderFirstSync::Run(const std::vector<std::string> &nodeIds, uint64_t startHeight, uint64_t endHeight, uint64_t chainHeight,
+                         std::map<uint64_t, std::set<CBlock, BlockComparator>> &blocks)
+{
+    std::lock_guard<std::mutex> runLock(_runMutex);
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.runs;
+    }
+    auto fallback = [this](int ret) {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.fallbacks;
+        return ret;
+    };
+
+    std::map<std::string, Agreed> agreed;
+    int ret = collectSummaries(nodeIds, startHeight, endHeight, agreed);
+    if (ret != 0)
+    {
+        return fallback(ret);
+    }
+
+    std::set<uint64_t> agreedHeights;
+    for (const auto &[hash, entry] : agreed)
+    {
+        agreedHeights.insert(entry.summary.height());
+    }
+
+    DBReader dbReader;
+    uint64_t top = 0;
+    if (DBStatus::DB_SUCCESS != dbReader.getBlockTop(top))
+    {
+        ERRORLOG("getBlockTop fail");
+        return fallback(-3);
+    }
+    std::set<std::string> localHashes;
+    for (uint64_t height = startHeight; height <= std::min(endHeight, top); ++height)
+    {
+        std::vector<std::string> hashes;
+        if (DBStatus::DB_SUCCESS != dbReader.getBlockHashsByBlockHeight(height, hashes))
+        {
+            ERRORLOG("getBlockHashsByBlockHeight fail, height:{}", height);
+            return fallback(-3);
+        }
+        for (auto &hash : hashes)
+        {
+            if (agreed.find(hash) == agreed.end() && agreedHeights.count(height) != 0 && height + kStableDepth < chainHeight)
+            {
+                DEBUGLOG("local block {} at height {} is not in the agreed set", hash.substr(0, 6), height);
+                return fallback(-2);
+            }
+            localHashes.insert(std::move(hash));
+        }
+    }
+
+    std::map<std::string, Agreed> missing;
+    for (auto &[hash, entry] : agreed)
+    {
+        if (localHashes.find(hash) == localHashes.end())
+        {
+            missing.emplace(hash, std::move(entry));
+        }
+    }
+    INFOLOG("header first sync {}-{}: {} agreed, {} to download", startHeight, endHeight, agreed.size(), missing.size());
+    if (missing.empty())
+    {
+        return 0;
+    }
+
+    std::vector<CBlock> bodies;
+    if (!fetchBodies(missing, bodies))
+    {
+        // Hash sync downloads the whole range again, handing over the partial set would save those blocks twice
+        DEBUGLOG("header first sync {}-{}: discard {} downloaded bodies", startHeight, endHeight, bodies.size());
+        return fallback(-4);
+    }
+    for (auto &block : bodies)
+    {
+        blocks[block.height()].insert(std::move(block));
+    }
+    return 0;
+}
+
+HeaderFirstSyncStats HeaderFirstSync::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+int HeaderFirstSync::collectSummaries(const std::vector<std::string> &nodeIds, uint64_t startHeight, uint64_t endHeight,
+                                      std::map<std::string, Agreed> &agreed)
+{
+    std::string msgId;
+    size_t sendNum = nodeIds.size();
+    if (!dataMgrPtr.CreateWait(kSummaryTimeoutSec, sendNum * 0.8, msgId, "syncGetBlockSummary"))
+    {
+        return -1;
+    }
+    for (const auto &nodeId : nodeIds)
+    {
+        if (!dataMgrPtr.AddResNode(msgId, nodeId))
+        {
+            ERRORLOG("header first sync AddResNode error");
+            return -1;
+        }
+        sendSyncGetBlockSummaryRequest(nodeId, msgId, startHeight, endHeight);
+    }
+    std::vector<std::string> retDatas;
+    if (!dataMgrPtr.WaitData(msgId, retDatas) && retDatas.size() < sendNum * 0.5)
+    {
+        // Nodes that predate summaries never answer, the caller falls back to hash sync
+        DEBUGLOG("wait block summaries time out send:{} recv:{}", sendNum, retDatas.size());
+        return -1;
+    }
+
+    // Votes are cast on the whole summary, so nodes that agree on the hash but not on the signers do not add up
+    std::map<std::string, Agreed> votes;
+    size_t received = 0;
+    SyncGetBlockSummaryAck ack;
+    for (const auto &retData : retDatas)
+    {
+        ack.Clear();
+        if (!ack.ParseFromString(retData))
+        {
+            continue;
+        }
+        ++received;
+        std::set<std::string> voted;
+        for (const auto &summary : ack.summaries())
+        {
+            if (summary.height() < startHeight || summary.height() > endHeight)
+            {
+                continue;
+            }
+            std::string key = summary.SerializeAsString();
+            if (!voted.insert(key).second)
+            {
+                continue;
+            }
+            auto &vote = votes[key];
+            vote.summary = summary;
+            vote.nodes.push_back(ack.self_node_id());
+        }
+    }
+    if (received == 0)
+    {
+        return -1;
+    }
+
+    uint64_t disputed = 0;
+    for (auto &[key, vote] : votes)
+    {
+        if (isAgreed(received, vote.nodes.size()))
+        {
+            agreed.emplace(vote.summary.hash(), std::move(vote));
+        }
+        else
+        {
+            ++disputed;
+        }
+    }
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _stats.agreedBlocks += agreed.size();
+    _stats.disputedSummaries += disputed;
+    return 0;
+}
+
+bool HeaderFirstSync::fetchBodies(const std::map<std::string, Agreed> &missing, std::vector<CBlock> &bodies)
+{
+    std::vector<const std::pair<const std::string, Agreed> *> ordered;
+    for (const auto &entry : missing)
+    {
+        ordered.push_back(&entry);
+    }
+    std::sort(ordered.begin(), ordered.end(), [](auto a, auto b){ return a->second.summary.height() < b->second.summary.height(); });
+
+    std::deque<Chunk> chunks;
+    for (size_t i = 0; i < ordered.size(); i += kBlocksPerRequest)
+    {
+        Chunk chunk;
+        for (size_t j = i; j < std::min(ordered.size(), i + kBlocksPerRequest); ++j)
+        {
+            chunk.hashes.push_back(ordered[j]->first);
+        }
+        chunks.push_back(std::move(chunk));
+    }
+
+    auto fetchChunk = [&missing](const std::string nodeId, const std::vector<std::string> hashes) -> ChunkResult {
+        ChunkResult result;
+        std::map<uint64_t, FastSyncBlockHashs> byHeight;
+        for (const auto &hash : hashes)
+        {
+            uint64_t height = missing.at(hash).summary.height();
+            byHeight[height].set_height(height);
+            byHeight[height].add_hashs(hash);
+        }
+        std::vector<FastSyncBlockHashs> requestHashs;
+        for (auto &[height, heightHashes] : byHeight)
+        {
+            requestHashs.push_back(std::move(heightHashes));
+        }
+
+        std::string msgId;
+        if (!dataMgrPtr.CreateWait(kBodyTimeoutSec, 1, msgId, "syncGetBlockBody") || !dataMgrPtr.AddResNode(msgId, nodeId))
+        {
+            return result;
+        }
+        sendFastSyncGetBlockRequest(nodeId, msgId, requestHashs);
+        std::vector<std::string> retDatas;
+        if (!dataMgrPtr.WaitData(msgId, retDatas) || retDatas.empty())
+        {
+            DEBUGLOG("wait block bodies from {} fail", nodeId);
+            return result;
+        }
+
+        FastSyncGetBlockAck ack;
+        if (!ack.ParseFromString(retDatas.at(0)))
+        {
+            return result;
+        }
+        CBlock block;
+        for (const auto &heightBlocks : ack.blocks())
+        {
+            for (const auto &blockRaw : heightBlocks.blocks())
+            {
+                if (!block.ParseFromString(blockRaw))
+                {
+                    ++result.rejected;
+                    continue;
+                }
+                auto found = missing.find(block.hash());
+                if (found == missing.end() || !MatchesSummary(block, found->second.summary))
+                {
+                    ++result.rejected;
+                    continue;
+                }
+                result.blocks.push_back(block);
+            }
+        }
+        return result;
+    };
+
+    std::set<std::string> fetched;
+    uint64_t rejected = 0;
+    bool complete = true;
+    size_t round = 0;
+    while (!chunks.empty())
+    {
+        std::vector<std::pair<Chunk, std::future<ChunkResult>>> inflight;
+        while (!chunks.empty() && inflight.size() < kMaxParallelRequests)
+        {
+            Chunk chunk = std::move(chunks.front());
+            chunks.pop_front();
+            // Rotate over the nodes that vouched for the chunk so retries and neighbouring chunks hit different nodes
+            const auto &nodes = missing.at(chunk.hashes.front()).nodes;
+            std::string nodeId = nodes[(round + inflight.size() + chunk.attempts) % nodes.size()];
+            auto future = std::async(std::launch::async, fetchChunk, nodeId, chunk.hashes);
+            inflight.emplace_back(std::move(chunk), std::move(future));
+        }
+        ++round;
+
+        for (auto &[chunk, future] : inflight)
+        {
+            ChunkResult result = future.get();
+            rejected += result.rejected;
+            for (auto &block : result.blocks)
+            {
+                if (fetched.insert(block.hash()).second)
+                {
+                    bodies.push_back(std::move(block));
+                }
+            }
+
+            Chunk retry;
+            retry.attempts = chunk.attempts + 1;
+            for (const auto &hash : chunk.hashes)
+            {
+                if (fetched.find(hash) == fetched.end())
+                {
+                    retry.hashes.push_back(hash);
+                }
+            }
+            if (retry.hashes.empty())
+            {
+                continue;
+            }
+            if (retry.attempts >= kMaxAttempts)
+            {
+                ERRORLOG("{} agreed blocks could not be downloaded, first {}", retry.hashes.size(), retry.hashes.front().substr(0, 6));
+                complete = false;
+                continue;
+            }
+            chunks.push_back(std::move(retry));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _stats.fetchedBlocks += bodies.size();
+    _stats.rejectedBodies += rejected;
+    return complete;
+}
@@ -0,0 +1,113 @@
+/**
+ * *****************************************************************************
+ * @file        header_first_sync.h
+ * @brief       Fast sync that agrees on block summaries before downloading bodies
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_HEADER_FIRST_SYNC_HEADER
+#define CA_HEADER_FIRST_SYNC_HEADER
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ca/block_compare.h"
+#include "proto/block.pb.h"
+#include "proto/sync_block.pb.h"
+
+/**
+ * @brief       Counters of header first sync
+ */
+struct HeaderFirstSyncStats
+{
+    uint64_t runs = 0;
+    uint64_t fallbacks = 0;
+    uint64_t agreedBlocks = 0;
+    uint64_t disputedSummaries = 0;
+    uint64_t fetchedBlocks = 0;
+    uint64_t rejectedBodies = 0;
+};
+
+/**
+ * @brief       Fast sync in two phases. Every sync node sends compact summaries
+ *              (hash, previous hash, merkle root, signers) of the range; a summary
+ *              is accepted once enough nodes reported it. Bodies of the accepted
+ *              blocks missing locally are then fetched in parallel from the nodes that
+ *              vouched for them and each body is checked against its summary, so a
+ *              byzantine node costs a summary, not a block download.
+ */
+class HeaderFirstSync
+{
+public:
+    HeaderFirstSync() = default;
+    ~HeaderFirstSync() = default;
+    HeaderFirstSync(HeaderFirstSync &&) = delete;
+    HeaderFirstSync(const HeaderFirstSync &) = delete;
+    HeaderFirstSync &operator=(HeaderFirstSync &&) = delete;
+    HeaderFirstSync &operator=(const HeaderFirstSync &) = delete;
+
+    /**
+     * @brief       Sync the height range through summaries first
+     *
+     * @param       nodeIds: sync nodes
+     * @param       startHeight: first height
+     * @param       endHeight: last height
+     * @param       chainHeight: current chain height
+     * @param       blocks: verified bodies of the agreed blocks missing locally, by height, only filled on success
+     * @return      int return 0 success,
+     *                  -1 too few nodes answered the summary request,
+     *                  -2 the local chain holds a stable block outside the agreed set,
+     *                  -3 database error,
+     *                  -4 some agreed bodies could not be downloaded
+     */
+    int Run(const std::vector<std::string> &nodeIds, uint64_t startHeight, uint64_t endHeight, uint64_t chainHeight,
+            std::map<uint64_t, std::set<CBlock, BlockComparator>> &blocks);
+
+    HeaderFirstSyncStats GetStats();
+
+    /**
+     * @brief       Build the summary of a block
+     *
+     * @param       block: block
+     * @param       summary: summary, signers sorted
+     */
+    static void MakeSummary(const CBlock &block, SyncBlockSummary &summary);
+
+    /**
+     * @brief       Check a downloaded body against its agreed summary
+     *
+     * @param       block: downloaded block
+     * @param       summary: agreed summary
+     * @return      true    the body matches
+     * @return      false   it does not
+     */
+    static bool MatchesSummary(const CBlock &block, const SyncBlockSummary &summary);
+
+    static constexpr uint32_t kSummaryTimeoutSec = 10;
+    static constexpr uint32_t kBodyTimeoutSec = 30;
+    static constexpr size_t kBlocksPerRequest = 100;
+    static constexpr size_t kMaxParallelRequests = 8;
+    static constexpr uint32_t kMaxAttempts = 3;
+
+private:
+    struct Agreed
+    {
+        SyncBlockSummary summary;
+        std::vector<std::string> nodes;
+    };
+
+    int collectSummaries(const std::vector<std::string> &nodeIds, uint64_t startHeight, uint64_t endHeight,
+                         std::map<std::string, Agreed> &agreed);
+    bool fetchBodies(const std::map<std::string, Agreed> &missing, std::vector<CBlock> &bodies);
+
+    std::mutex _runMutex;
+    std::mutex _statsMutex;
+    HeaderFirstSyncStats _stats;
+};
+
+#endif
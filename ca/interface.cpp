@@ -9,6 +9,9 @@
 #include "ca/resend_reconnect_node.h"
 #include "ca/transaction_cache.h"
 #include "ca/bonus_addr_cache.h"
+#include "ca/compact_block_relay.h"
+#include "ca/tx_ingest_pipeline.h"
+#include "ca/failed_transaction_cache.h"
 
 #include "utils/util.h"
 #include "utils/time_util.h"
@@ -20,6 +23,7 @@
 #include "db/db_api.h"
 #include "net/interface.h"
 #include "common/global_data.h"
+#include "common/peer_score.h"
 #include "include/scope_guard.h"
 
 
@@ -1505,21 +1509,6 @@ std::map<int32_t, std::string> GetReqCode()
 
 int sendConfirmationTransactionRequest(const std::shared_ptr<ConfirmTransactionReq>& msg,   ConfirmTransactionAck & ack)
 {
-    auto getRandomNumbers = [&](int limit) -> std::vector<int> {
-        std::random_device seed;
-        std::ranlux48 engine(seed());
-        std::uniform_int_distribution<int> u(0, limit - 1);
-        
-        std::set<int> uniqueNumbers;
-        while (uniqueNumbers.size() < 10) {
-            int randomNum = u(engine);
-            uniqueNumbers.insert(randomNum);
-        }
-        
-        std::vector<int> result(uniqueNumbers.begin(), uniqueNumbers.end());
-        return result;
-    };
-
     std::vector<Node> nodelist = MagicSingleton<PeerNode>::GetInstance()->GetNodelist();
     auto nodelistsize = nodelist.size();
     if(nodelistsize == 0)
@@ -1550,7 +1539,7 @@ int sendConfirmationTransactionRequest(const std::shared_ptr<ConfirmTransactionR
     //send_size
     std::string msgId;
     std::map<std::string, uint32_t> successHash;
-    if (!dataMgrPtr.CreateWait(10, send_num * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(10, send_num * 0.8, msgId, "confirmTransaction"))
     {
         ERRORLOG("sendConfirmationTransactionRequest CreateWait is error");
         ack.set_message("CreateWait error");
@@ -1566,15 +1555,18 @@ int sendConfirmationTransactionRequest(const std::shared_ptr<ConfirmTransactionR
         successHash.insert(std::make_pair(hash, 0));
     }
 
-    auto resultVector = getRandomNumbers(filterHeightNodeList.size());
-    int index = 0;
-    std::vector<std::string> resourceNodeRequired;
+    // Only the responders send the transaction bodies back, so they are the best scored nodes
+    std::vector<std::string> filterHeightAddrs;
+    for (auto &node : filterHeightNodeList)
+    {
+        filterHeightAddrs.push_back(node.address);
+    }
+    std::vector<std::string> resourceNodeRequired = MagicSingleton<PeerScore>::GetInstance()->Select(filterHeightAddrs, 10, "confirmTransaction");
     for (auto &node : filterHeightNodeList)
     {   
-        if(std::find(resultVector.begin(), resultVector.end(), index++) != resultVector.end())
+        if(std::find(resourceNodeRequired.begin(), resourceNodeRequired.end(), node.address) != resourceNodeRequired.end())
         {
             req.set_isresponse(1);
-            resourceNodeRequired.push_back(node.address);
         }else{
             req.set_isresponse(0);
         }
@@ -1819,6 +1811,14 @@ void RegisterInterface()
     MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<FastSyncGetHashAck>(handleFastSyncHashAcknowledge);
     MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<FastSyncGetBlockReq>(handleFastSyncBlockRequest);
     MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<FastSyncGetBlockAck>(handleFastSyncBlockAcknowledge);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetBlockSummaryReq>(handleSyncGetBlockSummaryRequest);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetBlockSummaryAck>(handleSyncGetBlockSummaryAcknowledge);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSumTreeReq>(handleSyncGetSumTreeRequest);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSumTreeAck>(handleSyncGetSumTreeAcknowledge);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSnapshotManifestReq>(handleSyncGetSnapshotManifestRequest);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSnapshotManifestAck>(handleSyncGetSnapshotManifestAcknowledge);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSnapshotChunkReq>(handleSyncGetSnapshotChunkRequest);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSnapshotChunkAck>(handleSyncGetSnapshotChunkAcknowledge);
 
     MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSumHashReq>(processSyncSumHashRequest);
     MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<SyncGetSumHashAck>(syncGetSumHashAcknowledge);
@@ -1850,13 +1850,19 @@ void RegisterInterface()
     MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSyncBlockCallback<GetCheckSumHashAck>(handleChecksumHashAcknowledge);
 
     // PCEnd correlation
-    MagicSingleton<ProtobufDispatcher>::GetInstance()->TxRegisterCallback<TxMsgReq>(HandleTx); // PCEnd transaction flow
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->TxRegisterCallback<TxMsgReq>(handleTxIngest); // PCEnd transaction flow
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerPreParseFilter(TxMsgReq::descriptor()->full_name(), [](const std::string &payload) {
+        return MagicSingleton<RejectedTxFilter>::GetInstance()->ShouldDrop(payload);
+    });
     MagicSingleton<ProtobufDispatcher>::GetInstance()->TxRegisterCallback<ContractTxMsgReq>(contractTransactionRequest);
     MagicSingleton<ProtobufDispatcher>::GetInstance()->TxRegisterCallback<ContractPackagerMsg>(handleContractPackagerMessage);
     MagicSingleton<ProtobufDispatcher>::GetInstance()->TxRegisterCallback<ContractDependencyBroadcastMsg>(HandleContractDependencyBroadcastMsg); 
     MagicSingleton<ProtobufDispatcher>::GetInstance()->TxRegisterCallback<VRFConsensusInfo>(HandleVRFConsensusInfoReq);
 
     MagicSingleton<ProtobufDispatcher>::GetInstance()->registerSaveBlockCallback<BuildBlockBroadcastMsg>(handleBuildBlockBroadcastMessage); // Building block broadcasting
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerBroadcastCallback<CompactBlockBroadcastMsg>(handleCompactBlockBroadcastMessage);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerCallback<GetBlockTxsReq>(handleGetBlockTxsRequest);
+    MagicSingleton<ProtobufDispatcher>::GetInstance()->registerCallback<GetBlockTxsAck>(handleGetBlockTxsAcknowledge);
 
     MagicSingleton<ProtobufDispatcher>::GetInstance()->blockRegisterCallback<BlockMsg>(HandleBlock);      // PCEnd transaction flow
     MagicSingleton<ProtobufDispatcher>::GetInstance()->blockRegisterCallback<SendReconnectNodeReq>(HandleSendReconnectNodeReq);
@@ -15,6 +15,7 @@
 #include "utils/timer.hpp"
 #include "utils/magic_singleton.h"
 #include "include/logging.h"
+#include "ca/contract_conflict_graph.h"
 
 
 class packDispatch
@@ -33,6 +34,7 @@ private:
         uint64_t time;
         std::unordered_map<std::string, std::vector<std::string>> hash_dep;
         std::unordered_map<std::string, CTransaction> hash_tx; 
+        ContractConflictGraph groups;
     };
 
     Hash_Depend packDispatchDependent;
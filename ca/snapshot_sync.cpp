@@ -0,0 +1,215 @@
+#include "ca/snapshot_sync.h"
+
+#include <deque>
+#include <map>
+#include <set>
+
+#include "ca/sync_block.h"
+#include "ca/spendable_utxo_index.h"
+#include "db/state_snapshot.h"
+#include "include/logging.h"
+#include "common/global_data.h"
+#include "common/peer_score.h"
+#include "utils/magic_singleton.h"
+
+int SnapshotSync::Run(const std::vector<std::string> &nodeIds, uint64_t nodeSelfHeight)
+{
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.runs;
+    }
+    auto finish = [this](int ret, uint64_t height) {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        if (ret == 0)
+        {
+            ++_stats.imports;
+            _stats.lastImportedHeight = height;
+        }
+        else if (ret < 0)
+        {
+            ++_stats.failures;
+        }
+        return ret;
+    };
+
+    auto stateSnapshot = MagicSingleton<StateSnapshot>::GetInstance();
+    bool pending = stateSnapshot->ImportPending();
+    SnapshotManifest manifest;
+    std::vector<std::string> holders;
+    int ret = queryManifests(nodeIds, manifest, holders);
+    if (ret != 0)
+    {
+        return finish(ret, 0);
+    }
+    // An interrupted import has already removed the old records and must be completed whatever the gain
+    if (!pending && manifest.height() < nodeSelfHeight + StateSnapshot::kInterval / 2)
+    {
+        return finish(1, 0);
+    }
+
+    INFOLOG("state snapshot sync at height {} from {} nodes, {} chunks, {} bytes", manifest.height(), holders.size(),
+            manifest.chunk_hashes_size(), manifest.total_bytes());
+    if (stateSnapshot->BeginImport(manifest) != 0)
+    {
+        return finish(-4, 0);
+    }
+    if (!download(manifest, holders))
+    {
+        return finish(-3, 0);
+    }
+    if (stateSnapshot->FinishImport(manifest) != 0)
+    {
+        return finish(-4, 0);
+    }
+    MagicSingleton<SpendableUtxoIndex>::GetInstance()->Clear();
+    return finish(0, manifest.height());
+}
+
+SnapshotSyncStats SnapshotSync::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+int SnapshotSync::queryManifests(const std::vector<std::string> &nodeIds, SnapshotManifest &manifest, std::vector<std::string> &holders)
+{
+    std::string msgId;
+    size_t sendNum = nodeIds.size();
+    if (!dataMgrPtr.CreateWait(kManifestTimeoutSec, sendNum * 0.8, msgId, "syncGetSnapshotManifest"))
+    {
+        return -1;
+    }
+    for (const auto &nodeId : nodeIds)
+    {
+        if (!dataMgrPtr.AddResNode(msgId, nodeId))
+        {
+            ERRORLOG("snapshot sync AddResNode error");
+            return -1;
+        }
+        sendSyncGetSnapshotManifestRequest(nodeId, msgId);
+    }
+    std::vector<std::string> retDatas;
+    if (!dataMgrPtr.WaitData(msgId, retDatas) && retDatas.size() < sendNum * 0.5)
+    {
+        DEBUGLOG("wait snapshot manifests time out send:{} recv:{}", sendNum, retDatas.size());
+        return -1;
+    }
+
+    // Nodes without a snapshot still count as answers, so a root needs the same majority as any sync vote
+    std::map<std::string, std::pair<SnapshotManifest, std::vector<std::string>>> votes;
+    size_t received = 0;
+    SyncGetSnapshotManifestAck ack;
+    for (const auto &retData : retDatas)
+    {
+        ack.Clear();
+        if (!ack.ParseFromString(retData))
+        {
+            continue;
+        }
+        ++received;
+        if (ack.code() != 0 || StateSnapshot::ComputeRoot(ack.manifest()) != ack.manifest().root())
+        {
+            continue;
+        }
+        auto &vote = votes[ack.manifest().root()];
+        vote.first = ack.manifest();
+        vote.second.push_back(ack.self_node_id());
+    }
+    if (received == 0)
+    {
+        return -1;
+    }
+
+    bool found = false;
+    for (auto &[root, vote] : votes)
+    {
+        size_t hits = vote.second.size();
+        bool isAgreed = received <= 10 ? SyncBlock::checkByzantineFault(received, hits) : hits >= received * 0.66;
+        if (isAgreed && (!found || vote.first.height() > manifest.height()))
+        {
+            manifest = vote.first;
+            holders = vote.second;
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        DEBUGLOG("no state snapshot agreed among {} answers", received);
+        return -2;
+    }
+    return 0;
+}
+
+bool SnapshotSync::download(const SnapshotManifest &manifest, const std::vector<std::string> &holders)
+{
+    auto stateSnapshot = MagicSingleton<StateSnapshot>::GetInstance();
+    struct Chunk
+    {
+        uint32_t index = 0;
+        uint32_t attempts = 0;
+    };
+    std::deque<Chunk> chunks;
+    for (int i = 0; i < manifest.chunk_hashes_size(); ++i)
+    {
+        chunks.push_back({static_cast<uint32_t>(i), 0});
+    }
+
+    uint64_t downloaded = 0;
+    uint64_t retries = 0;
+    uint64_t downloadedBytes = 0;
+    bool complete = true;
+    while (!chunks.empty() && complete)
+    {
+        // Requests of a round complete through futures, so one thread keeps all of them in flight
+        std::vector<std::pair<Chunk, std::future<GlobalDataManager::WaitResult>>> inflight;
+        while (!chunks.empty() && inflight.size() < kMaxParallelRequests)
+        {
+            Chunk chunk = chunks.front();
+            chunks.pop_front();
+            // Rotate over the nodes so neighbouring chunks and retries hit different nodes
+            std::string nodeId = holders[(chunk.index + chunk.attempts) % holders.size()];
+            std::string msgId;
+            auto future = dataMgrPtr.CreateFutureWait("syncGetSnapshotChunk", kChunkTimeoutSec, 1, {nodeId}, msgId);
+            sendSyncGetSnapshotChunkRequest(nodeId, msgId, manifest.height(), chunk.index);
+            uint64_t height = manifest.height();
+            uint32_t index = chunk.index;
+            MagicSingleton<PeerScore>::GetInstance()->Hedge(msgId, "syncGetSnapshotChunk", nodeId, holders, [msgId, height, index](const std::string &backup) {
+                sendSyncGetSnapshotChunkRequest(backup, msgId, height, index);
+            });
+            inflight.emplace_back(chunk, std::move(future));
+        }
+
+        for (auto &[chunk, future] : inflight)
+        {
+            auto result = future.get();
+            SyncGetSnapshotChunkAck ack;
+            int ret = 1;
+            if (result.quorum && ack.ParseFromString(result.data.front()) && ack.code() == 0
+                && ack.height() == manifest.height() && ack.index() == chunk.index)
+            {
+                ret = stateSnapshot->ImportChunk(manifest, chunk.index, ack.data());
+            }
+            if (ret == 0)
+            {
+                ++downloaded;
+                downloadedBytes += ack.data().size();
+                continue;
+            }
+            // A database error will not go away on another node
+            if (ret == -2 || chunk.attempts + 1 >= kMaxAttempts)
+            {
+                ERRORLOG("state snapshot chunk {} at height {} could not be imported", chunk.index, manifest.height());
+                complete = false;
+                continue;
+            }
+            ++retries;
+            chunks.push_back({chunk.index, chunk.attempts + 1});
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _stats.downloadedChunks += downloaded;
+    _stats.chunkRetries += retries;
+    _stats.downloadedBytes += downloadedBytes;
+    return complete;
+}
@@ -0,0 +1,78 @@
+/**
+ * *****************************************************************************
+ * @file        snapshot_sync.h
+ * @brief       Bootstraps a new node from a state snapshot agreed by the sync nodes
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_SNAPSHOT_SYNC_HEADER
+#define CA_SNAPSHOT_SYNC_HEADER
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "proto/sync_block.pb.h"
+
+/**
+ * @brief       Counters of snapshot sync
+ */
+struct SnapshotSyncStats
+{
+    uint64_t runs = 0;
+    uint64_t imports = 0;
+    uint64_t failures = 0;
+    uint64_t downloadedChunks = 0;
+    uint64_t chunkRetries = 0;
+    uint64_t downloadedBytes = 0;
+    uint64_t lastImportedHeight = 0;
+};
+
+/**
+ * @brief       Asks the sync nodes for the newest state snapshot they serve, takes the
+ *              highest root reported by enough of them, downloads its chunks in parallel
+ *              from the nodes that reported it and imports them, so a new node only has to
+ *              sync the blocks above the snapshot height.
+ */
+class SnapshotSync
+{
+public:
+    SnapshotSync() = default;
+    ~SnapshotSync() = default;
+    SnapshotSync(SnapshotSync &&) = delete;
+    SnapshotSync(const SnapshotSync &) = delete;
+    SnapshotSync &operator=(SnapshotSync &&) = delete;
+    SnapshotSync &operator=(const SnapshotSync &) = delete;
+
+    /**
+     * @brief       Import an agreed snapshot when it is far enough above the local top
+     *
+     * @param       nodeIds: sync nodes
+     * @param       nodeSelfHeight: local block top
+     * @return      int return 0 a snapshot was imported,
+     *                  1 no snapshot is worth importing,
+     *                  -1 too few nodes answered,
+     *                  -2 the nodes do not agree on a snapshot,
+     *                  -3 chunks could not be downloaded,
+     *                  -4 the import failed
+     */
+    int Run(const std::vector<std::string> &nodeIds, uint64_t nodeSelfHeight);
+
+    SnapshotSyncStats GetStats();
+
+    static constexpr uint32_t kManifestTimeoutSec = 10;
+    static constexpr uint32_t kChunkTimeoutSec = 30;
+    static constexpr size_t kMaxParallelRequests = 8;
+    static constexpr uint32_t kMaxAttempts = 3;
+
+private:
+    int queryManifests(const std::vector<std::string> &nodeIds, SnapshotManifest &manifest, std::vector<std::string> &holders);
+    bool download(const SnapshotManifest &manifest, const std::vector<std::string> &holders);
+
+    std::mutex _statsMutex;
+    SnapshotSyncStats _stats;
+};
+
+#endif
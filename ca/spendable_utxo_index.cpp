@@ -0,0 +1,302 @@
+#include "ca/spendable_utxo_index.h"
+
+#include <algorithm>
+
+#include "db/db_api.h"
+#include "include/logging.h"
+#include "utils/account_manager.h"
+#include "utils/magic_singleton.h"
+
+int SpendableUtxoIndex::Select(const std::string &address, const std::string &assetType, size_t maxCount,
+                               std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> &utxos, uint64_t &total)
+{
+    utxos.clear();
+    total = 0;
+    std::lock_guard<std::mutex> lock(_mutex);
+    releaseExpired();
+    Account *entry = account(address, assetType);
+    if (entry == nullptr)
+    {
+        return -1;
+    }
+    for (auto iter = entry->spendable.rbegin(); iter != entry->spendable.rend() && utxos.size() < maxCount; ++iter)
+    {
+        utxos.insert(utxo(address, iter->second, iter->first));
+        total += iter->first;
+    }
+    return 0;
+}
+
+void SpendableUtxoIndex::Reserve(const CTransaction &tx)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_reservations.count(tx.hash()))
+    {
+        return;
+    }
+    auto &reserved = _reservations[tx.hash()];
+    for (const auto &txUtxo : tx.utxos())
+    {
+        for (const auto &vin : txUtxo.vin())
+        {
+            if (!vin.contractaddr().empty())
+            {
+                continue;
+            }
+            std::string owner = GenerateAddr(vin.vinsign().pub());
+            for (const auto &prevout : vin.prevout())
+            {
+                if (_reservedBy.emplace(prevout.hash() + "_" + owner, tx.hash()).second)
+                {
+                    reserved.emplace_back(owner, prevout.hash());
+                    setReserved(owner, prevout.hash(), true);
+                }
+            }
+        }
+    }
+    if (reserved.empty())
+    {
+        _reservations.erase(tx.hash());
+    }
+}
+
+void SpendableUtxoIndex::Release(const std::string &txHash)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    release(txHash);
+}
+
+void SpendableUtxoIndex::Packaged(const std::string &txHash)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_reservations.count(txHash))
+    {
+        _packaged[txHash] = std::chrono::steady_clock::now() + kCommitTimeout;
+    }
+}
+
+void SpendableUtxoIndex::Invalidate(const CBlock &block)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto &tx : block.txs())
+    {
+        release(tx.hash());
+        for (const auto &txUtxo : tx.utxos())
+        {
+            for (const auto &owner : txUtxo.owner())
+            {
+                dropAddress(owner);
+            }
+            for (const auto &vout : txUtxo.vout())
+            {
+                dropAddress(vout.addr());
+            }
+        }
+    }
+}
+
+void SpendableUtxoIndex::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stats.invalidations += _accounts.size();
+    _accounts.clear();
+    _assetsByAddress.clear();
+}
+
+SpendableUtxoStats SpendableUtxoIndex::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    SpendableUtxoStats stats = _stats;
+    stats.accounts = _accounts.size();
+    stats.reservedUtxos = _reservedBy.size();
+    return stats;
+}
+
+SpendableUtxoIndex::Account *SpendableUtxoIndex::account(const std::string &address, const std::string &assetType)
+{
+    auto now = std::chrono::steady_clock::now();
+    AccountKey key{address, assetType};
+    auto found = _accounts.find(key);
+    if (found != _accounts.end())
+    {
+        ++_stats.hits;
+        found->second.used = now;
+        return &found->second;
+    }
+
+    // Read under the lock, so a block saved meanwhile drops the account only after it is complete
+    Account entry;
+    if (load(address, assetType, entry) != 0)
+    {
+        return nullptr;
+    }
+    ++_stats.loads;
+    if (_accounts.size() >= kMaxAccounts)
+    {
+        auto oldest = std::min_element(_accounts.begin(), _accounts.end(), [](const auto &a, const auto &b) {
+            return a.second.used < b.second.used;
+        });
+        auto assets = _assetsByAddress.find(oldest->first.first);
+        if (assets != _assetsByAddress.end())
+        {
+            assets->second.erase(oldest->first.second);
+            if (assets->second.empty())
+            {
+                _assetsByAddress.erase(assets);
+            }
+        }
+        _accounts.erase(oldest);
+    }
+    entry.used = now;
+    _assetsByAddress[address].insert(assetType);
+    return &_accounts.emplace(std::move(key), std::move(entry)).first->second;
+}
+
+int SpendableUtxoIndex::load(const std::string &address, const std::string &assetType, Account &entry)
+{
+    DBReader dbReader;
+    std::vector<std::string> utxoHashes;
+    DBStatus status = assetType.empty() ? dbReader.getUtxoHashsByAddress(address, utxoHashes)
+                                        : dbReader.getUtxoHashsByAddress(address, assetType, utxoHashes);
+    if (status == DBStatus::DB_NOT_FOUND)
+    {
+        return 0;
+    }
+    if (status != DBStatus::DB_SUCCESS)
+    {
+        ERRORLOG("getUtxoHashsByAddress fail, address:{}, assetType:{}", address, assetType);
+        return -1;
+    }
+
+    for (const auto &hash : utxoHashes)
+    {
+        if (entry.values.count(hash))
+        {
+            continue;
+        }
+        std::string balance;
+        status = assetType.empty() ? dbReader.getUtxoValueByUtxoHashes(hash, address, balance)
+                                   : dbReader.getUtxoValueByUtxoHashes(hash, address, assetType, balance);
+        if (status != DBStatus::DB_SUCCESS)
+        {
+            ERRORLOG("getUtxoValueByUtxoHashes fail, hash:{}, address:{}", hash, address);
+            return -1;
+        }
+        uint64_t value = TxHelper::calculate_utxo_value(balance);
+        entry.values.emplace(hash, value);
+        if (!_reservedBy.count(hash + "_" + address))
+        {
+            entry.spendable.emplace(value, hash);
+        }
+    }
+    return 0;
+}
+
+void SpendableUtxoIndex::dropAddress(const std::string &address)
+{
+    auto assets = _assetsByAddress.find(address);
+    if (assets == _assetsByAddress.end())
+    {
+        return;
+    }
+    for (const auto &assetType : assets->second)
+    {
+        _accounts.erase({address, assetType});
+        ++_stats.invalidations;
+    }
+    _assetsByAddress.erase(assets);
+}
+
+void SpendableUtxoIndex::setReserved(const std::string &address, const std::string &utxoHash, bool reserved)
+{
+    auto assets = _assetsByAddress.find(address);
+    if (assets == _assetsByAddress.end())
+    {
+        return;
+    }
+    for (const auto &assetType : assets->second)
+    {
+        auto found = _accounts.find({address, assetType});
+        if (found == _accounts.end())
+        {
+            continue;
+        }
+        auto value = found->second.values.find(utxoHash);
+        if (value == found->second.values.end())
+        {
+            continue;
+        }
+        if (reserved)
+        {
+            found->second.spendable.erase({value->second, utxoHash});
+        }
+        else
+        {
+            found->second.spendable.emplace(value->second, utxoHash);
+        }
+    }
+}
+
+void SpendableUtxoIndex::release(const std::string &txHash)
+{
+    _packaged.erase(txHash);
+    auto found = _reservations.find(txHash);
+    if (found == _reservations.end())
+    {
+        return;
+    }
+    for (const auto &[owner, utxoHash] : found->second)
+    {
+        _reservedBy.erase(utxoHash + "_" + owner);
+        setReserved(owner, utxoHash, false);
+    }
+    _reservations.erase(found);
+}
+
+void SpendableUtxoIndex::releaseExpired()
+{
+    auto now = std::chrono::steady_clock::now();
+    for (auto iter = _packaged.begin(); iter != _packaged.end();)
+    {
+        if (iter->second > now)
+        {
+            ++iter;
+            continue;
+        }
+        std::string txHash = iter->first;
+        ++iter;
+        DEBUGLOG("packaged tx {} not committed in time, utxos released", txHash);
+        release(txHash);
+        ++_stats.expiredReservations;
+    }
+}
+
+TxHelper::Utxo SpendableUtxoIndex::utxo(const std::string &address, const std::string &hash, uint64_t value)
+{
+    TxHelper::Utxo ret;
+    ret.value = value;
+    ret.addr = address;
+    ret.hash = hash;
+    // Outputs are stored by transaction hash and owner, n is always 0
+    ret.n = 0;
+    return ret;
+}
+
+int FindSpendableUtxo(const std::string &address, const std::string &assetType, size_t maxCount, uint64_t &total,
+                      std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> &utxos, bool isFindUtxo)
+{
+    if (MagicSingleton<SpendableUtxoIndex>::GetInstance()->Select(address, assetType, maxCount, utxos, total) != 0)
+    {
+        return -1;
+    }
+    if (isFindUtxo && !utxos.empty())
+    {
+        int ret = TxHelper::sendConfirmUtxoHashRequest(utxos);
+        if (ret != 0)
+        {
+            ERRORLOG("sendConfirmUtxoHashRequest error ret : {}", ret);
+            return -2;
+        }
+    }
+    return 0;
+}
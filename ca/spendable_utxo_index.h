@@ -0,0 +1,151 @@
+/**
+ * *****************************************************************************
+ * @file        spendable_utxo_index.h
+ * @brief       In memory per address index of spendable utxos ordered by value
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_SPENDABLE_UTXO_INDEX_HEADER
+#define CA_SPENDABLE_UTXO_INDEX_HEADER
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ca/txhelper.h"
+#include "proto/block.pb.h"
+#include "proto/transaction.pb.h"
+
+/**
+ * @brief       Counters of the index
+ */
+struct SpendableUtxoStats
+{
+    uint64_t hits = 0;
+    uint64_t loads = 0;
+    uint64_t invalidations = 0;
+    uint64_t expiredReservations = 0;
+    size_t accounts = 0;
+    size_t reservedUtxos = 0;
+};
+
+/**
+ * @brief       Spendable utxos of an address and asset, read from the database once and then kept
+ *              ordered by value, so coins are selected by a lookup instead of a rescan and re-sort of
+ *              the address on every transaction. Utxos spent by transactions in the local mempool are
+ *              reserved and not selected again until the transaction is committed in a saved block or
+ *              fails. A packaged transaction whose block is not saved within kCommitTimeout counts as
+ *              failed. A saved block drops the accounts of the addresses it touches and a rollback or
+ *              snapshot import drops all of them, the next selection reloads them from the database.
+ *              An empty asset type is the account read through the database calls without an asset.
+ */
+class SpendableUtxoIndex
+{
+public:
+    SpendableUtxoIndex() = default;
+    ~SpendableUtxoIndex() = default;
+    SpendableUtxoIndex(SpendableUtxoIndex &&) = delete;
+    SpendableUtxoIndex(const SpendableUtxoIndex &) = delete;
+    SpendableUtxoIndex &operator=(SpendableUtxoIndex &&) = delete;
+    SpendableUtxoIndex &operator=(const SpendableUtxoIndex &) = delete;
+
+    /**
+     * @brief       The largest unreserved utxos of an address, as TxHelper::FindUtxo selects them
+     *
+     * @param       address: owner of the utxos
+     * @param       assetType: asset of the utxos
+     * @param       maxCount: most utxos to select
+     * @param       utxos: selected utxos, empty when the address holds none
+     * @param       total: value of the selected utxos
+     * @return      int return 0 success, -1 the utxos could not be read
+     */
+    int Select(const std::string &address, const std::string &assetType, size_t maxCount,
+               std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> &utxos, uint64_t &total);
+
+    /**
+     * @brief       Reserve the utxos a pooled transaction spends
+     */
+    void Reserve(const CTransaction &tx);
+
+    /**
+     * @brief       Release the utxos reserved for a transaction that failed or left the pool unpackaged
+     */
+    void Release(const std::string &txHash);
+
+    /**
+     * @brief       Keep the reservation of a packaged transaction until its block is saved, at most
+     *              kCommitTimeout
+     */
+    void Packaged(const std::string &txHash);
+
+    /**
+     * @brief       Release the transactions a saved block commits and drop the accounts of the
+     *              addresses it spends from or pays to
+     */
+    void Invalidate(const CBlock &block);
+
+    /**
+     * @brief       Drop every account, reservations are kept
+     */
+    void Clear();
+
+    SpendableUtxoStats GetStats();
+
+    static constexpr size_t kMaxAccounts = 10000;
+    static constexpr std::chrono::seconds kCommitTimeout{60};
+
+private:
+    struct Account
+    {
+        // Every utxo of the account by hash, and the unreserved ones ordered by value
+        std::unordered_map<std::string, uint64_t> values;
+        std::set<std::pair<uint64_t, std::string>> spendable;
+        std::chrono::steady_clock::time_point used;
+    };
+
+    using AccountKey = std::pair<std::string, std::string>;
+    struct AccountKeyHash
+    {
+        size_t operator()(const AccountKey &key) const
+        {
+            return std::hash<std::string>()(key.first) ^ (std::hash<std::string>()(key.second) << 1);
+        }
+    };
+
+    Account *account(const std::string &address, const std::string &assetType);
+    int load(const std::string &address, const std::string &assetType, Account &entry);
+    void dropAddress(const std::string &address);
+    void setReserved(const std::string &address, const std::string &utxoHash, bool reserved);
+    void release(const std::string &txHash);
+    void releaseExpired();
+    static TxHelper::Utxo utxo(const std::string &address, const std::string &hash, uint64_t value);
+
+    std::mutex _mutex;
+    std::unordered_map<AccountKey, Account, AccountKeyHash> _accounts;
+    std::unordered_map<std::string, std::set<std::string>> _assetsByAddress;
+    // Utxo hash and owner joined by "_" to the reserving transaction. The asset is left out so the
+    // account read without an asset sees the reservation too, at worst another asset paid by the same
+    // transaction to the same owner is held back with it.
+    std::unordered_map<std::string, std::string> _reservedBy;
+    std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> _reservations;
+    // Packaged transactions by the time their reservation lapses
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> _packaged;
+    SpendableUtxoStats _stats;
+};
+
+/**
+ * @brief       TxHelper::FindUtxo for one address over the index: at most maxCount of its largest
+ *              unreserved utxos, confirmed with other nodes when isFindUtxo is set
+ *
+ * @return      int return 0 success, -1 the utxos could not be read, -2 the confirmation failed
+ */
+int FindSpendableUtxo(const std::string &address, const std::string &assetType, size_t maxCount, uint64_t &total,
+                      std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator> &utxos, bool isFindUtxo);
+
+#endif
@@ -0,0 +1,65 @@
+#include "ca/spent_outpoint_index.h"
+
+bool SpentOutpointIndex::Add(const std::string &txHash, std::vector<std::string> spendKeys, std::string *conflictHash)
+{
+    if (Conflicts(spendKeys, conflictHash) || _spendKeys.count(txHash))
+    {
+        if (conflictHash != nullptr && conflictHash->empty())
+        {
+            *conflictHash = txHash;
+        }
+        return false;
+    }
+    for (const auto &key : spendKeys)
+    {
+        _spentBy.emplace(key, txHash);
+    }
+    _spendKeys.emplace(txHash, std::move(spendKeys));
+    return true;
+}
+
+bool SpentOutpointIndex::Conflicts(const std::vector<std::string> &spendKeys, std::string *conflictHash) const
+{
+    for (const auto &key : spendKeys)
+    {
+        auto found = _spentBy.find(key);
+        if (found != _spentBy.end())
+        {
+            if (conflictHash != nullptr)
+            {
+                *conflictHash = found->second;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void SpentOutpointIndex::Remove(const std::string &txHash)
+{
+    auto found = _spendKeys.find(txHash);
+    if (found == _spendKeys.end())
+    {
+        return;
+    }
+    for (const auto &key : found->second)
+    {
+        auto spent = _spentBy.find(key);
+        if (spent != _spentBy.end() && spent->second == txHash)
+        {
+            _spentBy.erase(spent);
+        }
+    }
+    _spendKeys.erase(found);
+}
+
+void SpentOutpointIndex::Clear()
+{
+    _spentBy.clear();
+    _spendKeys.clear();
+}
+
+size_t SpentOutpointIndex::Size() const
+{
+    return _spendKeys.size();
+}
@@ -0,0 +1,58 @@
+/**
+ * *****************************************************************************
+ * @file        spent_outpoint_index.h
+ * @brief       Hash index from the outpoints spent by cached transactions to their transaction
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_SPENT_OUTPOINT_INDEX_HEADER
+#define CA_SPENT_OUTPOINT_INDEX_HEADER
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief       Maps every spend key (see Checker::SpendKeys) of the transactions in a cache to the
+ *              hash of the transaction spending it, so a new transaction is checked for double
+ *              spends with one lookup per input instead of a comparison against every cached
+ *              transaction. The keys of a transaction are kept with it so it can be removed again.
+ *              Not thread safe, the owner guards it with the lock of its cache.
+ */
+class SpentOutpointIndex
+{
+public:
+    SpentOutpointIndex() = default;
+    ~SpentOutpointIndex() = default;
+    SpentOutpointIndex(SpentOutpointIndex &&) = delete;
+    SpentOutpointIndex(const SpentOutpointIndex &) = delete;
+    SpentOutpointIndex &operator=(SpentOutpointIndex &&) = delete;
+    SpentOutpointIndex &operator=(const SpentOutpointIndex &) = delete;
+
+    /**
+     * @brief       Index a transaction unless one of its spend keys is already spent
+     *
+     * @param       txHash: transaction hash
+     * @param       spendKeys: spend keys of the transaction
+     * @param       conflictHash: set to the cached transaction spending the same output
+     * @return      true    indexed
+     * @return      false   double spend
+     */
+    bool Add(const std::string &txHash, std::vector<std::string> spendKeys, std::string *conflictHash = nullptr);
+
+    /**
+     * @brief       Whether any of the spend keys is spent by an indexed transaction
+     */
+    bool Conflicts(const std::vector<std::string> &spendKeys, std::string *conflictHash = nullptr) const;
+
+    void Remove(const std::string &txHash);
+    void Clear();
+    size_t Size() const;
+
+private:
+    std::unordered_map<std::string, std::string> _spentBy;
+    std::unordered_map<std::string, std::vector<std::string>> _spendKeys;
+};
+
+#endif
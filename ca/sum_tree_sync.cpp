@@ -0,0 +1,159 @@
+#include "ca/sum_tree_sync.h"
+
+#include <algorithm>
+#include <set>
+
+#include "ca/sync_block.h"
+#include "db/db_api.h"
+#include "db/sum_hash_tree.h"
+#include "include/logging.h"
+#include "common/global_data.h"
+
+int SumTreeSync::FindDivergence(const std::vector<std::string> &nodeIds, uint64_t maxHeight, uint64_t &height)
+{
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.searches;
+    }
+    auto finish = [this](int ret, uint64_t divergentHeight) {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        if (ret == 0)
+        {
+            ++_stats.divergencesFound;
+            _stats.lastDivergentHeight = divergentHeight;
+        }
+        else if (ret < 0)
+        {
+            ++_stats.failures;
+        }
+        return ret;
+    };
+
+    DBReader dbReader;
+    if (!SumHashTree::IsComplete(dbReader))
+    {
+        DEBUGLOG("sum hash tree is still being built");
+        return finish(-1, 0);
+    }
+
+    uint32_t level = SumHashTree::kTopLevel;
+    uint64_t startIndex = 0;
+    uint64_t count = maxHeight / SumHashTree::Span(level) + 1;
+    while (true)
+    {
+        std::map<uint64_t, std::string> agreed;
+        int ret = queryLevel(nodeIds, level, startIndex, std::min<uint64_t>(count, kMaxNodesPerRequest), maxHeight, agreed);
+        if (ret != 0)
+        {
+            return finish(ret, 0);
+        }
+
+        uint64_t divergentIndex = UINT64_MAX;
+        for (uint64_t index = startIndex; index < startIndex + std::min<uint64_t>(count, kMaxNodesPerRequest); ++index)
+        {
+            std::string localHash;
+            if (!SumHashTree::GetNode(dbReader, level, index, maxHeight, localHash))
+            {
+                return finish(-1, 0);
+            }
+            auto found = agreed.find(index);
+            if (found == agreed.end())
+            {
+                DEBUGLOG("no majority for sum tree node {} at level {}", index, level);
+                return finish(-3, 0);
+            }
+            if (found->second != localHash)
+            {
+                divergentIndex = index;
+                break;
+            }
+        }
+        if (divergentIndex == UINT64_MAX)
+        {
+            return finish(1, 0);
+        }
+        if (level == 0)
+        {
+            height = divergentIndex;
+            INFOLOG("first divergent height {} found below max height {}", height, maxHeight);
+            return finish(0, height);
+        }
+        --level;
+        startIndex = divergentIndex * SumHashTree::kFanout;
+        count = SumHashTree::kFanout;
+    }
+}
+
+SumTreeSyncStats SumTreeSync::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+int SumTreeSync::queryLevel(const std::vector<std::string> &nodeIds, uint32_t level, uint64_t startIndex, uint32_t count, uint64_t maxHeight,
+                            std::map<uint64_t, std::string> &agreed)
+{
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.rounds;
+    }
+    std::string msgId;
+    size_t sendNum = nodeIds.size();
+    if (!dataMgrPtr.CreateWait(kRoundTimeoutSec, sendNum * 0.8, msgId, "syncGetSumTree"))
+    {
+        return -2;
+    }
+    for (const auto &nodeId : nodeIds)
+    {
+        if (!dataMgrPtr.AddResNode(msgId, nodeId))
+        {
+            ERRORLOG("sum tree sync AddResNode error");
+            return -2;
+        }
+        sendSyncGetSumTreeRequest(nodeId, msgId, level, startIndex, count, maxHeight);
+    }
+    std::vector<std::string> retDatas;
+    if (!dataMgrPtr.WaitData(msgId, retDatas) && retDatas.size() < sendNum * 0.5)
+    {
+        DEBUGLOG("wait sum tree nodes time out send:{} recv:{}", sendNum, retDatas.size());
+        return -2;
+    }
+
+    std::map<uint64_t, std::map<std::string, std::set<std::string>>> votes;
+    size_t received = 0;
+    SyncGetSumTreeAck ack;
+    for (const auto &retData : retDatas)
+    {
+        ack.Clear();
+        if (!ack.ParseFromString(retData) || ack.code() != 0 || ack.level() != level)
+        {
+            continue;
+        }
+        ++received;
+        for (const auto &node : ack.nodes())
+        {
+            if (node.index() >= startIndex && node.index() < startIndex + count)
+            {
+                votes[node.index()][node.hash()].insert(ack.self_node_id());
+            }
+        }
+    }
+    if (received == 0)
+    {
+        return -2;
+    }
+
+    for (const auto &[index, hashes] : votes)
+    {
+        for (const auto &[hash, voters] : hashes)
+        {
+            bool isAgreed = received <= 10 ? SyncBlock::checkByzantineFault(received, voters.size()) : voters.size() >= received * 0.66;
+            if (isAgreed)
+            {
+                agreed[index] = hash;
+                break;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * *****************************************************************************
+ * @file        sum_tree_sync.h
+ * @brief       Bisects the sum hash tree with sync nodes to find the first divergent height
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_SUM_TREE_SYNC_HEADER
+#define CA_SUM_TREE_SYNC_HEADER
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief       Counters of divergence searches
+ */
+struct SumTreeSyncStats
+{
+    uint64_t searches = 0;
+    uint64_t divergencesFound = 0;
+    uint64_t rounds = 0;
+    uint64_t failures = 0;
+    uint64_t lastDivergentHeight = 0;
+};
+
+/**
+ * @brief       Walks the sum hash tree from the top level down. Each round asks every
+ *              sync node for at most kFanout node hashes of one level, takes the majority
+ *              per node and descends into the first node where the local tree disagrees,
+ *              so the first divergent height is found in kLevels small rounds instead of
+ *              per-height hash lists over whole ranges.
+ */
+class SumTreeSync
+{
+public:
+    SumTreeSync() = default;
+    ~SumTreeSync() = default;
+    SumTreeSync(SumTreeSync &&) = delete;
+    SumTreeSync(const SumTreeSync &) = delete;
+    SumTreeSync &operator=(SumTreeSync &&) = delete;
+    SumTreeSync &operator=(const SumTreeSync &) = delete;
+
+    /**
+     * @brief       Find the lowest height at which the local chain differs from the majority of the nodes
+     *
+     * @param       nodeIds: sync nodes
+     * @param       maxHeight: compare the chains up to this height, usually the local top
+     * @param       height: first divergent height
+     * @return      int return 0 a divergent height was found,
+     *                  1 the chains agree up to maxHeight,
+     *                  -1 the local tree is incomplete or unreadable,
+     *                  -2 too few nodes answered,
+     *                  -3 the nodes do not agree among themselves
+     */
+    int FindDivergence(const std::vector<std::string> &nodeIds, uint64_t maxHeight, uint64_t &height);
+
+    SumTreeSyncStats GetStats();
+
+    static constexpr uint32_t kRoundTimeoutSec = 10;
+    static constexpr uint32_t kMaxNodesPerRequest = 64;
+
+private:
+    int queryLevel(const std::vector<std::string> &nodeIds, uint32_t level, uint64_t startIndex, uint32_t count, uint64_t maxHeight,
+                   std::map<uint64_t, std::string> &agreed);
+
+    std::mutex _statsMutex;
+    SumTreeSyncStats _stats;
+};
+
+#endif
@@ -10,6 +10,10 @@
 #include "ca/txhelper.h"
 #include "ca/algorithm.h"
 #include "ca/sync_block.h"
+#include "ca/sync_pipeline.h"
+#include "ca/header_first_sync.h"
+#include "ca/sum_tree_sync.h"
+#include "ca/snapshot_sync.h"
 #include "ca/transaction.h"
 #include "ca/block_helper.h"
 
@@ -19,20 +23,25 @@
 #include "utils/account_manager.h"
 
 #include "db/db_api.h"
+#include "db/sum_hash_tree.h"
+#include "db/state_snapshot.h"
 #include "net/dispatcher.h"
 #include "include/logging.h"
 #include "common/global_data.h"
+#include "common/peer_score.h"
 
 const static uint64_t kStabilityTime = 60 * 1000000;
 static uint64_t sync_fail_height = 0;
 static bool runFastSync = false;
 static bool isFastSyncFailed = false;
+static bool divergenceSearchPending = false;
 
 static bool execute_new_sync = false;
 static uint64_t initialSyncStartHeight = 0;
 
 static uint32_t syncHeightCount = 100;
 const static uint32_t SYNC_HEIGHT_TIME = 10;
+const static uint32_t SYNC_CATCH_UP_TIME = 1;
 const static uint32_t SYNC_STUCK_OVERTIME_COUNT = 6;
 const static double KScalingFactor = 0.95;
 static uint64_t syncSendNewSyncNumber = UINT32_MAX;
@@ -177,6 +186,7 @@ void SyncBlock::ThreadStart()
         syncHeightCount = kSynchronizationBoundary;
     }
     fastSyncHeightCount = 0; // 0 means "this variable doesn't use for now"
+    SumHashTree::StartBackfill();
     
     syncThreadRunning = true;
     _syncThread = std::thread(
@@ -304,7 +314,8 @@ void SyncBlock::ThreadStart()
                 { 
                     auto syncType = get_save_sync_type(nodeSelfHeight, chainHeight);
 
-                    if(execute_new_sync || runZeroSyncCount > 2)
+                    // Records removed by an unfinished snapshot import can only be restored by finishing it
+                    if((execute_new_sync || runZeroSyncCount > 2) && !MagicSingleton<StateSnapshot>::GetInstance()->ImportPending())
                     {
                         syncType = global::ca::SaveType::SyncNormal;
                     }
@@ -336,6 +347,16 @@ void SyncBlock::ThreadStart()
                         {
                             nodeSelfHeight = sync_fail_height;
                         }
+                        if(divergenceSearchPending)
+                        {
+                            divergenceSearchPending = false;
+                            uint64_t divergentHeight = 0;
+                            if(locateDivergence(pledgeAddr, chainHeight, nodeSelfHeight, syncSendNewSyncNumber, divergentHeight) == 0 && divergentHeight < nodeSelfHeight)
+                            {
+                                INFOLOG("new sync restarts at divergent height {} instead of {}", divergentHeight, nodeSelfHeight);
+                                nodeSelfHeight = divergentHeight;
+                            }
+                        }
                         if (nodeSelfHeight > syncHeightCount)
                         {
                             syncInitHeight = nodeSelfHeight - syncHeightCount;
@@ -367,6 +388,7 @@ void SyncBlock::ThreadStart()
                         {   
                             sync_fail_height = 0;
                             runFastSync = false;
+                            divergenceSearchPending = true;
                         }
                         if(runStatus == 0)
                         {
@@ -375,6 +397,12 @@ void SyncBlock::ThreadStart()
                             initialSyncStartHeight = 0;
                             sync_fail_height = 0;
                             runFastSync = false;
+
+                            // Still catching up: the pipeline already overlapped download and save, start the next round right away
+                            if (chainHeight > endSyncHeight_)
+                            {
+                                sleepTime = SYNC_CATCH_UP_TIME;
+                            }
                         }
                         DEBUGLOG("runNewSyncOnce sync return: {}", runStatus);
                     }
@@ -399,6 +427,28 @@ bool SyncBlock::runFastSyncOnce(const std::vector<std::string> &pledgeAddr, uint
         ERRORLOG("get sync node fail");
         return false;
     }
+
+    std::map<uint64_t, std::set<CBlock, BlockComparator>> headerFirstBlocks;
+    int headerFirstRet = MagicSingleton<HeaderFirstSync>::GetInstance()->Run(node_ids_to_send, syncInitHeight, endSyncHeight_, chainHeight, headerFirstBlocks);
+    if (headerFirstRet == 0 && !headerFirstBlocks.empty())
+    {
+        DBReader reader;
+        uint64_t top = 0;
+        if (reader.getBlockTop(top) != DBStatus::DB_SUCCESS)
+        {
+            ERRORLOG("getBlockTop fail");
+            return false;
+        }
+        MagicSingleton<BlockHelper>::GetInstance()->AddFastSyncBlock(headerFirstBlocks, get_save_sync_type(top, chainHeight));
+    }
+    if (headerFirstRet == 0)
+    {
+        return true;
+    }
+    // Nodes without summary support, local forks that need a rollback and bodies that could not all be
+    // downloaded are handled by hash sync, over the whole range
+    DEBUGLOG("header first sync ret:{}, falling back to hash sync", headerFirstRet);
+
     std::vector<std::string> node_ids_returned;
     std::vector<FastSyncBlockHashs> requestHashs;
 
@@ -421,6 +471,20 @@ bool SyncBlock::runFastSyncOnce(const std::vector<std::string> &pledgeAddr, uint
     return flag;
 }
 
+int SyncBlock::locateDivergence(const std::vector<std::string> &pledgeAddr, uint64_t chainHeight, uint64_t nodeSelfHeight, uint32_t syncNodeCount, uint64_t &height)
+{
+    std::vector<std::string> node_ids_to_send;
+    int ret = getSyncNode(syncNodeCount, chainHeight, pledgeAddr, node_ids_to_send);
+    if (ret != 0)
+    {
+        ERRORLOG("get sync node fail");
+        return ret - 1000;
+    }
+    ret = MagicSingleton<SumTreeSync>::GetInstance()->FindDivergence(node_ids_to_send, nodeSelfHeight, height);
+    DEBUGLOG("sum tree divergence search ret: {}, height: {}", ret, height);
+    return ret;
+}
+
 int SyncBlock::runNewSyncOnce(const std::vector<std::string> &pledgeAddr, uint64_t chainHeight, uint64_t nodeSelfHeight, uint64_t syncInitHeight, uint64_t endSyncHeight_, uint32_t syncNodeCount)
 {
     int ret = 0;
@@ -470,6 +534,23 @@ int SyncBlock::runFromZeroSyncOnce(const std::vector<std::string> &pledgeAddr, u
     {
         return ret - 1000;
     }
+    auto stateSnapshot = MagicSingleton<StateSnapshot>::GetInstance();
+    if (nodeSelfHeight < StateSnapshot::kInterval || stateSnapshot->ImportPending())
+    {
+        ret = MagicSingleton<SnapshotSync>::GetInstance()->Run(node_ids_to_send, nodeSelfHeight);
+        if (ret == 0)
+        {
+            // Only the blocks above the snapshot are left, the next round syncs them
+            return 0;
+        }
+        if (stateSnapshot->ImportPending())
+        {
+            ERRORLOG("state snapshot import unfinished ret: {}", ret);
+            return ret - 2000;
+        }
+        DEBUGLOG("state snapshot sync not used ret: {}", ret);
+        ret = 0;
+    }
     std::set<std::string> node_ids_returned;
     std::vector<uint64_t> heights;
     if (!syncFromZeroReserveHeights.empty())
@@ -616,6 +697,16 @@ int SyncBlock::get_sync_node_basic(uint32_t num, uint64_t heightBaseline,
                                 const std::function<bool(uint64_t, uint64_t)>& compareReserve,
                                 const std::vector<std::string> &pledgeAddr,
                                 std::vector<std::string> &node_ids_to_send)
+{
+    return get_sync_node_basic(num, heightBaseline, discardComparisonFunc, compareReserve, pledgeAddr, node_ids_to_send, "sync");
+}
+
+int SyncBlock::get_sync_node_basic(uint32_t num, uint64_t heightBaseline,
+                                const std::function<bool(uint64_t, uint64_t)>& discardComparisonFunc,
+                                const std::function<bool(uint64_t, uint64_t)>& compareReserve,
+                                const std::vector<std::string> &pledgeAddr,
+                                std::vector<std::string> &node_ids_to_send,
+                                const std::string &protocol)
 {
     DEBUGLOG("{} Nodes have passed qualification verification, heightBaseline:{}, num:{}", pledgeAddr.size(), heightBaseline, num);
     DBReader dbReader;
@@ -680,43 +771,37 @@ int SyncBlock::get_sync_node_basic(uint32_t num, uint64_t heightBaseline,
         num = global::ca::MIN_SYNC_QUAL_NODES;
     }
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
     std::set<std::string> sendNodeIdsContainer;
-    if(top < global::ca::MIN_UNSTAKE_HEIGHT)
-    {
-        while (sendNodeIdsContainer.size() < num && !qualifyingNode.empty())
+    // Nodes high enough are ranked by how fast and reliably they answered the protocol, some picks stay random to explore
+    auto selectNodes = [&](const std::vector<Node> &candidates) {
+        if (sendNodeIdsContainer.size() >= num)
         {
-            std::uniform_int_distribution<int> qualifyingNodeDistance(0, qualifyingNode.size() - 1);
-            int index = qualifyingNodeDistance(gen);
-            auto &node = qualifyingNode.at(index);
-            if (node.height < heightBaseline)
-            {
-                qualifyingNode.erase(qualifyingNode.cbegin() + index);
-                DEBUGLOG("qualifyingNode.erase, node.height:{}, heightBaseline:{}, addr:{}", node.height, heightBaseline, node.address);
-                continue;
-            }
-            DEBUGLOG("qualifyingNode size:{}, addr:{}, index:{}, nodeHeight:{}",qualifyingNode.size(), node.address, index, node.height);
-            sendNodeIdsContainer.insert(node.address);
-            qualifyingNode.erase(qualifyingNode.cbegin() + index); 
+            return;
         }
-
-        while (sendNodeIdsContainer.size() < num && !nodes.empty()) 
+        std::vector<std::string> eligible;
+        for (const auto &node : candidates)
         {
-            std::uniform_int_distribution<int> distNodes(0, nodes.size() - 1);
-            int index = distNodes(gen);
-            auto &node = nodes.at(index);
             if (node.height < heightBaseline)
             {
                 DEBUGLOG("node.height:{}, heightBaseline:{}, addr:{}", node.height, heightBaseline, node.address);
-                nodes.erase(nodes.begin() + index);
                 continue;
             }
-            DEBUGLOG("sendNodeIdsContainer size:{}, addr:{}, index:{}, nodeHeight:{}",sendNodeIdsContainer.size(), node.address, index, node.height);
-            sendNodeIdsContainer.insert(node.address);
-            nodes.erase(nodes.begin() + index);
+            if (sendNodeIdsContainer.find(node.address) == sendNodeIdsContainer.end())
+            {
+                eligible.push_back(node.address);
+            }
         }
+        for (const auto &addr : MagicSingleton<PeerScore>::GetInstance()->Select(eligible, num - sendNodeIdsContainer.size(), protocol))
+        {
+            DEBUGLOG("sendNodeIdsContainer size:{}, addr:{}", sendNodeIdsContainer.size(), addr);
+            sendNodeIdsContainer.insert(addr);
+        }
+    };
+
+    if(top < global::ca::MIN_UNSTAKE_HEIGHT)
+    {
+        selectNodes(qualifyingNode);
+        selectNodes(nodes);
     }
     else if(qualifyingNode.size() < global::ca::MIN_SYNC_QUAL_NODES || num < global::ca::MIN_SYNC_QUAL_NODES)
     {
@@ -725,20 +810,7 @@ int SyncBlock::get_sync_node_basic(uint32_t num, uint64_t heightBaseline,
     }
     else 
     {
-        while (sendNodeIdsContainer.size() < num && !qualifyingNode.empty())
-        {
-            std::uniform_int_distribution<int> qualifyingNodeDistance(0, qualifyingNode.size() - 1);
-            int index = qualifyingNodeDistance(gen);
-            auto &node = qualifyingNode.at(index);
-            if (node.height < heightBaseline)
-            {
-                qualifyingNode.erase(qualifyingNode.cbegin() + index);
-                continue;
-            }
-            DEBUGLOG("qualifyingNode size:{}, addr:{}, index:{}, nodeHeight:{}",qualifyingNode.size(), node.address, index, node.height);
-            sendNodeIdsContainer.insert(node.address);
-            qualifyingNode.erase(qualifyingNode.cbegin() + index); 
-        }
+        selectNodes(qualifyingNode);
     }
 
     for(const auto& addr : sendNodeIdsContainer)
@@ -785,7 +857,7 @@ bool SyncBlock::get_fast_sync_sum_hash_node(const std::vector<std::string> &node
     node_ids_returned.clear();
     std::string msgId;
     size_t sendNum = node_ids_to_send.size();
-    if (!dataMgrPtr.CreateWait(30, sendNum * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(30, sendNum * 0.8, msgId, "fastSyncSumHash"))
     {
         return false;
     }
@@ -1014,7 +1086,7 @@ bool SyncBlock::get_fast_sync_block_data(const std::string &sendNodeId, const st
     }
     
     std::string msgId;
-    if (!dataMgrPtr.CreateWait(30, 1, msgId))
+    if (!dataMgrPtr.CreateWait(30, 1, msgId, "fastSyncBlock"))
     {
         DEBUGLOG("create wait fail");
         return false;
@@ -1096,7 +1168,7 @@ int SyncBlock::get_sync_sum_hash_node(uint64_t pledge_addr_size, const std::vect
         DEBUGLOG("Enable Byzantine consensus across the entire network, syncSendNum:{}", syncSendNum);
         acceptanceRate = 0.9;
     }
-    if (!dataMgrPtr.CreateWait(60, sendNum * acceptanceRate, msgId))
+    if (!dataMgrPtr.CreateWait(60, sendNum * acceptanceRate, msgId, "syncSumHash"))
     {
         ret = -1;
         return ret;
@@ -1377,7 +1449,7 @@ int SyncBlock::get_sync_block_by_sum_hash_node(std::vector<std::string> &node_id
 {
     int ret = 0;
     std::string msgId;
-    if (!dataMgrPtr.CreateWait(90, node_ids_to_send.size() * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(90, node_ids_to_send.size() * 0.8, msgId, "syncBlockBySumHash"))
     {
         ret = -1;
         return ret;
@@ -1499,7 +1571,7 @@ int SyncBlock::get_from_zero_sync_sum_hash_node(const std::vector<std::string> &
         acceptanceRate = 0.9;
     }
 
-    if (!dataMgrPtr.CreateWait(90, sendNum * acceptanceRate, msgId))
+    if (!dataMgrPtr.CreateWait(90, sendNum * acceptanceRate, msgId, "fromZeroSumHash"))
     {
         return -1;
     }
@@ -1663,7 +1735,7 @@ int SyncBlock::getSyncBlockDataFromZero(const std::map<uint64_t, std::string>& s
     }
     
     std::string msgId;
-    if (!dataMgrPtr.CreateWait(90, node_ids_to_send.size(), msgId))
+    if (!dataMgrPtr.CreateWait(90, node_ids_to_send.size(), msgId, "fromZeroBlock"))
     {
         return -3;
     }
@@ -1876,7 +1948,7 @@ int SyncBlock::getSyncBlockHashVerification(const std::vector<std::string> &node
     int ret = 0;
     std::string msgId;
     uint64_t successCounter = 0;
-    if (!dataMgrPtr.CreateWait(60, sendNum * acceptanceRate, msgId))
+    if (!dataMgrPtr.CreateWait(60, sendNum * acceptanceRate, msgId, "syncBlockHashVerification"))
     {
         ret = -1;
         return ret;
@@ -2123,7 +2195,7 @@ int SyncBlock::get_sync_block_hash_node(const std::vector<std::string> &node_ids
     int ret = 0;
     std::string msgId;
     uint64_t successCounter = 0;
-    if (!dataMgrPtr.CreateWait(60, node_ids_to_send.size() * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(60, node_ids_to_send.size() * 0.8, msgId, "syncBlockHash"))
     {
         ret = -1;
         return ret;
@@ -2326,86 +2398,24 @@ int SyncBlock::get_sync_block_hash_node(const std::vector<std::string> &node_ids
 
 int SyncBlock::getSyncBlockData(std::vector<std::string> &node_ids_to_send, const std::vector<std::string> &reqHashes, uint64_t chainHeight)
 {
-    int ret = 0;
     if (reqHashes.empty() || node_ids_to_send.empty())
     {
         return 0;
     }
-    std::string msgId;
-    if (!dataMgrPtr.CreateWait(60, 3, msgId))
-    {
-        ret = -1;
-        return ret;
-    }
 
-    const uint32_t SEND_MAX_NUM = 10;
-    if(node_ids_to_send.size() > SEND_MAX_NUM)
-    {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::shuffle(node_ids_to_send.begin(), node_ids_to_send.end(), gen);
-        node_ids_to_send.resize(SEND_MAX_NUM);
-    }
-
-    for (auto &nodeId : node_ids_to_send)
-    {
-        if(!dataMgrPtr.AddResNode(msgId, nodeId))
-        {
-            ERRORLOG("getSyncBlockData AddResNode error");
-            return -2;
-        }
-        sendSyncGetBlockRequest(nodeId, msgId, reqHashes);
-        DEBUGLOG("new sync block from {}", nodeId);
-    }
-    std::vector<std::string> retDatas;
-    if (!dataMgrPtr.WaitData(msgId, retDatas))
+    uint64_t nodeSelfHeight = 0;
+    DBReader dbReader;
+    if (DBStatus::DB_SUCCESS != dbReader.getBlockTop(nodeSelfHeight))
     {
-        if(retDatas.empty())
-        {
-            for(const auto& t: node_ids_to_send)
-            {
-                DEBUGLOG("getSyncBlockData send node id:{}", t);
-            }
-            ERRORLOG("wait sync block data time out send:{} recv:{}", node_ids_to_send.size(), retDatas.size());
-            ret = -3;
-            return ret;
-        }
+        return -1;
     }
 
-    CBlock block;
-    CBlock hash_block;
-    SyncGetBlockAck ack;
-    std::map<uint64_t, std::set<CBlock, BlockComparator>> syncBlockData;
-    for (auto &retData : retDatas)
+    DEBUGLOG("getSyncBlockData chainHeight:{}, nodeSelfHeight:{}, blocks:{}, nodes:{}", chainHeight, nodeSelfHeight, reqHashes.size(), node_ids_to_send.size());
+    if (MagicSingleton<SyncPipeline>::GetInstance()->Run(node_ids_to_send, reqHashes, nodeSelfHeight) != 0)
     {
-        ack.Clear();
-        if (!ack.ParseFromString(retData))
-        {
-            continue;
-        }
-        for (auto &block_raw : ack.blocks())
-        {
-            if (block.ParseFromString(block_raw))
-            {
-                std::string findKey = std::to_string(block.height()) + "_" + block.hash().substr(0, SUBSTR_LEN);
-                if (reqHashes.cend() == std::find(reqHashes.cbegin(), reqHashes.cend(), findKey))
-                {
-                    continue;
-                }
-                hash_block = block;
-                hash_block.clear_hash();
-                hash_block.clear_sign();
-                if (block.hash() != Getsha256hash(hash_block.SerializeAsString()))
-                {
-                    continue;
-                }
-                addBlockToMap(block, syncBlockData);
-            }
-        }
+        ERRORLOG("sync pipeline could not fetch every requested block");
+        return -3;
     }
-
-    MagicSingleton<BlockHelper>::GetInstance()->AddSyncBlock(syncBlockData, global::ca::SaveType::SyncNormal);
-
     return 0;
 }
 
@@ -2512,7 +2522,7 @@ bool SyncBlock::get_sync_node_hash_info(const std::vector<Node> &nodes, const st
     DEBUGLOG("recvRequirement size: {}", recvRequirement);
 
     std::string msgId;
-    if (!dataMgrPtr.CreateWait(60, recvRequirement, msgId))
+    if (!dataMgrPtr.CreateWait(60, recvRequirement, msgId, "syncNodeHeight"))
     {
         ERRORLOG("Create wait fail");
         return false;
@@ -2569,7 +2579,7 @@ int SyncBlock::fetchRollbackBlock(const std::vector<std::string> &node_ids_to_se
     int ret = 0;
     std::string msgId;
     uint64_t successCounter = 0;
-    if (!dataMgrPtr.CreateWait(60, sendNum * acceptanceRate, msgId))
+    if (!dataMgrPtr.CreateWait(60, sendNum * acceptanceRate, msgId, "syncRollbackBlock"))
     {
         ret = -1;
         return ret;
@@ -2976,6 +2986,256 @@ int handleFastSyncBlockAcknowledge(const std::shared_ptr<FastSyncGetBlockAck> &m
     return 0;
 }
 
+void sendSyncGetBlockSummaryRequest(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight)
+{
+    SyncGetBlockSummaryReq req;
+    req.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    req.set_msg_id(msgId);
+    req.set_start_height(startHeight);
+    req.set_end_height(endHeight);
+    NetSendMessage<SyncGetBlockSummaryReq>(nodeId, req, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+void sendSyncBlockSummaryAcknowledge(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight)
+{
+    if(startHeight > endHeight)
+    {
+        return;
+    }
+    if ((endHeight - startHeight) > 100000)
+    {
+        return;
+    }
+    SyncGetBlockSummaryAck ack;
+    ack.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    ack.set_msg_id(msgId);
+    DBReader dbReader;
+    uint64_t nodeBlockHeight = 0;
+    if (DBStatus::DB_SUCCESS != dbReader.getBlockTop(nodeBlockHeight))
+    {
+        ERRORLOG("getBlockTop error");
+        return;
+    }
+    ack.set_node_block_height(nodeBlockHeight);
+
+    // Same stability rule as the fast sync hash list: blocks younger than kStabilityTime may still be replaced
+    uint64_t currentTime = MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp();
+    for (uint64_t height = startHeight; height <= endHeight && height <= nodeBlockHeight; ++height)
+    {
+        std::vector<std::string> hashs;
+        std::vector<std::string> blocksRaw;
+        if (DBStatus::DB_SUCCESS != dbReader.getBlockHashsByBlockHeight(height, hashs)
+            || DBStatus::DB_SUCCESS != dbReader.getBlocksByBlockHash(hashs, blocksRaw))
+        {
+            ERRORLOG("read blocks at height {} fail", height);
+            return;
+        }
+        for (const auto &blockRaw : blocksRaw)
+        {
+            CBlock block;
+            if (!block.ParseFromString(blockRaw))
+            {
+                return;
+            }
+            if ((currentTime - block.time()) < kStabilityTime)
+            {
+                continue;
+            }
+            HeaderFirstSync::MakeSummary(block, *ack.add_summaries());
+        }
+    }
+    NetSendMessage<SyncGetBlockSummaryAck>(nodeId, ack, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+int handleSyncGetBlockSummaryRequest(const std::shared_ptr<SyncGetBlockSummaryReq> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetBlockSummaryRequest verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    sendSyncBlockSummaryAcknowledge(msg->self_node_id(), msg->msg_id(), msg->start_height(), msg->end_height());
+    return 0;
+}
+
+int handleSyncGetBlockSummaryAcknowledge(const std::shared_ptr<SyncGetBlockSummaryAck> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetBlockSummaryAcknowledge verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    dataMgrPtr.waitDataToAdd(msg->msg_id(), msg->self_node_id(), msg->SerializeAsString());
+    return 0;
+}
+
+void sendSyncGetSumTreeRequest(const std::string &nodeId, const std::string &msgId, uint32_t level, uint64_t startIndex, uint32_t count, uint64_t maxHeight)
+{
+    SyncGetSumTreeReq req;
+    req.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    req.set_msg_id(msgId);
+    req.set_level(level);
+    req.set_start_index(startIndex);
+    req.set_count(count);
+    req.set_max_height(maxHeight);
+    NetSendMessage<SyncGetSumTreeReq>(nodeId, req, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+void sendSyncSumTreeAcknowledge(const std::string &nodeId, const std::string &msgId, uint32_t level, uint64_t startIndex, uint32_t count, uint64_t maxHeight)
+{
+    if (level >= SumHashTree::kLevels || count == 0 || count > SumTreeSync::kMaxNodesPerRequest)
+    {
+        return;
+    }
+    SyncGetSumTreeAck ack;
+    ack.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    ack.set_msg_id(msgId);
+    ack.set_level(level);
+    DBReader dbReader;
+    uint64_t nodeBlockHeight = 0;
+    if (DBStatus::DB_SUCCESS != dbReader.getBlockTop(nodeBlockHeight))
+    {
+        ERRORLOG("getBlockTop error");
+        return;
+    }
+    ack.set_node_block_height(nodeBlockHeight);
+
+    // A node still building its tree or lagging behind the cut would vote with partial hashes
+    if (!SumHashTree::IsComplete(dbReader) || nodeBlockHeight < maxHeight)
+    {
+        ack.set_code(-1);
+    }
+    else
+    {
+        for (uint64_t index = startIndex; index < startIndex + count; ++index)
+        {
+            std::string hash;
+            if (!SumHashTree::GetNode(dbReader, level, index, maxHeight, hash))
+            {
+                ERRORLOG("read sum tree node {} at level {} fail", index, level);
+                return;
+            }
+            auto node = ack.add_nodes();
+            node->set_index(index);
+            node->set_hash(hash);
+        }
+        ack.set_code(0);
+    }
+    NetSendMessage<SyncGetSumTreeAck>(nodeId, ack, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+int handleSyncGetSumTreeRequest(const std::shared_ptr<SyncGetSumTreeReq> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetSumTreeRequest verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    sendSyncSumTreeAcknowledge(msg->self_node_id(), msg->msg_id(), msg->level(), msg->start_index(), msg->count(), msg->max_height());
+    return 0;
+}
+
+int handleSyncGetSumTreeAcknowledge(const std::shared_ptr<SyncGetSumTreeAck> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetSumTreeAcknowledge verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    dataMgrPtr.waitDataToAdd(msg->msg_id(), msg->self_node_id(), msg->SerializeAsString());
+    return 0;
+}
+
+void sendSyncGetSnapshotManifestRequest(const std::string &nodeId, const std::string &msgId)
+{
+    SyncGetSnapshotManifestReq req;
+    req.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    req.set_msg_id(msgId);
+    NetSendMessage<SyncGetSnapshotManifestReq>(nodeId, req, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+void sendSyncSnapshotManifestAcknowledge(const std::string &nodeId, const std::string &msgId)
+{
+    SyncGetSnapshotManifestAck ack;
+    ack.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    ack.set_msg_id(msgId);
+    DBReader dbReader;
+    uint64_t nodeBlockHeight = 0;
+    if (DBStatus::DB_SUCCESS != dbReader.getBlockTop(nodeBlockHeight))
+    {
+        ERRORLOG("getBlockTop error");
+        return;
+    }
+    ack.set_node_block_height(nodeBlockHeight);
+    ack.set_code(MagicSingleton<StateSnapshot>::GetInstance()->GetManifest(*ack.mutable_manifest()) ? 0 : -1);
+    NetSendMessage<SyncGetSnapshotManifestAck>(nodeId, ack, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+void sendSyncGetSnapshotChunkRequest(const std::string &nodeId, const std::string &msgId, uint64_t height, uint32_t index)
+{
+    SyncGetSnapshotChunkReq req;
+    req.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    req.set_msg_id(msgId);
+    req.set_height(height);
+    req.set_index(index);
+    NetSendMessage<SyncGetSnapshotChunkReq>(nodeId, req, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+void sendSyncSnapshotChunkAcknowledge(const std::string &nodeId, const std::string &msgId, uint64_t height, uint32_t index)
+{
+    SyncGetSnapshotChunkAck ack;
+    ack.set_self_node_id(MagicSingleton<PeerNode>::GetInstance()->GetSelfId());
+    ack.set_msg_id(msgId);
+    ack.set_height(height);
+    ack.set_index(index);
+    ack.set_code(MagicSingleton<StateSnapshot>::GetInstance()->ReadChunk(height, index, *ack.mutable_data()));
+    NetSendMessage<SyncGetSnapshotChunkAck>(nodeId, ack, net_com::Compress::COMPRESS_TRUE, net_com::Encrypt::ENCRYPT_FALSE, net_com::Priority::PRIORITY_HIGH_LEVEL_1);
+}
+
+int handleSyncGetSnapshotManifestRequest(const std::shared_ptr<SyncGetSnapshotManifestReq> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetSnapshotManifestRequest verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    sendSyncSnapshotManifestAcknowledge(msg->self_node_id(), msg->msg_id());
+    return 0;
+}
+
+int handleSyncGetSnapshotManifestAcknowledge(const std::shared_ptr<SyncGetSnapshotManifestAck> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetSnapshotManifestAcknowledge verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    dataMgrPtr.waitDataToAdd(msg->msg_id(), msg->self_node_id(), msg->SerializeAsString());
+    return 0;
+}
+
+int handleSyncGetSnapshotChunkRequest(const std::shared_ptr<SyncGetSnapshotChunkReq> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetSnapshotChunkRequest verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    sendSyncSnapshotChunkAcknowledge(msg->self_node_id(), msg->msg_id(), msg->height(), msg->index());
+    return 0;
+}
+
+int handleSyncGetSnapshotChunkAcknowledge(const std::shared_ptr<SyncGetSnapshotChunkAck> &msg, const MsgData &msgdata)
+{
+    if(!PeerNode::verifyPeerNodeIdRequest(msgdata.fd, msg->self_node_id()))
+    {
+        ERRORLOG("handleSyncGetSnapshotChunkAcknowledge verifyPeerNodeIdRequest error");
+        return -1;
+    }
+    dataMgrPtr.waitDataToAdd(msg->msg_id(), msg->self_node_id(), msg->SerializeAsString());
+    return 0;
+}
+
 void sendSyncGetSumHashRequest(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight)
 {
     SyncGetSumHashReq req;
@@ -3716,4 +3976,4 @@ int checkVinAcknowledge(const std::shared_ptr<CheckVinAck> &msg, const MsgData &
     DEBUGLOG("handle check vin ack");
     dataMgrPtr.waitDataToAdd(msg->msg_id(), msg->self_node_id(), msg->SerializeAsString());
     return 0;
-}
\ No newline at end of file
+}
\ No newline at end of file
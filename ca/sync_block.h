@@ -119,6 +119,12 @@ public:
     static int get_sync_node_basic(uint32_t num, uint64_t heightBaseline, const std::function<bool(uint64_t, uint64_t)>& discardComparisonFunc, const std::function<bool(uint64_t, uint64_t)>& compareReserve, const std::vector<std::string> &pledgeAddr,
                          std::vector<std::string> &node_ids_to_send);
 
+    /**
+     * @brief       get_sync_node_basic ranking the candidates by their measured score for the protocol
+     */
+    static int get_sync_node_basic(uint32_t num, uint64_t heightBaseline, const std::function<bool(uint64_t, uint64_t)>& discardComparisonFunc, const std::function<bool(uint64_t, uint64_t)>& compareReserve, const std::vector<std::string> &pledgeAddr,
+                         std::vector<std::string> &node_ids_to_send, const std::string &protocol);
+
     static int fetchRollbackBlock(const std::vector<std::string> &node_ids_to_send, uint64_t syncInitHeight, uint64_t endSyncHeight_, uint64_t nodeSelfHeight, std::vector<CBlock> &retBlocks);
 
 private:
@@ -146,6 +152,18 @@ private:
      * @return      int  return 0 success 
      */
     static int runNewSyncOnce(const std::vector<std::string> &pledgeAddr, uint64_t chainHeight, uint64_t nodeSelfHeight, uint64_t syncInitHeight, uint64_t endSyncHeight_, uint32_t syncNodeCount);
+
+    /**
+     * @brief       Bisect the sum hash tree with the sync nodes to find where the local chain forks off
+     * 
+     * @param       pledgeAddr: Delegating pledge list
+     * @param       chainHeight: Current chain height
+     * @param       nodeSelfHeight: self node height
+     * @param       syncNodeCount: sync node num
+     * @param       height: first divergent height
+     * @return      int  return 0 a divergent height was found
+     */
+    static int locateDivergence(const std::vector<std::string> &pledgeAddr, uint64_t chainHeight, uint64_t nodeSelfHeight, uint32_t syncNodeCount, uint64_t &height);
     
     /**
      * @brief       from zero sync 
@@ -359,6 +377,25 @@ int handleFastSyncHashAcknowledge(const std::shared_ptr<FastSyncGetHashAck> &msg
 int handleFastSyncBlockRequest(const std::shared_ptr<FastSyncGetBlockReq> &msg, const MsgData &msgdata);
 int handleFastSyncBlockAcknowledge(const std::shared_ptr<FastSyncGetBlockAck> &msg, const MsgData &msgdata);
 
+void sendSyncGetBlockSummaryRequest(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight);
+void sendSyncBlockSummaryAcknowledge(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight);
+int handleSyncGetBlockSummaryRequest(const std::shared_ptr<SyncGetBlockSummaryReq> &msg, const MsgData &msgdata);
+int handleSyncGetBlockSummaryAcknowledge(const std::shared_ptr<SyncGetBlockSummaryAck> &msg, const MsgData &msgdata);
+
+void sendSyncGetSumTreeRequest(const std::string &nodeId, const std::string &msgId, uint32_t level, uint64_t startIndex, uint32_t count, uint64_t maxHeight);
+void sendSyncSumTreeAcknowledge(const std::string &nodeId, const std::string &msgId, uint32_t level, uint64_t startIndex, uint32_t count, uint64_t maxHeight);
+int handleSyncGetSumTreeRequest(const std::shared_ptr<SyncGetSumTreeReq> &msg, const MsgData &msgdata);
+int handleSyncGetSumTreeAcknowledge(const std::shared_ptr<SyncGetSumTreeAck> &msg, const MsgData &msgdata);
+
+void sendSyncGetSnapshotManifestRequest(const std::string &nodeId, const std::string &msgId);
+void sendSyncSnapshotManifestAcknowledge(const std::string &nodeId, const std::string &msgId);
+void sendSyncGetSnapshotChunkRequest(const std::string &nodeId, const std::string &msgId, uint64_t height, uint32_t index);
+void sendSyncSnapshotChunkAcknowledge(const std::string &nodeId, const std::string &msgId, uint64_t height, uint32_t index);
+int handleSyncGetSnapshotManifestRequest(const std::shared_ptr<SyncGetSnapshotManifestReq> &msg, const MsgData &msgdata);
+int handleSyncGetSnapshotManifestAcknowledge(const std::shared_ptr<SyncGetSnapshotManifestAck> &msg, const MsgData &msgdata);
+int handleSyncGetSnapshotChunkRequest(const std::shared_ptr<SyncGetSnapshotChunkReq> &msg, const MsgData &msgdata);
+int handleSyncGetSnapshotChunkAcknowledge(const std::shared_ptr<SyncGetSnapshotChunkAck> &msg, const MsgData &msgdata);
+
 void sendSyncGetSumHashRequest(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight);
 void sendSyncSumHashAcknowledgement(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight);
 void sendSyncGetHeightHashRequest(const std::string &nodeId, const std::string &msgId, uint64_t startHeight, uint64_t endHeight);
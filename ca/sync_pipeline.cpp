@@ -0,0 +1,473 @@
+#include "ca/sync_pipeline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "ca/global.h"
+#include "ca/sync_block.h"
+#include "ca/block_helper.h"
+#include "db/db_api.h"
+#include "include/logging.h"
+#include "common/global_data.h"
+#include "common/peer_score.h"
+#include "utils/magic_singleton.h"
+#include "utils/account_manager.h"
+
+namespace
+{
+    const uint32_t SUBSTR_LEN = 8;
+    const double kDefaultRttMs = 1000;
+    const double kSampleWeight = 0.3;
+    const uint32_t kMinRequestTimeoutSec = 5;
+    const uint32_t kMaxRequestTimeoutSec = 30;
+    const uint32_t kSaveStallSec = 15;
+    const size_t kMaxPeerSamples = 256;
+
+    uint64_t keyHeight(const std::string &key)
+    {
+        return std::strtoull(key.c_str(), nullptr, 10);
+    }
+
+    // Peers new to the pipeline start from what other requests measured of them
+    double defaultRttMs(const std::string &peer)
+    {
+        double score = MagicSingleton<PeerScore>::GetInstance()->Score(peer, "syncGetBlock");
+        return score > 0 ? std::min(1000.0 / score, kDefaultRttMs) : kDefaultRttMs;
+    }
+
+    double secondsSince(std::chrono::steady_clock::time_point begin)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+}
+
+int SyncPipeline::Run(const std::vector<std::string> &peers, const std::vector<std::string> &reqHashes, uint64_t nodeSelfHeight)
+{
+    if (reqHashes.empty() || peers.empty())
+    {
+        return 0;
+    }
+
+    std::vector<std::string> keys = reqHashes;
+    std::stable_sort(keys.begin(), keys.end(), [](const std::string &a, const std::string &b){
+        return keyHeight(a) < keyHeight(b);
+    });
+
+    std::lock_guard<std::mutex> runLock(_runMutex);
+    std::unique_lock<std::mutex> lock(_mutex);
+    _peers = peers;
+    _ranges.clear();
+    _downloadQueue.clear();
+    _verifyQueue.clear();
+    _verified.clear();
+    _failedRange = SIZE_MAX;
+    _nextSave = 0;
+    _inflight = 0;
+    _outstanding.clear();
+    _stopping = false;
+    _runDownloaded = 0;
+    _runVerified = 0;
+    _runVerifyNanos = 0;
+
+    if (_peerSamples.size() > kMaxPeerSamples)
+    {
+        std::set<std::string> current(peers.begin(), peers.end());
+        for (auto iter = _peerSamples.begin(); iter != _peerSamples.end();)
+        {
+            iter = current.count(iter->first) ? std::next(iter) : _peerSamples.erase(iter);
+        }
+    }
+    for (const auto &peer : peers)
+    {
+        _peerSamples[peer].inflight = 0;
+    }
+
+    for (size_t begin = 0; begin < keys.size(); begin += kBlocksPerRange)
+    {
+        Range range;
+        range.index = _ranges.size();
+        auto end = std::min(keys.size(), begin + kBlocksPerRange);
+        range.pending.insert(keys.begin() + begin, keys.begin() + end);
+        _downloadQueue.push_back(range.index);
+        _ranges.push_back(std::move(range));
+    }
+    DEBUGLOG("sync pipeline begin, blocks:{}, ranges:{}, peers:{}, window:{}", keys.size(), _ranges.size(), peers.size(), _window);
+
+    auto begin = std::chrono::steady_clock::now();
+    _lastResponse = begin;
+    std::thread verifier(&SyncPipeline::verifyLoop, this);
+    std::thread saver(&SyncPipeline::saveLoop, this, nodeSelfHeight);
+
+    struct Fetch
+    {
+        size_t index;
+        std::string peer;
+        std::vector<std::string> keys;
+        uint32_t timeoutSec;
+    };
+    while (_nextSave < _ranges.size() && !(_failedRange != SIZE_MAX && _nextSave > _failedRange))
+    {
+        std::vector<Fetch> fetches;
+        while (_inflight < _window && !_downloadQueue.empty())
+        {
+            auto &range = _ranges[_downloadQueue.front()];
+            std::string peer;
+            if (!selectPeer(range, peer))
+            {
+                break;
+            }
+            _downloadQueue.pop_front();
+            ++_inflight;
+            ++range.attempts;
+            range.triedPeers.insert(peer);
+            ++_peerSamples[peer].inflight;
+
+            std::vector<std::string> rangeKeys(range.pending.begin(), range.pending.end());
+            fetches.push_back({range.index, peer, std::move(rangeKeys), requestTimeoutSec(peer)});
+        }
+        if (!fetches.empty())
+        {
+            // Responses are delivered by callbacks taking _mutex, so requests go out unlocked
+            lock.unlock();
+            for (auto &fetch : fetches)
+            {
+                fetchRange(fetch.index, std::move(fetch.peer), std::move(fetch.keys), fetch.timeoutSec);
+            }
+            lock.lock();
+        }
+        _cv.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    _stopping = true;
+    bool failed = _failedRange != SIZE_MAX;
+    std::set<std::string> outstanding = _outstanding;
+    lock.unlock();
+    _cv.notify_all();
+
+    // Requests still in flight are no longer needed, nothing waits for their timeouts
+    for (const auto &msgId : outstanding)
+    {
+        dataMgrPtr.Cancel(msgId);
+    }
+    lock.lock();
+    _cv.wait(lock, [this]{ return _inflight == 0; });
+    lock.unlock();
+    verifier.join();
+    saver.join();
+
+    {
+        std::lock_guard<std::mutex> statsLock(_statsMutex);
+        double downloadSec = std::chrono::duration<double>(_lastResponse - begin).count();
+        ++_stats.runs;
+        _stats.window = _window;
+        _stats.downloadBlocksPerSec = downloadSec > 0 ? _runDownloaded / downloadSec : 0;
+        _stats.verifyBlocksPerSec = _runVerifyNanos > 0 ? _runVerified * 1e9 / _runVerifyNanos : 0;
+        INFOLOG("sync pipeline end, elapsed:{:.2f}s, download:{:.1f} blocks/s, verify:{:.1f} blocks/s, save:{:.1f} blocks/s, window:{}",
+                secondsSince(begin), _stats.downloadBlocksPerSec, _stats.verifyBlocksPerSec, _stats.saveBlocksPerSec, _window);
+    }
+    return failed ? -1 : 0;
+}
+
+SyncPipelineStats SyncPipeline::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+void SyncPipeline::fetchRange(size_t index, std::string peer, std::vector<std::string> keys, uint32_t timeoutSec)
+{
+    auto begin = std::chrono::steady_clock::now();
+    auto msgId = std::make_shared<std::string>();
+    auto deliver = [this, index, peer, begin, msgId](GlobalDataManager::WaitResult result) {
+        Response response;
+        response.index = index;
+        // A hedged request may have been answered by the backup peer
+        response.peer = result.responders.empty() ? peer : result.responders.front();
+        response.timedOut = !result.quorum;
+        response.rttMs = secondsSince(begin) * 1000;
+        response.data = std::move(result.data);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_inflight;
+            --_peerSamples[peer].inflight;
+            _outstanding.erase(*msgId);
+            if (!result.cancelled)
+            {
+                _lastResponse = std::chrono::steady_clock::now();
+                _verifyQueue.push_back(std::move(response));
+            }
+        }
+        _cv.notify_all();
+    };
+
+    if (!dataMgrPtr.CreateAsyncWait("syncGetBlock", timeoutSec, 1, {peer}, deliver, *msgId))
+    {
+        GlobalDataManager::WaitResult timedOut;
+        timedOut.timedOut = true;
+        deliver(std::move(timedOut));
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _outstanding.insert(*msgId);
+    }
+    sendSyncGetBlockRequest(peer, *msgId, keys);
+    // _peers only changes between runs and a hedge only fires while this request is still open
+    MagicSingleton<PeerScore>::GetInstance()->Hedge(*msgId, "syncGetBlock", peer, _peers, [msgId, keys](const std::string &backup) {
+        sendSyncGetBlockRequest(backup, *msgId, keys);
+    });
+}
+
+void SyncPipeline::verifyLoop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cv.wait(lock, [this]{ return _stopping || !_verifyQueue.empty(); });
+        if (_verifyQueue.empty())
+        {
+            return;
+        }
+        Response response = std::move(_verifyQueue.front());
+        _verifyQueue.pop_front();
+        std::set<std::string> pending = _ranges[response.index].pending;
+        lock.unlock();
+
+        auto begin = std::chrono::steady_clock::now();
+        std::map<uint64_t, std::set<CBlock, BlockComparator>> blocks;
+        std::set<std::string> received;
+        SyncGetBlockAck ack;
+        CBlock block;
+        for (const auto &retData : response.data)
+        {
+            ack.Clear();
+            if (!ack.ParseFromString(retData))
+            {
+                continue;
+            }
+            for (const auto &blockRaw : ack.blocks())
+            {
+                if (!block.ParseFromString(blockRaw))
+                {
+                    continue;
+                }
+                std::string findKey = std::to_string(block.height()) + "_" + block.hash().substr(0, SUBSTR_LEN);
+                if (pending.find(findKey) == pending.end())
+                {
+                    continue;
+                }
+                if (!blockMatchesHeader(block))
+                {
+                    continue;
+                }
+                received.insert(findKey);
+                blocks[block.height()].insert(block);
+            }
+        }
+        auto verifyNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+        lock.lock();
+        auto &range = _ranges[response.index];
+        for (const auto &key : received)
+        {
+            range.pending.erase(key);
+        }
+        for (auto &[height, heightBlocks] : blocks)
+        {
+            range.blocks[height].insert(heightBlocks.begin(), heightBlocks.end());
+        }
+        _runDownloaded += received.size();
+        _runVerified += received.size();
+        _runVerifyNanos += verifyNanos;
+        {
+            std::lock_guard<std::mutex> statsLock(_statsMutex);
+            _stats.downloadedBlocks += received.size();
+            _stats.verifiedBlocks += received.size();
+            _stats.timeouts += response.timedOut ? 1 : 0;
+        }
+
+        updatePeer(response.peer, response.rttMs, received.size(), response.timedOut || received.empty());
+        resizeWindow(response.timedOut);
+
+        if (range.pending.empty() || range.attempts >= kMaxRangeAttempts)
+        {
+            if (!range.pending.empty())
+            {
+                ERRORLOG("sync pipeline range {} still misses {} blocks after {} attempts", range.index, range.pending.size(), range.attempts);
+                _failedRange = std::min(_failedRange, range.index);
+            }
+            _verified.insert(range.index);
+        }
+        else
+        {
+            DEBUGLOG("sync pipeline retry range {}, missing:{}, peer:{}", range.index, range.pending.size(), response.peer);
+            std::lock_guard<std::mutex> statsLock(_statsMutex);
+            ++_stats.retries;
+            _downloadQueue.push_front(range.index);
+        }
+        _cv.notify_all();
+    }
+}
+
+void SyncPipeline::saveLoop(uint64_t nodeSelfHeight)
+{
+    std::map<uint64_t, uint64_t> handedBlocks;
+    uint64_t targetHeight = nodeSelfHeight;
+    std::chrono::steady_clock::time_point begin;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_nextSave < _ranges.size())
+    {
+        _cv.wait(lock, [this]{ return _stopping || _verified.count(_nextSave); });
+        if (!_verified.count(_nextSave))
+        {
+            break;
+        }
+        auto &range = _ranges[_nextSave];
+        auto blocks = std::move(range.blocks);
+        bool last = range.index == _failedRange;
+        ++_nextSave;
+        lock.unlock();
+        _cv.notify_all();
+
+        if (handedBlocks.empty())
+        {
+            begin = std::chrono::steady_clock::now();
+        }
+        for (const auto &[height, heightBlocks] : blocks)
+        {
+            handedBlocks[height] += heightBlocks.size();
+            targetHeight = std::max(targetHeight, height);
+        }
+        MagicSingleton<BlockHelper>::GetInstance()->AddSyncBlock(blocks, global::ca::SaveType::SyncNormal);
+
+        lock.lock();
+        if (last)
+        {
+            break;
+        }
+    }
+    lock.unlock();
+
+    if (handedBlocks.empty())
+    {
+        return;
+    }
+
+    // BlockHelper saves on its own schedule; follow the top height until the handed blocks land or progress stalls
+    uint64_t top = nodeSelfHeight;
+    auto lastProgress = std::chrono::steady_clock::now();
+    while (top < targetHeight && secondsSince(lastProgress) < kSaveStallSec)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        uint64_t current = 0;
+        DBReader dbReader;
+        if (DBStatus::DB_SUCCESS == dbReader.getBlockTop(current) && current > top)
+        {
+            top = current;
+            lastProgress = std::chrono::steady_clock::now();
+        }
+    }
+
+    uint64_t saved = 0;
+    for (const auto &[height, count] : handedBlocks)
+    {
+        if (height > top)
+        {
+            break;
+        }
+        saved += count;
+    }
+    double elapsed = secondsSince(begin);
+    std::lock_guard<std::mutex> statsLock(_statsMutex);
+    _stats.savedBlocks += saved;
+    _stats.saveBlocksPerSec = elapsed > 0 ? saved / elapsed : 0;
+}
+
+bool SyncPipeline::selectPeer(const Range &range, std::string &peer)
+{
+    double bestScore = 0;
+    bool bestTried = true;
+    bool found = false;
+    for (const auto &candidate : _peers)
+    {
+        const auto &sample = _peerSamples[candidate];
+        if (sample.inflight >= kMaxPeerInflight)
+        {
+            continue;
+        }
+        bool tried = range.triedPeers.count(candidate) != 0;
+        double rtt = sample.rttMs > 0 ? sample.rttMs : defaultRttMs(candidate);
+        double score = (sample.inflight + 1) * rtt * (1 + sample.failures);
+        if (!found || (bestTried && !tried) || (bestTried == tried && score < bestScore))
+        {
+            peer = candidate;
+            bestScore = score;
+            bestTried = tried;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void SyncPipeline::updatePeer(const std::string &peer, double rttMs, size_t blocks, bool failed)
+{
+    auto &sample = _peerSamples[peer];
+    if (failed)
+    {
+        ++sample.failures;
+        sample.rttMs = std::max(sample.rttMs, rttMs);
+        return;
+    }
+    if (sample.failures > 0)
+    {
+        --sample.failures;
+    }
+    double blocksPerSec = rttMs > 0 ? blocks * 1000.0 / rttMs : 0;
+    sample.rttMs = sample.rttMs > 0 ? sample.rttMs * (1 - kSampleWeight) + rttMs * kSampleWeight : rttMs;
+    sample.blocksPerSec = sample.blocksPerSec > 0 ? sample.blocksPerSec * (1 - kSampleWeight) + blocksPerSec * kSampleWeight : blocksPerSec;
+}
+
+void SyncPipeline::resizeWindow(bool congested)
+{
+    uint32_t ceiling = std::clamp<uint32_t>(_peers.size() * kMaxPeerInflight, kMinWindow, kMaxWindow);
+    if (congested)
+    {
+        _window = std::max(kMinWindow, _window / 2);
+        return;
+    }
+
+    double throughput = 0;
+    double rtt = 0;
+    uint32_t measured = 0;
+    for (const auto &peer : _peers)
+    {
+        const auto &sample = _peerSamples[peer];
+        if (sample.rttMs > 0 && sample.failures == 0)
+        {
+            throughput += sample.blocksPerSec;
+            rtt += sample.rttMs;
+            ++measured;
+        }
+    }
+    if (measured == 0)
+    {
+        return;
+    }
+    rtt /= measured;
+
+    // Enough ranges in flight to cover one round trip at the measured aggregate rate, grown one step at a time
+    auto bdp = static_cast<uint32_t>(std::ceil(throughput * rtt / 1000 / kBlocksPerRange)) + 1;
+    _window = std::clamp<uint32_t>(std::min(bdp, _window + 1), kMinWindow, ceiling);
+}
+
+uint32_t SyncPipeline::requestTimeoutSec(const std::string &peer)
+{
+    const auto &sample = _peerSamples[peer];
+    if (sample.rttMs <= 0)
+    {
+        return kMaxRequestTimeoutSec;
+    }
+    return std::clamp<uint32_t>(std::ceil(sample.rttMs * 4 / 1000), kMinRequestTimeoutSec, kMaxRequestTimeoutSec);
+}
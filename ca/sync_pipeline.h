@@ -0,0 +1,145 @@
+/**
+ * *****************************************************************************
+ * @file        sync_pipeline.h
+ * @brief       Windowed, multi-peer block download with concurrent verify and save stages
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_SYNC_PIPELINE_HEADER
+#define CA_SYNC_PIPELINE_HEADER
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ca/block_compare.h"
+#include "proto/block.pb.h"
+
+/**
+ * @brief       Per-peer transfer measurements kept across sync rounds
+ */
+struct SyncPeerSample
+{
+    double rttMs = 0;
+    double blocksPerSec = 0;
+    uint32_t inflight = 0;
+    uint32_t failures = 0;
+};
+
+/**
+ * @brief       Throughput of the last pipeline run and running totals
+ */
+struct SyncPipelineStats
+{
+    uint32_t window = 0;
+    uint64_t runs = 0;
+    uint64_t downloadedBlocks = 0;
+    uint64_t verifiedBlocks = 0;
+    uint64_t savedBlocks = 0;
+    uint64_t timeouts = 0;
+    uint64_t retries = 0;
+    double downloadBlocksPerSec = 0;
+    double verifyBlocksPerSec = 0;
+    double saveBlocksPerSec = 0;
+};
+
+/**
+ * @brief       Block download engine used by new sync.
+ *              Requested hashes are split into height ordered ranges. Up to `window`
+ *              ranges are in flight at once, spread over the returned peers. Responses
+ *              arrive through async waits, so no thread is parked per request; a verify
+ *              thread checks them as they arrive and a save thread hands verified
+ *              ranges to BlockHelper in height order. The window follows the measured
+ *              bandwidth-delay product of the peers.
+ */
+class SyncPipeline
+{
+public:
+    SyncPipeline() = default;
+    ~SyncPipeline() = default;
+    SyncPipeline(SyncPipeline &&) = delete;
+    SyncPipeline(const SyncPipeline &) = delete;
+    SyncPipeline &operator=(SyncPipeline &&) = delete;
+    SyncPipeline &operator=(const SyncPipeline &) = delete;
+
+    /**
+     * @brief       Download, verify and save the requested blocks
+     *
+     * @param       peers: nodes that returned the verified block hashes
+     * @param       reqHashes: "height_hashprefix" keys of the blocks to fetch
+     * @param       nodeSelfHeight: local top height before the run
+     * @return      int return 0 success, negative when some range could not be fetched
+     */
+    int Run(const std::vector<std::string> &peers, const std::vector<std::string> &reqHashes, uint64_t nodeSelfHeight);
+
+    /**
+     * @brief       Snapshot of the pipeline counters
+     */
+    SyncPipelineStats GetStats();
+
+    static constexpr size_t kBlocksPerRange = 32;
+    static constexpr uint32_t kMinWindow = 2;
+    static constexpr uint32_t kMaxWindow = 32;
+    static constexpr uint32_t kMaxPeerInflight = 2;
+    static constexpr uint32_t kMaxRangeAttempts = 4;
+
+private:
+    struct Range
+    {
+        size_t index = 0;
+        std::set<std::string> pending;
+        std::set<std::string> triedPeers;
+        uint32_t attempts = 0;
+        std::map<uint64_t, std::set<CBlock, BlockComparator>> blocks;
+    };
+
+    struct Response
+    {
+        size_t index = 0;
+        std::string peer;
+        bool timedOut = false;
+        double rttMs = 0;
+        std::vector<std::string> data;
+    };
+
+    void fetchRange(size_t index, std::string peer, std::vector<std::string> keys, uint32_t timeoutSec);
+    void verifyLoop();
+    void saveLoop(uint64_t nodeSelfHeight);
+    bool selectPeer(const Range &range, std::string &peer);
+    void updatePeer(const std::string &peer, double rttMs, size_t blocks, bool failed);
+    void resizeWindow(bool congested);
+    uint32_t requestTimeoutSec(const std::string &peer);
+
+    std::mutex _runMutex;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::vector<std::string> _peers;
+    std::vector<Range> _ranges;
+    std::deque<size_t> _downloadQueue;
+    std::deque<Response> _verifyQueue;
+    std::set<size_t> _verified;
+    size_t _failedRange = SIZE_MAX;
+    size_t _nextSave = 0;
+    uint32_t _inflight = 0;
+    std::set<std::string> _outstanding;
+    bool _stopping = false;
+    uint64_t _runDownloaded = 0;
+    uint64_t _runVerified = 0;
+    uint64_t _runVerifyNanos = 0;
+    std::chrono::steady_clock::time_point _lastResponse;
+
+    std::map<std::string, SyncPeerSample> _peerSamples;
+    uint32_t _window = kMinWindow;
+
+    std::mutex _statsMutex;
+    SyncPipelineStats _stats;
+};
+
+#endif
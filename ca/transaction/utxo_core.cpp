@@ -6,6 +6,7 @@
 #include "db_api.h"
 #include "google/protobuf/util/json_util.h"
 #include "net/peer_node.h"
+#include "spendable_utxo_index.h"
 #include "sync_block.h"
 #include "transaction.h"
 #include "transaction.pb.h"
@@ -89,9 +90,7 @@ UtxoCore::createUtxoTransferFrom(CTxUtxos *utxo, const TransferFromParam &param,
   std::multiset<TxHelper::Utxo, TxHelper::UnspentTxOutputComparator>
       outputUtxosSet;
 
-  std::multimap<std::string, std::string> fromAddr_assetType;
-  fromAddr_assetType.insert({param.from.str(), param.asset_type.str()});
-  int ret = TxHelper::FindUtxo(fromAddr_assetType, TxHelper::MAX_VIN_SIZE, balance,outputUtxosSet, param.is_find_utxo);
+  int ret = FindSpendableUtxo(param.from.str(), param.asset_type.str(), TxHelper::MAX_VIN_SIZE, balance, outputUtxosSet, param.is_find_utxo);
   if (ret != 0) {
     ERRORLOG( "FindUtxo failed! The error code is {} " , ret);
     std::cout << Sutil::Format("addr:%s,assettype:%s,ret:%s,is_find_utxo:%s", param.from.str(),param.asset_type.str(),ret,param.is_find_utxo) << std::endl;
@@ -462,7 +461,7 @@ mmc::Expected<uint64_t> UtxoCore::transactionDiscoveryHeight() {
 
   uint64_t endSyncHeight_ = nodeSelfHeight - 3;
   std::string msgId;
-  if (!dataMgrPtr.CreateWait(90, pledgeAddr.size() * 0.8, msgId)) {
+  if (!dataMgrPtr.CreateWait(90, pledgeAddr.size() * 0.8, msgId, "transactionDiscoveryHeight")) {
     return UtxoError(UE_GET_TOP_FAIL).trace(EMATE("-3"));
     return -3;
   }
@@ -10,8 +10,13 @@
 #include "ca/algorithm.h"
 #include "ca/transaction.h"
 #include "ca/block_helper.h"
+#include "ca/block_preverify.h"
+#include "ca/compact_block_relay.h"
 #include "ca/transaction_cache.h"
 #include "ca/failed_transaction_cache.h"
+#include "ca/spent_outpoint_index.h"
+#include "ca/tx_mempool.h"
+#include "ca/spendable_utxo_index.h"
 #include "ca/sync_block.h"
 
 #include <nlohmann/json.hpp>
@@ -20,6 +25,7 @@
 #include "utils/time_util.h"
 #include "utils/time_util.h"
 #include "utils/bench_mark.h"
+#include "utils/tx_lifecycle_tracer.h"
 #include "utils/contract_utils.h"
 #include "utils/magic_singleton.h"
 #include "utils/account_manager.h"
@@ -30,9 +36,24 @@
 #include "common/time_report.h"
 #include "common/global_data.h"
 #include "ca/evm/evm_manager.h"
+#include "ca/evm/contract_payload.h"
 
 class contractDataContainer;
 
+namespace
+{
+    // Spend keys of the cached transactions, guarded by the mutex of their cache
+    SpentOutpointIndex transactionSpends;
+    SpentOutpointIndex contractSpends;
+
+    // A transaction failed or left the mempool unpackaged, its spends no longer conflict and its utxos are selectable again
+    void releaseTransaction(const std::string &txHash)
+    {
+        transactionSpends.Remove(txHash);
+        MagicSingleton<SpendableUtxoIndex>::GetInstance()->Release(txHash);
+    }
+}
+
 const int TransactionCache::BUILD_INTERVAL = 3 * 1000;
 const time_t TransactionCache::_kTxExpireInterval  = 10;
 const int TransactionCache::BUILD_THRESHOLD = 1000000;
@@ -147,6 +168,10 @@ int BuildBlock(const std::list<CTransaction>& txs, const uint64_t& blockHeight,
         auto tx_sum = cblock.txs_size();
         ERRORLOG("Create block failed! : {},  Total number of transactions : {} ", ret, tx_sum);
 		return ret - 100;
+    }
+    for (const auto& tx : cblock.txs())
+    {
+        MagicSingleton<TxLifecycleTracer>::GetInstance()->Record(TxTraceStage::kPack, tx.hash());
     }
 	std::string serBlock = cblock.SerializeAsString();
 	ca_algorithm::PrintBlock(cblock);
@@ -179,52 +204,70 @@ int BuildBlock(const std::list<CTransaction>& txs, const uint64_t& blockHeight,
 
 TransactionCache::TransactionCache()
 {
-    _buildTimer.AsyncLoop(
-        BUILD_INTERVAL, 
-        [=](){ _blockBuilder.notify_one(); }
-        );
+    // No build timer, the packing thread wakes on the deadlines of TxMempoolLimits
 }
 
 uint64_t TransactionCache::getBlockCount()
 {
-    std::unique_lock<std::mutex> locker(transactionCacheMutex);
-    return _transactionCache.rbegin()->get_tx_utxo_height();
+    // _transactionCache only holds a selection while a block is packed, every pending transaction is in the pool
+    return MagicSingleton<TxMempool>::GetInstance()->Size();
 }
 
 int TransactionCache::AddCache(CTransaction& transaction, const std::shared_ptr<TxMsgReq>& msg)
 {
     auto txType = (global::ca::TxType)transaction.txtype();
     bool isContractExecution = txType == global::ca::TxType::TX_TYPE_INVOKE_CONTRACT || txType == global::ca::TxType::kTransactionTypeDeploy;
+    // Derived once here, outside the cache locks, and kept in the index until the transaction leaves the cache
+    std::vector<std::string> spendKeys = Checker::SpendKeys(transaction);
+    std::string conflictHash;
     if (isContractExecution)
     {
         std::unique_lock<std::mutex> locker(contractCacheMutex);
-        if(Checker::CheckConflict(transaction, _contractCache))
+        if(!contractSpends.Add(transaction.hash(), std::move(spendKeys), &conflictHash))
         {
-            DEBUGLOG("DoubleSpentTransactions, txHash:{}", transaction.hash());
+            DEBUGLOG("DoubleSpentTransactions, txHash:{}, conflict:{}", transaction.hash(), conflictHash);
             return -1;
         }
         _contractCache.push_back({transaction, msg->txmsginfo().nodeheight(), false});
+        // Verified by now, later packaging and execution reuse the decoded payload
+        contract_payload::Remember(transaction);
     }
     else
     {
         std::unique_lock<std::mutex> locker(transactionCacheMutex);
-        if(Checker::CheckConflict(transaction, _transactionCache))
+        if(!transactionSpends.Add(transaction.hash(), std::move(spendKeys), &conflictHash))
         {
-            DEBUGLOG("DoubleSpentTransactions, txHash:{}", transaction.hash());
+            DEBUGLOG("DoubleSpentTransactions, txHash:{}, conflict:{}", transaction.hash(), conflictHash);
             return -2;
         }
 
+        uint64_t txUtxoHeight = msg->txmsginfo().txutxoheight();
         if((global::ca::TxType)transaction.txtype() == global::ca::TxType::kTXTypeFund){
-            _transactionCache.push_back({*msg, transaction, msg->txmsginfo().nodeheight()});
-        }else{
-            _transactionCache.push_back({*msg, transaction, msg->txmsginfo().txutxoheight()});
+            txUtxoHeight = msg->txmsginfo().nodeheight();
         }
 
-        if (_transactionCache.size() >= BUILD_THRESHOLD)
+        auto pool = MagicSingleton<TxMempool>::GetInstance();
+        std::vector<std::string> evicted;
+        int ret = pool->Add({*msg, transaction, txUtxoHeight}, evicted);
+        for (const auto &evictedHash : evicted)
+        {
+            releaseTransaction(evictedHash);
+        }
+        if (ret != 0)
+        {
+            transactionSpends.Remove(transaction.hash());
+            DEBUGLOG("mempool rejected txHash:{}, ret:{}", transaction.hash(), ret);
+            return ret - 2;
+        }
+        MagicSingleton<SpendableUtxoIndex>::GetInstance()->Reserve(transaction);
+
+        if (pool->Size() >= pool->GetLimits().packCount)
         {
             _blockBuilder.notify_one();
         }
     }
+    MagicSingleton<CompactBlockRelay>::GetInstance()->AddTransaction(transaction);
+    MagicSingleton<TxLifecycleTracer>::GetInstance()->Record(TxTraceStage::kMempoolInsert, transaction.hash());
     return 0;
 }
 
@@ -345,10 +388,59 @@ int TransactionCache::get_build_block_height(std::vector<TransactionEntity>& txc
 
 void TransactionCache::processTransactionCacheFunc()
 {
+    auto pool = MagicSingleton<TxMempool>::GetInstance();
+    // Earliest time to pack again after an attempt that left its transactions pooled
+    auto retryAt = std::chrono::steady_clock::now();
     while (_threadRun)
     {
         std::unique_lock<std::mutex> locker(transactionCacheMutex);
-        _blockBuilder.wait(locker);
+        // Wake on a full block or when the oldest pending transaction reaches its deadline
+        while (_threadRun)
+        {
+            for (const auto &expiredHash : pool->Expire())
+            {
+                releaseTransaction(expiredHash);
+            }
+
+            auto limits = pool->GetLimits();
+            auto packDelay = std::chrono::milliseconds(limits.packDelayMs);
+            auto now = std::chrono::steady_clock::now();
+            size_t pending = pool->Size();
+            auto oldestAge = pool->OldestAge();
+            bool due = pending >= limits.packCount || (pending > 0 && oldestAge >= packDelay);
+            if (due && now >= retryAt)
+            {
+                break;
+            }
+
+            auto wait = pending > 0 && oldestAge < packDelay ? packDelay - oldestAge : packDelay;
+            if (due)
+            {
+                wait = std::chrono::duration_cast<std::chrono::milliseconds>(retryAt - now);
+            }
+            _blockBuilder.wait_for(locker, std::max(wait, std::chrono::milliseconds(1)));
+        }
+        if (!_threadRun)
+        {
+            break;
+        }
+
+        // Build from a snapshot so transactions keep arriving while the block is packed, their
+        // spends stay indexed until the snapshot leaves the pool, so new ones cannot conflict with it
+        _transactionCache = pool->SelectBest();
+        locker.unlock();
+        retryAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(pool->GetLimits().packDelayMs);
+
+        auto dropCandidates = [this, &pool]() {
+            std::lock_guard<std::mutex> lock(transactionCacheMutex);
+            for (const auto &txEntity : _transactionCache)
+            {
+                const std::string &txHash = txEntity.GetTransaction().hash();
+                pool->Remove(txHash, false);
+                releaseTransaction(txHash);
+            }
+            _transactionCache.clear();
+        };
 
         std::list<CTransaction> buildTxs;
         if(_transactionCache.empty())
@@ -360,7 +452,7 @@ void TransactionCache::processTransactionCacheFunc()
         int buildHeight = get_build_block_height(_transactionCache);
         if(buildHeight < 0)
         {
-            _transactionCache.clear();
+            dropCandidates();
             ERRORLOG("get_build_block_height fail!!! ret:{}", buildHeight);
             continue;
         }
@@ -378,17 +470,29 @@ void TransactionCache::processTransactionCacheFunc()
             ERRORLOG("{} build block fail", ret);
             if(ret == -103 || ret == -104 || ret == -105)
             {
+                std::lock_guard<std::mutex> lock(transactionCacheMutex);
+                _transactionCache.clear();
                 continue;
             }
             
-            _transactionCache.clear();
+            dropCandidates();
             std::cout << "block packaging fail" << std::endl;
             continue;
         }
         std::cout << "block successfully packaged" << std::endl;
-        _transactionCache.clear();
 
-        locker.unlock();
+        // Only the packaged transactions leave, the rest wait for the next block
+        std::lock_guard<std::mutex> lock(transactionCacheMutex);
+        for (const auto &txEntity : _transactionCache)
+        {
+            const std::string &txHash = txEntity.GetTransaction().hash();
+            pool->Remove(txHash);
+            // Its utxos stay reserved until the block is saved
+            transactionSpends.Remove(txHash);
+            MagicSingleton<SpendableUtxoIndex>::GetInstance()->Packaged(txHash);
+        }
+        _transactionCache.clear();
+        retryAt = std::chrono::steady_clock::now();
     }
 }
 
@@ -424,6 +528,7 @@ void TransactionCache::ProcessContract(int64_t topTransactionHeight_)
     ON_SCOPE_EXIT{
         removeExpiredFromDirtyContractMap();
         _contractCache.clear();
+        contractSpends.Clear();
         contractInfoCache.clear();
     };
 
@@ -532,7 +637,6 @@ int TransactionCache::addContractInfoCache(const CTransaction &transaction,
     std::string contractOwnerEvmAddress;
     global::ca::VmType vmType;
 
-    std::string code;
     std::string input;
     std::string deployerAddr;
     std::string destAddr;
@@ -540,48 +644,28 @@ int TransactionCache::addContractInfoCache(const CTransaction &transaction,
     std::string contractAddress;
     std::string CallType = "";
     std::string transmitFlowMessage = "";
-    try
+    auto payload = contract_payload::Get(transaction);
+    if (payload == nullptr)
     {
-        nlohmann::json dataJson = nlohmann::json::parse(transaction.data());
-        nlohmann::json txInfo = dataJson["TxInfo"].get<nlohmann::json>();
-
-        if(txInfo.find(Evmone::contractSenderKeyName_) != txInfo.end())
-        {
-            contractOwnerEvmAddress = txInfo[Evmone::contractSenderKeyName_].get<std::string>();
-        }
-        vmType = txInfo[Evmone::contractVmKeyName].get<global::ca::VmType>();
-
-        if (txType == global::ca::TxType::TX_TYPE_INVOKE_CONTRACT)
-        {
-
-            input = txInfo[Evmone::contract_input_key_name].get<std::string>();
-
-            if (txInfo.find("CallType") != txInfo.end())
-            {
-                CallType = txInfo["CallType"].get<std::string>();
-            }
-
-            if(txInfo.find("transmitFlowMessage") != txInfo.end()){
-                transmitFlowMessage = txInfo["transmitFlowMessage"].get<std::string>();
-            }
-
-            if(vmType == global::ca::VmType::EVM)
-            {
-                contractTransfer = txInfo[Evmone::contractTransferKeyLabel].get<uint64_t>();
-                contractAddress = txInfo[Evmone::contractRecipientKeyNameStr].get<std::string>();
-            }
-        }
-        else if (txType == global::ca::TxType::kTransactionTypeDeploy)
+        ERRORLOG("contract payload parse fail");
+        return -2;
+    }
+    contractOwnerEvmAddress = payload->sender;
+    vmType = (global::ca::VmType)payload->vmType;
+    if (txType == global::ca::TxType::TX_TYPE_INVOKE_CONTRACT)
+    {
+        input = evmc::hex({reinterpret_cast<const uint8_t *>(payload->input.data()), payload->input.size()});
+        CallType = payload->callType;
+        transmitFlowMessage = payload->transmitFlowMessage;
+        if(vmType == global::ca::VmType::EVM)
         {
-            code = txInfo[Evmone::contract_input_key_name].get<std::string>();
-            contractAddress = txInfo[Evmone::contractRecipientKeyNameStr].get<std::string>();
+            contractTransfer = payload->transfer;
+            contractAddress = payload->recipient;
         }
-
     }
-    catch (...)
+    else if (txType == global::ca::TxType::kTransactionTypeDeploy)
     {
-        ERRORLOG("json parse fail");
-        return -2;
+        contractAddress = payload->recipient;
     }
               
     int64_t gasCost = 0;
@@ -654,10 +738,8 @@ int TransactionCache::addContractInfoCache(const CTransaction &transaction,
                 ERRORLOG("verify contract address fail, ret: {}", ret)
                 return ret - 100;
             }
-            DEBUGLOG("888Output: {}", code);
-
-            host.code = evm_utils::StringTobytes(code);
-            if (code.empty())
+            host.code.assign(reinterpret_cast<const uint8_t *>(payload->input.data()), payload->input.size());
+            if (host.code.empty())
             {
                 ERRORLOG("fail to convert contract code to hex format");
                 return -21;
@@ -988,15 +1070,48 @@ int TransactionCache::ContractTransaction(const std::vector<TxMsgReq> &transmitM
     std::map<std::string, std::future<int>> txTaskResults_;
     int64_t topTransactionHeight_ = 0;
 
+    std::vector<std::pair<const TxMsgReq*, CTransaction>> parsedTransactions;
     for (const TxMsgReq& txMsg : transmitMessageRequests)
     {
-        const TxMsgInfo& txMsgInfo = txMsg.txmsginfo();
         CTransaction transaction;
-        if (!transaction.ParseFromString(txMsgInfo.tx()))
+        if (!transaction.ParseFromString(txMsg.txmsginfo().tx()))
         {
             ERRORLOG("Failed to deserialize transaction body!");
             continue;
         }
+        parsedTransactions.emplace_back(&txMsg, std::move(transaction));
+    }
+
+    // Owner signatures of the whole group are checked in one batch before any transaction is dispatched
+    std::vector<Ed25519VerifyItem> ownerSigns;
+    std::vector<size_t> signOwners;
+    for (size_t i = 0; i < parsedTransactions.size(); ++i)
+    {
+        size_t before = ownerSigns.size();
+        BlockPreVerifier::CollectOwnerSigns(parsedTransactions[i].second, ownerSigns);
+        signOwners.insert(signOwners.end(), ownerSigns.size() - before, i);
+    }
+    std::vector<char> signValid;
+    ed25519BatchVerify(ownerSigns, signValid);
+    std::vector<bool> rejected(parsedTransactions.size(), false);
+    for (size_t i = 0; i < ownerSigns.size(); ++i)
+    {
+        if (!signValid[i])
+        {
+            rejected[signOwners[i]] = true;
+        }
+    }
+
+    for (size_t i = 0; i < parsedTransactions.size(); ++i)
+    {
+        const TxMsgReq& txMsg = *parsedTransactions[i].first;
+        const TxMsgInfo& txMsgInfo = txMsg.txmsginfo();
+        const CTransaction& transaction = parsedTransactions[i].second;
+        if (rejected[i])
+        {
+            ERRORLOG("tx {} carries a signature that does not verify, dropped", transaction.hash().substr(0,6));
+            continue;
+        }
 
         if (txMsgInfo.nodeheight() > topTransactionHeight_)
         {
@@ -1267,6 +1382,7 @@ bool TransactionCache::removeContractsCacheRequest(const std::map<std::string, C
     auto it = _contractCache.begin();
     while (it != _contractCache.end()) {
         if (contractTxs.find(it->GetTransaction().hash()) != contractTxs.end()) {
+            contractSpends.Remove(it->GetTransaction().hash());
             it = _contractCache.erase(it);
         } else {
             ++it;
@@ -1377,7 +1493,7 @@ int newSeekContractPreHash(const std::list<std::pair<std::string, std::string>>
 
     //send_size
     std::string msgId;
-    if (!dataMgrPtr.CreateWait(3, node_ids_to_send.size() * 0.8, msgId))
+    if (!dataMgrPtr.CreateWait(3, node_ids_to_send.size() * 0.8, msgId, "seekContractPreHash"))
     {
         return -3;
     }
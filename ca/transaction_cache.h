@@ -94,7 +94,7 @@ class TransactionCache
          * 
          * @param       transaction: 
          * @param       sendTxMsg: 
-         * @return      int 
+         * @return      int 0 success, -1 -2 double spend, -3 already pooled, -4 the mempool is full of better transactions
          */
         int AddCache(CTransaction& transaction, const std::shared_ptr<TxMsgReq>& msg);
 
@@ -0,0 +1,308 @@
+#include "ca/tx_ingest_pipeline.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "ca/algorithm.h"
+#include "ca/block_preverify.h"
+#include "ca/failed_transaction_cache.h"
+#include "ca/transaction.h"
+#include "ca/tx_mempool.h"
+#include "common/task_pool.h"
+#include "db/db_api.h"
+#include "include/logging.h"
+#include "utils/account_manager.h"
+#include "utils/ed25519_batch.h"
+#include "utils/magic_singleton.h"
+#include "utils/tx_lifecycle_tracer.h"
+#include "utils/util.h"
+
+TxIngestPipeline::~TxIngestPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _cv.notify_all();
+    _admitCv.notify_all();
+    if (_worker.joinable())
+    {
+        _worker.join();
+    }
+}
+
+int TxIngestPipeline::Submit(const std::shared_ptr<TxMsgReq> &msg, const MsgData &msgData)
+{
+    std::call_once(_started, [this]{ _worker = std::thread(&TxIngestPipeline::run, this); });
+
+    auto start = std::chrono::steady_clock::now();
+    Item item{msg, msgData, CTransaction()};
+    int ret = syntax(*msg, item.tx);
+    if (ret != 0)
+    {
+        // The version belongs to the envelope, any other failure to the transaction bytes
+        if (ret != -1)
+        {
+            MagicSingleton<RejectedTxFilter>::GetInstance()->Reject(msg->txmsginfo().tx());
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        count(_stats.syntax, 0, 1, start);
+        return -2;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        count(_stats.syntax, 1, 0, start);
+    }
+
+    // A filter hit is only a hint, the transaction is dropped when it is still in flight or pooled.
+    // One that failed verification before is no longer either and is verified again.
+    start = std::chrono::steady_clock::now();
+    const std::string txHash = item.tx.hash();
+    bool seen = !_seen.Insert(txHash);
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (seen)
+    {
+        ++_stats.dedupFilterPositives;
+        if (_inFlight.count(txHash) || MagicSingleton<TxMempool>::GetInstance()->Contains(txHash))
+        {
+            count(_stats.dedup, 0, 1, start);
+            return -1;
+        }
+    }
+    else if (_inFlight.count(txHash))
+    {
+        count(_stats.dedup, 0, 1, start);
+        return -1;
+    }
+    count(_stats.dedup, 1, 0, start);
+
+    if (_queue.size() >= kQueueCapacity)
+    {
+        ++_stats.queueFull;
+        DEBUGLOG("tx ingest queue full, drop tx:{}", txHash);
+        return -3;
+    }
+    _inFlight.insert(txHash);
+    _queue.push_back(std::move(item));
+    if (_queue.size() >= kBatchSize)
+    {
+        lock.unlock();
+        _cv.notify_one();
+    }
+    return 0;
+}
+
+TxIngestStats TxIngestPipeline::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    TxIngestStats stats = _stats;
+    stats.queued = _queue.size();
+    stats.inFlight = _inFlight.size();
+    stats.dedupFalsePositiveRate = _seen.EstimatedFalsePositiveRate();
+    return stats;
+}
+
+int TxIngestPipeline::syntax(const TxMsgReq &msg, CTransaction &tx)
+{
+    if (Util::IsVersionCompatible(msg.version()) != 0)
+    {
+        return -1;
+    }
+    if (!msg.has_txmsginfo() || !tx.ParseFromString(msg.txmsginfo().tx()))
+    {
+        return -2;
+    }
+    if (tx.hash().empty() || tx.utxos_size() == 0)
+    {
+        return -3;
+    }
+    if (tx.hash() != ca_algorithm::calculateTransactionHash(tx))
+    {
+        return -4;
+    }
+    return 0;
+}
+
+void TxIngestPipeline::run()
+{
+    while (true)
+    {
+        std::vector<Item> batch;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait_for(lock, std::chrono::milliseconds(kBatchWaitMs), [this]{ return _stopping || _queue.size() >= kBatchSize; });
+            if (_stopping)
+            {
+                return;
+            }
+
+            // Backpressure: admissions in flight bound the batch, the rest waits in the queue
+            _admitCv.wait(lock, [this]{ return _stopping || _admitting < kMaxInFlight; });
+            if (_stopping)
+            {
+                return;
+            }
+            size_t take = std::min({_queue.size(), kBatchSize, kMaxInFlight - _admitting});
+            batch.reserve(take);
+            for (size_t i = 0; i < take; ++i)
+            {
+                batch.push_back(std::move(_queue.front()));
+                _queue.pop_front();
+            }
+            _admitting += take;
+        }
+        if (batch.empty())
+        {
+            continue;
+        }
+
+        verifySignatures(batch);
+        prefetchUtxos(batch);
+        admit(batch);
+    }
+}
+
+void TxIngestPipeline::verifySignatures(std::vector<Item> &batch)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Ed25519VerifyItem> items;
+    std::vector<size_t> owners;
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        size_t before = items.size();
+        BlockPreVerifier::CollectOwnerSigns(batch[i].tx, items);
+        owners.insert(owners.end(), items.size() - before, i);
+    }
+
+    std::vector<char> valid;
+    if (!items.empty())
+    {
+        ed25519BatchVerify(items, valid);
+    }
+    std::vector<char> rejected(batch.size(), 0);
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        if (!valid[i])
+        {
+            rejected[owners[i]] = 1;
+        }
+    }
+
+    std::vector<Item> passed;
+    passed.reserve(batch.size());
+    std::vector<std::string> dropped;
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        if (rejected[i])
+        {
+            DEBUGLOG("tx ingest bad owner signature, drop tx:{}", batch[i].tx.hash());
+            MagicSingleton<RejectedTxFilter>::GetInstance()->Reject(batch[i].msg->txmsginfo().tx());
+            dropped.push_back(batch[i].tx.hash());
+            continue;
+        }
+        passed.push_back(std::move(batch[i]));
+    }
+    batch.swap(passed);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    count(_stats.signature, batch.size(), dropped.size(), start);
+    for (const auto &txHash : dropped)
+    {
+        _inFlight.erase(txHash);
+    }
+    _admitting -= dropped.size();
+    if (!dropped.empty())
+    {
+        _admitCv.notify_one();
+    }
+}
+
+void TxIngestPipeline::prefetchUtxos(const std::vector<Item> &batch)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::tuple<std::string, std::string, std::string>> utxos;
+    for (const auto &item : batch)
+    {
+        for (const auto &txUtxo : item.tx.utxos())
+        {
+            for (const auto &vin : txUtxo.vin())
+            {
+                if (!vin.contractaddr().empty())
+                {
+                    continue;
+                }
+                std::string owner = GenerateAddr(vin.vinsign().pub());
+                for (const auto &prevout : vin.prevout())
+                {
+                    utxos.emplace_back(prevout.hash(), owner, txUtxo.assettype());
+                }
+            }
+        }
+    }
+
+    // Only the database cache is warmed, a missing output is left for full verification to reject
+    uint64_t misses = 0;
+    if (!utxos.empty())
+    {
+        DBReader dbReader;
+        std::vector<std::string> balances;
+        std::vector<bool> found;
+        if (dbReader.getUtxoValuesByUtxoHashes(utxos, balances, found) == DBStatus::DB_SUCCESS)
+        {
+            misses = std::count(found.begin(), found.end(), false);
+        }
+        else
+        {
+            ERRORLOG("getUtxoValuesByUtxoHashes fail, utxos:{}", utxos.size());
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    count(_stats.utxo, batch.size(), 0, start);
+    _stats.utxoMisses += misses;
+}
+
+void TxIngestPipeline::admit(std::vector<Item> &batch)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (auto &item : batch)
+    {
+        auto msg = std::move(item.msg);
+        auto msgData = std::move(item.msgData);
+        auto txHash = item.tx.hash();
+        MagicSingleton<TxLifecycleTracer>::GetInstance()->Record(TxTraceStage::kAdmissionVerify, txHash);
+        MagicSingleton<TaskPool>::GetInstance()->CommitTransactionTask([this, msg, msgData, txHash]{
+            int ret = HandleTx(msg, msgData);
+            if (ret != 0)
+            {
+                DEBUGLOG("HandleTx fail, ret:{}, tx:{}", ret, txHash);
+            }
+            finish(txHash);
+        });
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    count(_stats.admit, batch.size(), 0, start);
+}
+
+void TxIngestPipeline::finish(const std::string &txHash)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _inFlight.erase(txHash);
+        --_admitting;
+    }
+    _admitCv.notify_one();
+}
+
+void TxIngestPipeline::count(TxIngestStageStats &stage, uint64_t passed, uint64_t dropped, std::chrono::steady_clock::time_point start)
+{
+    stage.passed += passed;
+    stage.dropped += dropped;
+    stage.busyMicros += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+int handleTxIngest(const std::shared_ptr<TxMsgReq> &msg, const MsgData &msgData)
+{
+    return MagicSingleton<TxIngestPipeline>::GetInstance()->Submit(msg, msgData);
+}
@@ -0,0 +1,130 @@
+/**
+ * *****************************************************************************
+ * @file        tx_ingest_pipeline.h
+ * @brief       Staged admission of broadcast transactions ahead of full verification
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_TX_INGEST_PIPELINE_HEADER
+#define CA_TX_INGEST_PIPELINE_HEADER
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "net/msg_queue.h"
+#include "proto/ca_protomsg.pb.h"
+#include "proto/transaction.pb.h"
+#include "utils/rotating_bloom_filter.h"
+
+/**
+ * @brief       Counters of one stage. Throughput is the growth of passed between two reads, busy
+ *              time over passed and dropped is the cost per transaction.
+ */
+struct TxIngestStageStats
+{
+    uint64_t passed = 0;
+    uint64_t dropped = 0;
+    uint64_t busyMicros = 0;
+};
+
+struct TxIngestStats
+{
+    TxIngestStageStats dedup;
+    TxIngestStageStats syntax;
+    TxIngestStageStats signature;
+    TxIngestStageStats utxo;
+    TxIngestStageStats admit;
+    uint64_t queueFull = 0;
+    uint64_t utxoMisses = 0;
+    uint64_t dedupFilterPositives = 0;
+    size_t queued = 0;
+    size_t inFlight = 0;
+    double dedupFalsePositiveRate = 0;
+};
+
+/**
+ * @brief       Broadcast transactions pass five stages before they cost a full verification:
+ *              1. dedup, a rotating bloom filter of recent hashes, with a hit confirmed against the
+ *                 transactions in flight and in the mempool so a false positive is never dropped
+ *              2. syntax, parse, version and a recomputed hash, on the receiving thread
+ *              3. signature, the owner signatures of a whole batch verified across the cores; the
+ *                 verified signatures are cached, so full verification does not check them again
+ *              4. utxo, the spent outputs of the batch read with one multi get, which warms the
+ *                 database cache for the per output reads of full verification
+ *              5. admit, HandleTx on the transaction pool for full verification and the mempool
+ *              The stage 2 output queue and the admissions in flight are bounded. A full queue drops
+ *              the transaction, full admissions hold the batch stages back.
+ */
+class TxIngestPipeline
+{
+public:
+    TxIngestPipeline() = default;
+    ~TxIngestPipeline();
+    TxIngestPipeline(TxIngestPipeline &&) = delete;
+    TxIngestPipeline(const TxIngestPipeline &) = delete;
+    TxIngestPipeline &operator=(TxIngestPipeline &&) = delete;
+    TxIngestPipeline &operator=(const TxIngestPipeline &) = delete;
+
+    /**
+     * @brief       Run the inline stages and queue the transaction for the batch stages
+     *
+     * @param       msg: transaction message
+     * @param       msgData: sender of the message
+     * @return      int return 0 queued, -1 duplicate, -2 malformed, -3 queue full
+     */
+    int Submit(const std::shared_ptr<TxMsgReq> &msg, const MsgData &msgData);
+
+    TxIngestStats GetStats();
+
+    static constexpr size_t kQueueCapacity = 65536;
+    static constexpr size_t kBatchSize = 512;
+    static constexpr uint64_t kBatchWaitMs = 2;
+    static constexpr size_t kMaxInFlight = 4096;
+    static constexpr size_t kDedupCapacity = 1 << 20;
+    static constexpr double kDedupFalsePositiveRate = 0.001;
+    static constexpr uint64_t kDedupSpanSec = 600;
+
+private:
+    struct Item
+    {
+        std::shared_ptr<TxMsgReq> msg;
+        MsgData msgData;
+        CTransaction tx;
+    };
+
+    int syntax(const TxMsgReq &msg, CTransaction &tx);
+    void run();
+    void verifySignatures(std::vector<Item> &batch);
+    void prefetchUtxos(const std::vector<Item> &batch);
+    void admit(std::vector<Item> &batch);
+    void finish(const std::string &txHash);
+    static void count(TxIngestStageStats &stage, uint64_t passed, uint64_t dropped, std::chrono::steady_clock::time_point start);
+
+    std::once_flag _started;
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::condition_variable _admitCv;
+    std::deque<Item> _queue;
+    std::unordered_set<std::string> _inFlight;
+    size_t _admitting = 0;
+    bool _stopping = false;
+    RotatingBloomFilter _seen{kDedupCapacity, kDedupFalsePositiveRate, std::chrono::seconds(kDedupSpanSec)};
+    TxIngestStats _stats;
+};
+
+/**
+ * @brief       Dispatcher entry for TxMsgReq
+ */
+int handleTxIngest(const std::shared_ptr<TxMsgReq> &msg, const MsgData &msgData);
+
+#endif
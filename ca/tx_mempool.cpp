@@ -0,0 +1,232 @@
+#include "ca/tx_mempool.h"
+
+#include <algorithm>
+
+#include "ca/global.h"
+
+namespace
+{
+    // Map nodes, index entries and the copies inside TransactionEntity
+    const size_t kEntryOverhead = 512;
+
+    void recordAge(TxMempoolAgeHistogram &ages, std::chrono::steady_clock::duration age)
+    {
+        uint64_t ageMs = std::chrono::duration_cast<std::chrono::milliseconds>(age).count();
+        auto bucket = std::lower_bound(kTxMempoolAgeBucketsMs.begin(), kTxMempoolAgeBucketsMs.end(), ageMs);
+        ++ages[bucket - kTxMempoolAgeBucketsMs.begin()];
+    }
+}
+
+int TxMempool::Add(const TransactionEntity &entity, std::vector<std::string> &evicted)
+{
+    const CTransaction transaction = entity.GetTransaction();
+    const std::string &txHash = transaction.hash();
+    size_t txBytes = transaction.ByteSizeLong();
+    size_t bytes = txBytes + entity.GetTxMsg().ByteSizeLong() + kEntryOverhead;
+    double feeRate = static_cast<double>(Fee(transaction)) / std::max<size_t>(txBytes, 1);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_byHash.count(txHash))
+    {
+        ++_stats.duplicates;
+        return -1;
+    }
+
+    Rank rank{feeRate, _sequence++, txHash};
+    // Make room from the bottom of the rank, but only for a transaction ranked above what it replaces
+    while (!_byRank.empty() && (_byHash.size() + 1 > _limits.maxCount || _bytes + bytes > _limits.maxBytes))
+    {
+        auto lowest = std::prev(_byRank.end());
+        if (!RankOrder()(rank, *lowest))
+        {
+            ++_stats.rejectedFull;
+            return -2;
+        }
+        std::string lowestHash = std::get<2>(*lowest);
+        erase(_byHash.find(lowestHash), _stats.droppedAgeMs);
+        evicted.push_back(std::move(lowestHash));
+        ++_stats.evicted;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    Entry entry{entity, rank, txBytes, bytes, Sender(transaction), {}, now};
+    entry.expiry = _byExpiry.emplace(now + std::chrono::seconds(_limits.expireSec), txHash);
+    _byArrival.emplace(std::get<1>(rank), now);
+    _byRank.insert(rank);
+    _bySender[entry.sender].insert(txHash);
+    _bytes += bytes;
+    _byHash.emplace(txHash, std::move(entry));
+    ++_stats.added;
+    return 0;
+}
+
+bool TxMempool::Remove(const std::string &txHash, bool packaged)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _byHash.find(txHash);
+    if (found == _byHash.end())
+    {
+        return false;
+    }
+    erase(found, packaged ? _stats.packagedAgeMs : _stats.droppedAgeMs);
+    ++_stats.removed;
+    return true;
+}
+
+bool TxMempool::Contains(const std::string &txHash)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _byHash.count(txHash) > 0;
+}
+
+std::vector<TransactionEntity> TxMempool::SelectBest()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<TransactionEntity> selected;
+    size_t blockBytes = 0;
+    for (auto iter = _byRank.begin(); iter != _byRank.end() && selected.size() < _limits.maxBlockCount; ++iter)
+    {
+        const auto &entry = _byHash.at(std::get<2>(*iter));
+        if (blockBytes + entry.txBytes > _limits.maxBlockBytes)
+        {
+            break;
+        }
+        blockBytes += entry.txBytes;
+        selected.push_back(entry.entity);
+    }
+    return selected;
+}
+
+std::vector<std::string> TxMempool::Expire()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::string> expired;
+    auto now = std::chrono::steady_clock::now();
+    while (!_byExpiry.empty() && _byExpiry.begin()->first <= now)
+    {
+        std::string txHash = _byExpiry.begin()->second;
+        auto found = _byHash.find(txHash);
+        if (found == _byHash.end())
+        {
+            _byExpiry.erase(_byExpiry.begin());
+            continue;
+        }
+        erase(found, _stats.droppedAgeMs);
+        expired.push_back(std::move(txHash));
+        ++_stats.expired;
+    }
+    return expired;
+}
+
+std::chrono::milliseconds TxMempool::OldestAge()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_byArrival.empty())
+    {
+        return std::chrono::milliseconds(0);
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _byArrival.begin()->second);
+}
+
+std::vector<std::string> TxMempool::BySender(const std::string &sender)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _bySender.find(sender);
+    if (found == _bySender.end())
+    {
+        return {};
+    }
+    return std::vector<std::string>(found->second.begin(), found->second.end());
+}
+
+void TxMempool::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stats.removed += _byHash.size();
+    _byHash.clear();
+    _byRank.clear();
+    _bySender.clear();
+    _byExpiry.clear();
+    _byArrival.clear();
+    _bytes = 0;
+}
+
+size_t TxMempool::Size()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _byHash.size();
+}
+
+void TxMempool::SetLimits(const TxMempoolLimits &limits)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _limits = limits;
+}
+
+TxMempoolLimits TxMempool::GetLimits()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _limits;
+}
+
+TxMempoolStats TxMempool::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    TxMempoolStats stats = _stats;
+    stats.count = _byHash.size();
+    stats.bytes = _bytes;
+    if (!_byArrival.empty())
+    {
+        stats.oldestAgeMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _byArrival.begin()->second).count();
+    }
+    return stats;
+}
+
+uint64_t TxMempool::Fee(const CTransaction &tx)
+{
+    uint64_t fee = 0;
+    for (const auto &utxo : tx.utxos())
+    {
+        for (const auto &vout : utxo.vout())
+        {
+            if (vout.addr() == global::ca::VIRTUAL_BURN_GAS_ADDR && vout.value() > 0)
+            {
+                fee += vout.value();
+            }
+        }
+    }
+    return fee;
+}
+
+std::string TxMempool::Sender(const CTransaction &tx)
+{
+    if (tx.utxos_size() == 0 || tx.utxos(0).owner_size() == 0)
+    {
+        return {};
+    }
+    return tx.utxos(0).owner(0);
+}
+
+void TxMempool::erase(std::unordered_map<std::string, Entry>::iterator found, TxMempoolAgeHistogram &ages)
+{
+    if (found == _byHash.end())
+    {
+        return;
+    }
+    auto &entry = found->second;
+    recordAge(ages, std::chrono::steady_clock::now() - entry.arrival);
+    _byArrival.erase(std::get<1>(entry.rank));
+    _byRank.erase(entry.rank);
+    auto sender = _bySender.find(entry.sender);
+    if (sender != _bySender.end())
+    {
+        sender->second.erase(found->first);
+        if (sender->second.empty())
+        {
+            _bySender.erase(sender);
+        }
+    }
+    _byExpiry.erase(entry.expiry);
+    _bytes -= entry.bytes;
+    _byHash.erase(found);
+}
@@ -0,0 +1,188 @@
+/**
+ * *****************************************************************************
+ * @file        tx_mempool.h
+ * @brief       Pending transactions indexed by hash, priority, sender and expiry with size limits
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef CA_TX_MEMPOOL_HEADER
+#define CA_TX_MEMPOOL_HEADER
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "ca/transaction_entity.h"
+
+/**
+ * @brief       Size limits of the pool and of the set taken for one block. A block is packed once
+ *              packCount transactions are pending or the oldest one has waited packDelayMs.
+ */
+struct TxMempoolLimits
+{
+    size_t maxCount = 200000;
+    size_t maxBytes = 512 * 1024 * 1024;
+    uint64_t expireSec = 300;
+    size_t maxBlockCount = 20000;
+    size_t maxBlockBytes = 16 * 1024 * 1024;
+    size_t packCount = 20000;
+    uint64_t packDelayMs = 3000;
+};
+
+/**
+ * @brief       Upper bounds in milliseconds of the time in pool histogram buckets, the last bucket
+ *              counts everything above them
+ */
+constexpr std::array<uint64_t, 10> kTxMempoolAgeBucketsMs = {100, 250, 500, 1000, 2000, 3000, 5000, 10000, 30000, 60000};
+using TxMempoolAgeHistogram = std::array<uint64_t, kTxMempoolAgeBucketsMs.size() + 1>;
+
+/**
+ * @brief       Counters of the pool
+ */
+struct TxMempoolStats
+{
+    uint64_t added = 0;
+    uint64_t duplicates = 0;
+    uint64_t rejectedFull = 0;
+    uint64_t evicted = 0;
+    uint64_t expired = 0;
+    uint64_t removed = 0;
+    size_t count = 0;
+    size_t bytes = 0;
+    uint64_t oldestAgeMs = 0;
+    TxMempoolAgeHistogram packagedAgeMs{};
+    TxMempoolAgeHistogram droppedAgeMs{};
+};
+
+/**
+ * @brief       Pending transactions ranked by the gas they burn per serialized byte, older first on
+ *              equal rates. A full pool evicts from the lowest rank to make room for a better
+ *              transaction and rejects one that ranks below everything it holds. The best set for a
+ *              block is read from the top of the rank index, so its cost does not grow with the pool.
+ *              Entries also leave after expireSec in the pool, found through an index ordered by
+ *              expiry instead of a sweep over every entry.
+ */
+class TxMempool
+{
+public:
+    TxMempool() = default;
+    ~TxMempool() = default;
+    TxMempool(TxMempool &&) = delete;
+    TxMempool(const TxMempool &) = delete;
+    TxMempool &operator=(TxMempool &&) = delete;
+    TxMempool &operator=(const TxMempool &) = delete;
+
+    /**
+     * @brief       Add a transaction, evicting lower ranked ones when the pool is full
+     *
+     * @param       entity: transaction with its message
+     * @param       evicted: hashes of the transactions evicted for it
+     * @return      int return 0 success, -1 already pooled, -2 the pool is full of better transactions
+     */
+    int Add(const TransactionEntity &entity, std::vector<std::string> &evicted);
+
+    /**
+     * @brief       Remove a transaction
+     *
+     * @param       txHash: transaction hash
+     * @param       packaged: it left for a block, otherwise it was dropped
+     * @return      true    it was pooled
+     */
+    bool Remove(const std::string &txHash, bool packaged = true);
+
+    bool Contains(const std::string &txHash);
+
+    /**
+     * @brief       Best ranked transactions within the block limits, best first; they stay pooled
+     */
+    std::vector<TransactionEntity> SelectBest();
+
+    /**
+     * @brief       Remove the transactions pooled longer than expireSec
+     *
+     * @return      hashes of the removed transactions
+     */
+    std::vector<std::string> Expire();
+
+    /**
+     * @brief       Time the oldest pooled transaction has waited, zero when the pool is empty
+     */
+    std::chrono::milliseconds OldestAge();
+
+    /**
+     * @brief       Hashes of the pooled transactions of a sender
+     */
+    std::vector<std::string> BySender(const std::string &sender);
+
+    void Clear();
+    size_t Size();
+    void SetLimits(const TxMempoolLimits &limits);
+    TxMempoolLimits GetLimits();
+    TxMempoolStats GetStats();
+
+    /**
+     * @brief       Gas burned by the transaction
+     */
+    static uint64_t Fee(const CTransaction &tx);
+
+    /**
+     * @brief       First owner of the transaction
+     */
+    static std::string Sender(const CTransaction &tx);
+
+private:
+    // Higher fee rate first, then earlier arrival
+    using Rank = std::tuple<double, uint64_t, std::string>;
+    struct RankOrder
+    {
+        bool operator()(const Rank &a, const Rank &b) const
+        {
+            if (std::get<0>(a) != std::get<0>(b))
+            {
+                return std::get<0>(a) > std::get<0>(b);
+            }
+            if (std::get<1>(a) != std::get<1>(b))
+            {
+                return std::get<1>(a) < std::get<1>(b);
+            }
+            return std::get<2>(a) < std::get<2>(b);
+        }
+    };
+
+    using ExpiryIndex = std::multimap<std::chrono::steady_clock::time_point, std::string>;
+
+    struct Entry
+    {
+        TransactionEntity entity;
+        Rank rank;
+        size_t txBytes = 0;
+        size_t bytes = 0;
+        std::string sender;
+        ExpiryIndex::iterator expiry;
+        std::chrono::steady_clock::time_point arrival;
+    };
+
+    void erase(std::unordered_map<std::string, Entry>::iterator found, TxMempoolAgeHistogram &ages);
+
+    std::mutex _mutex;
+    TxMempoolLimits _limits;
+    uint64_t _sequence = 0;
+    size_t _bytes = 0;
+    std::unordered_map<std::string, Entry> _byHash;
+    std::set<Rank, RankOrder> _byRank;
+    std::unordered_map<std::string, std::set<std::string>> _bySender;
+    ExpiryIndex _byExpiry;
+    // Arrival sequence to arrival time, the first entry is the oldest pooled transaction
+    std::map<uint64_t, std::chrono::steady_clock::time_point> _byArrival;
+    TxMempoolStats _stats;
+};
+
+#endif
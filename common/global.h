@@ -16,8 +16,8 @@ namespace global
     static const std::string kNetVersion = "0.0";
     static const std::string kIOSCompatible = "4.0.4";
     static const std::string ANDROID_COMPATIBLE = "3.1.0";
-    static const std::string LINUX_COMPATIBLE = "0.0.0";
-    static const std::string WINDOWS_COMPATIBLE = "0.0.0";
+    static const std::string LINUX_COMPATIBLE = "0.0.1";
+    static const std::string WINDOWS_COMPATIBLE = "0.0.1";
 
 
 
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "common/global_data.h"
+#include "common/peer_score.h"
 #include "utils/magic_singleton.h"
 #include "utils/time_util.h"
 #include "utils/account_manager.h"
@@ -11,40 +16,185 @@ struct GlobalData
     std::mutex mutex;
     std::condition_variable condition;
     std::vector<std::string> data;
+    std::vector<std::string> responders;
     std::set<std::string> res_ids;
+    std::string protocol;
+    std::chrono::steady_clock::time_point created;
+    GlobalDataManager::WaitCallback callback;
+    bool async = false;
+    bool cancelled = false;
+    bool finished = false;
     ~GlobalData()
     {
         data.clear();
         res_ids.clear();
     }
+
+    // Responders still outstanding can no longer bring the answers up to retNum
+    bool quorumUnreachable() const
+    {
+        return data.size() + res_ids.size() < retNum;
+    }
 };
 
+namespace
+{
+    const std::string kDefaultProtocol = "default";
+
+    std::mutex waitStatsMutex;
+    std::map<std::string, GlobalDataManager::WaitStats> waitStats;
+
+    void recordCreated(const std::string &protocol)
+    {
+        std::lock_guard<std::mutex> lock(waitStatsMutex);
+        ++waitStats[protocol].requests;
+    }
+
+    uint64_t elapsedMs(const GlobalData &wait)
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wait.created).count();
+    }
+
+    // Peers that did not answer fail on timeout and only bound their latency once the quorum made them unnecessary
+    void scoreOutstanding(const GlobalData &wait, const std::set<std::string> &outstanding, bool quorum, bool timedOut)
+    {
+        if (!quorum && !timedOut)
+        {
+            return;
+        }
+        auto peerScore = MagicSingleton<PeerScore>::GetInstance();
+        uint64_t latencyMs = elapsedMs(wait);
+        for (const auto &peer : outstanding)
+        {
+            if (quorum)
+            {
+                peerScore->RecordOutstanding(peer, wait.protocol, latencyMs);
+            }
+            else
+            {
+                peerScore->Record(peer, wait.protocol, latencyMs, 0, false);
+            }
+        }
+    }
+
+    void recordEnded(const GlobalData &wait, size_t responses, bool quorum, bool timedOut, bool cancelled)
+    {
+        uint64_t latencyMs = elapsedMs(wait);
+        std::lock_guard<std::mutex> lock(waitStatsMutex);
+        auto &stats = waitStats[wait.protocol];
+        stats.responses += responses;
+        stats.totalLatencyMs += latencyMs;
+        stats.maxLatencyMs = std::max(stats.maxLatencyMs, latencyMs);
+        if (quorum)
+        {
+            ++stats.quorumReached;
+        }
+        else if (cancelled)
+        {
+            ++stats.cancelled;
+        }
+        else if (timedOut)
+        {
+            ++stats.timedOut;
+        }
+        else
+        {
+            ++stats.unreachable;
+        }
+    }
+}
+
 bool GlobalDataManager::CreateWait(uint32_t timeOutSec, uint32_t retNum, std::string &outMsgId)
 {
-    outMsgId = Getsha256hash(std::to_string(MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp()));
+    return CreateWait(timeOutSec, retNum, outMsgId, kDefaultProtocol);
+}
+
+bool GlobalDataManager::CreateWait(uint32_t timeOutSec, uint32_t retNum, std::string &outMsgId, const std::string &protocol)
+{
+    // Pipelined sync opens several waits within the same microsecond, so the timestamp alone is not unique
+    static std::atomic<uint64_t> sequence{0};
+    outMsgId = Getsha256hash(std::to_string(MagicSingleton<TimeUtil>::GetInstance()->GetUTCTimestamp()) + "_" + std::to_string(sequence++));
     std::shared_ptr<GlobalData> dataPtr = std::make_shared<GlobalData>();
     dataPtr->msgId = outMsgId;
     dataPtr->timeOutSec = timeOutSec;
     dataPtr->retNum = retNum;
+    dataPtr->protocol = protocol;
+    dataPtr->created = std::chrono::steady_clock::now();
     {
         std::lock_guard lock(data_mutex);
         _globalData.insert(std::make_pair(dataPtr->msgId, dataPtr));
     }
+    recordCreated(protocol);
 
     return true;
 }
 
-bool GlobalDataManager::AddResNode(const std::string &msgId, const std::string &resId)
+bool GlobalDataManager::CreateAsyncWait(const std::string &protocol, uint32_t timeOutSec, uint32_t retNum,
+                                        const std::vector<std::string> &resIds, WaitCallback callback, std::string &outMsgId)
 {
-    std::shared_ptr<GlobalData> dataPtr;
+    if (!CreateWait(timeOutSec, retNum, outMsgId, protocol))
     {
-        std::lock_guard lock(data_mutex);
-        auto it = _globalData.find(msgId);
-        if (_globalData.end() == it)
+        return false;
+    }
+    auto dataPtr = findWait(outMsgId);
+    if (dataPtr == nullptr)
+    {
+        return false;
+    }
+    {
+        std::lock_guard lock(dataPtr->mutex);
+        dataPtr->async = true;
+        dataPtr->callback = std::move(callback);
+        dataPtr->res_ids.insert(resIds.begin(), resIds.end());
+    }
+    scheduleTimeout(outMsgId, dataPtr->created + std::chrono::seconds(timeOutSec));
+    return true;
+}
+
+std::future<GlobalDataManager::WaitResult> GlobalDataManager::CreateFutureWait(const std::string &protocol, uint32_t timeOutSec, uint32_t retNum,
+                                                                               const std::vector<std::string> &resIds, std::string &outMsgId)
+{
+    auto promise = std::make_shared<std::promise<WaitResult>>();
+    auto future = promise->get_future();
+    if (!CreateAsyncWait(protocol, timeOutSec, retNum, resIds, [promise](WaitResult result) { promise->set_value(std::move(result)); }, outMsgId))
+    {
+        promise->set_value(WaitResult());
+    }
+    return future;
+}
+
+bool GlobalDataManager::Cancel(const std::string &msgId)
+{
+    auto dataPtr = findWait(msgId);
+    if (dataPtr == nullptr)
+    {
+        return false;
+    }
+    {
+        std::lock_guard lock(dataPtr->mutex);
+        dataPtr->cancelled = true;
+        if (!dataPtr->async)
         {
-            return false;
+            dataPtr->condition.notify_all();
+            return true;
         }
-        dataPtr = it->second;
+    }
+    endAsyncWait(dataPtr, false, true);
+    return true;
+}
+
+std::map<std::string, GlobalDataManager::WaitStats> GlobalDataManager::GetWaitStats()
+{
+    std::lock_guard<std::mutex> lock(waitStatsMutex);
+    return waitStats;
+}
+
+bool GlobalDataManager::AddResNode(const std::string &msgId, const std::string &resId)
+{
+    std::shared_ptr<GlobalData> dataPtr = findWait(msgId);
+    if (dataPtr == nullptr)
+    {
+        return false;
     }
     {
         std::lock_guard lock(dataPtr->mutex);
@@ -55,16 +205,17 @@ bool GlobalDataManager::AddResNode(const std::string &msgId, const std::string &
 
 bool GlobalDataManager::waitDataToAdd(const std::string &msgId, const std::string &resId, const std::string &data)
 {
-    std::shared_ptr<GlobalData> dataPtr;
+    return waitDataToAdd(msgId, resId, std::string(data));
+}
+
+bool GlobalDataManager::waitDataToAdd(const std::string &msgId, const std::string &resId, std::string &&data)
+{
+    std::shared_ptr<GlobalData> dataPtr = findWait(msgId);
+    if (dataPtr == nullptr)
     {
-        std::lock_guard lock(data_mutex);
-        auto it = _globalData.find(msgId);
-        if (_globalData.end() == it)
-        {
-            return false;
-        }
-        dataPtr = it->second;
+        return false;
     }
+    size_t bytes = 0;
     {
         std::lock_guard lock(dataPtr->mutex);
         auto found = dataPtr->res_ids.find(resId);
@@ -74,42 +225,49 @@ bool GlobalDataManager::waitDataToAdd(const std::string &msgId, const std::strin
             return false;
         }
         dataPtr->res_ids.erase(found);
-        dataPtr->data.push_back(data);
-        if (dataPtr->data.size() >= dataPtr->retNum)
+        bytes = data.size();
+        dataPtr->data.push_back(std::move(data));
+        dataPtr->responders.push_back(resId);
+        if (!dataPtr->async)
         {
-            dataPtr->condition.notify_all();
+            if (dataPtr->data.size() >= dataPtr->retNum)
+            {
+                dataPtr->condition.notify_all();
+            }
         }
     }
+    MagicSingleton<PeerScore>::GetInstance()->Record(resId, dataPtr->protocol, elapsedMs(*dataPtr), bytes, true);
+    if (dataPtr->async)
+    {
+        endAsyncWait(dataPtr, false, false);
+    }
     return true;
 }
 
 bool GlobalDataManager::WaitData(const std::string &msgId, std::vector<std::string> &retData)
 {
-    std::shared_ptr<GlobalData> dataPtr;
+    std::shared_ptr<GlobalData> dataPtr = findWait(msgId);
+    if (dataPtr == nullptr)
     {
-        std::lock_guard lock(data_mutex);
-        auto it = _globalData.find(msgId);
-        if (_globalData.end() == it)
-        {
-            return false;
-        }
-        dataPtr = it->second;
+        return false;
     }
     std::unique_lock<std::mutex> lock(dataPtr->mutex);
     bool flag = true;
-    if (dataPtr->data.size() < dataPtr->retNum)
-    {
-        dataPtr->condition.wait_for(lock, std::chrono::seconds(dataPtr->timeOutSec));
-    }
+    // Callers may ask for more answers than the nodes they registered, a blocking wait runs until the quorum or the timeout
+    bool ended = dataPtr->condition.wait_for(lock, std::chrono::seconds(dataPtr->timeOutSec), [&dataPtr]() {
+        return dataPtr->data.size() >= dataPtr->retNum || dataPtr->cancelled;
+    });
 
-    {
-        retData = dataPtr->data;
-    }
+    // The wait is dropped below, so responses arriving later are rejected and the data can be handed over
+    retData = std::move(dataPtr->data);
+    dataPtr->data.clear();
 
     if (retData.size() < dataPtr->retNum)
     {
         flag = false;
     }
+    bool cancelled = dataPtr->cancelled;
+    std::set<std::string> outstanding = dataPtr->res_ids;
 
     // Only unlock data_ptr->mutex after all operations on it are complete.
     lock.unlock();
@@ -122,6 +280,8 @@ bool GlobalDataManager::WaitData(const std::string &msgId, std::vector<std::stri
             _globalData.erase(it);
         }
     }
+    recordEnded(*dataPtr, retData.size(), flag, !ended, cancelled);
+    scoreOutstanding(*dataPtr, outstanding, flag, !ended && !cancelled);
 
     return flag;
 }
@@ -132,3 +292,102 @@ GlobalDataManager &GlobalDataManager::get_global_data_manager()
     return dataManager;
 }
 
+std::shared_ptr<GlobalData> GlobalDataManager::findWait(const std::string &msgId)
+{
+    std::lock_guard lock(data_mutex);
+    auto it = _globalData.find(msgId);
+    if (_globalData.end() == it)
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void GlobalDataManager::endAsyncWait(const std::shared_ptr<GlobalData> &dataPtr, bool timedOut, bool cancelled)
+{
+    WaitResult result;
+    WaitCallback callback;
+    std::set<std::string> outstanding;
+    {
+        std::lock_guard lock(dataPtr->mutex);
+        if (dataPtr->finished)
+        {
+            return;
+        }
+        bool quorum = dataPtr->data.size() >= dataPtr->retNum;
+        if (!quorum && !timedOut && !cancelled && !dataPtr->quorumUnreachable())
+        {
+            return;
+        }
+        dataPtr->finished = true;
+        result.quorum = quorum;
+        result.timedOut = !quorum && timedOut;
+        result.cancelled = !quorum && cancelled;
+        result.data = std::move(dataPtr->data);
+        result.responders = std::move(dataPtr->responders);
+        dataPtr->data.clear();
+        callback = std::move(dataPtr->callback);
+        outstanding = dataPtr->res_ids;
+    }
+    {
+        std::lock_guard lock(data_mutex);
+        _globalData.erase(dataPtr->msgId);
+    }
+    recordEnded(*dataPtr, result.data.size(), result.quorum, result.timedOut, result.cancelled);
+    scoreOutstanding(*dataPtr, outstanding, result.quorum, result.timedOut);
+    if (callback)
+    {
+        callback(std::move(result));
+    }
+}
+
+void GlobalDataManager::scheduleTimeout(const std::string &msgId, std::chrono::steady_clock::time_point deadline)
+{
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    RunAfter(delay, [this, msgId]() {
+        if (auto dataPtr = findWait(msgId))
+        {
+            endAsyncWait(dataPtr, true, false);
+        }
+    });
+}
+
+void GlobalDataManager::RunAfter(std::chrono::milliseconds delay, std::function<void()> task)
+{
+    // One timer thread serves every async wait and delayed task
+    static std::mutex timerMutex;
+    static std::condition_variable timerCondition;
+    static std::multimap<std::chrono::steady_clock::time_point, std::function<void()>> deadlines;
+    static std::once_flag timerStarted;
+
+    std::call_once(timerStarted, []() {
+        std::thread([]() {
+            std::unique_lock<std::mutex> lock(timerMutex);
+            while (true)
+            {
+                if (deadlines.empty())
+                {
+                    timerCondition.wait(lock);
+                    continue;
+                }
+                auto first = deadlines.begin();
+                if (first->first > std::chrono::steady_clock::now())
+                {
+                    timerCondition.wait_until(lock, first->first);
+                    continue;
+                }
+                auto expired = std::move(first->second);
+                deadlines.erase(first);
+                lock.unlock();
+                expired();
+                lock.lock();
+            }
+        }).detach();
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(timerMutex);
+        deadlines.emplace(std::chrono::steady_clock::now() + delay, std::move(task));
+    }
+    timerCondition.notify_one();
+}
@@ -10,7 +10,11 @@
 #ifndef COMMON_GLOBAL_HEADER_DATA
 #define COMMON_GLOBAL_HEADER_DATA
 
+#include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -21,6 +25,39 @@ struct GlobalData;
 class GlobalDataManager
 {
 public:
+    /**
+     * @brief       Outcome of a wait: quorum is set once retNum responses arrived
+     */
+    struct WaitResult
+    {
+        bool quorum = false;
+        bool timedOut = false;
+        bool cancelled = false;
+        std::vector<std::string> data;
+        std::vector<std::string> responders;
+    };
+
+    /**
+     * @brief       Per protocol counters of request waits
+     */
+    struct WaitStats
+    {
+        uint64_t requests = 0;
+        uint64_t quorumReached = 0;
+        uint64_t timedOut = 0;
+        uint64_t cancelled = 0;
+        uint64_t unreachable = 0;
+        uint64_t responses = 0;
+        uint64_t totalLatencyMs = 0;
+        uint64_t maxLatencyMs = 0;
+    };
+
+    /**
+     * @brief       Runs once per async wait, on the thread that delivered the last response,
+     *              the timer thread or the thread that cancelled the wait, so it must not block
+     */
+    using WaitCallback = std::function<void(WaitResult)>;
+
     /**
      * @brief       Create a Wait object
      * 
@@ -32,6 +69,56 @@ public:
      */
     bool CreateWait(uint32_t timeOutSec, uint32_t retNum,
                     std::string &outMsgId);
+
+    /**
+     * @brief       Create a Wait object whose latency is reported under the protocol name
+     */
+    bool CreateWait(uint32_t timeOutSec, uint32_t retNum,
+                    std::string &outMsgId, const std::string &protocol);
+
+    /**
+     * @brief       Create a wait that completes without a waiting thread. The callback runs as soon as
+     *              retNum of the responders answered, when the answers still missing can no longer reach
+     *              retNum, on timeout or on Cancel.
+     * 
+     * @param       protocol: name used for the latency counters
+     * @param       timeOutSec: timeout
+     * @param       retNum: responses needed for the quorum
+     * @param       resIds: nodes the request is sent to, more can be added with AddResNode
+     * @param       callback: completion callback
+     * @param       outMsgId: message id to put into the requests
+     * @return      true 
+     * @return      false 
+     */
+    bool CreateAsyncWait(const std::string &protocol, uint32_t timeOutSec, uint32_t retNum,
+                         const std::vector<std::string> &resIds, WaitCallback callback, std::string &outMsgId);
+
+    /**
+     * @brief       CreateAsyncWait completing a future instead of calling back
+     */
+    std::future<WaitResult> CreateFutureWait(const std::string &protocol, uint32_t timeOutSec, uint32_t retNum,
+                                             const std::vector<std::string> &resIds, std::string &outMsgId);
+
+    /**
+     * @brief       Stop waiting for the remaining responses. An async wait completes with what has
+     *              arrived, a blocking WaitData returns at once.
+     * 
+     * @param       msgId 
+     * @return      true the wait existed
+     * @return      false 
+     */
+    bool Cancel(const std::string &msgId);
+
+    /**
+     * @brief       Counters of the waits per protocol
+     */
+    std::map<std::string, WaitStats> GetWaitStats();
+
+    /**
+     * @brief       Run a task on the timer thread of the async waits once the delay has passed,
+     *              the task must not block
+     */
+    void RunAfter(std::chrono::milliseconds delay, std::function<void()> task);
     /**
      * @brief       
      * 
@@ -63,6 +150,11 @@ public:
      */
     bool waitDataToAdd(const std::string &msgId, const std::string &res_id, const std::string &data);
 
+    /**
+     * @brief       waitDataToAdd taking over the serialized response instead of copying it
+     */
+    bool waitDataToAdd(const std::string &msgId, const std::string &res_id, std::string &&data);
+
     /**
      * @brief       
      * 
@@ -83,6 +175,10 @@ private:
     GlobalDataManager(const GlobalDataManager &) = delete;
     GlobalDataManager &operator=(GlobalDataManager &&) = delete;
     GlobalDataManager &operator=(const GlobalDataManager &) = delete;
+
+    std::shared_ptr<GlobalData> findWait(const std::string &msgId);
+    void endAsyncWait(const std::shared_ptr<GlobalData> &dataPtr, bool timedOut, bool cancelled);
+    void scheduleTimeout(const std::string &msgId, std::chrono::steady_clock::time_point deadline);
     std::mutex data_mutex;
     friend std::string PrintCache(int where);
     std::map<std::string, std::shared_ptr<GlobalData>> _globalData;
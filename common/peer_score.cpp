@@ -0,0 +1,258 @@
+#include "common/peer_score.h"
+
+#include <algorithm>
+#include <random>
+
+#include "common/global_data.h"
+#include "include/logging.h"
+
+namespace
+{
+    const std::string kAllProtocols = "all";
+
+    std::mt19937 &generator()
+    {
+        thread_local std::mt19937 gen(std::random_device{}());
+        return gen;
+    }
+
+    double moving(double average, double sample, bool first)
+    {
+        return first ? sample : average * (1 - PeerScore::kSampleWeight) + sample * PeerScore::kSampleWeight;
+    }
+}
+
+void PeerScore::Record(const std::string &peerId, const std::string &protocol, uint64_t latencyMs, uint64_t bytes, bool success)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &entry = touch(peerId);
+    addSample(entry.protocols[protocol], latencyMs, bytes, success);
+    addSample(entry.protocols[kAllProtocols], latencyMs, bytes, success);
+}
+
+void PeerScore::RecordOutstanding(const std::string &peerId, const std::string &protocol, uint64_t latencyMs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &entry = touch(peerId);
+    for (const auto &name : {protocol, kAllProtocols})
+    {
+        // Only a lower bound, so it can raise the latency but never lower it
+        auto &samples = entry.protocols[name];
+        samples.latencies.push_back(latencyMs);
+        if (samples.latencies.size() > kLatencySamples)
+        {
+            samples.latencies.pop_front();
+        }
+        if (latencyMs > samples.latencyMs)
+        {
+            samples.latencyMs = moving(samples.latencyMs, latencyMs, samples.successes + samples.failures == 0);
+        }
+    }
+}
+
+double PeerScore::Score(const std::string &peerId, const std::string &protocol)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return score(peerId, protocol);
+}
+
+std::vector<std::string> PeerScore::Select(const std::vector<std::string> &candidates, size_t count, const std::string &protocol)
+{
+    if (candidates.size() <= count)
+    {
+        return candidates;
+    }
+
+    std::vector<std::pair<double, std::string>> ranked;
+    ranked.reserve(candidates.size());
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto &candidate : candidates)
+        {
+            ranked.emplace_back(score(candidate, protocol), candidate);
+        }
+    }
+    // Shuffle first so equal scores, such as unknown peers, are not always taken in list order
+    std::shuffle(ranked.begin(), ranked.end(), generator());
+    std::stable_sort(ranked.begin(), ranked.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+
+    double slots = count * kExplorationRate;
+    size_t explore = static_cast<size_t>(slots);
+    if (std::uniform_real_distribution<double>(0, 1)(generator()) < slots - explore)
+    {
+        ++explore;
+    }
+    explore = std::min(explore, count);
+
+    std::vector<std::string> selected;
+    selected.reserve(count);
+    for (size_t i = 0; i < count - explore; ++i)
+    {
+        selected.push_back(ranked[i].second);
+    }
+    std::shuffle(ranked.begin() + (count - explore), ranked.end(), generator());
+    for (size_t i = count - explore; i < count; ++i)
+    {
+        selected.push_back(ranked[i].second);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_selections;
+    _explored += explore;
+    return selected;
+}
+
+uint64_t PeerScore::HedgeDelayMs(const std::string &peerId, const std::string &protocol)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _peers.find(peerId);
+    if (found == _peers.end())
+    {
+        return 0;
+    }
+    auto samples = found->second.protocols.find(protocol);
+    if (samples == found->second.protocols.end() || samples->second.latencies.size() < kMinHedgeSamples)
+    {
+        return 0;
+    }
+    return std::max(p95(samples->second), kMinHedgeDelayMs);
+}
+
+void PeerScore::Hedge(const std::string &msgId, const std::string &protocol, const std::string &primary,
+                      const std::vector<std::string> &candidates, std::function<void(const std::string &)> send)
+{
+    uint64_t delayMs = HedgeDelayMs(primary, protocol);
+    if (delayMs == 0)
+    {
+        return;
+    }
+    std::vector<std::string> backups;
+    std::copy_if(candidates.begin(), candidates.end(), std::back_inserter(backups), [&primary](const std::string &candidate) {
+        return candidate != primary;
+    });
+    if (backups.empty())
+    {
+        return;
+    }
+
+    dataMgrPtr.RunAfter(std::chrono::milliseconds(delayMs), [this, msgId, protocol, primary, backups, send]() {
+        auto backup = Select(backups, 1, protocol);
+        // AddResNode fails once the wait completed, so answered requests are not hedged
+        if (backup.empty() || !dataMgrPtr.AddResNode(msgId, backup.front()))
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_hedges;
+        }
+        DEBUGLOG("hedge {} request {} from {} to {}", protocol, msgId, primary, backup.front());
+        send(backup.front());
+    });
+}
+
+PeerScoreStats PeerScore::GetStats()
+{
+    PeerScoreStats stats;
+    std::lock_guard<std::mutex> lock(_mutex);
+    stats.selections = _selections;
+    stats.explored = _explored;
+    stats.hedges = _hedges;
+    for (const auto &[peerId, entry] : _peers)
+    {
+        auto &protocols = stats.peers[peerId];
+        for (const auto &[protocol, samples] : entry.protocols)
+        {
+            auto &out = protocols[protocol];
+            out.successes = samples.successes;
+            out.failures = samples.failures;
+            out.bytes = samples.bytes;
+            out.latencyMs = samples.latencyMs;
+            out.bytesPerSec = samples.bytesPerSec;
+            out.failureRate = samples.failureRate;
+            out.p95LatencyMs = p95(samples);
+            out.score = score(samples);
+        }
+    }
+    return stats;
+}
+
+void PeerScore::addSample(Samples &samples, uint64_t latencyMs, uint64_t bytes, bool success)
+{
+    bool first = samples.successes + samples.failures == 0;
+    samples.latencies.push_back(latencyMs);
+    if (samples.latencies.size() > kLatencySamples)
+    {
+        samples.latencies.pop_front();
+    }
+    samples.failureRate = moving(samples.failureRate, success ? 0 : 1, first);
+    if (success)
+    {
+        ++samples.successes;
+        samples.bytes += bytes;
+        samples.latencyMs = moving(samples.latencyMs, latencyMs, first);
+        double bytesPerSec = bytes * 1000.0 / std::max<uint64_t>(latencyMs, 1);
+        samples.bytesPerSec = samples.successes == 1 ? bytesPerSec : moving(samples.bytesPerSec, bytesPerSec, false);
+    }
+    else
+    {
+        ++samples.failures;
+        // A peer that stops answering looks at least as slow as the time it was given
+        samples.latencyMs = std::max(samples.latencyMs, moving(samples.latencyMs, latencyMs, first));
+    }
+}
+
+double PeerScore::score(const std::string &peerId, const std::string &protocol)
+{
+    auto found = _peers.find(peerId);
+    if (found == _peers.end())
+    {
+        return score(Samples());
+    }
+    const auto &protocols = found->second.protocols;
+    for (const auto &name : {protocol, kAllProtocols})
+    {
+        auto samples = protocols.find(name);
+        if (samples != protocols.end() && samples->second.successes + samples->second.failures >= kMinSamples)
+        {
+            return score(samples->second);
+        }
+    }
+    return score(Samples());
+}
+
+double PeerScore::score(const Samples &samples)
+{
+    // Answers per second for small requests plus reference sized transfers per second for bulk ones
+    double latencyMs = samples.successes + samples.failures > 0 ? samples.latencyMs : kPriorLatencyMs;
+    double rate = 1000.0 / std::max(latencyMs, 1.0) + samples.bytesPerSec / kReferenceBytes;
+    return (1 - samples.failureRate) * rate;
+}
+
+uint64_t PeerScore::p95(const Samples &samples)
+{
+    if (samples.latencies.empty())
+    {
+        return 0;
+    }
+    std::vector<uint32_t> latencies(samples.latencies.begin(), samples.latencies.end());
+    auto nth = latencies.begin() + (latencies.size() - 1) * 95 / 100;
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return *nth;
+}
+
+PeerScore::Peer &PeerScore::touch(const std::string &peerId)
+{
+    auto now = std::chrono::steady_clock::now();
+    auto found = _peers.find(peerId);
+    if (found == _peers.end() && _peers.size() >= kMaxPeers)
+    {
+        auto oldest = std::min_element(_peers.begin(), _peers.end(), [](const auto &a, const auto &b) {
+            return a.second.updated < b.second.updated;
+        });
+        _peers.erase(oldest);
+    }
+    auto &entry = _peers[peerId];
+    entry.updated = now;
+    return entry;
+}
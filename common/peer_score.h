@@ -0,0 +1,160 @@
+/**
+ * *****************************************************************************
+ * @file        peer_score.h
+ * @brief       Per peer and per protocol latency, throughput and failure scores used to pick request targets
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef COMMON_PEER_SCORE_HEADER
+#define COMMON_PEER_SCORE_HEADER
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief       Measurements of one peer for one protocol
+ */
+struct PeerProtocolStats
+{
+    uint64_t successes = 0;
+    uint64_t failures = 0;
+    uint64_t bytes = 0;
+    double latencyMs = 0;
+    double bytesPerSec = 0;
+    double failureRate = 0;
+    uint64_t p95LatencyMs = 0;
+    double score = 0;
+};
+
+/**
+ * @brief       Selection counters and the measurements of every peer, keyed by peer and protocol
+ */
+struct PeerScoreStats
+{
+    uint64_t selections = 0;
+    uint64_t explored = 0;
+    uint64_t hedges = 0;
+    std::map<std::string, std::map<std::string, PeerProtocolStats>> peers;
+};
+
+/**
+ * @brief       Request waits report every answer, timeout and late responder here, so each peer
+ *              carries a moving latency, throughput and failure rate per protocol and over all
+ *              protocols. Callers rank candidate peers by score instead of picking at random, while
+ *              a share of the slots still goes to random candidates so new or recovered peers get
+ *              measured. Unknown peers start from an optimistic prior for the same reason.
+ *
+ *              A request whose peer has not answered within its p95 latency can be hedged to one
+ *              more peer; the first answer completes the wait.
+ */
+class PeerScore
+{
+public:
+    PeerScore() = default;
+    ~PeerScore() = default;
+    PeerScore(PeerScore &&) = delete;
+    PeerScore(const PeerScore &) = delete;
+    PeerScore &operator=(PeerScore &&) = delete;
+    PeerScore &operator=(const PeerScore &) = delete;
+
+    /**
+     * @brief       Record the outcome of one request
+     *
+     * @param       peer: node id
+     * @param       protocol: request protocol
+     * @param       latencyMs: time from request to answer or to giving up
+     * @param       bytes: size of the answer
+     * @param       success: whether the peer answered
+     */
+    void Record(const std::string &peer, const std::string &protocol, uint64_t latencyMs, uint64_t bytes, bool success);
+
+    /**
+     * @brief       Record a peer still outstanding when the request completed without it, its latency
+     *              is at least latencyMs
+     */
+    void RecordOutstanding(const std::string &peer, const std::string &protocol, uint64_t latencyMs);
+
+    /**
+     * @brief       Higher is better; uses the peer's overall measurements while the protocol has too few
+     */
+    double Score(const std::string &peer, const std::string &protocol);
+
+    /**
+     * @brief       Pick count peers: the best scored ones plus a share of random exploration picks
+     *
+     * @param       candidates: eligible peers
+     * @param       count: number of peers wanted
+     * @param       protocol: request protocol
+     * @return      all candidates when there are no more than count
+     */
+    std::vector<std::string> Select(const std::vector<std::string> &candidates, size_t count, const std::string &protocol);
+
+    /**
+     * @brief       The p95 latency of the peer for the protocol, 0 while there are too few samples to hedge
+     */
+    uint64_t HedgeDelayMs(const std::string &peer, const std::string &protocol);
+
+    /**
+     * @brief       Send the request of an open wait to one more candidate if the primary peer has not
+     *              answered within its hedge delay
+     *
+     * @param       msgId: wait the request belongs to
+     * @param       protocol: request protocol
+     * @param       primary: peer the request was sent to
+     * @param       candidates: peers that can serve the request
+     * @param       send: sends the request to the given peer
+     */
+    void Hedge(const std::string &msgId, const std::string &protocol, const std::string &primary,
+               const std::vector<std::string> &candidates, std::function<void(const std::string &)> send);
+
+    PeerScoreStats GetStats();
+
+    static constexpr size_t kLatencySamples = 64;
+    static constexpr size_t kMinSamples = 3;
+    static constexpr size_t kMinHedgeSamples = 8;
+    static constexpr uint64_t kMinHedgeDelayMs = 50;
+    static constexpr double kSampleWeight = 0.2;
+    static constexpr double kExplorationRate = 0.2;
+    static constexpr double kPriorLatencyMs = 200;
+    static constexpr double kReferenceBytes = 64 * 1024;
+    static constexpr size_t kMaxPeers = 4096;
+
+private:
+    struct Samples
+    {
+        uint64_t successes = 0;
+        uint64_t failures = 0;
+        uint64_t bytes = 0;
+        double latencyMs = 0;
+        double bytesPerSec = 0;
+        double failureRate = 0;
+        std::deque<uint32_t> latencies;
+    };
+
+    struct Peer
+    {
+        std::map<std::string, Samples> protocols;
+        std::chrono::steady_clock::time_point updated;
+    };
+
+    void addSample(Samples &samples, uint64_t latencyMs, uint64_t bytes, bool success);
+    double score(const std::string &peer, const std::string &protocol);
+    static double score(const Samples &samples);
+    static uint64_t p95(const Samples &samples);
+    Peer &touch(const std::string &peerId);
+
+    std::mutex _mutex;
+    std::map<std::string, Peer> _peers;
+    uint64_t _selections = 0;
+    uint64_t _explored = 0;
+    uint64_t _hedges = 0;
+};
+
+#endif
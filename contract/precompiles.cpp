@@ -214,7 +214,7 @@ std::optional<evmc::Result> call_precompile(evmc_revision rev, const evmc_messag
     if (gas_left < 0)
         return evmc::Result{EVMC_OUT_OF_GAS};
 
-    static Cache cache;
+    auto& cache = precompile_cache();
     if (auto r = cache.find(static_cast<PrecompileId>(id), input, gas_left); r.has_value())
         return r;
 
@@ -15,34 +15,102 @@
 
 namespace evmone::state
 {
-std::optional<evmc::Result> Cache::find(PrecompileId id, bytes_view input, int64_t gas_left) const
+namespace
 {
-    if (const auto& cache = m_cache.at(stdx::to_underlying(id)); !cache.empty())
+/// Fixed bookkeeping cost of an entry: key, list node and index node.
+constexpr size_t EntryOverhead = sizeof(hash256) + 96;
+}  // namespace
+
+size_t Cache::entry_cost(const Entry& e) noexcept
+{
+    return EntryOverhead + (e.output.has_value() ? e.output->size() : 0);
+}
+
+bool Cache::is_cacheable(PrecompileId id) noexcept
+{
+    switch (id)
     {
-        const auto input_hash = keccak256(input);
-        if (const auto it = cache.find(input_hash); it != cache.end())
-        {
-            if (const auto& o = it->second; !o.has_value())
-                return evmc::Result{EVMC_PRECOMPILE_FAILURE};
-            else
-                return evmc::Result{EVMC_SUCCESS, gas_left, 0, o->data(), o->size()};
-        }
+    case PrecompileId::ecrecover:
+    case PrecompileId::expmod:
+    case PrecompileId::ecpairing:
+    case PrecompileId::blake2bf:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void Cache::evict(Slot& slot) noexcept
+{
+    while (slot.bytes > m_capacity_bytes && !slot.lru.empty())
+    {
+        const auto& last = slot.lru.back();
+        slot.bytes -= entry_cost(last);
+        slot.index.erase(last.key);
+        slot.lru.pop_back();
+        ++slot.evictions;
     }
-    return {};
+}
+
+std::optional<evmc::Result> Cache::find(PrecompileId id, bytes_view input, int64_t gas_left)
+{
+    if (!is_cacheable(id))
+        return {};
+
+    auto& slot = m_cache.at(stdx::to_underlying(id));
+    const auto input_hash = keccak256(input);
+
+    std::lock_guard lock{slot.mutex};
+    const auto it = slot.index.find(input_hash);
+    if (it == slot.index.end())
+    {
+        ++slot.misses;
+        return {};
+    }
+    ++slot.hits;
+    slot.lru.splice(slot.lru.begin(), slot.lru, it->second);
+    if (const auto& o = it->second->output; !o.has_value())
+        return evmc::Result{EVMC_PRECOMPILE_FAILURE};
+    else
+        return evmc::Result{EVMC_SUCCESS, gas_left, 0, o->data(), o->size()};
 }
 
 void Cache::insert(PrecompileId id, bytes_view input, const evmc::Result& result)
 {
-    if (id == PrecompileId::identity)  // Do not cache "identity".
+    if (!is_cacheable(id))
         return;
-    const auto input_hash = keccak256(input);
-    std::optional<bytes> cached_output;
+
+    Entry entry{keccak256(input), std::nullopt};
     if (result.status_code == EVMC_SUCCESS)
-        cached_output = bytes{result.output_data, result.output_size};
-    m_cache.at(stdx::to_underlying(id)).insert({input_hash, std::move(cached_output)});
+        entry.output = bytes{result.output_data, result.output_size};
+    const auto cost = entry_cost(entry);
+    if (cost > m_capacity_bytes)
+        return;
+
+    auto& slot = m_cache.at(stdx::to_underlying(id));
+    std::lock_guard lock{slot.mutex};
+    if (slot.index.count(entry.key) != 0)
+        return;
+    slot.lru.push_front(std::move(entry));
+    slot.index.emplace(slot.lru.front().key, slot.lru.begin());
+    slot.bytes += cost;
+    evict(slot);
+}
+
+PrecompileCacheStats Cache::stats(PrecompileId id) const noexcept
+{
+    const auto& slot = m_cache.at(stdx::to_underlying(id));
+    PrecompileCacheStats s;
+    s.hits = slot.hits;
+    s.misses = slot.misses;
+    s.evictions = slot.evictions;
+    std::lock_guard lock{slot.mutex};
+    s.entries = slot.index.size();
+    s.bytes = slot.bytes;
+    return s;
 }
 
-Cache::Cache() noexcept
+Cache::Cache(size_t capacity_bytes) noexcept : m_capacity_bytes{capacity_bytes}
 {
     const auto stub_file = std::getenv("EVMONE_PRECOMPILES_STUB");
     if (stub_file == nullptr)
@@ -53,12 +121,18 @@ Cache::Cache() noexcept
         const auto j = nlohmann::json::parse(std::ifstream{stub_file});
         for (size_t id = 0; id < j.size(); ++id)
         {
-            auto& cache = m_cache.at(id);
+            auto& slot = m_cache.at(id);
             for (const auto& [h_str, j_input] : j[id].items())
             {
-                auto& e = cache[evmc::from_hex<hash256>(h_str).value()];
+                Entry entry{evmc::from_hex<hash256>(h_str).value(), std::nullopt};
+                if (slot.index.count(entry.key) != 0)
+                    continue;
                 if (!j_input.is_null())
-                    e = evmc::from_hex(j_input.get<std::string>());
+                    entry.output = evmc::from_hex(j_input.get<std::string>());
+                const auto cost = entry_cost(entry);
+                slot.lru.push_back(std::move(entry));
+                slot.index.emplace(slot.lru.back().key, std::prev(slot.lru.end()));
+                slot.bytes += cost;
             }
         }
     }
@@ -80,11 +154,11 @@ Cache::~Cache() noexcept
         for (size_t id = 0; id < std::size(m_cache); ++id)
         {
             auto& q = j[id];
-            for (const auto& [h, o] : m_cache[id])
+            for (const auto& e : m_cache[id].lru)
             {
-                auto& v = q[evmc::hex(h)];
-                if (o)
-                    v = evmc::hex(*o);
+                auto& v = q[evmc::hex(e.key)];
+                if (e.output)
+                    v = evmc::hex(*e.output);
             }
         }
         std::ofstream{dump_file} << std::setw(2) << j << '\n';
@@ -94,4 +168,10 @@ Cache::~Cache() noexcept
         std::cerr << "evmone: Dumping precompiles to '" << dump_file << "' has failed!\n";
     }
 }
+
+Cache& precompile_cache() noexcept
+{
+    static Cache cache;
+    return cache;
+}
 }  // namespace evmone::state
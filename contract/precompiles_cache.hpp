@@ -1,12 +1,16 @@
 // evmone: Fast Ethereum Virtual Machine implementation
 // Copyright 2022 The evmone Authors.
 // SPDX-License-Identifier: Apache-2.0
+#pragma once
 
 #include "hash_utils.hpp"
 #include "precompiles.hpp"
 #include <evmc/evmc.hpp>
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <list>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 
@@ -15,14 +19,55 @@ namespace evmone::state
 using evmc::bytes;
 using evmc::bytes_view;
 
+/// Counters of a single precompile's cache.
+struct PrecompileCacheStats
+{
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t entries = 0;
+    uint64_t bytes = 0;
+};
+
+/// Thread-safe, LRU-bounded cache of precompile results keyed by the input hash.
+///
+/// Only precompiles whose execution is much more expensive than hashing the input
+/// (ecrecover, expmod, ecpairing, blake2bf) are cached.
 class Cache
 {
-    std::array<std::unordered_map<hash256, std::optional<bytes>>, NumPrecompiles> m_cache;
+    struct Entry
+    {
+        hash256 key;
+        std::optional<bytes> output;
+    };
+
+    struct Slot
+    {
+        mutable std::mutex mutex;
+        std::list<Entry> lru;
+        std::unordered_map<hash256, std::list<Entry>::iterator> index;
+        size_t bytes = 0;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+    };
+
+    std::array<Slot, NumPrecompiles> m_cache;
+    size_t m_capacity_bytes;
+
+    static size_t entry_cost(const Entry& e) noexcept;
+    void evict(Slot& slot) noexcept;
 
 public:
-    Cache() noexcept;
+    /// Default memory budget of each precompile's cache.
+    static constexpr size_t DefaultCapacityBytes = 8 * 1024 * 1024;
+
+    explicit Cache(size_t capacity_bytes = DefaultCapacityBytes) noexcept;
     ~Cache() noexcept;
 
+    /// Whether results of the precompile are worth caching.
+    static bool is_cacheable(PrecompileId id) noexcept;
+
     /// Lookups the precompiles cache.
     ///
     /// @param id        The precompile ID.
@@ -31,9 +76,15 @@ public:
     ///                  used for constructing the result for successful execution.
     /// @return          The cached execution result
     ///                  or std::nullopt if the matching cache entry is not found.
-    std::optional<evmc::Result> find(PrecompileId id, bytes_view input, int64_t gas_left) const;
+    std::optional<evmc::Result> find(PrecompileId id, bytes_view input, int64_t gas_left);
 
     /// Inserts new precompiles cache entry.
     void insert(PrecompileId id, bytes_view input, const evmc::Result& result);
+
+    /// Returns the counters of the precompile's cache.
+    PrecompileCacheStats stats(PrecompileId id) const noexcept;
 };
+
+/// The cache shared by all EVM executions in the process.
+Cache& precompile_cache() noexcept;
 }  // namespace evmone::state
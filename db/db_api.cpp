@@ -3,6 +3,13 @@
 #include "include/logging.h"
 #include "utils/string_util.h"
 #include "ca/global.h"
+#include "db/sum_hash_tree.h"
+#include "db/state_snapshot.h"
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 
 const std::string KAssetType = "assetType_";    //asset type
 const std::string KRevokeTxHash = "revokeTxHash_";
@@ -25,6 +32,9 @@ const std::string kBlockHeightToBlockHashKey = "blkht2blkhs_";
 const std::string BLOCK_HEIGHT_TO_SUM_HASH = "blkht2sumhs_";
 const std::string K_TOP_THOUSAND_SUM_HASH_KEY = "topthousandsumhs_";
 const std::string kBlockHeight_2000_Sum_Hash = "thousandsblkht2sumhs_";
+const std::string kSumTreeNodeKey = "sumtree_";
+const std::string kSumTreeBuiltKey = "sumtreebuilt_";
+const std::string kSnapshotImportKey = "snapshotimport_";
 const std::string K_BLOCK_HASH_TO_BLOCK_RAW_KEY = "blkhs2blkraw_";
 const std::string BLOCK_TOP_KEY_VALUE = "blktop_";
 const std::string ADDRESS_TO_UTXO_KEY = "addr2utxo_";
@@ -72,6 +82,106 @@ const std::string K_CONTRACT_ADDR_TO_DEPLOY_UTXO = "contractaddr2deployutxo_";
 const std::string kContractAddrToLatestUtxo = "contractaddr2latestutxo_";
 const std::string LATEST_CONTRACT_BLOCK_HASH = "latestcontractblockhash_";
 const std::string kContractMptKey = "contractmpt_";
+namespace
+{
+    // Heights whose block hashes changed in each open transaction. Kept outside DBReadWriter so its layout,
+    // which the prebuilt libraries rely on, stays unchanged.
+    std::mutex touchedHeightsMutex;
+    std::unordered_map<const DBReadWriter *, std::set<uint64_t>> touchedHeights;
+
+    void touchHeight(const DBReadWriter *writer, uint64_t height)
+    {
+        std::lock_guard<std::mutex> lock(touchedHeightsMutex);
+        touchedHeights[writer].insert(height);
+    }
+
+    std::set<uint64_t> takeTouchedHeights(const DBReadWriter *writer)
+    {
+        std::lock_guard<std::mutex> lock(touchedHeightsMutex);
+        auto found = touchedHeights.find(writer);
+        if (found == touchedHeights.end())
+        {
+            return {};
+        }
+        std::set<uint64_t> heights = std::move(found->second);
+        touchedHeights.erase(found);
+        return heights;
+    }
+
+    // Block top written by each open transaction, handed to the state snapshot producer once committed
+    std::unordered_map<const DBReadWriter *, uint64_t> writtenTops;
+
+    void recordTop(const DBReadWriter *writer, uint64_t height)
+    {
+        std::lock_guard<std::mutex> lock(touchedHeightsMutex);
+        writtenTops[writer] = height;
+    }
+
+    bool takeTop(const DBReadWriter *writer, uint64_t &height)
+    {
+        std::lock_guard<std::mutex> lock(touchedHeightsMutex);
+        auto found = writtenTops.find(writer);
+        if (found == writtenTops.end())
+        {
+            return false;
+        }
+        height = found->second;
+        writtenTops.erase(found);
+        return true;
+    }
+
+    // MPT nodes written by each open transaction, put in one untracked batch when it commits. Node keys are
+    // content addressed, so a node written twice holds the same value and is put once.
+    std::mutex pendingMptMutex;
+    std::unordered_map<const DBReadWriter *, std::map<std::string, std::string>> pendingMptNodes;
+
+    void addPendingMpt(const DBReadWriter *writer, const std::string &mptKey, const std::string &mptValue)
+    {
+        std::lock_guard<std::mutex> lock(pendingMptMutex);
+        pendingMptNodes[writer][mptKey] = mptValue;
+    }
+
+    bool findPendingMpt(const DBReadWriter *writer, const std::string &mptKey, std::string &mptValue)
+    {
+        std::lock_guard<std::mutex> lock(pendingMptMutex);
+        auto found = pendingMptNodes.find(writer);
+        if (found == pendingMptNodes.end())
+        {
+            return false;
+        }
+        auto node = found->second.find(mptKey);
+        if (node == found->second.end())
+        {
+            return false;
+        }
+        mptValue = node->second;
+        return true;
+    }
+
+    void erasePendingMpt(const DBReadWriter *writer, const std::string &mptKey)
+    {
+        std::lock_guard<std::mutex> lock(pendingMptMutex);
+        auto found = pendingMptNodes.find(writer);
+        if (found != pendingMptNodes.end())
+        {
+            found->second.erase(mptKey);
+        }
+    }
+
+    std::map<std::string, std::string> takePendingMpt(const DBReadWriter *writer)
+    {
+        std::lock_guard<std::mutex> lock(pendingMptMutex);
+        auto found = pendingMptNodes.find(writer);
+        if (found == pendingMptNodes.end())
+        {
+            return {};
+        }
+        std::map<std::string, std::string> nodes = std::move(found->second);
+        pendingMptNodes.erase(found);
+        return nodes;
+    }
+}
+
 bool DBInit(const std::string &db_path)
 {
     MagicSingleton<RocksDB>::GetInstance()->setDBPath(db_path);
@@ -81,6 +191,7 @@ bool DBInit(const std::string &db_path)
         ERRORLOG("rocksdb init fail {}", ret_status.ToString());
         return false;
     }
+    MagicSingleton<StateSnapshot>::GetInstance()->SetDirectory(db_path + ".snapshots");
     return true;
 }
 void destroyDatabase()
@@ -216,6 +327,28 @@ DBStatus DBReader::getTopThousandSumHash(uint64_t &thousandNum)
     return ret;
 }
 
+DBStatus DBReader::getSumTreeNode(uint32_t level, uint64_t index, std::string &hash)
+{
+    std::string db_key = kSumTreeNodeKey + std::to_string(level) + "_" + std::to_string(index);
+    return readData(db_key, hash);
+}
+
+DBStatus DBReader::getSumTreeBuiltHeight(uint64_t &height)
+{
+    std::string value;
+    auto ret = readData(kSumTreeBuiltKey, value);
+    if (DBStatus::DB_SUCCESS == ret)
+    {
+        height = std::stoull(value);
+    }
+    return ret;
+}
+
+DBStatus DBReader::getSnapshotImportRoot(std::string &root)
+{
+    return readData(kSnapshotImportKey, root);
+}
+
 
 
 DBStatus DBReader::getBlockTop(uint64_t &blockHeight)
@@ -266,6 +399,45 @@ DBStatus DBReader::getUtxoValueByUtxoHashes(const std::string &utxoHash, const s
     return readData(db_key, balance);
 }
 
+DBStatus DBReader::getUtxoValuesByUtxoHashes(const std::vector<std::tuple<std::string, std::string, std::string>> &utxos, std::vector<std::string> &balances, std::vector<bool> &found)
+{
+    balances.clear();
+    found.clear();
+    if (utxos.empty())
+    {
+        return DBStatus::DB_PARAM_NULL;
+    }
+
+    std::vector<std::string> db_keys_str;
+    std::vector<rocksdb::Slice> db_keys;
+    db_keys_str.reserve(utxos.size());
+    db_keys.reserve(utxos.size());
+    for (const auto &[utxoHash, address, assetType] : utxos)
+    {
+        db_keys_str.push_back(address + "_" + utxoHash + "_" + assetType);
+        db_keys.push_back(rocksdb::Slice(db_keys_str.back()));
+    }
+
+    // Missing utxos are reported per key instead of failing the whole batch
+    std::vector<rocksdb::Status> ret_status;
+    db_reader_.multiReadData(db_keys, balances, ret_status);
+    if (ret_status.size() != db_keys.size())
+    {
+        return DBStatus::DB_ERROR;
+    }
+    found.resize(ret_status.size());
+    for (size_t i = 0; i < ret_status.size(); ++i)
+    {
+        if (!ret_status[i].ok() && !ret_status[i].IsNotFound())
+        {
+            return DBStatus::DB_ERROR;
+        }
+        found[i] = ret_status[i].ok();
+    }
+    balances.resize(db_keys.size());
+    return DBStatus::DB_SUCCESS;
+}
+
 // Obtain the transaction raw data by the transaction hash
 DBStatus DBReader::getTransactionByHash(const std::string &txHash, std::string &txRaw)
 {
@@ -875,10 +1047,18 @@ DBReadWriter::DBReadWriter(const std::string &txn_name) : dbReaderWriter(MagicSi
 
 DBReadWriter::~DBReadWriter()
 {
+    uint64_t top = 0;
+    takeTouchedHeights(this);
+    takeTop(this, top);
+    takePendingMpt(this);
     transactionRollBack();
 }
 DBStatus DBReadWriter::reInitTransaction()
 {
+    uint64_t top = 0;
+    takeTouchedHeights(this);
+    takeTop(this, top);
+    takePendingMpt(this);
     auto ret = transactionRollBack();
     if (DBStatus::DB_SUCCESS != ret)
     {
@@ -895,10 +1075,36 @@ DBStatus DBReadWriter::reInitTransaction()
 
 DBStatus DBReadWriter::transactionCommit()
 {
+    std::map<std::string, std::string> mptNodes = takePendingMpt(this);
+    if (!mptNodes.empty() && DBStatus::DB_SUCCESS != setMptValuesByMptKeys({mptNodes.begin(), mptNodes.end()}))
+    {
+        ERRORLOG("mpt nodes batch write failed, nodes:{}", mptNodes.size());
+        return DBStatus::DB_ERROR;
+    }
+
+    // The sum hash tree follows block saves and rollbacks in the same transaction
+    std::set<uint64_t> heights = takeTouchedHeights(this);
+    std::unique_lock<std::mutex> treeLock(SumHashTree::UpdateMutex(), std::defer_lock);
+    if (!heights.empty())
+    {
+        treeLock.lock();
+        if (DBStatus::DB_SUCCESS != SumHashTree::Update(*this, heights))
+        {
+            ERRORLOG("sum hash tree update failed");
+            return DBStatus::DB_ERROR;
+        }
+    }
+
+    uint64_t top = 0;
+    bool topWritten = takeTop(this, top);
     rocksdb::Status ret_status;
     if (dbReaderWriter.transactionCommit(ret_status))
     {
         autoOperationTrans = false;
+        if (topWritten)
+        {
+            MagicSingleton<StateSnapshot>::GetInstance()->OnBlockTop(top);
+        }
         return DBStatus::DB_SUCCESS;
     }
     ERRORLOG("transactionCommit faild:{}:{}", ret_status.code(), ret_status.ToString());
@@ -925,6 +1131,7 @@ DBStatus DBReadWriter::deleteBlockHeightByBlockHash(const std::string &blockHash
 DBStatus DBReadWriter::setBlockHashByBlockHeight(const unsigned int blockHeight, const std::string &blockHash, bool isMainBlock)
 {
     std::string db_key = kBlockHeightToBlockHashKey + std::to_string(blockHeight);
+    touchHeight(this, blockHeight);
     return mergeValue(db_key, blockHash, isMainBlock);
 }
 
@@ -933,6 +1140,7 @@ DBStatus DBReadWriter::setBlockHashByBlockHeight(const unsigned int blockHeight,
 DBStatus DBReadWriter::removeBlockHashByBlockHeight(const unsigned int blockHeight, const std::string &blockHash)
 {
     std::string db_key = kBlockHeightToBlockHashKey + std::to_string(blockHeight);
+    touchHeight(this, blockHeight);
     return removeMergeValue(db_key, blockHash);
 }
 
@@ -993,9 +1201,65 @@ DBStatus DBReadWriter::removeTopThousandSumhash(const uint64_t &thousandNum)
     return deleteData(K_TOP_THOUSAND_SUM_HASH_KEY);
 }
 
+DBStatus DBReadWriter::setSumTreeNode(uint32_t level, uint64_t index, const std::string &hash)
+{
+    std::string db_key = kSumTreeNodeKey + std::to_string(level) + "_" + std::to_string(index);
+    return writeData(db_key, hash);
+}
+
+DBStatus DBReadWriter::removeSumTreeNode(uint32_t level, uint64_t index)
+{
+    std::string db_key = kSumTreeNodeKey + std::to_string(level) + "_" + std::to_string(index);
+    return deleteData(db_key);
+}
+
+DBStatus DBReadWriter::setSumTreeBuiltHeight(uint64_t height)
+{
+    return writeData(kSumTreeBuiltKey, std::to_string(height));
+}
+
+DBStatus DBReadWriter::setSnapshotImportRoot(const std::string &root)
+{
+    return writeData(kSnapshotImportKey, root);
+}
+
+DBStatus DBReadWriter::removeSnapshotImportRoot()
+{
+    return deleteData(kSnapshotImportKey);
+}
+
+DBStatus DBReadWriter::writeSnapshotRecords(const std::vector<std::pair<std::string, std::string>> &records)
+{
+    // Tracked puts, a writer touching the same utxo or index key at the same time conflicts on commit
+    for (const auto &[key, value] : records)
+    {
+        auto ret = writeData(key, value);
+        if (DBStatus::DB_SUCCESS != ret)
+        {
+            ERRORLOG("writeSnapshotRecords failed key:{}", key);
+            return ret;
+        }
+    }
+    return DBStatus::DB_SUCCESS;
+}
+
+DBStatus DBReadWriter::removeSnapshotRecords(const std::vector<std::string> &keys)
+{
+    for (const auto &key : keys)
+    {
+        auto ret = deleteData(key);
+        if (DBStatus::DB_SUCCESS != ret)
+        {
+            return ret;
+        }
+    }
+    return DBStatus::DB_SUCCESS;
+}
+
 // Set the highest block
 DBStatus DBReadWriter::setBlockTop(const unsigned int blockHeight)
 {
+    recordTop(this, blockHeight);
     return writeData(BLOCK_TOP_KEY_VALUE, std::to_string(blockHeight));
 }
 
@@ -1332,11 +1596,33 @@ DBStatus DBReadWriter::removeLatestUtxoByContractAddr(const std::string &contrac
 
 DBStatus DBReadWriter::setMptValueByMptKey(const std::string &mptKey, const std::string &MptValue)
 {
-    std::string db_key = kContractMptKey + mptKey;
-    return writeData(db_key, MptValue);
+    if (mptKey.empty() || MptValue.empty())
+    {
+        ERRORLOG("mpt key or value is empty");
+        return DBStatus::DB_ERROR;
+    }
+    // Held until the transaction commits, where the nodes of every saved contract go out in one batch
+    addPendingMpt(this, mptKey, MptValue);
+    return DBStatus::DB_SUCCESS;
+}
+DBStatus DBReadWriter::setMptValuesByMptKeys(const std::vector<std::pair<std::string, std::string>> &mptValues)
+{
+    std::vector<std::pair<std::string, std::string>> kvs;
+    kvs.reserve(mptValues.size());
+    for (const auto &item : mptValues)
+    {
+        kvs.emplace_back(kContractMptKey + item.first, item.second);
+    }
+    rocksdb::Status ret_status;
+    if (dbReaderWriter.writeBatchData(kvs, ret_status))
+    {
+        return DBStatus::DB_SUCCESS;
+    }
+    return DBStatus::DB_ERROR;
 }
 DBStatus DBReadWriter::removeMptValueByMptKey(const std::string &mptKey)
 {
+    erasePendingMpt(this, mptKey);
     std::string db_key = kContractMptKey + mptKey;
     return deleteData(db_key);
 }
@@ -1657,6 +1943,11 @@ DBStatus DBReadWriter::readData(const std::string &key, std::string &value)
     {
         return DBStatus::DB_PARAM_NULL;
     }
+    if (key.compare(0, kContractMptKey.size(), kContractMptKey) == 0
+        && findPendingMpt(this, key.substr(kContractMptKey.size()), value))
+    {
+        return DBStatus::DB_SUCCESS;
+    }
     rocksdb::Status ret_status;
     if (dbReaderWriter.readData(key, value, ret_status))
     {
@@ -5,6 +5,7 @@
 #include "db/rocksdb_read_write.h"
 #include "proto/block.pb.h"
 #include <string>
+#include <tuple>
 #include <vector>
 
 bool DBInit(const std::string &path);
@@ -128,6 +129,32 @@ public:
      */
     DBStatus getTopThousandSumHash(uint64_t &thousandNum);
 
+    /**
+     * @brief Get a node of the height sum hash tree
+     * 
+     * @param level Tree level, 0 for single heights
+     * @param index Node index within the level
+     * @param hash Variable to store the node hash
+     * @return DBStatus Operation result status code
+     */
+    DBStatus getSumTreeNode(uint32_t level, uint64_t index, std::string &hash);
+
+    /**
+     * @brief Get the height up to which the sum hash tree has been built from existing blocks
+     * 
+     * @param height Variable to store the height, UINT64_MAX once the tree covers the whole chain
+     * @return DBStatus Operation result status code
+     */
+    DBStatus getSumTreeBuiltHeight(uint64_t &height);
+
+    /**
+     * @brief Get the root of the state snapshot whose import has started but not finished
+     * 
+     * @param root Variable to store the snapshot root
+     * @return DBStatus Operation result status code, DB_NOT_FOUND when no import is pending
+     */
+    DBStatus getSnapshotImportRoot(std::string &root);
+
     /**
      * @brief Get the top block height of the current blockchain
      * 
@@ -176,6 +203,16 @@ public:
      */
     DBStatus getUtxoValueByUtxoHashes(const std::string &utxoHash, const std::string &address, const std::string &assetType, std::string &balance);
 
+    /**
+     * @brief Batch read the balances of utxos with one multi get
+     * 
+     * @param utxos UTXO hash, address and asset type of each utxo
+     * @param balances Balance of each utxo, empty when it is not found
+     * @param found Whether each utxo was found
+     * @return DBStatus DB_SUCCESS when every read completed, found or not
+     */
+    DBStatus getUtxoValuesByUtxoHashes(const std::vector<std::tuple<std::string, std::string, std::string>> &utxos, std::vector<std::string> &balances, std::vector<bool> &found);
+
     /**
      * @brief Get transaction raw data by transaction hash
      * 
@@ -773,6 +810,64 @@ public:
      */
     DBStatus removeTopThousandSumhash(const uint64_t &thousandNum);   
 
+    /**
+     * @brief Set a node of the height sum hash tree
+     * 
+     * @param level Tree level
+     * @param index Node index within the level
+     * @param hash Node hash
+     * @return DBStatus Operation result status code
+     */
+    DBStatus setSumTreeNode(uint32_t level, uint64_t index, const std::string &hash);
+
+    /**
+     * @brief Remove a node of the height sum hash tree
+     * 
+     * @param level Tree level
+     * @param index Node index within the level
+     * @return DBStatus Operation result status code
+     */
+    DBStatus removeSumTreeNode(uint32_t level, uint64_t index);
+
+    /**
+     * @brief Set the height up to which the sum hash tree has been built from existing blocks
+     * 
+     * @param height Built height
+     * @return DBStatus Operation result status code
+     */
+    DBStatus setSumTreeBuiltHeight(uint64_t height);
+
+    /**
+     * @brief Mark a state snapshot import as started
+     * 
+     * @param root Root of the snapshot being imported
+     * @return DBStatus Operation result status code
+     */
+    DBStatus setSnapshotImportRoot(const std::string &root);
+
+    /**
+     * @brief Mark the state snapshot import as finished
+     * 
+     * @return DBStatus Operation result status code
+     */
+    DBStatus removeSnapshotImportRoot();
+
+    /**
+     * @brief Write raw records of a state snapshot
+     * 
+     * @param records Key value pairs of a snapshot chunk
+     * @return DBStatus Operation result status code
+     */
+    DBStatus writeSnapshotRecords(const std::vector<std::pair<std::string, std::string>> &records);
+
+    /**
+     * @brief Remove raw keys before a state snapshot is imported
+     * 
+     * @param keys Keys to remove
+     * @return DBStatus Operation result status code
+     */
+    DBStatus removeSnapshotRecords(const std::vector<std::string> &keys);
+
     /**
      * @brief Set blockchain top height
      * 
@@ -1318,6 +1413,14 @@ public:
      */
     DBStatus setMptValueByMptKey(const std::string &mptKey, const std::string &mptValue);
 
+    /**
+     * @brief Set a batch of MPT values by MPT key
+     * 
+     * @param mptValues Pairs of MPT key and MPT value
+     * @return DBStatus Operation result status code
+     */
+    DBStatus setMptValuesByMptKeys(const std::vector<std::pair<std::string, std::string>> &mptValues);
+
     /**
      * @brief Remove MPT value by MPT key
      * 
@@ -1709,4 +1812,4 @@ private:
     bool autoOperationTrans;
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
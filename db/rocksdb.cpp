@@ -116,4 +116,34 @@ void RocksDB::getDBMemoryUsage(std::string& info)
     {
         info.append("block_cache_pinned_usage: ").append(block_cache_pinned_usage).append("\n");
     }
-}
\ No newline at end of file
+}
+
+const rocksdb::Snapshot *RocksDB::getSnapshot()
+{
+    if (!isInitSuccess())
+    {
+        ERRORLOG("rocksdb not init");
+        return nullptr;
+    }
+    return db_->GetSnapshot();
+}
+
+void RocksDB::releaseSnapshot(const rocksdb::Snapshot *snapshot)
+{
+    if (snapshot != nullptr && isInitSuccess())
+    {
+        db_->ReleaseSnapshot(snapshot);
+    }
+}
+
+rocksdb::Iterator *RocksDB::newIterator(const rocksdb::Snapshot *snapshot)
+{
+    if (!isInitSuccess())
+    {
+        ERRORLOG("rocksdb not init");
+        return nullptr;
+    }
+    rocksdb::ReadOptions readOptions;
+    readOptions.snapshot = snapshot;
+    return db_->NewIterator(readOptions);
+}
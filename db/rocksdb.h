@@ -59,6 +59,25 @@ public:
      */
     void getDBMemoryUsage(std::string& info);
 
+    /**
+     * Take a consistent read view of the whole database
+     * @return The snapshot, nullptr when the database is not initialized
+     */
+    const rocksdb::Snapshot *getSnapshot();
+
+    /**
+     * Release a snapshot taken with getSnapshot
+     * @param snapshot The snapshot to release
+     */
+    void releaseSnapshot(const rocksdb::Snapshot *snapshot);
+
+    /**
+     * Create an iterator over all keys
+     * @param snapshot Read view to iterate, nullptr for the current data
+     * @return The iterator owned by the caller, nullptr when the database is not initialized
+     */
+    rocksdb::Iterator *newIterator(const rocksdb::Snapshot *snapshot = nullptr);
+
 private:
     friend class BackgroundErrorListener;
     friend class RocksDBDataReader;
@@ -353,6 +353,40 @@ bool RocksDBReadWriter::writeData(const std::string &key, const std::string &val
     }
     return false;
 }
+bool RocksDBReadWriter::writeBatchData(const std::vector<std::pair<std::string, std::string>> &kvs, rocksdb::Status &retStatus)
+{
+    if (!rocksdb_->isInitSuccess())
+    {
+        ERRORLOG("rocksdb not init");
+        retStatus = rocksdb::Status::Aborted();
+        return false;
+    }
+    if (nullptr == txn_)
+    {
+        ERRORLOG("transaction is null");
+        retStatus = rocksdb::Status::Aborted();
+        return false;
+    }
+    for (const auto &kv : kvs)
+    {
+        if (kv.first.empty() || kv.second.empty())
+        {
+            ERRORLOG("key or value is empty");
+            retStatus = rocksdb::Status::Aborted();
+            return false;
+        }
+        // Keys written through this path are content addressed, so there is
+        // nothing to conflict with and no row lock is taken.
+        retStatus = txn_->PutUntracked(kv.first, kv.second);
+        if (!retStatus.ok())
+        {
+            ERRORLOG("{} rocksdb writeBatchData failed key:{} code:({}),subcode:({}),severity:({}),info:({})",
+                     txn_name_, kv.first, retStatus.code(), retStatus.subcode(), retStatus.severity(), retStatus.ToString());
+            return false;
+        }
+    }
+    return true;
+}
 bool RocksDBReadWriter::deleteData(const std::string &key, rocksdb::Status &retStatus)
 {
     if (!rocksdb_->isInitSuccess())
@@ -92,6 +92,15 @@ public:
      */
     bool writeData(const std::string &key, const std::string &value, rocksdb::Status &retStatus);
 
+    /**
+     * @brief Write a batch of content-addressed key-value pairs without row locking
+     * 
+     * @param kvs The key-value pairs to write
+     * @param retStatus Used to store the status of the write operation
+     * @return Whether the write was successful
+     */
+    bool writeBatchData(const std::vector<std::pair<std::string, std::string>> &kvs, rocksdb::Status &retStatus);
+
     /**
      * @brief Delete a single key-value pair
      * 
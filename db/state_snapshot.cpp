@@ -0,0 +1,635 @@
+#include "db/state_snapshot.h"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include "db/db_api.h"
+#include "db/sum_hash_tree.h"
+#include "include/logging.h"
+#include "proto/block.pb.h"
+#include "utils/account_manager.h"
+#include "utils/magic_singleton.h"
+
+namespace
+{
+    const std::string kManifestFile = "manifest";
+    const std::string kChunkFilePrefix = "chunk_";
+    const std::string kBlockTopKey = "blktop_";
+
+    // Keys describing the local node rather than the chain, kept in sync with db_api.cpp
+    const std::set<std::string> kLocalKeys = {"initver_", "sumtreebuilt_", "snapshotimport_", kBlockTopKey};
+
+    bool isLocalKey(const std::string &key)
+    {
+        return kLocalKeys.count(key) != 0;
+    }
+
+    const std::string kBlockHeightToHashesPrefix = "blkht2blkhs_";
+    const std::string kBlockHashToHeightPrefix = "blkhs2blkht_";
+    const std::string kBlockRawPrefix = "blkhs2blkraw_";
+    const std::string kTxRawPrefix = "txhs2txraw_";
+    const std::string kTxBlockPrefix = "txhs2blkhs_";
+
+    // Block and transaction history, only the block tail and the transactions state refers to are exported
+    const std::vector<std::string> kHistoryPrefixes = {kBlockHeightToHashesPrefix, kBlockHashToHeightPrefix, kBlockRawPrefix,
+                                                       kTxRawPrefix, kTxBlockPrefix, "addr2txraw_", "addr2blkhs_", "addr2txtop_"};
+
+    // Values written through mergeValue, '_' separated lists in the order their entries arrived, kept in sync with db_api.cpp
+    const std::vector<std::string> kMergeListPrefixes = {
+        kBlockHeightToHashesPrefix, "addr2utxo_", "stakeaddr_", "mutlisign_", "bonusaddr_", "bonusaddr2delegatingaddr_",
+        "delegatingaddr2bonusaddr_", "delegatingaddr2assettypebalance_", "delegating_nodeaddr2delegatingaddrutxo_",
+        "bonusutxo_", "fundutxo_", "delegatingutxo_", "allevmdeployeraddr_", "deployeraddr2contractaddr_", "signaddr_",
+        "assetType_", "revokeTxHash_", "approveVote_", "againstVote_", "voteTxHash_", "Lockaddr_", "addrAssetType_",
+        "timetxhashexchequer_"};
+
+    bool hasPrefix(const std::string &key, const std::string &prefix)
+    {
+        return key.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    bool hasAnyPrefix(const std::string &key, const std::vector<std::string> &prefixes)
+    {
+        return std::any_of(prefixes.begin(), prefixes.end(), [&key](const std::string &prefix) { return hasPrefix(key, prefix); });
+    }
+
+    std::vector<std::string> splitList(const std::string &value)
+    {
+        std::vector<std::string> entries;
+        size_t begin = 0;
+        while (begin <= value.size())
+        {
+            size_t end = value.find('_', begin);
+            if (end == std::string::npos)
+            {
+                end = value.size();
+            }
+            if (end > begin)
+            {
+                entries.push_back(value.substr(begin, end - begin));
+            }
+            begin = end + 1;
+        }
+        return entries;
+    }
+
+    // Merge lists hold the same entries on every node but in arrival and rollback order, so they are sorted.
+    // Readers take the first block hash of a height as its main block, that one keeps its place.
+    std::string canonicalValue(const std::string &key, const std::string &value)
+    {
+        if (!hasAnyPrefix(key, kMergeListPrefixes))
+        {
+            return value;
+        }
+        std::vector<std::string> entries = splitList(value);
+        auto sortFrom = entries.begin();
+        if (hasPrefix(key, kBlockHeightToHashesPrefix) && !entries.empty())
+        {
+            ++sortFrom;
+        }
+        std::sort(sortFrom, entries.end());
+        entries.erase(std::unique(sortFrom, entries.end()), entries.end());
+        std::string canonical;
+        for (const auto &entry : entries)
+        {
+            canonical += entry + "_";
+        }
+        return canonical;
+    }
+
+    // Utxo lists, utxo value keys and contract utxos name the transactions whose outputs state still holds
+    void collectHashes(const std::string &text, std::set<std::string> &hashes)
+    {
+        constexpr size_t kHashSize = 64;
+        size_t begin = 0;
+        while (begin < text.size())
+        {
+            size_t end = std::min(text.find('_', begin), text.size());
+            if (end - begin == kHashSize && std::all_of(text.begin() + begin, text.begin() + end,
+                                                        [](char c) { return std::isxdigit(static_cast<unsigned char>(c)) != 0; }))
+            {
+                hashes.insert(text.substr(begin, kHashSize));
+            }
+            begin = end + 1;
+        }
+    }
+
+    bool readRecord(rocksdb::Iterator &it, const std::string &key, std::string &value)
+    {
+        it.Seek(key);
+        if (!it.Valid() || it.key().ToString() != key)
+        {
+            return false;
+        }
+        value = it.value().ToString();
+        return true;
+    }
+
+    void appendLength(std::string &chunk, uint32_t length)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            chunk.push_back(static_cast<char>((length >> (8 * i)) & 0xff));
+        }
+    }
+
+    bool readLength(const std::string &chunk, size_t &pos, uint32_t &length)
+    {
+        if (chunk.size() - pos < 4)
+        {
+            return false;
+        }
+        length = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            length |= static_cast<uint32_t>(static_cast<unsigned char>(chunk[pos + i])) << (8 * i);
+        }
+        pos += 4;
+        return chunk.size() - pos >= length;
+    }
+
+    void appendRecord(std::string &chunk, const std::string &key, const std::string &value)
+    {
+        appendLength(chunk, key.size());
+        chunk += key;
+        appendLength(chunk, value.size());
+        chunk += value;
+    }
+
+    bool parseRecords(const std::string &chunk, std::vector<std::pair<std::string, std::string>> &records)
+    {
+        size_t pos = 0;
+        while (pos < chunk.size())
+        {
+            uint32_t keyLength = 0;
+            if (!readLength(chunk, pos, keyLength))
+            {
+                return false;
+            }
+            std::string key = chunk.substr(pos, keyLength);
+            pos += keyLength;
+            uint32_t valueLength = 0;
+            if (!readLength(chunk, pos, valueLength))
+            {
+                return false;
+            }
+            records.emplace_back(std::move(key), chunk.substr(pos, valueLength));
+            pos += valueLength;
+        }
+        return true;
+    }
+
+    // Hash over the sum hash tree top nodes of the chain cut at the height
+    bool chainHash(DBReader &reader, uint64_t height, std::string &hash)
+    {
+        uint64_t span = SumHashTree::Span(SumHashTree::kTopLevel);
+        std::string joined;
+        for (uint64_t index = 0; index <= height / span; ++index)
+        {
+            std::string node;
+            if (!SumHashTree::GetNode(reader, SumHashTree::kTopLevel, index, height, node))
+            {
+                return false;
+            }
+            joined += node + ";";
+        }
+        hash = Getsha256hash(joined);
+        return true;
+    }
+
+    bool readFile(const std::string &path, std::string &data)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        data = content.str();
+        return true;
+    }
+
+    bool writeFile(const std::string &path, const std::string &data)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), data.size());
+        return static_cast<bool>(file);
+    }
+}
+
+void StateSnapshot::SetDirectory(const std::string &directory)
+{
+    std::lock_guard<std::mutex> lock(_directoryMutex);
+    _directory = directory;
+}
+
+void StateSnapshot::OnBlockTop(uint64_t height)
+{
+    if (height == 0 || height % kInterval != 0)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_directoryMutex);
+        if (_directory.empty())
+        {
+            return;
+        }
+    }
+    if (_producing.exchange(true))
+    {
+        DEBUGLOG("state snapshot still being written, height {} skipped", height);
+        return;
+    }
+
+    DBReader reader;
+    std::string hash;
+    if (!SumHashTree::IsComplete(reader) || !chainHash(reader, height, hash))
+    {
+        DEBUGLOG("sum hash tree not ready, no state snapshot at height {}", height);
+        _producing = false;
+        return;
+    }
+    const rocksdb::Snapshot *view = MagicSingleton<RocksDB>::GetInstance()->getSnapshot();
+    if (view == nullptr)
+    {
+        _producing = false;
+        return;
+    }
+    std::thread([this, height, view, hash]() {
+        produce(height, view, hash);
+        prune();
+        _producing = false;
+    }).detach();
+}
+
+void StateSnapshot::produce(uint64_t height, const rocksdb::Snapshot *view, const std::string &chainHash)
+{
+    auto rocksdb = MagicSingleton<RocksDB>::GetInstance();
+    std::string directory = heightDirectory(height);
+    std::error_code ec;
+    std::filesystem::remove_all(directory, ec);
+    std::filesystem::create_directories(directory, ec);
+
+    SnapshotManifest manifest;
+    manifest.set_height(height);
+    manifest.set_chain_hash(chainHash);
+
+    std::string chunk;
+    std::string top;
+    auto flush = [&]() {
+        std::string path = directory + "/" + kChunkFilePrefix + std::to_string(manifest.chunk_hashes_size());
+        if (!writeFile(path, chunk))
+        {
+            ERRORLOG("write state snapshot chunk {} fail", path);
+            return false;
+        }
+        manifest.add_chunk_hashes(Getsha256hash(chunk));
+        manifest.set_total_bytes(manifest.total_bytes() + chunk.size());
+        chunk.clear();
+        return true;
+    };
+
+    bool success = !ec;
+    auto emit = [&](const std::string &key, const std::string &value) {
+        appendRecord(chunk, key, value);
+        manifest.set_key_count(manifest.key_count() + 1);
+        if (chunk.size() >= kChunkBytes)
+        {
+            success = flush();
+        }
+    };
+
+    std::unique_ptr<rocksdb::Iterator> it(rocksdb->newIterator(view));
+    if (it == nullptr)
+    {
+        success = false;
+    }
+    else
+    {
+        // State tables, in key order
+        std::set<std::string> referencedTxs;
+        for (it->SeekToFirst(); success && it->Valid(); it->Next())
+        {
+            std::string key = it->key().ToString();
+            if (key == kBlockTopKey)
+            {
+                top = it->value().ToString();
+            }
+            if (isLocalKey(key) || hasAnyPrefix(key, kHistoryPrefixes) || it->value().empty())
+            {
+                continue;
+            }
+            std::string value = canonicalValue(key, it->value().ToString());
+            collectHashes(key, referencedTxs);
+            collectHashes(value, referencedTxs);
+            emit(key, value);
+        }
+        success = success && it->status().ok();
+
+        // The last kBlockTail heights, so the next blocks find their predecessors
+        for (uint64_t tail = height >= kBlockTail ? height - kBlockTail + 1 : 0; success && tail <= height; ++tail)
+        {
+            std::string key = kBlockHeightToHashesPrefix + std::to_string(tail);
+            std::string hashes;
+            if (!readRecord(*it, key, hashes))
+            {
+                continue;
+            }
+            std::string value = canonicalValue(key, hashes);
+            emit(key, value);
+            for (const auto &blockHash : splitList(value))
+            {
+                std::string blockHeight;
+                std::string blockRaw;
+                CBlock block;
+                if (!readRecord(*it, kBlockHashToHeightPrefix + blockHash, blockHeight)
+                    || !readRecord(*it, kBlockRawPrefix + blockHash, blockRaw) || !block.ParseFromString(blockRaw))
+                {
+                    ERRORLOG("state snapshot block {} at height {} missing", blockHash, tail);
+                    success = false;
+                    break;
+                }
+                emit(kBlockHashToHeightPrefix + blockHash, blockHeight);
+                emit(kBlockRawPrefix + blockHash, blockRaw);
+                for (const auto &tx : block.txs())
+                {
+                    referencedTxs.insert(tx.hash());
+                }
+            }
+        }
+
+        // Transactions of the tail blocks and those the state refers to
+        for (const auto &prefix : {kTxBlockPrefix, kTxRawPrefix})
+        {
+            for (it->Seek(prefix); success && it->Valid() && hasPrefix(it->key().ToString(), prefix); it->Next())
+            {
+                std::string key = it->key().ToString();
+                if (referencedTxs.count(key.substr(prefix.size())) != 0 && !it->value().empty())
+                {
+                    emit(key, it->value().ToString());
+                }
+            }
+        }
+        success = success && it->status().ok() && (chunk.empty() || flush());
+        it.reset();
+    }
+    rocksdb->releaseSnapshot(view);
+
+    // Another block may have been committed between the top change and the read view
+    if (success && top != std::to_string(height))
+    {
+        DEBUGLOG("state snapshot view moved past height {} to {}", height, top);
+        success = false;
+    }
+    if (success)
+    {
+        manifest.set_root(ComputeRoot(manifest));
+        success = writeFile(directory + "/" + kManifestFile, manifest.SerializeAsString());
+    }
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    if (!success)
+    {
+        std::filesystem::remove_all(directory, ec);
+        ++_stats.discarded;
+        return;
+    }
+    ++_stats.produced;
+    _stats.lastProducedHeight = height;
+    INFOLOG("state snapshot at height {} written, {} records in {} chunks, root {}", height, manifest.key_count(),
+            manifest.chunk_hashes_size(), manifest.root());
+}
+
+bool StateSnapshot::GetManifest(SnapshotManifest &manifest)
+{
+    DBReader reader;
+    uint64_t top = 0;
+    if (reader.getBlockTop(top) != DBStatus::DB_SUCCESS || !SumHashTree::IsComplete(reader))
+    {
+        return false;
+    }
+    for (uint64_t height : storedHeights())
+    {
+        if (top < height + kFinalityDepth || !readManifest(height, manifest))
+        {
+            continue;
+        }
+        std::string hash;
+        if (!chainHash(reader, height, hash))
+        {
+            return false;
+        }
+        if (hash == manifest.chain_hash())
+        {
+            return true;
+        }
+        DEBUGLOG("state snapshot at height {} no longer matches the chain", height);
+    }
+    return false;
+}
+
+int StateSnapshot::ReadChunk(uint64_t height, uint32_t index, std::string &data)
+{
+    SnapshotManifest manifest;
+    if (!readManifest(height, manifest) || index >= static_cast<uint32_t>(manifest.chunk_hashes_size()))
+    {
+        return -1;
+    }
+    if (!readFile(heightDirectory(height) + "/" + kChunkFilePrefix + std::to_string(index), data))
+    {
+        ERRORLOG("read state snapshot chunk {} at height {} fail", index, height);
+        return -2;
+    }
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    ++_stats.servedChunks;
+    return 0;
+}
+
+int StateSnapshot::BeginImport(const SnapshotManifest &manifest)
+{
+    if (manifest.chunk_hashes_size() == 0 || ComputeRoot(manifest) != manifest.root())
+    {
+        return -1;
+    }
+    {
+        DBReadWriter writer;
+        if (writer.setSnapshotImportRoot(manifest.root()) != DBStatus::DB_SUCCESS
+            || writer.transactionCommit() != DBStatus::DB_SUCCESS)
+        {
+            return -2;
+        }
+    }
+
+    std::vector<std::string> keys;
+    {
+        std::unique_ptr<rocksdb::Iterator> it(MagicSingleton<RocksDB>::GetInstance()->newIterator());
+        if (it == nullptr)
+        {
+            return -2;
+        }
+        for (it->SeekToFirst(); it->Valid(); it->Next())
+        {
+            std::string key = it->key().ToString();
+            if (!isLocalKey(key))
+            {
+                keys.push_back(std::move(key));
+            }
+        }
+        if (!it->status().ok())
+        {
+            ERRORLOG("iterate records before state snapshot import fail: {}", it->status().ToString());
+            return -2;
+        }
+    }
+    for (size_t begin = 0; begin < keys.size(); begin += kRemoveKeysPerTransaction)
+    {
+        size_t end = std::min(keys.size(), begin + kRemoveKeysPerTransaction);
+        DBReadWriter writer;
+        if (writer.removeSnapshotRecords(std::vector<std::string>(keys.begin() + begin, keys.begin() + end)) != DBStatus::DB_SUCCESS
+            || writer.transactionCommit() != DBStatus::DB_SUCCESS)
+        {
+            return -2;
+        }
+    }
+    INFOLOG("state snapshot import at height {} started, {} local records removed", manifest.height(), keys.size());
+    return 0;
+}
+
+int StateSnapshot::ImportChunk(const SnapshotManifest &manifest, uint32_t index, const std::string &data)
+{
+    std::vector<std::pair<std::string, std::string>> records;
+    bool valid = index < static_cast<uint32_t>(manifest.chunk_hashes_size())
+                 && Getsha256hash(data) == manifest.chunk_hashes(index)
+                 && parseRecords(data, records);
+    for (size_t i = 0; valid && i < records.size(); ++i)
+    {
+        valid = !isLocalKey(records[i].first);
+    }
+    if (!valid)
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        ++_stats.rejectedChunks;
+        return -1;
+    }
+
+    DBReadWriter writer;
+    if (writer.writeSnapshotRecords(records) != DBStatus::DB_SUCCESS || writer.transactionCommit() != DBStatus::DB_SUCCESS)
+    {
+        return -2;
+    }
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    ++_stats.importedChunks;
+    _stats.importedKeys += records.size();
+    return 0;
+}
+
+int StateSnapshot::FinishImport(const SnapshotManifest &manifest)
+{
+    std::lock_guard<std::mutex> treeLock(SumHashTree::UpdateMutex());
+    DBReadWriter writer;
+    std::string hash;
+    if (!chainHash(writer, manifest.height(), hash))
+    {
+        return -2;
+    }
+    if (hash != manifest.chain_hash())
+    {
+        ERRORLOG("imported chain at height {} does not match the snapshot manifest", manifest.height());
+        return -1;
+    }
+    // The imported tree already covers every imported block
+    if (writer.setSumTreeBuiltHeight(SumHashTree::kBuiltComplete) != DBStatus::DB_SUCCESS
+        || writer.setBlockTop(static_cast<unsigned int>(manifest.height())) != DBStatus::DB_SUCCESS
+        || writer.removeSnapshotImportRoot() != DBStatus::DB_SUCCESS
+        || writer.transactionCommit() != DBStatus::DB_SUCCESS)
+    {
+        return -2;
+    }
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    ++_stats.imports;
+    _stats.lastImportedHeight = manifest.height();
+    INFOLOG("state snapshot import at height {} finished, root {}", manifest.height(), manifest.root());
+    return 0;
+}
+
+bool StateSnapshot::ImportPending()
+{
+    DBReader reader;
+    std::string root;
+    return reader.getSnapshotImportRoot(root) == DBStatus::DB_SUCCESS;
+}
+
+StateSnapshotStats StateSnapshot::GetStats()
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+std::string StateSnapshot::ComputeRoot(const SnapshotManifest &manifest)
+{
+    std::string joined = std::to_string(manifest.height()) + ";" + manifest.chain_hash() + ";"
+                         + std::to_string(manifest.key_count()) + ";" + std::to_string(manifest.total_bytes()) + ";";
+    for (const auto &chunkHash : manifest.chunk_hashes())
+    {
+        joined += chunkHash + ";";
+    }
+    return Getsha256hash(joined);
+}
+
+bool StateSnapshot::readManifest(uint64_t height, SnapshotManifest &manifest)
+{
+    std::string data;
+    manifest.Clear();
+    return readFile(heightDirectory(height) + "/" + kManifestFile, data) && manifest.ParseFromString(data)
+           && manifest.height() == height && ComputeRoot(manifest) == manifest.root();
+}
+
+std::vector<uint64_t> StateSnapshot::storedHeights()
+{
+    std::vector<uint64_t> heights;
+    std::string directory;
+    {
+        std::lock_guard<std::mutex> lock(_directoryMutex);
+        directory = _directory;
+    }
+    std::error_code ec;
+    if (directory.empty() || !std::filesystem::is_directory(directory, ec))
+    {
+        return heights;
+    }
+    for (const auto &entry : std::filesystem::directory_iterator(directory, ec))
+    {
+        std::string name = entry.path().filename().string();
+        if (!name.empty() && std::all_of(name.begin(), name.end(), ::isdigit)
+            && std::filesystem::exists(entry.path() / kManifestFile, ec))
+        {
+            heights.push_back(std::stoull(name));
+        }
+    }
+    std::sort(heights.rbegin(), heights.rend());
+    return heights;
+}
+
+void StateSnapshot::prune()
+{
+    std::vector<uint64_t> heights = storedHeights();
+    std::error_code ec;
+    for (size_t i = kRetainedSnapshots; i < heights.size(); ++i)
+    {
+        std::filesystem::remove_all(heightDirectory(heights[i]), ec);
+        DEBUGLOG("state snapshot at height {} removed", heights[i]);
+    }
+}
+
+std::string StateSnapshot::heightDirectory(uint64_t height)
+{
+    std::lock_guard<std::mutex> lock(_directoryMutex);
+    return _directory + "/" + std::to_string(height);
+}
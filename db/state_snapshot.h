@@ -0,0 +1,144 @@
+/**
+ * *****************************************************************************
+ * @file        state_snapshot.h
+ * @brief       Chunked state snapshots at finalized heights and their import
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef DB_STATE_SNAPSHOT_HEADER
+#define DB_STATE_SNAPSHOT_HEADER
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "db/rocksdb.h"
+#include "proto/sync_block.pb.h"
+
+/**
+ * @brief       Counters of snapshot production and import
+ */
+struct StateSnapshotStats
+{
+    uint64_t produced = 0;
+    uint64_t discarded = 0;
+    uint64_t lastProducedHeight = 0;
+    uint64_t servedChunks = 0;
+    uint64_t imports = 0;
+    uint64_t importedChunks = 0;
+    uint64_t importedKeys = 0;
+    uint64_t rejectedChunks = 0;
+    uint64_t lastImportedHeight = 0;
+};
+
+/**
+ * @brief       Every kInterval heights the database is captured in a consistent read view and
+ *              written in the background as chunks of records. State tables, UTXOs, indexes,
+ *              contract MPT nodes, period aggregates and the sum hash tree, are carried in key
+ *              order, with the '_' lists merged on write sorted so their arrival order does not
+ *              matter. Of the block and transaction history only the last kBlockTail heights and
+ *              the transactions of them or referenced by state are carried. Each chunk is hashed and
+ *              the manifest root covers the height, the chunk hashes and the sum hash tree over the
+ *              chain below the height, so nodes holding the same state publish the same root.
+ *              A snapshot is only served once kFinalityDepth blocks lie on top of it and the chain
+ *              below it is still the one it was taken from.
+ *
+ *              A new node replaces its database with an agreed snapshot: the import is marked
+ *              started, the old records are removed, chunks are verified and written as they
+ *              arrive and the block top is set last, so an interrupted import is detected and
+ *              redone instead of leaving a partial state behind.
+ */
+class StateSnapshot
+{
+public:
+    StateSnapshot() = default;
+    ~StateSnapshot() = default;
+    StateSnapshot(StateSnapshot &&) = delete;
+    StateSnapshot(const StateSnapshot &) = delete;
+    StateSnapshot &operator=(StateSnapshot &&) = delete;
+    StateSnapshot &operator=(const StateSnapshot &) = delete;
+
+    /**
+     * @brief       Directory holding one subdirectory of chunks per snapshot height
+     */
+    void SetDirectory(const std::string &directory);
+
+    /**
+     * @brief       Called after a transaction that moved the block top has committed
+     *
+     * @param       height: new block top
+     */
+    void OnBlockTop(uint64_t height);
+
+    /**
+     * @brief       Newest snapshot that is final and still matches the local chain
+     *
+     * @param       manifest: snapshot manifest
+     * @return      true    a snapshot is served
+     * @return      false   none is available
+     */
+    bool GetManifest(SnapshotManifest &manifest);
+
+    /**
+     * @brief       Read one chunk of a served snapshot
+     *
+     * @return      int return 0 success, -1 unknown snapshot or chunk, -2 read failure
+     */
+    int ReadChunk(uint64_t height, uint32_t index, std::string &data);
+
+    /**
+     * @brief       Mark the import of the manifest as started and remove the current records
+     *
+     * @return      int return 0 success, -1 the manifest root does not match, -2 database error
+     */
+    int BeginImport(const SnapshotManifest &manifest);
+
+    /**
+     * @brief       Verify one chunk against the manifest and write its records
+     *
+     * @return      int return 0 success, -1 hash mismatch or malformed chunk, -2 database error
+     */
+    int ImportChunk(const SnapshotManifest &manifest, uint32_t index, const std::string &data);
+
+    /**
+     * @brief       Check the imported chain against the manifest and set the block top
+     *
+     * @return      int return 0 success, -1 the imported chain does not match, -2 database error
+     */
+    int FinishImport(const SnapshotManifest &manifest);
+
+    /**
+     * @brief       Whether an import was started and never finished
+     */
+    bool ImportPending();
+
+    StateSnapshotStats GetStats();
+
+    static std::string ComputeRoot(const SnapshotManifest &manifest);
+
+    static constexpr uint64_t kInterval = 10000;
+    static constexpr uint64_t kFinalityDepth = 100;
+    static constexpr uint64_t kBlockTail = 100;
+    static constexpr size_t kChunkBytes = 1024 * 1024;
+    static constexpr size_t kRetainedSnapshots = 2;
+    static constexpr size_t kRemoveKeysPerTransaction = 10000;
+
+private:
+    void produce(uint64_t height, const rocksdb::Snapshot *view, const std::string &chainHash);
+    bool readManifest(uint64_t height, SnapshotManifest &manifest);
+    std::vector<uint64_t> storedHeights();
+    void prune();
+    std::string heightDirectory(uint64_t height);
+
+    std::mutex _directoryMutex;
+    std::string _directory;
+    std::atomic<bool> _producing{false};
+
+    std::mutex _statsMutex;
+    StateSnapshotStats _stats;
+};
+
+#endif
@@ -0,0 +1,220 @@
+#include "db/sum_hash_tree.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "include/logging.h"
+#include "utils/account_manager.h"
+
+namespace
+{
+    std::string leafHash(std::vector<std::string> blockHashes)
+    {
+        if (blockHashes.empty())
+        {
+            return std::string();
+        }
+        std::sort(blockHashes.begin(), blockHashes.end());
+        std::string joined;
+        for (const auto &hash : blockHashes)
+        {
+            joined += hash;
+        }
+        return Getsha256hash(joined);
+    }
+
+    // Children are listed with their position so that moving a block to another height changes the hash
+    std::string combine(const std::vector<std::string> &children)
+    {
+        std::string joined;
+        for (size_t i = 0; i < children.size(); ++i)
+        {
+            if (!children[i].empty())
+            {
+                joined += std::to_string(i) + ":" + children[i] + ";";
+            }
+        }
+        return joined.empty() ? std::string() : Getsha256hash(joined);
+    }
+
+    bool readNode(DBReader &reader, uint32_t level, uint64_t index, std::string &hash)
+    {
+        hash.clear();
+        auto ret = reader.getSumTreeNode(level, index, hash);
+        return ret == DBStatus::DB_SUCCESS || ret == DBStatus::DB_NOT_FOUND;
+    }
+
+    bool readLeaf(DBReader &reader, uint64_t height, std::string &hash)
+    {
+        std::vector<std::string> blockHashes;
+        auto ret = reader.getBlockHashsByBlockHeight(height, blockHashes);
+        if (ret != DBStatus::DB_SUCCESS && ret != DBStatus::DB_NOT_FOUND)
+        {
+            return false;
+        }
+        hash = leafHash(std::move(blockHashes));
+        return true;
+    }
+
+    DBStatus writeNode(DBReadWriter &writer, uint32_t level, uint64_t index, const std::string &hash)
+    {
+        return hash.empty() ? writer.removeSumTreeNode(level, index) : writer.setSumTreeNode(level, index, hash);
+    }
+
+    std::atomic<bool> backfillRunning{false};
+}
+
+uint64_t SumHashTree::Span(uint32_t level)
+{
+    uint64_t span = 1;
+    for (uint32_t i = 0; i < level; ++i)
+    {
+        span *= kFanout;
+    }
+    return span;
+}
+
+DBStatus SumHashTree::Update(DBReadWriter &writer, const std::set<uint64_t> &heights)
+{
+    std::set<uint64_t> changed;
+    for (uint64_t height : heights)
+    {
+        std::string hash;
+        if (!readLeaf(writer, height, hash))
+        {
+            return DBStatus::DB_ERROR;
+        }
+        auto ret = writeNode(writer, 0, height, hash);
+        if (ret != DBStatus::DB_SUCCESS)
+        {
+            return ret;
+        }
+        changed.insert(height);
+    }
+
+    for (uint32_t level = 1; level < kLevels; ++level)
+    {
+        std::set<uint64_t> parents;
+        for (uint64_t index : changed)
+        {
+            parents.insert(index / kFanout);
+        }
+        for (uint64_t parent : parents)
+        {
+            std::vector<std::string> children(kFanout);
+            for (uint32_t i = 0; i < kFanout; ++i)
+            {
+                if (!readNode(writer, level - 1, parent * kFanout + i, children[i]))
+                {
+                    return DBStatus::DB_ERROR;
+                }
+            }
+            auto ret = writeNode(writer, level, parent, combine(children));
+            if (ret != DBStatus::DB_SUCCESS)
+            {
+                return ret;
+            }
+        }
+        changed = std::move(parents);
+    }
+    return DBStatus::DB_SUCCESS;
+}
+
+bool SumHashTree::GetNode(DBReader &reader, uint32_t level, uint64_t index, uint64_t maxHeight, std::string &hash)
+{
+    hash.clear();
+    uint64_t span = Span(level);
+    uint64_t first = index * span;
+    if (first > maxHeight)
+    {
+        return true;
+    }
+    if (level == 0 || first + span - 1 <= maxHeight)
+    {
+        return readNode(reader, level, index, hash);
+    }
+
+    std::vector<std::string> children(kFanout);
+    for (uint32_t i = 0; i < kFanout; ++i)
+    {
+        if (!GetNode(reader, level - 1, index * kFanout + i, maxHeight, children[i]))
+        {
+            return false;
+        }
+    }
+    hash = combine(children);
+    return true;
+}
+
+bool SumHashTree::IsComplete(DBReader &reader)
+{
+    uint64_t built = 0;
+    return reader.getSumTreeBuiltHeight(built) == DBStatus::DB_SUCCESS && built == kBuiltComplete;
+}
+
+std::mutex &SumHashTree::UpdateMutex()
+{
+    static std::mutex updateMutex;
+    return updateMutex;
+}
+
+void SumHashTree::StartBackfill()
+{
+    if (backfillRunning.exchange(true))
+    {
+        return;
+    }
+    std::thread([]() {
+        uint64_t next = 0;
+        {
+            DBReader reader;
+            if (IsComplete(reader))
+            {
+                backfillRunning = false;
+                return;
+            }
+            uint64_t built = 0;
+            if (reader.getSumTreeBuiltHeight(built) == DBStatus::DB_SUCCESS)
+            {
+                next = built + 1;
+            }
+        }
+        INFOLOG("sum hash tree backfill starts at height {}", next);
+
+        while (true)
+        {
+            std::lock_guard<std::mutex> lock(UpdateMutex());
+            DBReadWriter writer;
+            uint64_t top = 0;
+            if (writer.getBlockTop(top) != DBStatus::DB_SUCCESS)
+            {
+                ERRORLOG("sum hash tree backfill getBlockTop fail");
+                break;
+            }
+            // Saves commit their own tree updates, so once the backfill reaches the top the tree is complete
+            bool reachesTop = next + kBackfillHeightsPerTransaction > top;
+            uint64_t last = reachesTop ? top : next + kBackfillHeightsPerTransaction - 1;
+            std::set<uint64_t> heights;
+            for (uint64_t height = next; height <= last; ++height)
+            {
+                heights.insert(height);
+            }
+            if (Update(writer, heights) != DBStatus::DB_SUCCESS
+                || writer.setSumTreeBuiltHeight(reachesTop ? kBuiltComplete : last) != DBStatus::DB_SUCCESS
+                || writer.transactionCommit() != DBStatus::DB_SUCCESS)
+            {
+                ERRORLOG("sum hash tree backfill failed at height {}", next);
+                break;
+            }
+            if (reachesTop)
+            {
+                INFOLOG("sum hash tree backfill complete at height {}", top);
+                break;
+            }
+            next = last + 1;
+        }
+        backfillRunning = false;
+    }).detach();
+}
@@ -0,0 +1,82 @@
+/**
+ * *****************************************************************************
+ * @file        sum_hash_tree.h
+ * @brief       Persistent hierarchical sum hashes over block heights
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef DB_SUM_HASH_TREE_HEADER
+#define DB_SUM_HASH_TREE_HEADER
+
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "db/db_api.h"
+
+/**
+ * @brief       Sum hash tree over heights with a fan-out of kFanout per level.
+ *              Level 0 holds the hash of the sorted block hashes of one height, a node of
+ *              level k covers kFanout^k heights and hashes its non-empty children with their
+ *              position. Every write transaction that adds or removes block hashes updates the
+ *              affected leaves and their ancestors before it commits, so save and rollback keep
+ *              the tree current. Two nodes agreeing on a node agree on every block below it,
+ *              which lets sync bisect to the first divergent height.
+ */
+class SumHashTree
+{
+public:
+    static constexpr uint32_t kFanout = 16;
+    static constexpr uint32_t kLevels = 7;
+    static constexpr uint32_t kTopLevel = kLevels - 1;
+    static constexpr uint64_t kBuiltComplete = UINT64_MAX;
+
+    /**
+     * @brief       Number of heights one node of the level covers
+     */
+    static uint64_t Span(uint32_t level);
+
+    /**
+     * @brief       Recompute the leaves of the heights and all their ancestors inside the transaction
+     *
+     * @param       writer: transaction that changed the block hashes of the heights
+     * @param       heights: changed heights
+     * @return      DBStatus Operation result status code
+     */
+    static DBStatus Update(DBReadWriter &writer, const std::set<uint64_t> &heights);
+
+    /**
+     * @brief       Hash of a node over the chain cut at maxHeight. Nodes entirely below the cut
+     *              come from the database, the node straddling it is recomputed from its children.
+     *
+     * @param       reader: database reader
+     * @param       level: node level
+     * @param       index: node index within the level
+     * @param       maxHeight: highest height taken into account
+     * @param       hash: node hash, empty when no block lies under the node
+     * @return      true    success
+     * @return      false   database error
+     */
+    static bool GetNode(DBReader &reader, uint32_t level, uint64_t index, uint64_t maxHeight, std::string &hash);
+
+    /**
+     * @brief       Whether the tree covers every block of the chain
+     */
+    static bool IsComplete(DBReader &reader);
+
+    /**
+     * @brief       Build the tree for blocks saved before it existed, in a background thread
+     */
+    static void StartBackfill();
+
+    /**
+     * @brief       Serializes tree updates with the commit of the transaction that caused them
+     */
+    static std::mutex &UpdateMutex();
+
+    static constexpr uint64_t kBackfillHeightsPerTransaction = 4096;
+};
+
+#endif
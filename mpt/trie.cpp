@@ -2,17 +2,59 @@
 
 #include <memory>
 #include <iostream>
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <future>
+#include <thread>
 
 #include <db/db_api.h>
 #include "./commondata.h"
 #include "./common.h"
 #include "./rlp.h"
 #include "./trie.h"
+#include "./trie_node_cache.h"
 #include "utils/account_manager.h"
 #include "include/logging.h"
 #include "utils/magic_singleton.h"
 
+namespace
+{
+    // Children of the top full node are spread over at most this many threads, the caller included
+    constexpr size_t kMaxHashWorkers = 4;
+
+    template <typename F>
+    void forEachBounded(const std::vector<int>& indices, F&& work)
+    {
+        size_t workers = std::min<size_t>({kMaxHashWorkers, indices.size(), std::max(1u, std::thread::hardware_concurrency())});
+        std::atomic<size_t> next{0};
+        auto drain = [&]() {
+            for (size_t i = next++; i < indices.size(); i = next++)
+            {
+                work(indices[i]);
+            }
+        };
+        std::vector<std::future<void>> helpers;
+        for (size_t w = 1; w < workers; ++w)
+        {
+            helpers.push_back(std::async(std::launch::async, drain));
+        }
+        drain();
+        for (auto& helper : helpers)
+        {
+            helper.get();
+        }
+    }
+
+    void mergeDirtyNodes(std::map<std::string, std::string>& dirtyHash, std::vector<std::pair<std::string, std::string>>& nodes)
+    {
+        for (auto& node : nodes)
+        {
+            dirtyHash[node.first] = std::move(node.second);
+        }
+    }
+}
+
 std::string Trie::wrapperKey(std::string str) const
 {
     return str + str[str.length() - 1] + 'z';
@@ -82,6 +124,45 @@ void Trie::GetBlockStorage(std::pair<std::string, std::string>& rootHash, std::m
     return;
 }
 
+size_t Trie::CountDirtyNodes(nodePtr n, size_t limit) const
+{
+    size_t count = 0;
+    std::vector<nodePtr> pending{n};
+    while (!pending.empty() && count < limit)
+    {
+        auto cur = pending.back();
+        pending.pop_back();
+        if (cur == NULL)
+        {
+            continue;
+        }
+        if (cur->name == typeid(ShortNode).name())
+        {
+            auto sn = cur->toSonClass<ShortNode>();
+            if (!sn->nodeFlags.hash.data.empty())
+            {
+                continue;
+            }
+            ++count;
+            pending.push_back(sn->nodeVal);
+        }
+        else if (cur->name == typeid(FullNode).name())
+        {
+            auto fn = cur->toSonClass<FullNode>();
+            if (!fn->flags.hash.data.empty())
+            {
+                continue;
+            }
+            ++count;
+            for (int i = 0; i < 16; i++)
+            {
+                pending.push_back(fn->children[i]);
+            }
+        }
+    }
+    return count;
+}
+
 nodePtr Trie::ResolveHash(nodePtr n, std::string prefix) const
 {
     std::string strSha1;
@@ -249,6 +330,14 @@ nodePtr Trie::Update(std::string key, std::string value)
 
 nodePtr Trie::DescendKey(std::string key) const
 {
+    // Nodes are content addressed, so a decoded node is valid for any trie that references its hash
+    auto nodeCache = MagicSingleton<TrieNodeCache>::GetInstance();
+    nodePtr cached;
+    if (nodeCache->Get(key, cached))
+    {
+        return cached;
+    }
+
     DBReader dataReader;
     std::string value;
 
@@ -256,6 +345,8 @@ nodePtr Trie::DescendKey(std::string key) const
     {
         this->contractDataStorage->get(contractAddr + "_" + key, value);
     }
+    // Nodes of the uncommitted overlay may be rolled back, only committed ones are shared
+    bool committed = value.empty();
     
     if(value.empty() && dataReader.getMptValueByMptKey(contractAddr + "_" + key, value) != 0)
     {
@@ -264,7 +355,12 @@ nodePtr Trie::DescendKey(std::string key) const
     dev::bytes bs = dev::fromHex(value);
     if (value == "") return NULL;
     dev::RLP r = dev::RLP(bs);
-    return DecodeNode(key, r);  // if not, it must be a list
+    auto node = DecodeNode(key, r);  // if not, it must be a list
+    if (committed)
+    {
+        nodeCache->Put(key, node, bs.size());
+    }
+    return node;
 }
 nodePtr Trie::DecodeShort(std::string hash, dev::RLP const& r) const
 {
@@ -341,6 +437,10 @@ nodePtr Trie::DecodeNode(std::string hash, dev::RLP const& r) const
 }
 
 nodePtr Trie::hash(nodePtr n)
+{
+    return hash(n, false);
+}
+nodePtr Trie::hash(nodePtr n, bool fanOut)
 {
     if (n->name == typeid(ShortNode).name())
     {
@@ -352,7 +452,7 @@ nodePtr Trie::hash(nodePtr n)
                 new packing<HashNode>(sn->nodeFlags.hash));
         }
 
-        auto hashed = HashShortNodeChildren(n);
+        auto hashed = HashShortNodeChildren(n, fanOut);
         auto hashnode = hashed->toSonClass<HashNode>();
         sn->nodeFlags.hash = *hashnode;
 
@@ -369,7 +469,7 @@ nodePtr Trie::hash(nodePtr n)
                 new packing<HashNode>(fn->flags.hash));
         }
 
-        auto hashed = HashFullNodeChildren(n);
+        auto hashed = HashFullNodeChildren(n, fanOut);
         auto hashnode = hashed->toSonClass<HashNode>();
         fn->flags.hash = *hashnode;
 
@@ -383,6 +483,10 @@ nodePtr Trie::hash(nodePtr n)
 
 }
 nodePtr Trie::HashShortNodeChildren(nodePtr n)
+{
+    return HashShortNodeChildren(n, false);
+}
+nodePtr Trie::HashShortNodeChildren(nodePtr n, bool fanOut)
 {
 
     auto sn = n->toSonClass<ShortNode>();
@@ -392,28 +496,40 @@ nodePtr Trie::HashShortNodeChildren(nodePtr n)
     if (vn->name == typeid(ShortNode).name() || vn->name == typeid(FullNode).name())
     {
 
-        sn->nodeFlags.hash = *hash(vn)->toSonClass<HashNode>();
+        sn->nodeFlags.hash = *hash(vn, fanOut)->toSonClass<HashNode>();
     }
 
     return ToHash(n);
 }
 nodePtr Trie::HashFullNodeChildren(nodePtr n)
+{
+    return HashFullNodeChildren(n, false);
+}
+nodePtr Trie::HashFullNodeChildren(nodePtr n, bool fanOut)
 {
 
     auto fn = n->toSonClass<FullNode>();
 
     FullNode collapsed;
+    // Children are disjoint subtrees, so they can be hashed on separate threads
+    std::vector<int> parallel;
     for (int i = 0; i < 16; i++)
     {
         auto child = fn->children[i];
         if (child != NULL)
         {
+            if (fanOut && (child->name == typeid(ShortNode).name() || child->name == typeid(FullNode).name()))
+            {
+                parallel.push_back(i);
+                continue;
+            }
             collapsed.children[i] = hash(child);
         }
         else {
             collapsed.children[i] = NULL;
         }
     }
+    forEachBounded(parallel, [this, &fn, &collapsed](int i) { collapsed.children[i] = hash(fn->children[i]); });
 
     return ToHash(std::shared_ptr<packing<FullNode>>(
         new packing<FullNode>(collapsed)));
@@ -478,7 +594,14 @@ dev::RLPStream Trie::Encode(nodePtr n)
     return dev::RLPStream();
 }
 
-nodePtr Trie::Store(nodePtr n) {
+nodePtr Trie::Store(nodePtr n)
+{
+    std::vector<std::pair<std::string, std::string>> nodes;
+    auto hashed = Store(n, nodes);
+    mergeDirtyNodes(dirtyHash, nodes);
+    return hashed;
+}
+nodePtr Trie::Store(nodePtr n, std::vector<std::pair<std::string, std::string>>& nodes) {
 
     if (n->name != typeid(ShortNode).name() && n->name != typeid(FullNode).name())
     {
@@ -504,7 +627,7 @@ nodePtr Trie::Store(nodePtr n) {
         dev::bytes data = rlp.out();
         std::string stringData = dev::toHex(data);
 
-        dirtyHash[hash.data] = stringData;
+        nodes.emplace_back(hash.data, std::move(stringData));
 
         return std::shared_ptr<packing<HashNode>>(
             new packing<HashNode>(hash));
@@ -512,6 +635,13 @@ nodePtr Trie::Store(nodePtr n) {
 
 }
 nodePtr Trie::Commit(nodePtr n)
+{
+    std::vector<std::pair<std::string, std::string>> nodes;
+    auto hashed = Commit(n, nodes, false);
+    mergeDirtyNodes(dirtyHash, nodes);
+    return hashed;
+}
+nodePtr Trie::Commit(nodePtr n, std::vector<std::pair<std::string, std::string>>& nodes, bool fanOut)
 {
     if (n->name == typeid(ShortNode).name())
     {
@@ -525,10 +655,10 @@ nodePtr Trie::Commit(nodePtr n)
         auto vn = sn->nodeVal;
         if (vn->name == typeid(FullNode).name())
         {
-            auto childV = Commit(vn);
+            auto childV = Commit(vn, nodes, fanOut);
             sn->nodeVal = childV;
         }
-        auto hashed = Store(n);
+        auto hashed = Store(n, nodes);
         if (hashed->name == typeid(HashNode).name())
         {
             return hashed;
@@ -543,9 +673,9 @@ nodePtr Trie::Commit(nodePtr n)
             return std::shared_ptr<packing<HashNode>>(
                 new packing<HashNode>(fn->flags.hash));
         }
-        std::array<nodePtr, 17> hashedKids = commitChildren(n);
+        std::array<nodePtr, 17> hashedKids = commitChildren(n, nodes, fanOut);
         fn->children = hashedKids;
-        auto hashed = Store(n);
+        auto hashed = Store(n, nodes);
         if (hashed->name == typeid(HashNode).name())
         {
             return hashed;
@@ -559,9 +689,19 @@ nodePtr Trie::Commit(nodePtr n)
     return NULL;
 }
 std::array<nodePtr, 17> Trie::commitChildren(nodePtr n)
+{
+    std::vector<std::pair<std::string, std::string>> nodes;
+    auto children = commitChildren(n, nodes, false);
+    mergeDirtyNodes(dirtyHash, nodes);
+    return children;
+}
+std::array<nodePtr, 17> Trie::commitChildren(nodePtr n, std::vector<std::pair<std::string, std::string>>& nodes, bool fanOut)
 {
     auto fn = n->toSonClass<FullNode>();
     std::array<nodePtr, 17> children;
+    // Each child collects its dirty nodes on its own and they are appended in child order
+    std::array<std::vector<std::pair<std::string, std::string>>, 16> childNodes;
+    std::vector<int> parallel;
     for (int i = 0; i < 16; i++)
     {
         auto child = fn->children[i];
@@ -575,9 +715,19 @@ std::array<nodePtr, 17> Trie::commitChildren(nodePtr n)
             continue;
         }
 
-        auto hashed = Commit(child);
+        if (fanOut)
+        {
+            parallel.push_back(i);
+            continue;
+        }
+        auto hashed = Commit(child, nodes, false);
         children[i] = hashed;
     }
+    forEachBounded(parallel, [this, &fn, &children, &childNodes](int i) { children[i] = Commit(fn->children[i], childNodes[i], false); });
+    for (int i : parallel)
+    {
+        nodes.insert(nodes.end(), std::make_move_iterator(childNodes[i].begin()), std::make_move_iterator(childNodes[i].end()));
+    }
     if (fn->children[16] != NULL)
     {
         children[16] = fn->children[16];
@@ -591,7 +741,10 @@ void Trie::Save()
     {
         return;
     }
-    hash(root);
+    bool fanOut = CountDirtyNodes(root, kParallelHashThreshold) >= kParallelHashThreshold;
+    hash(root, fanOut);
 
-    this->root = Commit(root);
+    std::vector<std::pair<std::string, std::string>> nodes;
+    this->root = Commit(root, nodes, fanOut);
+    mergeDirtyNodes(dirtyHash, nodes);
 }
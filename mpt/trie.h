@@ -16,6 +16,7 @@
 #include <string>
 #include <unordered_map>
 #include <shared_mutex>
+#include <vector>
 
 #include <boost/algorithm/hex.hpp>
 #include <boost/uuid/detail/sha1.hpp>
@@ -129,14 +130,20 @@ public:
     nodePtr DecodeNode(std::string hash, dev::RLP const& r) const;
 
     nodePtr hash(nodePtr n);
+    nodePtr hash(nodePtr n, bool fanOut);
     nodePtr HashShortNodeChildren(nodePtr n);
+    nodePtr HashShortNodeChildren(nodePtr n, bool fanOut);
     nodePtr HashFullNodeChildren(nodePtr n);
+    nodePtr HashFullNodeChildren(nodePtr n, bool fanOut);
     nodePtr ToHash(nodePtr n);
     dev::RLPStream Encode(nodePtr n);
 
     nodePtr Store(nodePtr n);
+    nodePtr Store(nodePtr n, std::vector<std::pair<std::string, std::string>>& nodes);
     nodePtr Commit(nodePtr n);
+    nodePtr Commit(nodePtr n, std::vector<std::pair<std::string, std::string>>& nodes, bool fanOut);
     std::array<nodePtr, 17>commitChildren(nodePtr n);
+    std::array<nodePtr, 17>commitChildren(nodePtr n, std::vector<std::pair<std::string, std::string>>& nodes, bool fanOut);
 
     void Save();
 
@@ -147,6 +154,12 @@ public:
     int Toint(char c) const;
 
     void GetBlockStorage(std::pair<std::string, std::string>& rootHash, std::map<std::string, std::string>& dirtyHash);
+
+    // Subtrees with at least this many unhashed nodes have the children of
+    // their top full node hashed and committed on a few worker threads.
+    static constexpr size_t kParallelHashThreshold = 256;
+private:
+    size_t CountDirtyNodes(nodePtr n, size_t limit) const;
 public:
     mutable nodePtr root;
     std::string contractAddr;
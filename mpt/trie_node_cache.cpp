@@ -0,0 +1,134 @@
+#include "./trie_node_cache.h"
+
+#include <functional>
+
+nodePtr TrieNodeCache::CloneNode(const nodePtr& node)
+{
+    if (node == NULL)
+    {
+        return NULL;
+    }
+    // Hash and value nodes are never modified in place, only short and full nodes are
+    if (node->name == typeid(ShortNode).name())
+    {
+        auto sn = node->toSonClass<ShortNode>();
+        return std::shared_ptr<packing<ShortNode>>(
+            new packing<ShortNode>(ShortNode{ sn->nodeKey, CloneNode(sn->nodeVal), sn->nodeFlags }));
+    }
+    else if (node->name == typeid(FullNode).name())
+    {
+        auto fn = node->toSonClass<FullNode>();
+        FullNode copy;
+        copy.flags = fn->flags;
+        for (size_t i = 0; i < fn->children.size(); ++i)
+        {
+            copy.children[i] = CloneNode(fn->children[i]);
+        }
+        return std::shared_ptr<packing<FullNode>>(
+            new packing<FullNode>(copy));
+    }
+    return node;
+}
+
+TrieNodeCache::Shard& TrieNodeCache::shardFor(const std::string& hash)
+{
+    return _shards[std::hash<std::string>{}(hash) % kShardCount];
+}
+
+bool TrieNodeCache::Get(const std::string& hash, nodePtr& node)
+{
+    auto& shard = shardFor(hash);
+    nodePtr cached;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.index.find(hash);
+        if (found == shard.index.end())
+        {
+            ++_misses;
+            return false;
+        }
+        shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+        cached = found->second->node;
+    }
+    ++_hits;
+    node = CloneNode(cached);
+    return true;
+}
+
+void TrieNodeCache::Put(const std::string& hash, const nodePtr& node, size_t encodedSize)
+{
+    if (hash.empty() || node == NULL)
+    {
+        return;
+    }
+    const size_t cost = encodedSize + hash.size() + kEntryOverhead;
+    const size_t shardCapacity = _capacityBytes / kShardCount;
+    if (cost > shardCapacity)
+    {
+        return;
+    }
+
+    auto copy = CloneNode(node);
+    auto& shard = shardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.index.find(hash) != shard.index.end())
+    {
+        return;
+    }
+    shard.lru.push_front(Entry{hash, std::move(copy), cost});
+    shard.index.emplace(hash, shard.lru.begin());
+    shard.bytes += cost;
+    ++_inserts;
+    evict(shard, shardCapacity);
+}
+
+void TrieNodeCache::evict(Shard& shard, size_t shardCapacity)
+{
+    while (shard.bytes > shardCapacity && !shard.lru.empty())
+    {
+        auto& last = shard.lru.back();
+        shard.bytes -= last.cost;
+        shard.index.erase(last.hash);
+        shard.lru.pop_back();
+        ++_evictions;
+    }
+}
+
+void TrieNodeCache::SetCapacity(size_t capacityBytes)
+{
+    _capacityBytes = capacityBytes;
+    const size_t shardCapacity = capacityBytes / kShardCount;
+    for (auto& shard : _shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        evict(shard, shardCapacity);
+    }
+}
+
+void TrieNodeCache::Clear()
+{
+    for (auto& shard : _shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.lru.clear();
+        shard.index.clear();
+        shard.bytes = 0;
+    }
+}
+
+TrieNodeCache::Stats TrieNodeCache::GetStats() const
+{
+    Stats stats;
+    stats.hits = _hits;
+    stats.misses = _misses;
+    stats.inserts = _inserts;
+    stats.evictions = _evictions;
+    stats.capacityBytes = _capacityBytes;
+    for (auto& shard : _shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.entries += shard.index.size();
+        stats.bytes += shard.bytes;
+    }
+    return stats;
+}
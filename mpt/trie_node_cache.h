@@ -0,0 +1,99 @@
+/**
+ * *****************************************************************************
+ * @file        trie_node_cache.h
+ * @brief       Process-wide cache of decoded trie nodes keyed by node hash
+ * @author  ()
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef MPT_TRIE_NODE_CACHE_HEADER_GUARD
+#define MPT_TRIE_NODE_CACHE_HEADER_GUARD
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "node.h"
+
+class TrieNodeCache
+{
+public:
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t inserts = 0;
+        uint64_t evictions = 0;
+        uint64_t entries = 0;
+        uint64_t bytes = 0;
+        uint64_t capacityBytes = 0;
+    };
+
+    TrieNodeCache() = default;
+    ~TrieNodeCache() = default;
+    TrieNodeCache(TrieNodeCache &&) = delete;
+    TrieNodeCache(const TrieNodeCache &) = delete;
+    TrieNodeCache &operator=(TrieNodeCache &&) = delete;
+    TrieNodeCache &operator=(const TrieNodeCache &) = delete;
+
+    /**
+     * @brief       Look up a node by hash
+     *
+     * @param       hash: node hash
+     * @param       node: receives a private copy of the cached node that the caller may mutate
+     * @return      true if the node was cached
+     */
+    bool Get(const std::string& hash, nodePtr& node);
+
+    /**
+     * @brief       Cache a freshly decoded node
+     *
+     * @param       hash: node hash
+     * @param       node: decoded node, a copy is kept so later edits by the caller do not leak in
+     * @param       encodedSize: size of the encoded node, used to bound memory
+     */
+    void Put(const std::string& hash, const nodePtr& node, size_t encodedSize);
+
+    void SetCapacity(size_t capacityBytes);
+    void Clear();
+    Stats GetStats() const;
+
+    static nodePtr CloneNode(const nodePtr& node);
+
+    static constexpr size_t kDefaultCapacityBytes = 128 * 1024 * 1024;
+
+private:
+    struct Entry
+    {
+        std::string hash;
+        nodePtr node;
+        size_t cost;
+    };
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::list<Entry> lru;
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+        size_t bytes = 0;
+    };
+
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kEntryOverhead = 128;
+
+    Shard& shardFor(const std::string& hash);
+    void evict(Shard& shard, size_t shardCapacity);
+
+    std::array<Shard, kShardCount> _shards;
+    std::atomic<size_t> _capacityBytes{kDefaultCapacityBytes};
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _inserts{0};
+    std::atomic<uint64_t> _evictions{0};
+};
+
+#endif
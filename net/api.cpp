@@ -43,6 +43,7 @@
 #include "key_exchange.h"
 
 #include "../ca/algorithm.h"
+#include "../ca/compact_block_relay.h"
 
 int net_tcp::Socket(int family, int type, int protocol)
 {
@@ -307,6 +308,10 @@ int net_com::InitConnection(u32 u32_ip, u16 u16_port, u16 &connectedPort)
 }
 
 void net_com::SendMessageTask(const std::string& addr, BuildBlockBroadcastMsg &msg) {
+	if (MagicSingleton<CompactBlockRelay>::GetInstance()->Send(addr, msg))
+	{
+		return;
+	}
   	net_com::SendMessage(addr, msg);
 }
 
@@ -2,6 +2,7 @@
 
 #include <utility>
 #include <string>
+#include <shared_mutex>
 
 #include "./global.h"
 #include "./key_exchange.h"
@@ -13,6 +14,19 @@
 #include "../proto/common.pb.h"
 #include "../utils/compress.h"
 
+namespace
+{
+    // Kept outside the class so its layout stays as the prebuilt modules know it
+    std::shared_mutex preParseFiltersMutex;
+    std::map<std::string, std::function<bool(const std::string &)>> preParseFilters;
+}
+
+void ProtobufDispatcher::registerPreParseFilter(const std::string &type, std::function<bool(const std::string &payload)> filter)
+{
+    std::unique_lock<std::shared_mutex> lock(preParseFiltersMutex);
+    preParseFilters[type] = std::move(filter);
+}
+
 int ProtobufDispatcher::Handle(const MsgData &data)
 {
     CommonMsg commonMsg;
@@ -105,6 +119,15 @@ int ProtobufDispatcher::Handle(const MsgData &data)
     {
         str_plaintext = std::move(subSerializedMessage);
     }
+    {
+        std::shared_lock<std::shared_mutex> lock(preParseFiltersMutex);
+        auto filter = preParseFilters.find(type);
+        if (filter != preParseFilters.end() && filter->second(str_plaintext))
+        {
+            return -13;
+        }
+    }
+
     MessagePtr subMsg(proto->New());
     ret = subMsg->ParseFromString(str_plaintext);
     if (!ret)
@@ -160,6 +160,15 @@ public:
      * @param       oss 
      */
     void TaskInfo(std::ostringstream& oss);
+
+    /**
+     * @brief       Register a check on the decrypted payload of a message type, run before the payload
+     *              is parsed. A message the check returns true for is dropped.
+     * 
+     * @param       type: message type name
+     * @param       filter: check on the serialized message
+     */
+    void registerPreParseFilter(const std::string &type, std::function<bool(const std::string &payload)> filter);
 private:
     /**
      * @brief       
@@ -180,7 +180,7 @@ int KeyExchangeManager::keyExchangeRequest(Node &dest)
     request.set_allocated_key_info(key_info);
 
     std::string msg_id;
-    if (!dataMgrPtr.CreateWait(3, 1, msg_id))
+    if (!dataMgrPtr.CreateWait(3, 1, msg_id, "keyExchange"))
     {
         return -4;
     }
@@ -45,7 +45,7 @@ bool UnregisterNode::Register(std::map<uint32_t, Node> nodeMap)
 {
     std::string msgId;
     uint32 sendNum = nodeMap.size();
-    if (!dataMgrPtr.CreateWait(5, sendNum, msgId))
+    if (!dataMgrPtr.CreateWait(5, sendNum, msgId, "registerNode"))
     {
         return false;
     }
@@ -140,7 +140,7 @@ bool UnregisterNode::startRegistrationNode(std::map<std::string, int> &serverLis
 {
     std::string msgId;
     uint32 sendNum = serverList.size();
-    if (!dataMgrPtr.CreateWait(5, sendNum, msgId))
+    if (!dataMgrPtr.CreateWait(5, sendNum, msgId, "startRegistrationNode"))
     {
         return false;
     }
@@ -242,7 +242,7 @@ bool UnregisterNode::syncStartNode()
     std::string msgId;
     std::vector<Node> node_list = MagicSingleton<PeerNode>::GetInstance()->GetNodelist();
     uint32 sendNum = node_list.size();
-    if (!dataMgrPtr.CreateWait(5, sendNum, msgId))
+    if (!dataMgrPtr.CreateWait(5, sendNum, msgId, "syncStartNode"))
     {
         return false;
     }
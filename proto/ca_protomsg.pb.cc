@@ -222,7 +222,62 @@ struct ContractDependencyBroadcastMsgDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContractDependencyBroadcastMsgDefaultTypeInternal _ContractDependencyBroadcastMsg_default_instance_;
-static ::_pb::Metadata file_level_metadata_ca_5fprotomsg_2eproto[13];
+PROTOBUF_CONSTEXPR CompactBlockBroadcastMsg::CompactBlockBroadcastMsg(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.shortids_)*/{}
+  , /*decltype(_impl_.castaddrs_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.flag_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CompactBlockBroadcastMsgDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompactBlockBroadcastMsgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompactBlockBroadcastMsgDefaultTypeInternal() {}
+  union {
+    CompactBlockBroadcastMsg _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompactBlockBroadcastMsgDefaultTypeInternal _CompactBlockBroadcastMsg_default_instance_;
+PROTOBUF_CONSTEXPR GetBlockTxsReq::GetBlockTxsReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.indexes_)*/{}
+  , /*decltype(_impl_._indexes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.blockhash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetBlockTxsReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetBlockTxsReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetBlockTxsReqDefaultTypeInternal() {}
+  union {
+    GetBlockTxsReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetBlockTxsReqDefaultTypeInternal _GetBlockTxsReq_default_instance_;
+PROTOBUF_CONSTEXPR GetBlockTxsAck::GetBlockTxsAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.indexes_)*/{}
+  , /*decltype(_impl_._indexes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.txs_)*/{}
+  , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.blockhash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.blockraw_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetBlockTxsAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetBlockTxsAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetBlockTxsAckDefaultTypeInternal() {}
+  union {
+    GetBlockTxsAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetBlockTxsAckDefaultTypeInternal _GetBlockTxsAck_default_instance_;
+static ::_pb::Metadata file_level_metadata_ca_5fprotomsg_2eproto[16];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ca_5fprotomsg_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ca_5fprotomsg_2eproto = nullptr;
 
@@ -351,6 +406,41 @@ const uint32_t TableStruct_ca_5fprotomsg_2eproto::offsets[] PROTOBUF_SECTION_VAR
   PROTOBUF_FIELD_OFFSET(::ContractDependencyBroadcastMsg, _impl_.version_),
   PROTOBUF_FIELD_OFFSET(::ContractDependencyBroadcastMsg, _impl_.dependencies_),
   PROTOBUF_FIELD_OFFSET(::ContractDependencyBroadcastMsg, _impl_.sign_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _impl_.shortids_),
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _impl_.flag_),
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::CompactBlockBroadcastMsg, _impl_.castaddrs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsReq, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsReq, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsReq, _impl_.blockhash_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsReq, _impl_.indexes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsAck, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsAck, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsAck, _impl_.blockhash_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsAck, _impl_.indexes_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsAck, _impl_.txs_),
+  PROTOBUF_FIELD_OFFSET(::GetBlockTxsAck, _impl_.blockraw_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::SignNodeMsg)},
@@ -366,6 +456,9 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 98, -1, -1, sizeof(::ContractPackagerMsg)},
   { 107, -1, -1, sizeof(::ContractDependencyBroadcastMsg_DependencyInfo)},
   { 115, -1, -1, sizeof(::ContractDependencyBroadcastMsg)},
+  { 124, -1, -1, sizeof(::CompactBlockBroadcastMsg)},
+  { 137, -1, -1, sizeof(::GetBlockTxsReq)},
+  { 147, -1, -1, sizeof(::GetBlockTxsAck)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -382,6 +475,9 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::_ContractPackagerMsg_default_instance_._instance,
   &::_ContractDependencyBroadcastMsg_DependencyInfo_default_instance_._instance,
   &::_ContractDependencyBroadcastMsg_default_instance_._instance,
+  &::_CompactBlockBroadcastMsg_default_instance_._instance,
+  &::_GetBlockTxsReq_default_instance_._instance,
+  &::_GetBlockTxsAck_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_ca_5fprotomsg_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -415,16 +511,24 @@ const char descriptor_table_protodef_ca_5fprotomsg_2eproto[] PROTOBUF_SECTION_VA
   ".ContractDependencyBroadcastMsg.Dependen"
   "cyInfo\022\024\n\004sign\030\003 \001(\0132\006.CSign\032=\n\016Dependen"
   "cyInfo\022\031\n\021dependencyAddress\030\001 \001(\t\022\020\n\010txH"
-  "ashes\030\002 \003(\tb\006proto3"
+  "ashes\030\002 \003(\t\"\210\001\n\030CompactBlockBroadcastMsg"
+  "\022\017\n\007version\030\001 \001(\t\022\n\n\002id\030\002 \001(\t\022\016\n\006header\030"
+  "\003 \001(\014\022\020\n\010shortIds\030\004 \003(\006\022\014\n\004flag\030\005 \001(\005\022\014\n"
+  "\004type\030\006 \001(\005\022\021\n\tcastAddrs\030\007 \003(\t\"Q\n\016GetBlo"
+  "ckTxsReq\022\017\n\007version\030\001 \001(\t\022\n\n\002id\030\002 \001(\t\022\021\n"
+  "\tblockHash\030\003 \001(\t\022\017\n\007indexes\030\004 \003(\r\"p\n\016Get"
+  "BlockTxsAck\022\017\n\007version\030\001 \001(\t\022\n\n\002id\030\002 \001(\t"
+  "\022\021\n\tblockHash\030\003 \001(\t\022\017\n\007indexes\030\004 \003(\r\022\013\n\003"
+  "txs\030\005 \003(\014\022\020\n\010blockRaw\030\006 \001(\014b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_ca_5fprotomsg_2eproto_deps[1] = {
   &::descriptor_table_sign_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_ca_5fprotomsg_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_ca_5fprotomsg_2eproto = {
-    false, false, 1219, descriptor_table_protodef_ca_5fprotomsg_2eproto,
+    false, false, 1555, descriptor_table_protodef_ca_5fprotomsg_2eproto,
     "ca_protomsg.proto",
-    &descriptor_table_ca_5fprotomsg_2eproto_once, descriptor_table_ca_5fprotomsg_2eproto_deps, 1, 13,
+    &descriptor_table_ca_5fprotomsg_2eproto_once, descriptor_table_ca_5fprotomsg_2eproto_deps, 1, 16,
     schemas, file_default_instances, TableStruct_ca_5fprotomsg_2eproto::offsets,
     file_level_metadata_ca_5fprotomsg_2eproto, file_level_enum_descriptors_ca_5fprotomsg_2eproto,
     file_level_service_descriptors_ca_5fprotomsg_2eproto,
@@ -4333,59 +4437,1270 @@ void ContractDependencyBroadcastMsg::InternalSwap(ContractDependencyBroadcastMsg
       file_level_metadata_ca_5fprotomsg_2eproto[12]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::SignNodeMsg*
-Arena::CreateMaybeMessage< ::SignNodeMsg >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::SignNodeMsg >(arena);
-}
-template<> PROTOBUF_NOINLINE ::TxMsgInfo*
-Arena::CreateMaybeMessage< ::TxMsgInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TxMsgInfo >(arena);
-}
-template<> PROTOBUF_NOINLINE ::TxMsgReq*
-Arena::CreateMaybeMessage< ::TxMsgReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TxMsgReq >(arena);
-}
-template<> PROTOBUF_NOINLINE ::VrfData*
-Arena::CreateMaybeMessage< ::VrfData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::VrfData >(arena);
-}
-template<> PROTOBUF_NOINLINE ::Vrf*
-Arena::CreateMaybeMessage< ::Vrf >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::Vrf >(arena);
+// ===================================================================
+
+class CompactBlockBroadcastMsg::_Internal {
+ public:
+};
+
+CompactBlockBroadcastMsg::CompactBlockBroadcastMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CompactBlockBroadcastMsg)
 }
-template<> PROTOBUF_NOINLINE ::VRFBlockInfo*
-Arena::CreateMaybeMessage< ::VRFBlockInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::VRFBlockInfo >(arena);
+CompactBlockBroadcastMsg::CompactBlockBroadcastMsg(const CompactBlockBroadcastMsg& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CompactBlockBroadcastMsg* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shortids_){from._impl_.shortids_}
+    , decltype(_impl_.castaddrs_){from._impl_.castaddrs_}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.header_){}
+    , decltype(_impl_.flag_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_version().empty()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.header_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.header_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_header().empty()) {
+    _this->_impl_.header_.Set(from._internal_header(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.flag_, &from._impl_.flag_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.flag_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:CompactBlockBroadcastMsg)
 }
-template<> PROTOBUF_NOINLINE ::VRFConsensusInfo*
-Arena::CreateMaybeMessage< ::VRFConsensusInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::VRFConsensusInfo >(arena);
+
+inline void CompactBlockBroadcastMsg::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.shortids_){arena}
+    , decltype(_impl_.castaddrs_){arena}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.header_){}
+    , decltype(_impl_.flag_){0}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.header_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.header_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-template<> PROTOBUF_NOINLINE ::TxMsgAck*
-Arena::CreateMaybeMessage< ::TxMsgAck >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::TxMsgAck >(arena);
+
+CompactBlockBroadcastMsg::~CompactBlockBroadcastMsg() {
+  // @@protoc_insertion_point(destructor:CompactBlockBroadcastMsg)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::BuildBlockBroadcastMsg*
-Arena::CreateMaybeMessage< ::BuildBlockBroadcastMsg >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::BuildBlockBroadcastMsg >(arena);
+
+inline void CompactBlockBroadcastMsg::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.shortids_.~RepeatedField();
+  _impl_.castaddrs_.~RepeatedPtrField();
+  _impl_.version_.Destroy();
+  _impl_.id_.Destroy();
+  _impl_.header_.Destroy();
 }
-template<> PROTOBUF_NOINLINE ::ContractTxMsgReq*
-Arena::CreateMaybeMessage< ::ContractTxMsgReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::ContractTxMsgReq >(arena);
+
+void CompactBlockBroadcastMsg::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::ContractPackagerMsg*
-Arena::CreateMaybeMessage< ::ContractPackagerMsg >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::ContractPackagerMsg >(arena);
+
+void CompactBlockBroadcastMsg::Clear() {
+// @@protoc_insertion_point(message_clear_start:CompactBlockBroadcastMsg)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.shortids_.Clear();
+  _impl_.castaddrs_.Clear();
+  _impl_.version_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
+  _impl_.header_.ClearToEmpty();
+  ::memset(&_impl_.flag_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.flag_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::ContractDependencyBroadcastMsg_DependencyInfo*
-Arena::CreateMaybeMessage< ::ContractDependencyBroadcastMsg_DependencyInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::ContractDependencyBroadcastMsg_DependencyInfo >(arena);
+
+const char* CompactBlockBroadcastMsg::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "CompactBlockBroadcastMsg.version"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "CompactBlockBroadcastMsg.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes header = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_header();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 shortIds = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_shortids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 33) {
+          _internal_add_shortids(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 flag = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.flag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 type = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string castAddrs = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_castaddrs();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "CompactBlockBroadcastMsg.castAddrs"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::ContractDependencyBroadcastMsg*
-Arena::CreateMaybeMessage< ::ContractDependencyBroadcastMsg >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::ContractDependencyBroadcastMsg >(arena);
+
+uint8_t* CompactBlockBroadcastMsg::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CompactBlockBroadcastMsg)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string version = 1;
+  if (!this->_internal_version().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_version().data(), static_cast<int>(this->_internal_version().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "CompactBlockBroadcastMsg.version");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "CompactBlockBroadcastMsg.id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_id(), target);
+  }
+
+  // bytes header = 3;
+  if (!this->_internal_header().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_header(), target);
+  }
+
+  // repeated fixed64 shortIds = 4;
+  if (this->_internal_shortids_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_shortids(), target);
+  }
+
+  // int32 flag = 5;
+  if (this->_internal_flag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_flag(), target);
+  }
+
+  // int32 type = 6;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_type(), target);
+  }
+
+  // repeated string castAddrs = 7;
+  for (int i = 0, n = this->_internal_castaddrs_size(); i < n; i++) {
+    const auto& s = this->_internal_castaddrs(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "CompactBlockBroadcastMsg.castAddrs");
+    target = stream->WriteString(7, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CompactBlockBroadcastMsg)
+  return target;
+}
+
+size_t CompactBlockBroadcastMsg::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CompactBlockBroadcastMsg)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 shortIds = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_shortids_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated string castAddrs = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.castaddrs_.size());
+  for (int i = 0, n = _impl_.castaddrs_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.castaddrs_.Get(i));
+  }
+
+  // string version = 1;
+  if (!this->_internal_version().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_version());
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // bytes header = 3;
+  if (!this->_internal_header().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_header());
+  }
+
+  // int32 flag = 5;
+  if (this->_internal_flag() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_flag());
+  }
+
+  // int32 type = 6;
+  if (this->_internal_type() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompactBlockBroadcastMsg::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CompactBlockBroadcastMsg::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompactBlockBroadcastMsg::GetClassData() const { return &_class_data_; }
+
+
+void CompactBlockBroadcastMsg::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompactBlockBroadcastMsg*>(&to_msg);
+  auto& from = static_cast<const CompactBlockBroadcastMsg&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CompactBlockBroadcastMsg)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.shortids_.MergeFrom(from._impl_.shortids_);
+  _this->_impl_.castaddrs_.MergeFrom(from._impl_.castaddrs_);
+  if (!from._internal_version().empty()) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_header().empty()) {
+    _this->_internal_set_header(from._internal_header());
+  }
+  if (from._internal_flag() != 0) {
+    _this->_internal_set_flag(from._internal_flag());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CompactBlockBroadcastMsg::CopyFrom(const CompactBlockBroadcastMsg& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CompactBlockBroadcastMsg)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompactBlockBroadcastMsg::IsInitialized() const {
+  return true;
+}
+
+void CompactBlockBroadcastMsg::InternalSwap(CompactBlockBroadcastMsg* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.shortids_.InternalSwap(&other->_impl_.shortids_);
+  _impl_.castaddrs_.InternalSwap(&other->_impl_.castaddrs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.header_, lhs_arena,
+      &other->_impl_.header_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CompactBlockBroadcastMsg, _impl_.type_)
+      + sizeof(CompactBlockBroadcastMsg::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(CompactBlockBroadcastMsg, _impl_.flag_)>(
+          reinterpret_cast<char*>(&_impl_.flag_),
+          reinterpret_cast<char*>(&other->_impl_.flag_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CompactBlockBroadcastMsg::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ca_5fprotomsg_2eproto_getter, &descriptor_table_ca_5fprotomsg_2eproto_once,
+      file_level_metadata_ca_5fprotomsg_2eproto[13]);
+}
+
+// ===================================================================
+
+class GetBlockTxsReq::_Internal {
+ public:
+};
+
+GetBlockTxsReq::GetBlockTxsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:GetBlockTxsReq)
+}
+GetBlockTxsReq::GetBlockTxsReq(const GetBlockTxsReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetBlockTxsReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.indexes_){from._impl_.indexes_}
+    , /*decltype(_impl_._indexes_cached_byte_size_)*/{0}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.blockhash_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_version().empty()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.blockhash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.blockhash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_blockhash().empty()) {
+    _this->_impl_.blockhash_.Set(from._internal_blockhash(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:GetBlockTxsReq)
+}
+
+inline void GetBlockTxsReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.indexes_){arena}
+    , /*decltype(_impl_._indexes_cached_byte_size_)*/{0}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.blockhash_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.blockhash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.blockhash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetBlockTxsReq::~GetBlockTxsReq() {
+  // @@protoc_insertion_point(destructor:GetBlockTxsReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetBlockTxsReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.indexes_.~RepeatedField();
+  _impl_.version_.Destroy();
+  _impl_.id_.Destroy();
+  _impl_.blockhash_.Destroy();
+}
+
+void GetBlockTxsReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetBlockTxsReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:GetBlockTxsReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.indexes_.Clear();
+  _impl_.version_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
+  _impl_.blockhash_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetBlockTxsReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "GetBlockTxsReq.version"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "GetBlockTxsReq.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string blockHash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_blockhash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "GetBlockTxsReq.blockHash"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 indexes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_indexes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_indexes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetBlockTxsReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:GetBlockTxsReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string version = 1;
+  if (!this->_internal_version().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_version().data(), static_cast<int>(this->_internal_version().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "GetBlockTxsReq.version");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "GetBlockTxsReq.id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_id(), target);
+  }
+
+  // string blockHash = 3;
+  if (!this->_internal_blockhash().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_blockhash().data(), static_cast<int>(this->_internal_blockhash().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "GetBlockTxsReq.blockHash");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_blockhash(), target);
+  }
+
+  // repeated uint32 indexes = 4;
+  {
+    int byte_size = _impl_._indexes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_indexes(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:GetBlockTxsReq)
+  return target;
+}
+
+size_t GetBlockTxsReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:GetBlockTxsReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 indexes = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.indexes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._indexes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string version = 1;
+  if (!this->_internal_version().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_version());
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string blockHash = 3;
+  if (!this->_internal_blockhash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_blockhash());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetBlockTxsReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetBlockTxsReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetBlockTxsReq::GetClassData() const { return &_class_data_; }
+
+
+void GetBlockTxsReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetBlockTxsReq*>(&to_msg);
+  auto& from = static_cast<const GetBlockTxsReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GetBlockTxsReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.indexes_.MergeFrom(from._impl_.indexes_);
+  if (!from._internal_version().empty()) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_blockhash().empty()) {
+    _this->_internal_set_blockhash(from._internal_blockhash());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetBlockTxsReq::CopyFrom(const GetBlockTxsReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:GetBlockTxsReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetBlockTxsReq::IsInitialized() const {
+  return true;
+}
+
+void GetBlockTxsReq::InternalSwap(GetBlockTxsReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.indexes_.InternalSwap(&other->_impl_.indexes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.blockhash_, lhs_arena,
+      &other->_impl_.blockhash_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetBlockTxsReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ca_5fprotomsg_2eproto_getter, &descriptor_table_ca_5fprotomsg_2eproto_once,
+      file_level_metadata_ca_5fprotomsg_2eproto[14]);
+}
+
+// ===================================================================
+
+class GetBlockTxsAck::_Internal {
+ public:
+};
+
+GetBlockTxsAck::GetBlockTxsAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:GetBlockTxsAck)
+}
+GetBlockTxsAck::GetBlockTxsAck(const GetBlockTxsAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetBlockTxsAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.indexes_){from._impl_.indexes_}
+    , /*decltype(_impl_._indexes_cached_byte_size_)*/{0}
+    , decltype(_impl_.txs_){from._impl_.txs_}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.blockhash_){}
+    , decltype(_impl_.blockraw_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_version().empty()) {
+    _this->_impl_.version_.Set(from._internal_version(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.blockhash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.blockhash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_blockhash().empty()) {
+    _this->_impl_.blockhash_.Set(from._internal_blockhash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.blockraw_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.blockraw_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_blockraw().empty()) {
+    _this->_impl_.blockraw_.Set(from._internal_blockraw(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:GetBlockTxsAck)
+}
+
+inline void GetBlockTxsAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.indexes_){arena}
+    , /*decltype(_impl_._indexes_cached_byte_size_)*/{0}
+    , decltype(_impl_.txs_){arena}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.blockhash_){}
+    , decltype(_impl_.blockraw_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.version_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.version_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.blockhash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.blockhash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.blockraw_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.blockraw_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetBlockTxsAck::~GetBlockTxsAck() {
+  // @@protoc_insertion_point(destructor:GetBlockTxsAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetBlockTxsAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.indexes_.~RepeatedField();
+  _impl_.txs_.~RepeatedPtrField();
+  _impl_.version_.Destroy();
+  _impl_.id_.Destroy();
+  _impl_.blockhash_.Destroy();
+  _impl_.blockraw_.Destroy();
+}
+
+void GetBlockTxsAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetBlockTxsAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:GetBlockTxsAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.indexes_.Clear();
+  _impl_.txs_.Clear();
+  _impl_.version_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
+  _impl_.blockhash_.ClearToEmpty();
+  _impl_.blockraw_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetBlockTxsAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_version();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "GetBlockTxsAck.version"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "GetBlockTxsAck.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string blockHash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_blockhash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "GetBlockTxsAck.blockHash"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 indexes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_indexes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_indexes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes txs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_txs();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes blockRaw = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_blockraw();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetBlockTxsAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:GetBlockTxsAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string version = 1;
+  if (!this->_internal_version().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_version().data(), static_cast<int>(this->_internal_version().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "GetBlockTxsAck.version");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_version(), target);
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "GetBlockTxsAck.id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_id(), target);
+  }
+
+  // string blockHash = 3;
+  if (!this->_internal_blockhash().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_blockhash().data(), static_cast<int>(this->_internal_blockhash().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "GetBlockTxsAck.blockHash");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_blockhash(), target);
+  }
+
+  // repeated uint32 indexes = 4;
+  {
+    int byte_size = _impl_._indexes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_indexes(), byte_size, target);
+    }
+  }
+
+  // repeated bytes txs = 5;
+  for (int i = 0, n = this->_internal_txs_size(); i < n; i++) {
+    const auto& s = this->_internal_txs(i);
+    target = stream->WriteBytes(5, s, target);
+  }
+
+  // bytes blockRaw = 6;
+  if (!this->_internal_blockraw().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_blockraw(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:GetBlockTxsAck)
+  return target;
+}
+
+size_t GetBlockTxsAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:GetBlockTxsAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 indexes = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.indexes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._indexes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated bytes txs = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.txs_.size());
+  for (int i = 0, n = _impl_.txs_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.txs_.Get(i));
+  }
+
+  // string version = 1;
+  if (!this->_internal_version().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_version());
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string blockHash = 3;
+  if (!this->_internal_blockhash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_blockhash());
+  }
+
+  // bytes blockRaw = 6;
+  if (!this->_internal_blockraw().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_blockraw());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetBlockTxsAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetBlockTxsAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetBlockTxsAck::GetClassData() const { return &_class_data_; }
+
+
+void GetBlockTxsAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetBlockTxsAck*>(&to_msg);
+  auto& from = static_cast<const GetBlockTxsAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GetBlockTxsAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.indexes_.MergeFrom(from._impl_.indexes_);
+  _this->_impl_.txs_.MergeFrom(from._impl_.txs_);
+  if (!from._internal_version().empty()) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_blockhash().empty()) {
+    _this->_internal_set_blockhash(from._internal_blockhash());
+  }
+  if (!from._internal_blockraw().empty()) {
+    _this->_internal_set_blockraw(from._internal_blockraw());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetBlockTxsAck::CopyFrom(const GetBlockTxsAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:GetBlockTxsAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetBlockTxsAck::IsInitialized() const {
+  return true;
+}
+
+void GetBlockTxsAck::InternalSwap(GetBlockTxsAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.indexes_.InternalSwap(&other->_impl_.indexes_);
+  _impl_.txs_.InternalSwap(&other->_impl_.txs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.version_, lhs_arena,
+      &other->_impl_.version_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.blockhash_, lhs_arena,
+      &other->_impl_.blockhash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.blockraw_, lhs_arena,
+      &other->_impl_.blockraw_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetBlockTxsAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ca_5fprotomsg_2eproto_getter, &descriptor_table_ca_5fprotomsg_2eproto_once,
+      file_level_metadata_ca_5fprotomsg_2eproto[15]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::SignNodeMsg*
+Arena::CreateMaybeMessage< ::SignNodeMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SignNodeMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TxMsgInfo*
+Arena::CreateMaybeMessage< ::TxMsgInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TxMsgInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TxMsgReq*
+Arena::CreateMaybeMessage< ::TxMsgReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TxMsgReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::VrfData*
+Arena::CreateMaybeMessage< ::VrfData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::VrfData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Vrf*
+Arena::CreateMaybeMessage< ::Vrf >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Vrf >(arena);
+}
+template<> PROTOBUF_NOINLINE ::VRFBlockInfo*
+Arena::CreateMaybeMessage< ::VRFBlockInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::VRFBlockInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::VRFConsensusInfo*
+Arena::CreateMaybeMessage< ::VRFConsensusInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::VRFConsensusInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TxMsgAck*
+Arena::CreateMaybeMessage< ::TxMsgAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TxMsgAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::BuildBlockBroadcastMsg*
+Arena::CreateMaybeMessage< ::BuildBlockBroadcastMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::BuildBlockBroadcastMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ContractTxMsgReq*
+Arena::CreateMaybeMessage< ::ContractTxMsgReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ContractTxMsgReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ContractPackagerMsg*
+Arena::CreateMaybeMessage< ::ContractPackagerMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ContractPackagerMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ContractDependencyBroadcastMsg_DependencyInfo*
+Arena::CreateMaybeMessage< ::ContractDependencyBroadcastMsg_DependencyInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ContractDependencyBroadcastMsg_DependencyInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ContractDependencyBroadcastMsg*
+Arena::CreateMaybeMessage< ::ContractDependencyBroadcastMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ContractDependencyBroadcastMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CompactBlockBroadcastMsg*
+Arena::CreateMaybeMessage< ::CompactBlockBroadcastMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CompactBlockBroadcastMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::GetBlockTxsReq*
+Arena::CreateMaybeMessage< ::GetBlockTxsReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::GetBlockTxsReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::GetBlockTxsAck*
+Arena::CreateMaybeMessage< ::GetBlockTxsAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::GetBlockTxsAck >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
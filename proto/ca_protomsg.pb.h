@@ -48,6 +48,9 @@ extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table
 class BuildBlockBroadcastMsg;
 struct BuildBlockBroadcastMsgDefaultTypeInternal;
 extern BuildBlockBroadcastMsgDefaultTypeInternal _BuildBlockBroadcastMsg_default_instance_;
+class CompactBlockBroadcastMsg;
+struct CompactBlockBroadcastMsgDefaultTypeInternal;
+extern CompactBlockBroadcastMsgDefaultTypeInternal _CompactBlockBroadcastMsg_default_instance_;
 class ContractDependencyBroadcastMsg;
 struct ContractDependencyBroadcastMsgDefaultTypeInternal;
 extern ContractDependencyBroadcastMsgDefaultTypeInternal _ContractDependencyBroadcastMsg_default_instance_;
@@ -60,6 +63,12 @@ extern ContractPackagerMsgDefaultTypeInternal _ContractPackagerMsg_default_insta
 class ContractTxMsgReq;
 struct ContractTxMsgReqDefaultTypeInternal;
 extern ContractTxMsgReqDefaultTypeInternal _ContractTxMsgReq_default_instance_;
+class GetBlockTxsAck;
+struct GetBlockTxsAckDefaultTypeInternal;
+extern GetBlockTxsAckDefaultTypeInternal _GetBlockTxsAck_default_instance_;
+class GetBlockTxsReq;
+struct GetBlockTxsReqDefaultTypeInternal;
+extern GetBlockTxsReqDefaultTypeInternal _GetBlockTxsReq_default_instance_;
 class SignNodeMsg;
 struct SignNodeMsgDefaultTypeInternal;
 extern SignNodeMsgDefaultTypeInternal _SignNodeMsg_default_instance_;
@@ -86,10 +95,13 @@ struct VrfDataDefaultTypeInternal;
 extern VrfDataDefaultTypeInternal _VrfData_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
 template<> ::BuildBlockBroadcastMsg* Arena::CreateMaybeMessage<::BuildBlockBroadcastMsg>(Arena*);
+template<> ::CompactBlockBroadcastMsg* Arena::CreateMaybeMessage<::CompactBlockBroadcastMsg>(Arena*);
 template<> ::ContractDependencyBroadcastMsg* Arena::CreateMaybeMessage<::ContractDependencyBroadcastMsg>(Arena*);
 template<> ::ContractDependencyBroadcastMsg_DependencyInfo* Arena::CreateMaybeMessage<::ContractDependencyBroadcastMsg_DependencyInfo>(Arena*);
 template<> ::ContractPackagerMsg* Arena::CreateMaybeMessage<::ContractPackagerMsg>(Arena*);
 template<> ::ContractTxMsgReq* Arena::CreateMaybeMessage<::ContractTxMsgReq>(Arena*);
+template<> ::GetBlockTxsAck* Arena::CreateMaybeMessage<::GetBlockTxsAck>(Arena*);
+template<> ::GetBlockTxsReq* Arena::CreateMaybeMessage<::GetBlockTxsReq>(Arena*);
 template<> ::SignNodeMsg* Arena::CreateMaybeMessage<::SignNodeMsg>(Arena*);
 template<> ::TxMsgAck* Arena::CreateMaybeMessage<::TxMsgAck>(Arena*);
 template<> ::TxMsgInfo* Arena::CreateMaybeMessage<::TxMsgInfo>(Arena*);
@@ -2663,449 +2675,2003 @@ class ContractDependencyBroadcastMsg final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_ca_5fprotomsg_2eproto;
 };
+// -------------------------------------------------------------------
+
+class CompactBlockBroadcastMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CompactBlockBroadcastMsg) */ {
+ public:
+  inline CompactBlockBroadcastMsg() : CompactBlockBroadcastMsg(nullptr) {}
+  ~CompactBlockBroadcastMsg() override;
+  explicit PROTOBUF_CONSTEXPR CompactBlockBroadcastMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompactBlockBroadcastMsg(const CompactBlockBroadcastMsg& from);
+  CompactBlockBroadcastMsg(CompactBlockBroadcastMsg&& from) noexcept
+    : CompactBlockBroadcastMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline CompactBlockBroadcastMsg& operator=(const CompactBlockBroadcastMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompactBlockBroadcastMsg& operator=(CompactBlockBroadcastMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompactBlockBroadcastMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompactBlockBroadcastMsg* internal_default_instance() {
+    return reinterpret_cast<const CompactBlockBroadcastMsg*>(
+               &_CompactBlockBroadcastMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CompactBlockBroadcastMsg& a, CompactBlockBroadcastMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompactBlockBroadcastMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompactBlockBroadcastMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompactBlockBroadcastMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompactBlockBroadcastMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompactBlockBroadcastMsg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompactBlockBroadcastMsg& from) {
+    CompactBlockBroadcastMsg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompactBlockBroadcastMsg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CompactBlockBroadcastMsg";
+  }
+  protected:
+  explicit CompactBlockBroadcastMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShortIdsFieldNumber = 4,
+    kCastAddrsFieldNumber = 7,
+    kVersionFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kHeaderFieldNumber = 3,
+    kFlagFieldNumber = 5,
+    kTypeFieldNumber = 6,
+  };
+  // repeated fixed64 shortIds = 4;
+  int shortids_size() const;
+  private:
+  int _internal_shortids_size() const;
+  public:
+  void clear_shortids();
+  private:
+  uint64_t _internal_shortids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_shortids() const;
+  void _internal_add_shortids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_shortids();
+  public:
+  uint64_t shortids(int index) const;
+  void set_shortids(int index, uint64_t value);
+  void add_shortids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      shortids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_shortids();
+
+  // repeated string castAddrs = 7;
+  int castaddrs_size() const;
+  private:
+  int _internal_castaddrs_size() const;
+  public:
+  void clear_castaddrs();
+  const std::string& castaddrs(int index) const;
+  std::string* mutable_castaddrs(int index);
+  void set_castaddrs(int index, const std::string& value);
+  void set_castaddrs(int index, std::string&& value);
+  void set_castaddrs(int index, const char* value);
+  void set_castaddrs(int index, const char* value, size_t size);
+  std::string* add_castaddrs();
+  void add_castaddrs(const std::string& value);
+  void add_castaddrs(std::string&& value);
+  void add_castaddrs(const char* value);
+  void add_castaddrs(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& castaddrs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_castaddrs();
+  private:
+  const std::string& _internal_castaddrs(int index) const;
+  std::string* _internal_add_castaddrs();
+  public:
+
+  // string version = 1;
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // string id = 2;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // bytes header = 3;
+  void clear_header();
+  const std::string& header() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_header(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_header();
+  PROTOBUF_NODISCARD std::string* release_header();
+  void set_allocated_header(std::string* header);
+  private:
+  const std::string& _internal_header() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_header(const std::string& value);
+  std::string* _internal_mutable_header();
+  public:
+
+  // int32 flag = 5;
+  void clear_flag();
+  int32_t flag() const;
+  void set_flag(int32_t value);
+  private:
+  int32_t _internal_flag() const;
+  void _internal_set_flag(int32_t value);
+  public:
+
+  // int32 type = 6;
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CompactBlockBroadcastMsg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > shortids_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> castaddrs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr header_;
+    int32_t flag_;
+    int32_t type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ca_5fprotomsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetBlockTxsReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GetBlockTxsReq) */ {
+ public:
+  inline GetBlockTxsReq() : GetBlockTxsReq(nullptr) {}
+  ~GetBlockTxsReq() override;
+  explicit PROTOBUF_CONSTEXPR GetBlockTxsReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetBlockTxsReq(const GetBlockTxsReq& from);
+  GetBlockTxsReq(GetBlockTxsReq&& from) noexcept
+    : GetBlockTxsReq() {
+    *this = ::std::move(from);
+  }
+
+  inline GetBlockTxsReq& operator=(const GetBlockTxsReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetBlockTxsReq& operator=(GetBlockTxsReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetBlockTxsReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetBlockTxsReq* internal_default_instance() {
+    return reinterpret_cast<const GetBlockTxsReq*>(
+               &_GetBlockTxsReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(GetBlockTxsReq& a, GetBlockTxsReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetBlockTxsReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetBlockTxsReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetBlockTxsReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetBlockTxsReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetBlockTxsReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetBlockTxsReq& from) {
+    GetBlockTxsReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetBlockTxsReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GetBlockTxsReq";
+  }
+  protected:
+  explicit GetBlockTxsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIndexesFieldNumber = 4,
+    kVersionFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kBlockHashFieldNumber = 3,
+  };
+  // repeated uint32 indexes = 4;
+  int indexes_size() const;
+  private:
+  int _internal_indexes_size() const;
+  public:
+  void clear_indexes();
+  private:
+  uint32_t _internal_indexes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_indexes() const;
+  void _internal_add_indexes(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_indexes();
+  public:
+  uint32_t indexes(int index) const;
+  void set_indexes(int index, uint32_t value);
+  void add_indexes(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      indexes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_indexes();
+
+  // string version = 1;
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // string id = 2;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string blockHash = 3;
+  void clear_blockhash();
+  const std::string& blockhash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_blockhash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_blockhash();
+  PROTOBUF_NODISCARD std::string* release_blockhash();
+  void set_allocated_blockhash(std::string* blockhash);
+  private:
+  const std::string& _internal_blockhash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blockhash(const std::string& value);
+  std::string* _internal_mutable_blockhash();
+  public:
+
+  // @@protoc_insertion_point(class_scope:GetBlockTxsReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > indexes_;
+    mutable std::atomic<int> _indexes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blockhash_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ca_5fprotomsg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetBlockTxsAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GetBlockTxsAck) */ {
+ public:
+  inline GetBlockTxsAck() : GetBlockTxsAck(nullptr) {}
+  ~GetBlockTxsAck() override;
+  explicit PROTOBUF_CONSTEXPR GetBlockTxsAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetBlockTxsAck(const GetBlockTxsAck& from);
+  GetBlockTxsAck(GetBlockTxsAck&& from) noexcept
+    : GetBlockTxsAck() {
+    *this = ::std::move(from);
+  }
+
+  inline GetBlockTxsAck& operator=(const GetBlockTxsAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetBlockTxsAck& operator=(GetBlockTxsAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetBlockTxsAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetBlockTxsAck* internal_default_instance() {
+    return reinterpret_cast<const GetBlockTxsAck*>(
+               &_GetBlockTxsAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(GetBlockTxsAck& a, GetBlockTxsAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetBlockTxsAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetBlockTxsAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetBlockTxsAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetBlockTxsAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetBlockTxsAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetBlockTxsAck& from) {
+    GetBlockTxsAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetBlockTxsAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GetBlockTxsAck";
+  }
+  protected:
+  explicit GetBlockTxsAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIndexesFieldNumber = 4,
+    kTxsFieldNumber = 5,
+    kVersionFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kBlockHashFieldNumber = 3,
+    kBlockRawFieldNumber = 6,
+  };
+  // repeated uint32 indexes = 4;
+  int indexes_size() const;
+  private:
+  int _internal_indexes_size() const;
+  public:
+  void clear_indexes();
+  private:
+  uint32_t _internal_indexes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_indexes() const;
+  void _internal_add_indexes(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_indexes();
+  public:
+  uint32_t indexes(int index) const;
+  void set_indexes(int index, uint32_t value);
+  void add_indexes(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      indexes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_indexes();
+
+  // repeated bytes txs = 5;
+  int txs_size() const;
+  private:
+  int _internal_txs_size() const;
+  public:
+  void clear_txs();
+  const std::string& txs(int index) const;
+  std::string* mutable_txs(int index);
+  void set_txs(int index, const std::string& value);
+  void set_txs(int index, std::string&& value);
+  void set_txs(int index, const char* value);
+  void set_txs(int index, const void* value, size_t size);
+  std::string* add_txs();
+  void add_txs(const std::string& value);
+  void add_txs(std::string&& value);
+  void add_txs(const char* value);
+  void add_txs(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& txs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_txs();
+  private:
+  const std::string& _internal_txs(int index) const;
+  std::string* _internal_add_txs();
+  public:
+
+  // string version = 1;
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // string id = 2;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string blockHash = 3;
+  void clear_blockhash();
+  const std::string& blockhash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_blockhash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_blockhash();
+  PROTOBUF_NODISCARD std::string* release_blockhash();
+  void set_allocated_blockhash(std::string* blockhash);
+  private:
+  const std::string& _internal_blockhash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blockhash(const std::string& value);
+  std::string* _internal_mutable_blockhash();
+  public:
+
+  // bytes blockRaw = 6;
+  void clear_blockraw();
+  const std::string& blockraw() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_blockraw(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_blockraw();
+  PROTOBUF_NODISCARD std::string* release_blockraw();
+  void set_allocated_blockraw(std::string* blockraw);
+  private:
+  const std::string& _internal_blockraw() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blockraw(const std::string& value);
+  std::string* _internal_mutable_blockraw();
+  public:
+
+  // @@protoc_insertion_point(class_scope:GetBlockTxsAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > indexes_;
+    mutable std::atomic<int> _indexes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> txs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blockhash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blockraw_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ca_5fprotomsg_2eproto;
+};
+// ===================================================================
+
+
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SignNodeMsg
+
+// string id = 1;
+inline void SignNodeMsg::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& SignNodeMsg::id() const {
+  // @@protoc_insertion_point(field_get:SignNodeMsg.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignNodeMsg::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SignNodeMsg.id)
+}
+inline std::string* SignNodeMsg::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:SignNodeMsg.id)
+  return _s;
+}
+inline const std::string& SignNodeMsg::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void SignNodeMsg::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignNodeMsg::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignNodeMsg::release_id() {
+  // @@protoc_insertion_point(field_release:SignNodeMsg.id)
+  return _impl_.id_.Release();
+}
+inline void SignNodeMsg::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SignNodeMsg.id)
+}
+
+// bytes sign = 2;
+inline void SignNodeMsg::clear_sign() {
+  _impl_.sign_.ClearToEmpty();
+}
+inline const std::string& SignNodeMsg::sign() const {
+  // @@protoc_insertion_point(field_get:SignNodeMsg.sign)
+  return _internal_sign();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignNodeMsg::set_sign(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sign_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SignNodeMsg.sign)
+}
+inline std::string* SignNodeMsg::mutable_sign() {
+  std::string* _s = _internal_mutable_sign();
+  // @@protoc_insertion_point(field_mutable:SignNodeMsg.sign)
+  return _s;
+}
+inline const std::string& SignNodeMsg::_internal_sign() const {
+  return _impl_.sign_.Get();
+}
+inline void SignNodeMsg::_internal_set_sign(const std::string& value) {
+  
+  _impl_.sign_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignNodeMsg::_internal_mutable_sign() {
+  
+  return _impl_.sign_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignNodeMsg::release_sign() {
+  // @@protoc_insertion_point(field_release:SignNodeMsg.sign)
+  return _impl_.sign_.Release();
+}
+inline void SignNodeMsg::set_allocated_sign(std::string* sign) {
+  if (sign != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sign_.SetAllocated(sign, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sign_.IsDefault()) {
+    _impl_.sign_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SignNodeMsg.sign)
+}
+
+// bytes pub = 3;
+inline void SignNodeMsg::clear_pub() {
+  _impl_.pub_.ClearToEmpty();
+}
+inline const std::string& SignNodeMsg::pub() const {
+  // @@protoc_insertion_point(field_get:SignNodeMsg.pub)
+  return _internal_pub();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignNodeMsg::set_pub(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pub_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SignNodeMsg.pub)
+}
+inline std::string* SignNodeMsg::mutable_pub() {
+  std::string* _s = _internal_mutable_pub();
+  // @@protoc_insertion_point(field_mutable:SignNodeMsg.pub)
+  return _s;
+}
+inline const std::string& SignNodeMsg::_internal_pub() const {
+  return _impl_.pub_.Get();
+}
+inline void SignNodeMsg::_internal_set_pub(const std::string& value) {
+  
+  _impl_.pub_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignNodeMsg::_internal_mutable_pub() {
+  
+  return _impl_.pub_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignNodeMsg::release_pub() {
+  // @@protoc_insertion_point(field_release:SignNodeMsg.pub)
+  return _impl_.pub_.Release();
+}
+inline void SignNodeMsg::set_allocated_pub(std::string* pub) {
+  if (pub != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.pub_.SetAllocated(pub, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pub_.IsDefault()) {
+    _impl_.pub_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SignNodeMsg.pub)
+}
+
+// -------------------------------------------------------------------
+
+// TxMsgInfo
+
+// uint32 type = 1;
+inline void TxMsgInfo::clear_type() {
+  _impl_.type_ = 0u;
+}
+inline uint32_t TxMsgInfo::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint32_t TxMsgInfo::type() const {
+  // @@protoc_insertion_point(field_get:TxMsgInfo.type)
+  return _internal_type();
+}
+inline void TxMsgInfo::_internal_set_type(uint32_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void TxMsgInfo::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:TxMsgInfo.type)
+}
+
+// bytes tx = 2;
+inline void TxMsgInfo::clear_tx() {
+  _impl_.tx_.ClearToEmpty();
+}
+inline const std::string& TxMsgInfo::tx() const {
+  // @@protoc_insertion_point(field_get:TxMsgInfo.tx)
+  return _internal_tx();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxMsgInfo::set_tx(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tx_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TxMsgInfo.tx)
+}
+inline std::string* TxMsgInfo::mutable_tx() {
+  std::string* _s = _internal_mutable_tx();
+  // @@protoc_insertion_point(field_mutable:TxMsgInfo.tx)
+  return _s;
+}
+inline const std::string& TxMsgInfo::_internal_tx() const {
+  return _impl_.tx_.Get();
+}
+inline void TxMsgInfo::_internal_set_tx(const std::string& value) {
+  
+  _impl_.tx_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxMsgInfo::_internal_mutable_tx() {
+  
+  return _impl_.tx_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxMsgInfo::release_tx() {
+  // @@protoc_insertion_point(field_release:TxMsgInfo.tx)
+  return _impl_.tx_.Release();
+}
+inline void TxMsgInfo::set_allocated_tx(std::string* tx) {
+  if (tx != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tx_.SetAllocated(tx, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tx_.IsDefault()) {
+    _impl_.tx_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TxMsgInfo.tx)
+}
+
+// uint64 nodeHeight = 3;
+inline void TxMsgInfo::clear_nodeheight() {
+  _impl_.nodeheight_ = uint64_t{0u};
+}
+inline uint64_t TxMsgInfo::_internal_nodeheight() const {
+  return _impl_.nodeheight_;
+}
+inline uint64_t TxMsgInfo::nodeheight() const {
+  // @@protoc_insertion_point(field_get:TxMsgInfo.nodeHeight)
+  return _internal_nodeheight();
+}
+inline void TxMsgInfo::_internal_set_nodeheight(uint64_t value) {
+  
+  _impl_.nodeheight_ = value;
+}
+inline void TxMsgInfo::set_nodeheight(uint64_t value) {
+  _internal_set_nodeheight(value);
+  // @@protoc_insertion_point(field_set:TxMsgInfo.nodeHeight)
+}
+
+// uint64 txUtxoHeight = 4;
+inline void TxMsgInfo::clear_txutxoheight() {
+  _impl_.txutxoheight_ = uint64_t{0u};
+}
+inline uint64_t TxMsgInfo::_internal_txutxoheight() const {
+  return _impl_.txutxoheight_;
+}
+inline uint64_t TxMsgInfo::txutxoheight() const {
+  // @@protoc_insertion_point(field_get:TxMsgInfo.txUtxoHeight)
+  return _internal_txutxoheight();
+}
+inline void TxMsgInfo::_internal_set_txutxoheight(uint64_t value) {
+  
+  _impl_.txutxoheight_ = value;
+}
+inline void TxMsgInfo::set_txutxoheight(uint64_t value) {
+  _internal_set_txutxoheight(value);
+  // @@protoc_insertion_point(field_set:TxMsgInfo.txUtxoHeight)
+}
+
+// repeated string contractStorageList = 5;
+inline int TxMsgInfo::_internal_contractstoragelist_size() const {
+  return _impl_.contractstoragelist_.size();
+}
+inline int TxMsgInfo::contractstoragelist_size() const {
+  return _internal_contractstoragelist_size();
+}
+inline void TxMsgInfo::clear_contractstoragelist() {
+  _impl_.contractstoragelist_.Clear();
+}
+inline std::string* TxMsgInfo::add_contractstoragelist() {
+  std::string* _s = _internal_add_contractstoragelist();
+  // @@protoc_insertion_point(field_add_mutable:TxMsgInfo.contractStorageList)
+  return _s;
+}
+inline const std::string& TxMsgInfo::_internal_contractstoragelist(int index) const {
+  return _impl_.contractstoragelist_.Get(index);
+}
+inline const std::string& TxMsgInfo::contractstoragelist(int index) const {
+  // @@protoc_insertion_point(field_get:TxMsgInfo.contractStorageList)
+  return _internal_contractstoragelist(index);
+}
+inline std::string* TxMsgInfo::mutable_contractstoragelist(int index) {
+  // @@protoc_insertion_point(field_mutable:TxMsgInfo.contractStorageList)
+  return _impl_.contractstoragelist_.Mutable(index);
+}
+inline void TxMsgInfo::set_contractstoragelist(int index, const std::string& value) {
+  _impl_.contractstoragelist_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:TxMsgInfo.contractStorageList)
+}
+inline void TxMsgInfo::set_contractstoragelist(int index, std::string&& value) {
+  _impl_.contractstoragelist_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:TxMsgInfo.contractStorageList)
+}
+inline void TxMsgInfo::set_contractstoragelist(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contractstoragelist_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:TxMsgInfo.contractStorageList)
+}
+inline void TxMsgInfo::set_contractstoragelist(int index, const char* value, size_t size) {
+  _impl_.contractstoragelist_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:TxMsgInfo.contractStorageList)
+}
+inline std::string* TxMsgInfo::_internal_add_contractstoragelist() {
+  return _impl_.contractstoragelist_.Add();
+}
+inline void TxMsgInfo::add_contractstoragelist(const std::string& value) {
+  _impl_.contractstoragelist_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:TxMsgInfo.contractStorageList)
+}
+inline void TxMsgInfo::add_contractstoragelist(std::string&& value) {
+  _impl_.contractstoragelist_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:TxMsgInfo.contractStorageList)
+}
+inline void TxMsgInfo::add_contractstoragelist(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contractstoragelist_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:TxMsgInfo.contractStorageList)
+}
+inline void TxMsgInfo::add_contractstoragelist(const char* value, size_t size) {
+  _impl_.contractstoragelist_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:TxMsgInfo.contractStorageList)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TxMsgInfo::contractstoragelist() const {
+  // @@protoc_insertion_point(field_list:TxMsgInfo.contractStorageList)
+  return _impl_.contractstoragelist_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TxMsgInfo::mutable_contractstoragelist() {
+  // @@protoc_insertion_point(field_mutable_list:TxMsgInfo.contractStorageList)
+  return &_impl_.contractstoragelist_;
+}
+
+// -------------------------------------------------------------------
+
+// TxMsgReq
+
+// string version = 1;
+inline void TxMsgReq::clear_version() {
+  _impl_.version_.ClearToEmpty();
+}
+inline const std::string& TxMsgReq::version() const {
+  // @@protoc_insertion_point(field_get:TxMsgReq.version)
+  return _internal_version();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxMsgReq::set_version(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TxMsgReq.version)
+}
+inline std::string* TxMsgReq::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:TxMsgReq.version)
+  return _s;
+}
+inline const std::string& TxMsgReq::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void TxMsgReq::_internal_set_version(const std::string& value) {
+  
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TxMsgReq::_internal_mutable_version() {
+  
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TxMsgReq::release_version() {
+  // @@protoc_insertion_point(field_release:TxMsgReq.version)
+  return _impl_.version_.Release();
+}
+inline void TxMsgReq::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TxMsgReq.version)
+}
+
+// .TxMsgInfo txMsgInfo = 2;
+inline bool TxMsgReq::_internal_has_txmsginfo() const {
+  return this != internal_default_instance() && _impl_.txmsginfo_ != nullptr;
+}
+inline bool TxMsgReq::has_txmsginfo() const {
+  return _internal_has_txmsginfo();
+}
+inline void TxMsgReq::clear_txmsginfo() {
+  if (GetArenaForAllocation() == nullptr && _impl_.txmsginfo_ != nullptr) {
+    delete _impl_.txmsginfo_;
+  }
+  _impl_.txmsginfo_ = nullptr;
+}
+inline const ::TxMsgInfo& TxMsgReq::_internal_txmsginfo() const {
+  const ::TxMsgInfo* p = _impl_.txmsginfo_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TxMsgInfo&>(
+      ::_TxMsgInfo_default_instance_);
+}
+inline const ::TxMsgInfo& TxMsgReq::txmsginfo() const {
+  // @@protoc_insertion_point(field_get:TxMsgReq.txMsgInfo)
+  return _internal_txmsginfo();
+}
+inline void TxMsgReq::unsafe_arena_set_allocated_txmsginfo(
+    ::TxMsgInfo* txmsginfo) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txmsginfo_);
+  }
+  _impl_.txmsginfo_ = txmsginfo;
+  if (txmsginfo) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TxMsgReq.txMsgInfo)
+}
+inline ::TxMsgInfo* TxMsgReq::release_txmsginfo() {
+  
+  ::TxMsgInfo* temp = _impl_.txmsginfo_;
+  _impl_.txmsginfo_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TxMsgInfo* TxMsgReq::unsafe_arena_release_txmsginfo() {
+  // @@protoc_insertion_point(field_release:TxMsgReq.txMsgInfo)
+  
+  ::TxMsgInfo* temp = _impl_.txmsginfo_;
+  _impl_.txmsginfo_ = nullptr;
+  return temp;
+}
+inline ::TxMsgInfo* TxMsgReq::_internal_mutable_txmsginfo() {
+  
+  if (_impl_.txmsginfo_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TxMsgInfo>(GetArenaForAllocation());
+    _impl_.txmsginfo_ = p;
+  }
+  return _impl_.txmsginfo_;
+}
+inline ::TxMsgInfo* TxMsgReq::mutable_txmsginfo() {
+  ::TxMsgInfo* _msg = _internal_mutable_txmsginfo();
+  // @@protoc_insertion_point(field_mutable:TxMsgReq.txMsgInfo)
+  return _msg;
+}
+inline void TxMsgReq::set_allocated_txmsginfo(::TxMsgInfo* txmsginfo) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.txmsginfo_;
+  }
+  if (txmsginfo) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txmsginfo);
+    if (message_arena != submessage_arena) {
+      txmsginfo = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txmsginfo, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.txmsginfo_ = txmsginfo;
+  // @@protoc_insertion_point(field_set_allocated:TxMsgReq.txMsgInfo)
+}
+
+// repeated .SignNodeMsg signNodeMsg = 3;
+inline int TxMsgReq::_internal_signnodemsg_size() const {
+  return _impl_.signnodemsg_.size();
+}
+inline int TxMsgReq::signnodemsg_size() const {
+  return _internal_signnodemsg_size();
+}
+inline void TxMsgReq::clear_signnodemsg() {
+  _impl_.signnodemsg_.Clear();
+}
+inline ::SignNodeMsg* TxMsgReq::mutable_signnodemsg(int index) {
+  // @@protoc_insertion_point(field_mutable:TxMsgReq.signNodeMsg)
+  return _impl_.signnodemsg_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SignNodeMsg >*
+TxMsgReq::mutable_signnodemsg() {
+  // @@protoc_insertion_point(field_mutable_list:TxMsgReq.signNodeMsg)
+  return &_impl_.signnodemsg_;
+}
+inline const ::SignNodeMsg& TxMsgReq::_internal_signnodemsg(int index) const {
+  return _impl_.signnodemsg_.Get(index);
+}
+inline const ::SignNodeMsg& TxMsgReq::signnodemsg(int index) const {
+  // @@protoc_insertion_point(field_get:TxMsgReq.signNodeMsg)
+  return _internal_signnodemsg(index);
+}
+inline ::SignNodeMsg* TxMsgReq::_internal_add_signnodemsg() {
+  return _impl_.signnodemsg_.Add();
+}
+inline ::SignNodeMsg* TxMsgReq::add_signnodemsg() {
+  ::SignNodeMsg* _add = _internal_add_signnodemsg();
+  // @@protoc_insertion_point(field_add:TxMsgReq.signNodeMsg)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SignNodeMsg >&
+TxMsgReq::signnodemsg() const {
+  // @@protoc_insertion_point(field_list:TxMsgReq.signNodeMsg)
+  return _impl_.signnodemsg_;
+}
+
+// repeated string prevBlkHashs = 4;
+inline int TxMsgReq::_internal_prevblkhashs_size() const {
+  return _impl_.prevblkhashs_.size();
+}
+inline int TxMsgReq::prevblkhashs_size() const {
+  return _internal_prevblkhashs_size();
+}
+inline void TxMsgReq::clear_prevblkhashs() {
+  _impl_.prevblkhashs_.Clear();
+}
+inline std::string* TxMsgReq::add_prevblkhashs() {
+  std::string* _s = _internal_add_prevblkhashs();
+  // @@protoc_insertion_point(field_add_mutable:TxMsgReq.prevBlkHashs)
+  return _s;
+}
+inline const std::string& TxMsgReq::_internal_prevblkhashs(int index) const {
+  return _impl_.prevblkhashs_.Get(index);
+}
+inline const std::string& TxMsgReq::prevblkhashs(int index) const {
+  // @@protoc_insertion_point(field_get:TxMsgReq.prevBlkHashs)
+  return _internal_prevblkhashs(index);
+}
+inline std::string* TxMsgReq::mutable_prevblkhashs(int index) {
+  // @@protoc_insertion_point(field_mutable:TxMsgReq.prevBlkHashs)
+  return _impl_.prevblkhashs_.Mutable(index);
+}
+inline void TxMsgReq::set_prevblkhashs(int index, const std::string& value) {
+  _impl_.prevblkhashs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:TxMsgReq.prevBlkHashs)
+}
+inline void TxMsgReq::set_prevblkhashs(int index, std::string&& value) {
+  _impl_.prevblkhashs_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:TxMsgReq.prevBlkHashs)
+}
+inline void TxMsgReq::set_prevblkhashs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.prevblkhashs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:TxMsgReq.prevBlkHashs)
+}
+inline void TxMsgReq::set_prevblkhashs(int index, const char* value, size_t size) {
+  _impl_.prevblkhashs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:TxMsgReq.prevBlkHashs)
+}
+inline std::string* TxMsgReq::_internal_add_prevblkhashs() {
+  return _impl_.prevblkhashs_.Add();
+}
+inline void TxMsgReq::add_prevblkhashs(const std::string& value) {
+  _impl_.prevblkhashs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:TxMsgReq.prevBlkHashs)
+}
+inline void TxMsgReq::add_prevblkhashs(std::string&& value) {
+  _impl_.prevblkhashs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:TxMsgReq.prevBlkHashs)
+}
+inline void TxMsgReq::add_prevblkhashs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.prevblkhashs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:TxMsgReq.prevBlkHashs)
+}
+inline void TxMsgReq::add_prevblkhashs(const char* value, size_t size) {
+  _impl_.prevblkhashs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:TxMsgReq.prevBlkHashs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TxMsgReq::prevblkhashs() const {
+  // @@protoc_insertion_point(field_list:TxMsgReq.prevBlkHashs)
+  return _impl_.prevblkhashs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TxMsgReq::mutable_prevblkhashs() {
+  // @@protoc_insertion_point(field_mutable_list:TxMsgReq.prevBlkHashs)
+  return &_impl_.prevblkhashs_;
+}
+
+// -------------------------------------------------------------------
 
-// ===================================================================
+// VrfData
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// SignNodeMsg
+// string hash = 1;
+inline void VrfData::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
+}
+inline const std::string& VrfData::hash() const {
+  // @@protoc_insertion_point(field_get:VrfData.hash)
+  return _internal_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VrfData::set_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:VrfData.hash)
+}
+inline std::string* VrfData::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:VrfData.hash)
+  return _s;
+}
+inline const std::string& VrfData::_internal_hash() const {
+  return _impl_.hash_.Get();
+}
+inline void VrfData::_internal_set_hash(const std::string& value) {
+  
+  _impl_.hash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VrfData::_internal_mutable_hash() {
+  
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VrfData::release_hash() {
+  // @@protoc_insertion_point(field_release:VrfData.hash)
+  return _impl_.hash_.Release();
+}
+inline void VrfData::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:VrfData.hash)
+}
 
-// string id = 1;
-inline void SignNodeMsg::clear_id() {
-  _impl_.id_.ClearToEmpty();
+// uint64 range = 2;
+inline void VrfData::clear_range() {
+  _impl_.range_ = uint64_t{0u};
+}
+inline uint64_t VrfData::_internal_range() const {
+  return _impl_.range_;
+}
+inline uint64_t VrfData::range() const {
+  // @@protoc_insertion_point(field_get:VrfData.range)
+  return _internal_range();
+}
+inline void VrfData::_internal_set_range(uint64_t value) {
+  
+  _impl_.range_ = value;
+}
+inline void VrfData::set_range(uint64_t value) {
+  _internal_set_range(value);
+  // @@protoc_insertion_point(field_set:VrfData.range)
+}
+
+// uint64 percentage = 3;
+inline void VrfData::clear_percentage() {
+  _impl_.percentage_ = uint64_t{0u};
+}
+inline uint64_t VrfData::_internal_percentage() const {
+  return _impl_.percentage_;
+}
+inline uint64_t VrfData::percentage() const {
+  // @@protoc_insertion_point(field_get:VrfData.percentage)
+  return _internal_percentage();
+}
+inline void VrfData::_internal_set_percentage(uint64_t value) {
+  
+  _impl_.percentage_ = value;
+}
+inline void VrfData::set_percentage(uint64_t value) {
+  _internal_set_percentage(value);
+  // @@protoc_insertion_point(field_set:VrfData.percentage)
+}
+
+// uint64 height = 4;
+inline void VrfData::clear_height() {
+  _impl_.height_ = uint64_t{0u};
+}
+inline uint64_t VrfData::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint64_t VrfData::height() const {
+  // @@protoc_insertion_point(field_get:VrfData.height)
+  return _internal_height();
+}
+inline void VrfData::_internal_set_height(uint64_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void VrfData::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:VrfData.height)
+}
+
+// string targetAddr = 5;
+inline void VrfData::clear_targetaddr() {
+  _impl_.targetaddr_.ClearToEmpty();
+}
+inline const std::string& VrfData::targetaddr() const {
+  // @@protoc_insertion_point(field_get:VrfData.targetAddr)
+  return _internal_targetaddr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VrfData::set_targetaddr(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.targetaddr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:VrfData.targetAddr)
+}
+inline std::string* VrfData::mutable_targetaddr() {
+  std::string* _s = _internal_mutable_targetaddr();
+  // @@protoc_insertion_point(field_mutable:VrfData.targetAddr)
+  return _s;
+}
+inline const std::string& VrfData::_internal_targetaddr() const {
+  return _impl_.targetaddr_.Get();
+}
+inline void VrfData::_internal_set_targetaddr(const std::string& value) {
+  
+  _impl_.targetaddr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VrfData::_internal_mutable_targetaddr() {
+  
+  return _impl_.targetaddr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VrfData::release_targetaddr() {
+  // @@protoc_insertion_point(field_release:VrfData.targetAddr)
+  return _impl_.targetaddr_.Release();
+}
+inline void VrfData::set_allocated_targetaddr(std::string* targetaddr) {
+  if (targetaddr != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.targetaddr_.SetAllocated(targetaddr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.targetaddr_.IsDefault()) {
+    _impl_.targetaddr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:VrfData.targetAddr)
+}
+
+// repeated string vrfList = 6;
+inline int VrfData::_internal_vrflist_size() const {
+  return _impl_.vrflist_.size();
+}
+inline int VrfData::vrflist_size() const {
+  return _internal_vrflist_size();
+}
+inline void VrfData::clear_vrflist() {
+  _impl_.vrflist_.Clear();
+}
+inline std::string* VrfData::add_vrflist() {
+  std::string* _s = _internal_add_vrflist();
+  // @@protoc_insertion_point(field_add_mutable:VrfData.vrfList)
+  return _s;
+}
+inline const std::string& VrfData::_internal_vrflist(int index) const {
+  return _impl_.vrflist_.Get(index);
+}
+inline const std::string& VrfData::vrflist(int index) const {
+  // @@protoc_insertion_point(field_get:VrfData.vrfList)
+  return _internal_vrflist(index);
+}
+inline std::string* VrfData::mutable_vrflist(int index) {
+  // @@protoc_insertion_point(field_mutable:VrfData.vrfList)
+  return _impl_.vrflist_.Mutable(index);
+}
+inline void VrfData::set_vrflist(int index, const std::string& value) {
+  _impl_.vrflist_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:VrfData.vrfList)
+}
+inline void VrfData::set_vrflist(int index, std::string&& value) {
+  _impl_.vrflist_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:VrfData.vrfList)
+}
+inline void VrfData::set_vrflist(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.vrflist_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:VrfData.vrfList)
+}
+inline void VrfData::set_vrflist(int index, const char* value, size_t size) {
+  _impl_.vrflist_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:VrfData.vrfList)
+}
+inline std::string* VrfData::_internal_add_vrflist() {
+  return _impl_.vrflist_.Add();
+}
+inline void VrfData::add_vrflist(const std::string& value) {
+  _impl_.vrflist_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:VrfData.vrfList)
+}
+inline void VrfData::add_vrflist(std::string&& value) {
+  _impl_.vrflist_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:VrfData.vrfList)
+}
+inline void VrfData::add_vrflist(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.vrflist_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:VrfData.vrfList)
+}
+inline void VrfData::add_vrflist(const char* value, size_t size) {
+  _impl_.vrflist_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:VrfData.vrfList)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+VrfData::vrflist() const {
+  // @@protoc_insertion_point(field_list:VrfData.vrfList)
+  return _impl_.vrflist_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+VrfData::mutable_vrflist() {
+  // @@protoc_insertion_point(field_mutable_list:VrfData.vrfList)
+  return &_impl_.vrflist_;
 }
-inline const std::string& SignNodeMsg::id() const {
-  // @@protoc_insertion_point(field_get:SignNodeMsg.id)
-  return _internal_id();
+
+// string txvrfinfohash = 7;
+inline void VrfData::clear_txvrfinfohash() {
+  _impl_.txvrfinfohash_.ClearToEmpty();
+}
+inline const std::string& VrfData::txvrfinfohash() const {
+  // @@protoc_insertion_point(field_get:VrfData.txvrfinfohash)
+  return _internal_txvrfinfohash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SignNodeMsg::set_id(ArgT0&& arg0, ArgT... args) {
+void VrfData::set_txvrfinfohash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SignNodeMsg.id)
+ _impl_.txvrfinfohash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:VrfData.txvrfinfohash)
 }
-inline std::string* SignNodeMsg::mutable_id() {
-  std::string* _s = _internal_mutable_id();
-  // @@protoc_insertion_point(field_mutable:SignNodeMsg.id)
+inline std::string* VrfData::mutable_txvrfinfohash() {
+  std::string* _s = _internal_mutable_txvrfinfohash();
+  // @@protoc_insertion_point(field_mutable:VrfData.txvrfinfohash)
   return _s;
 }
-inline const std::string& SignNodeMsg::_internal_id() const {
-  return _impl_.id_.Get();
+inline const std::string& VrfData::_internal_txvrfinfohash() const {
+  return _impl_.txvrfinfohash_.Get();
 }
-inline void SignNodeMsg::_internal_set_id(const std::string& value) {
+inline void VrfData::_internal_set_txvrfinfohash(const std::string& value) {
   
-  _impl_.id_.Set(value, GetArenaForAllocation());
+  _impl_.txvrfinfohash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SignNodeMsg::_internal_mutable_id() {
+inline std::string* VrfData::_internal_mutable_txvrfinfohash() {
   
-  return _impl_.id_.Mutable(GetArenaForAllocation());
+  return _impl_.txvrfinfohash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SignNodeMsg::release_id() {
-  // @@protoc_insertion_point(field_release:SignNodeMsg.id)
-  return _impl_.id_.Release();
+inline std::string* VrfData::release_txvrfinfohash() {
+  // @@protoc_insertion_point(field_release:VrfData.txvrfinfohash)
+  return _impl_.txvrfinfohash_.Release();
 }
-inline void SignNodeMsg::set_allocated_id(std::string* id) {
-  if (id != nullptr) {
+inline void VrfData::set_allocated_txvrfinfohash(std::string* txvrfinfohash) {
+  if (txvrfinfohash != nullptr) {
     
   } else {
     
   }
-  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+  _impl_.txvrfinfohash_.SetAllocated(txvrfinfohash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.id_.IsDefault()) {
-    _impl_.id_.Set("", GetArenaForAllocation());
+  if (_impl_.txvrfinfohash_.IsDefault()) {
+    _impl_.txvrfinfohash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SignNodeMsg.id)
+  // @@protoc_insertion_point(field_set_allocated:VrfData.txvrfinfohash)
 }
 
-// bytes sign = 2;
-inline void SignNodeMsg::clear_sign() {
-  _impl_.sign_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// Vrf
+
+// .VrfData vrfdata = 1;
+inline bool Vrf::_internal_has_vrfdata() const {
+  return this != internal_default_instance() && _impl_.vrfdata_ != nullptr;
 }
-inline const std::string& SignNodeMsg::sign() const {
-  // @@protoc_insertion_point(field_get:SignNodeMsg.sign)
-  return _internal_sign();
+inline bool Vrf::has_vrfdata() const {
+  return _internal_has_vrfdata();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SignNodeMsg::set_sign(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.sign_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SignNodeMsg.sign)
+inline void Vrf::clear_vrfdata() {
+  if (GetArenaForAllocation() == nullptr && _impl_.vrfdata_ != nullptr) {
+    delete _impl_.vrfdata_;
+  }
+  _impl_.vrfdata_ = nullptr;
 }
-inline std::string* SignNodeMsg::mutable_sign() {
-  std::string* _s = _internal_mutable_sign();
-  // @@protoc_insertion_point(field_mutable:SignNodeMsg.sign)
-  return _s;
+inline const ::VrfData& Vrf::_internal_vrfdata() const {
+  const ::VrfData* p = _impl_.vrfdata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::VrfData&>(
+      ::_VrfData_default_instance_);
 }
-inline const std::string& SignNodeMsg::_internal_sign() const {
-  return _impl_.sign_.Get();
+inline const ::VrfData& Vrf::vrfdata() const {
+  // @@protoc_insertion_point(field_get:Vrf.vrfdata)
+  return _internal_vrfdata();
 }
-inline void SignNodeMsg::_internal_set_sign(const std::string& value) {
+inline void Vrf::unsafe_arena_set_allocated_vrfdata(
+    ::VrfData* vrfdata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfdata_);
+  }
+  _impl_.vrfdata_ = vrfdata;
+  if (vrfdata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Vrf.vrfdata)
+}
+inline ::VrfData* Vrf::release_vrfdata() {
   
-  _impl_.sign_.Set(value, GetArenaForAllocation());
+  ::VrfData* temp = _impl_.vrfdata_;
+  _impl_.vrfdata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* SignNodeMsg::_internal_mutable_sign() {
+inline ::VrfData* Vrf::unsafe_arena_release_vrfdata() {
+  // @@protoc_insertion_point(field_release:Vrf.vrfdata)
   
-  return _impl_.sign_.Mutable(GetArenaForAllocation());
+  ::VrfData* temp = _impl_.vrfdata_;
+  _impl_.vrfdata_ = nullptr;
+  return temp;
 }
-inline std::string* SignNodeMsg::release_sign() {
-  // @@protoc_insertion_point(field_release:SignNodeMsg.sign)
-  return _impl_.sign_.Release();
+inline ::VrfData* Vrf::_internal_mutable_vrfdata() {
+  
+  if (_impl_.vrfdata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::VrfData>(GetArenaForAllocation());
+    _impl_.vrfdata_ = p;
+  }
+  return _impl_.vrfdata_;
 }
-inline void SignNodeMsg::set_allocated_sign(std::string* sign) {
-  if (sign != nullptr) {
+inline ::VrfData* Vrf::mutable_vrfdata() {
+  ::VrfData* _msg = _internal_mutable_vrfdata();
+  // @@protoc_insertion_point(field_mutable:Vrf.vrfdata)
+  return _msg;
+}
+inline void Vrf::set_allocated_vrfdata(::VrfData* vrfdata) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.vrfdata_;
+  }
+  if (vrfdata) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vrfdata);
+    if (message_arena != submessage_arena) {
+      vrfdata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vrfdata, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.sign_.SetAllocated(sign, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.sign_.IsDefault()) {
-    _impl_.sign_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SignNodeMsg.sign)
+  _impl_.vrfdata_ = vrfdata;
+  // @@protoc_insertion_point(field_set_allocated:Vrf.vrfdata)
 }
 
-// bytes pub = 3;
-inline void SignNodeMsg::clear_pub() {
-  _impl_.pub_.ClearToEmpty();
+// .CSign Vrfsign = 2;
+inline bool Vrf::_internal_has_vrfsign() const {
+  return this != internal_default_instance() && _impl_.vrfsign_ != nullptr;
 }
-inline const std::string& SignNodeMsg::pub() const {
-  // @@protoc_insertion_point(field_get:SignNodeMsg.pub)
-  return _internal_pub();
+inline bool Vrf::has_vrfsign() const {
+  return _internal_has_vrfsign();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SignNodeMsg::set_pub(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.pub_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SignNodeMsg.pub)
+inline const ::CSign& Vrf::_internal_vrfsign() const {
+  const ::CSign* p = _impl_.vrfsign_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CSign&>(
+      ::_CSign_default_instance_);
 }
-inline std::string* SignNodeMsg::mutable_pub() {
-  std::string* _s = _internal_mutable_pub();
-  // @@protoc_insertion_point(field_mutable:SignNodeMsg.pub)
-  return _s;
+inline const ::CSign& Vrf::vrfsign() const {
+  // @@protoc_insertion_point(field_get:Vrf.Vrfsign)
+  return _internal_vrfsign();
 }
-inline const std::string& SignNodeMsg::_internal_pub() const {
-  return _impl_.pub_.Get();
+inline void Vrf::unsafe_arena_set_allocated_vrfsign(
+    ::CSign* vrfsign) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
+  }
+  _impl_.vrfsign_ = vrfsign;
+  if (vrfsign) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Vrf.Vrfsign)
 }
-inline void SignNodeMsg::_internal_set_pub(const std::string& value) {
+inline ::CSign* Vrf::release_vrfsign() {
   
-  _impl_.pub_.Set(value, GetArenaForAllocation());
+  ::CSign* temp = _impl_.vrfsign_;
+  _impl_.vrfsign_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* SignNodeMsg::_internal_mutable_pub() {
+inline ::CSign* Vrf::unsafe_arena_release_vrfsign() {
+  // @@protoc_insertion_point(field_release:Vrf.Vrfsign)
   
-  return _impl_.pub_.Mutable(GetArenaForAllocation());
+  ::CSign* temp = _impl_.vrfsign_;
+  _impl_.vrfsign_ = nullptr;
+  return temp;
 }
-inline std::string* SignNodeMsg::release_pub() {
-  // @@protoc_insertion_point(field_release:SignNodeMsg.pub)
-  return _impl_.pub_.Release();
+inline ::CSign* Vrf::_internal_mutable_vrfsign() {
+  
+  if (_impl_.vrfsign_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CSign>(GetArenaForAllocation());
+    _impl_.vrfsign_ = p;
+  }
+  return _impl_.vrfsign_;
 }
-inline void SignNodeMsg::set_allocated_pub(std::string* pub) {
-  if (pub != nullptr) {
+inline ::CSign* Vrf::mutable_vrfsign() {
+  ::CSign* _msg = _internal_mutable_vrfsign();
+  // @@protoc_insertion_point(field_mutable:Vrf.Vrfsign)
+  return _msg;
+}
+inline void Vrf::set_allocated_vrfsign(::CSign* vrfsign) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
+  }
+  if (vrfsign) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(vrfsign));
+    if (message_arena != submessage_arena) {
+      vrfsign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vrfsign, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.pub_.SetAllocated(pub, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.pub_.IsDefault()) {
-    _impl_.pub_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SignNodeMsg.pub)
+  _impl_.vrfsign_ = vrfsign;
+  // @@protoc_insertion_point(field_set_allocated:Vrf.Vrfsign)
 }
 
 // -------------------------------------------------------------------
 
-// TxMsgInfo
-
-// uint32 type = 1;
-inline void TxMsgInfo::clear_type() {
-  _impl_.type_ = 0u;
-}
-inline uint32_t TxMsgInfo::_internal_type() const {
-  return _impl_.type_;
-}
-inline uint32_t TxMsgInfo::type() const {
-  // @@protoc_insertion_point(field_get:TxMsgInfo.type)
-  return _internal_type();
-}
-inline void TxMsgInfo::_internal_set_type(uint32_t value) {
-  
-  _impl_.type_ = value;
-}
-inline void TxMsgInfo::set_type(uint32_t value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:TxMsgInfo.type)
-}
+// VRFBlockInfo
 
-// bytes tx = 2;
-inline void TxMsgInfo::clear_tx() {
-  _impl_.tx_.ClearToEmpty();
+// string blockHash = 1;
+inline void VRFBlockInfo::clear_blockhash() {
+  _impl_.blockhash_.ClearToEmpty();
 }
-inline const std::string& TxMsgInfo::tx() const {
-  // @@protoc_insertion_point(field_get:TxMsgInfo.tx)
-  return _internal_tx();
+inline const std::string& VRFBlockInfo::blockhash() const {
+  // @@protoc_insertion_point(field_get:VRFBlockInfo.blockHash)
+  return _internal_blockhash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void TxMsgInfo::set_tx(ArgT0&& arg0, ArgT... args) {
+void VRFBlockInfo::set_blockhash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.tx_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TxMsgInfo.tx)
+ _impl_.blockhash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:VRFBlockInfo.blockHash)
 }
-inline std::string* TxMsgInfo::mutable_tx() {
-  std::string* _s = _internal_mutable_tx();
-  // @@protoc_insertion_point(field_mutable:TxMsgInfo.tx)
+inline std::string* VRFBlockInfo::mutable_blockhash() {
+  std::string* _s = _internal_mutable_blockhash();
+  // @@protoc_insertion_point(field_mutable:VRFBlockInfo.blockHash)
   return _s;
 }
-inline const std::string& TxMsgInfo::_internal_tx() const {
-  return _impl_.tx_.Get();
+inline const std::string& VRFBlockInfo::_internal_blockhash() const {
+  return _impl_.blockhash_.Get();
 }
-inline void TxMsgInfo::_internal_set_tx(const std::string& value) {
+inline void VRFBlockInfo::_internal_set_blockhash(const std::string& value) {
   
-  _impl_.tx_.Set(value, GetArenaForAllocation());
+  _impl_.blockhash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TxMsgInfo::_internal_mutable_tx() {
+inline std::string* VRFBlockInfo::_internal_mutable_blockhash() {
   
-  return _impl_.tx_.Mutable(GetArenaForAllocation());
+  return _impl_.blockhash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TxMsgInfo::release_tx() {
-  // @@protoc_insertion_point(field_release:TxMsgInfo.tx)
-  return _impl_.tx_.Release();
+inline std::string* VRFBlockInfo::release_blockhash() {
+  // @@protoc_insertion_point(field_release:VRFBlockInfo.blockHash)
+  return _impl_.blockhash_.Release();
 }
-inline void TxMsgInfo::set_allocated_tx(std::string* tx) {
-  if (tx != nullptr) {
+inline void VRFBlockInfo::set_allocated_blockhash(std::string* blockhash) {
+  if (blockhash != nullptr) {
     
   } else {
     
   }
-  _impl_.tx_.SetAllocated(tx, GetArenaForAllocation());
+  _impl_.blockhash_.SetAllocated(blockhash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.tx_.IsDefault()) {
-    _impl_.tx_.Set("", GetArenaForAllocation());
+  if (_impl_.blockhash_.IsDefault()) {
+    _impl_.blockhash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TxMsgInfo.tx)
-}
-
-// uint64 nodeHeight = 3;
-inline void TxMsgInfo::clear_nodeheight() {
-  _impl_.nodeheight_ = uint64_t{0u};
-}
-inline uint64_t TxMsgInfo::_internal_nodeheight() const {
-  return _impl_.nodeheight_;
-}
-inline uint64_t TxMsgInfo::nodeheight() const {
-  // @@protoc_insertion_point(field_get:TxMsgInfo.nodeHeight)
-  return _internal_nodeheight();
-}
-inline void TxMsgInfo::_internal_set_nodeheight(uint64_t value) {
-  
-  _impl_.nodeheight_ = value;
-}
-inline void TxMsgInfo::set_nodeheight(uint64_t value) {
-  _internal_set_nodeheight(value);
-  // @@protoc_insertion_point(field_set:TxMsgInfo.nodeHeight)
+  // @@protoc_insertion_point(field_set_allocated:VRFBlockInfo.blockHash)
 }
 
-// uint64 txUtxoHeight = 4;
-inline void TxMsgInfo::clear_txutxoheight() {
-  _impl_.txutxoheight_ = uint64_t{0u};
+// uint64 height = 2;
+inline void VRFBlockInfo::clear_height() {
+  _impl_.height_ = uint64_t{0u};
 }
-inline uint64_t TxMsgInfo::_internal_txutxoheight() const {
-  return _impl_.txutxoheight_;
+inline uint64_t VRFBlockInfo::_internal_height() const {
+  return _impl_.height_;
 }
-inline uint64_t TxMsgInfo::txutxoheight() const {
-  // @@protoc_insertion_point(field_get:TxMsgInfo.txUtxoHeight)
-  return _internal_txutxoheight();
+inline uint64_t VRFBlockInfo::height() const {
+  // @@protoc_insertion_point(field_get:VRFBlockInfo.height)
+  return _internal_height();
 }
-inline void TxMsgInfo::_internal_set_txutxoheight(uint64_t value) {
+inline void VRFBlockInfo::_internal_set_height(uint64_t value) {
   
-  _impl_.txutxoheight_ = value;
-}
-inline void TxMsgInfo::set_txutxoheight(uint64_t value) {
-  _internal_set_txutxoheight(value);
-  // @@protoc_insertion_point(field_set:TxMsgInfo.txUtxoHeight)
-}
-
-// repeated string contractStorageList = 5;
-inline int TxMsgInfo::_internal_contractstoragelist_size() const {
-  return _impl_.contractstoragelist_.size();
-}
-inline int TxMsgInfo::contractstoragelist_size() const {
-  return _internal_contractstoragelist_size();
-}
-inline void TxMsgInfo::clear_contractstoragelist() {
-  _impl_.contractstoragelist_.Clear();
-}
-inline std::string* TxMsgInfo::add_contractstoragelist() {
-  std::string* _s = _internal_add_contractstoragelist();
-  // @@protoc_insertion_point(field_add_mutable:TxMsgInfo.contractStorageList)
-  return _s;
-}
-inline const std::string& TxMsgInfo::_internal_contractstoragelist(int index) const {
-  return _impl_.contractstoragelist_.Get(index);
-}
-inline const std::string& TxMsgInfo::contractstoragelist(int index) const {
-  // @@protoc_insertion_point(field_get:TxMsgInfo.contractStorageList)
-  return _internal_contractstoragelist(index);
-}
-inline std::string* TxMsgInfo::mutable_contractstoragelist(int index) {
-  // @@protoc_insertion_point(field_mutable:TxMsgInfo.contractStorageList)
-  return _impl_.contractstoragelist_.Mutable(index);
-}
-inline void TxMsgInfo::set_contractstoragelist(int index, const std::string& value) {
-  _impl_.contractstoragelist_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:TxMsgInfo.contractStorageList)
-}
-inline void TxMsgInfo::set_contractstoragelist(int index, std::string&& value) {
-  _impl_.contractstoragelist_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:TxMsgInfo.contractStorageList)
-}
-inline void TxMsgInfo::set_contractstoragelist(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.contractstoragelist_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:TxMsgInfo.contractStorageList)
-}
-inline void TxMsgInfo::set_contractstoragelist(int index, const char* value, size_t size) {
-  _impl_.contractstoragelist_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:TxMsgInfo.contractStorageList)
-}
-inline std::string* TxMsgInfo::_internal_add_contractstoragelist() {
-  return _impl_.contractstoragelist_.Add();
-}
-inline void TxMsgInfo::add_contractstoragelist(const std::string& value) {
-  _impl_.contractstoragelist_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:TxMsgInfo.contractStorageList)
-}
-inline void TxMsgInfo::add_contractstoragelist(std::string&& value) {
-  _impl_.contractstoragelist_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:TxMsgInfo.contractStorageList)
-}
-inline void TxMsgInfo::add_contractstoragelist(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.contractstoragelist_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:TxMsgInfo.contractStorageList)
-}
-inline void TxMsgInfo::add_contractstoragelist(const char* value, size_t size) {
-  _impl_.contractstoragelist_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:TxMsgInfo.contractStorageList)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-TxMsgInfo::contractstoragelist() const {
-  // @@protoc_insertion_point(field_list:TxMsgInfo.contractStorageList)
-  return _impl_.contractstoragelist_;
+  _impl_.height_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-TxMsgInfo::mutable_contractstoragelist() {
-  // @@protoc_insertion_point(field_mutable_list:TxMsgInfo.contractStorageList)
-  return &_impl_.contractstoragelist_;
+inline void VRFBlockInfo::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:VRFBlockInfo.height)
 }
 
 // -------------------------------------------------------------------
 
-// TxMsgReq
+// VRFConsensusInfo
 
-// string version = 1;
-inline void TxMsgReq::clear_version() {
-  _impl_.version_.ClearToEmpty();
+// string vrfSeed = 1;
+inline void VRFConsensusInfo::clear_vrfseed() {
+  _impl_.vrfseed_.ClearToEmpty();
 }
-inline const std::string& TxMsgReq::version() const {
-  // @@protoc_insertion_point(field_get:TxMsgReq.version)
-  return _internal_version();
+inline const std::string& VRFConsensusInfo::vrfseed() const {
+  // @@protoc_insertion_point(field_get:VRFConsensusInfo.vrfSeed)
+  return _internal_vrfseed();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void TxMsgReq::set_version(ArgT0&& arg0, ArgT... args) {
+void VRFConsensusInfo::set_vrfseed(ArgT0&& arg0, ArgT... args) {
  
- _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TxMsgReq.version)
+ _impl_.vrfseed_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:VRFConsensusInfo.vrfSeed)
 }
-inline std::string* TxMsgReq::mutable_version() {
-  std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:TxMsgReq.version)
+inline std::string* VRFConsensusInfo::mutable_vrfseed() {
+  std::string* _s = _internal_mutable_vrfseed();
+  // @@protoc_insertion_point(field_mutable:VRFConsensusInfo.vrfSeed)
   return _s;
 }
-inline const std::string& TxMsgReq::_internal_version() const {
-  return _impl_.version_.Get();
+inline const std::string& VRFConsensusInfo::_internal_vrfseed() const {
+  return _impl_.vrfseed_.Get();
 }
-inline void TxMsgReq::_internal_set_version(const std::string& value) {
+inline void VRFConsensusInfo::_internal_set_vrfseed(const std::string& value) {
   
-  _impl_.version_.Set(value, GetArenaForAllocation());
+  _impl_.vrfseed_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TxMsgReq::_internal_mutable_version() {
+inline std::string* VRFConsensusInfo::_internal_mutable_vrfseed() {
   
-  return _impl_.version_.Mutable(GetArenaForAllocation());
+  return _impl_.vrfseed_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TxMsgReq::release_version() {
-  // @@protoc_insertion_point(field_release:TxMsgReq.version)
-  return _impl_.version_.Release();
+inline std::string* VRFConsensusInfo::release_vrfseed() {
+  // @@protoc_insertion_point(field_release:VRFConsensusInfo.vrfSeed)
+  return _impl_.vrfseed_.Release();
 }
-inline void TxMsgReq::set_allocated_version(std::string* version) {
-  if (version != nullptr) {
+inline void VRFConsensusInfo::set_allocated_vrfseed(std::string* vrfseed) {
+  if (vrfseed != nullptr) {
     
   } else {
     
   }
-  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+  _impl_.vrfseed_.SetAllocated(vrfseed, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.version_.IsDefault()) {
-    _impl_.version_.Set("", GetArenaForAllocation());
+  if (_impl_.vrfseed_.IsDefault()) {
+    _impl_.vrfseed_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TxMsgReq.version)
+  // @@protoc_insertion_point(field_set_allocated:VRFConsensusInfo.vrfSeed)
 }
 
-// .TxMsgInfo txMsgInfo = 2;
-inline bool TxMsgReq::_internal_has_txmsginfo() const {
-  return this != internal_default_instance() && _impl_.txmsginfo_ != nullptr;
+// repeated .VRFBlockInfo blockinfo = 2;
+inline int VRFConsensusInfo::_internal_blockinfo_size() const {
+  return _impl_.blockinfo_.size();
 }
-inline bool TxMsgReq::has_txmsginfo() const {
-  return _internal_has_txmsginfo();
+inline int VRFConsensusInfo::blockinfo_size() const {
+  return _internal_blockinfo_size();
 }
-inline void TxMsgReq::clear_txmsginfo() {
-  if (GetArenaForAllocation() == nullptr && _impl_.txmsginfo_ != nullptr) {
-    delete _impl_.txmsginfo_;
-  }
-  _impl_.txmsginfo_ = nullptr;
+inline void VRFConsensusInfo::clear_blockinfo() {
+  _impl_.blockinfo_.Clear();
 }
-inline const ::TxMsgInfo& TxMsgReq::_internal_txmsginfo() const {
-  const ::TxMsgInfo* p = _impl_.txmsginfo_;
-  return p != nullptr ? *p : reinterpret_cast<const ::TxMsgInfo&>(
-      ::_TxMsgInfo_default_instance_);
+inline ::VRFBlockInfo* VRFConsensusInfo::mutable_blockinfo(int index) {
+  // @@protoc_insertion_point(field_mutable:VRFConsensusInfo.blockinfo)
+  return _impl_.blockinfo_.Mutable(index);
 }
-inline const ::TxMsgInfo& TxMsgReq::txmsginfo() const {
-  // @@protoc_insertion_point(field_get:TxMsgReq.txMsgInfo)
-  return _internal_txmsginfo();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VRFBlockInfo >*
+VRFConsensusInfo::mutable_blockinfo() {
+  // @@protoc_insertion_point(field_mutable_list:VRFConsensusInfo.blockinfo)
+  return &_impl_.blockinfo_;
 }
-inline void TxMsgReq::unsafe_arena_set_allocated_txmsginfo(
-    ::TxMsgInfo* txmsginfo) {
+inline const ::VRFBlockInfo& VRFConsensusInfo::_internal_blockinfo(int index) const {
+  return _impl_.blockinfo_.Get(index);
+}
+inline const ::VRFBlockInfo& VRFConsensusInfo::blockinfo(int index) const {
+  // @@protoc_insertion_point(field_get:VRFConsensusInfo.blockinfo)
+  return _internal_blockinfo(index);
+}
+inline ::VRFBlockInfo* VRFConsensusInfo::_internal_add_blockinfo() {
+  return _impl_.blockinfo_.Add();
+}
+inline ::VRFBlockInfo* VRFConsensusInfo::add_blockinfo() {
+  ::VRFBlockInfo* _add = _internal_add_blockinfo();
+  // @@protoc_insertion_point(field_add:VRFConsensusInfo.blockinfo)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VRFBlockInfo >&
+VRFConsensusInfo::blockinfo() const {
+  // @@protoc_insertion_point(field_list:VRFConsensusInfo.blockinfo)
+  return _impl_.blockinfo_;
+}
+
+// .CSign Vrfsign = 3;
+inline bool VRFConsensusInfo::_internal_has_vrfsign() const {
+  return this != internal_default_instance() && _impl_.vrfsign_ != nullptr;
+}
+inline bool VRFConsensusInfo::has_vrfsign() const {
+  return _internal_has_vrfsign();
+}
+inline const ::CSign& VRFConsensusInfo::_internal_vrfsign() const {
+  const ::CSign* p = _impl_.vrfsign_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CSign&>(
+      ::_CSign_default_instance_);
+}
+inline const ::CSign& VRFConsensusInfo::vrfsign() const {
+  // @@protoc_insertion_point(field_get:VRFConsensusInfo.Vrfsign)
+  return _internal_vrfsign();
+}
+inline void VRFConsensusInfo::unsafe_arena_set_allocated_vrfsign(
+    ::CSign* vrfsign) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txmsginfo_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
   }
-  _impl_.txmsginfo_ = txmsginfo;
-  if (txmsginfo) {
+  _impl_.vrfsign_ = vrfsign;
+  if (vrfsign) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TxMsgReq.txMsgInfo)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:VRFConsensusInfo.Vrfsign)
 }
-inline ::TxMsgInfo* TxMsgReq::release_txmsginfo() {
+inline ::CSign* VRFConsensusInfo::release_vrfsign() {
   
-  ::TxMsgInfo* temp = _impl_.txmsginfo_;
-  _impl_.txmsginfo_ = nullptr;
+  ::CSign* temp = _impl_.vrfsign_;
+  _impl_.vrfsign_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3117,493 +4683,583 @@ inline ::TxMsgInfo* TxMsgReq::release_txmsginfo() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::TxMsgInfo* TxMsgReq::unsafe_arena_release_txmsginfo() {
-  // @@protoc_insertion_point(field_release:TxMsgReq.txMsgInfo)
+inline ::CSign* VRFConsensusInfo::unsafe_arena_release_vrfsign() {
+  // @@protoc_insertion_point(field_release:VRFConsensusInfo.Vrfsign)
   
-  ::TxMsgInfo* temp = _impl_.txmsginfo_;
-  _impl_.txmsginfo_ = nullptr;
+  ::CSign* temp = _impl_.vrfsign_;
+  _impl_.vrfsign_ = nullptr;
   return temp;
 }
-inline ::TxMsgInfo* TxMsgReq::_internal_mutable_txmsginfo() {
+inline ::CSign* VRFConsensusInfo::_internal_mutable_vrfsign() {
   
-  if (_impl_.txmsginfo_ == nullptr) {
-    auto* p = CreateMaybeMessage<::TxMsgInfo>(GetArenaForAllocation());
-    _impl_.txmsginfo_ = p;
+  if (_impl_.vrfsign_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CSign>(GetArenaForAllocation());
+    _impl_.vrfsign_ = p;
   }
-  return _impl_.txmsginfo_;
+  return _impl_.vrfsign_;
 }
-inline ::TxMsgInfo* TxMsgReq::mutable_txmsginfo() {
-  ::TxMsgInfo* _msg = _internal_mutable_txmsginfo();
-  // @@protoc_insertion_point(field_mutable:TxMsgReq.txMsgInfo)
+inline ::CSign* VRFConsensusInfo::mutable_vrfsign() {
+  ::CSign* _msg = _internal_mutable_vrfsign();
+  // @@protoc_insertion_point(field_mutable:VRFConsensusInfo.Vrfsign)
   return _msg;
 }
-inline void TxMsgReq::set_allocated_txmsginfo(::TxMsgInfo* txmsginfo) {
+inline void VRFConsensusInfo::set_allocated_vrfsign(::CSign* vrfsign) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.txmsginfo_;
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
   }
-  if (txmsginfo) {
+  if (vrfsign) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txmsginfo);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(vrfsign));
     if (message_arena != submessage_arena) {
-      txmsginfo = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, txmsginfo, submessage_arena);
+      vrfsign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vrfsign, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.txmsginfo_ = txmsginfo;
-  // @@protoc_insertion_point(field_set_allocated:TxMsgReq.txMsgInfo)
+  _impl_.vrfsign_ = vrfsign;
+  // @@protoc_insertion_point(field_set_allocated:VRFConsensusInfo.Vrfsign)
 }
 
-// repeated .SignNodeMsg signNodeMsg = 3;
-inline int TxMsgReq::_internal_signnodemsg_size() const {
-  return _impl_.signnodemsg_.size();
+// -------------------------------------------------------------------
+
+// TxMsgAck
+
+// string version = 1;
+inline void TxMsgAck::clear_version() {
+  _impl_.version_.ClearToEmpty();
 }
-inline int TxMsgReq::signnodemsg_size() const {
-  return _internal_signnodemsg_size();
+inline const std::string& TxMsgAck::version() const {
+  // @@protoc_insertion_point(field_get:TxMsgAck.version)
+  return _internal_version();
 }
-inline void TxMsgReq::clear_signnodemsg() {
-  _impl_.signnodemsg_.Clear();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxMsgAck::set_version(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TxMsgAck.version)
 }
-inline ::SignNodeMsg* TxMsgReq::mutable_signnodemsg(int index) {
-  // @@protoc_insertion_point(field_mutable:TxMsgReq.signNodeMsg)
-  return _impl_.signnodemsg_.Mutable(index);
+inline std::string* TxMsgAck::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:TxMsgAck.version)
+  return _s;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SignNodeMsg >*
-TxMsgReq::mutable_signnodemsg() {
-  // @@protoc_insertion_point(field_mutable_list:TxMsgReq.signNodeMsg)
-  return &_impl_.signnodemsg_;
+inline const std::string& TxMsgAck::_internal_version() const {
+  return _impl_.version_.Get();
 }
-inline const ::SignNodeMsg& TxMsgReq::_internal_signnodemsg(int index) const {
-  return _impl_.signnodemsg_.Get(index);
+inline void TxMsgAck::_internal_set_version(const std::string& value) {
+  
+  _impl_.version_.Set(value, GetArenaForAllocation());
 }
-inline const ::SignNodeMsg& TxMsgReq::signnodemsg(int index) const {
-  // @@protoc_insertion_point(field_get:TxMsgReq.signNodeMsg)
-  return _internal_signnodemsg(index);
+inline std::string* TxMsgAck::_internal_mutable_version() {
+  
+  return _impl_.version_.Mutable(GetArenaForAllocation());
 }
-inline ::SignNodeMsg* TxMsgReq::_internal_add_signnodemsg() {
-  return _impl_.signnodemsg_.Add();
+inline std::string* TxMsgAck::release_version() {
+  // @@protoc_insertion_point(field_release:TxMsgAck.version)
+  return _impl_.version_.Release();
 }
-inline ::SignNodeMsg* TxMsgReq::add_signnodemsg() {
-  ::SignNodeMsg* _add = _internal_add_signnodemsg();
-  // @@protoc_insertion_point(field_add:TxMsgReq.signNodeMsg)
-  return _add;
+inline void TxMsgAck::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TxMsgAck.version)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SignNodeMsg >&
-TxMsgReq::signnodemsg() const {
-  // @@protoc_insertion_point(field_list:TxMsgReq.signNodeMsg)
-  return _impl_.signnodemsg_;
+
+// int32 code = 2;
+inline void TxMsgAck::clear_code() {
+  _impl_.code_ = 0;
+}
+inline int32_t TxMsgAck::_internal_code() const {
+  return _impl_.code_;
+}
+inline int32_t TxMsgAck::code() const {
+  // @@protoc_insertion_point(field_get:TxMsgAck.code)
+  return _internal_code();
+}
+inline void TxMsgAck::_internal_set_code(int32_t value) {
+  
+  _impl_.code_ = value;
+}
+inline void TxMsgAck::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:TxMsgAck.code)
 }
 
-// repeated string prevBlkHashs = 4;
-inline int TxMsgReq::_internal_prevblkhashs_size() const {
-  return _impl_.prevblkhashs_.size();
+// string message = 3;
+inline void TxMsgAck::clear_message() {
+  _impl_.message_.ClearToEmpty();
 }
-inline int TxMsgReq::prevblkhashs_size() const {
-  return _internal_prevblkhashs_size();
+inline const std::string& TxMsgAck::message() const {
+  // @@protoc_insertion_point(field_get:TxMsgAck.message)
+  return _internal_message();
 }
-inline void TxMsgReq::clear_prevblkhashs() {
-  _impl_.prevblkhashs_.Clear();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxMsgAck::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TxMsgAck.message)
 }
-inline std::string* TxMsgReq::add_prevblkhashs() {
-  std::string* _s = _internal_add_prevblkhashs();
-  // @@protoc_insertion_point(field_add_mutable:TxMsgReq.prevBlkHashs)
+inline std::string* TxMsgAck::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:TxMsgAck.message)
   return _s;
 }
-inline const std::string& TxMsgReq::_internal_prevblkhashs(int index) const {
-  return _impl_.prevblkhashs_.Get(index);
-}
-inline const std::string& TxMsgReq::prevblkhashs(int index) const {
-  // @@protoc_insertion_point(field_get:TxMsgReq.prevBlkHashs)
-  return _internal_prevblkhashs(index);
+inline const std::string& TxMsgAck::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline std::string* TxMsgReq::mutable_prevblkhashs(int index) {
-  // @@protoc_insertion_point(field_mutable:TxMsgReq.prevBlkHashs)
-  return _impl_.prevblkhashs_.Mutable(index);
+inline void TxMsgAck::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline void TxMsgReq::set_prevblkhashs(int index, const std::string& value) {
-  _impl_.prevblkhashs_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:TxMsgReq.prevBlkHashs)
+inline std::string* TxMsgAck::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
-inline void TxMsgReq::set_prevblkhashs(int index, std::string&& value) {
-  _impl_.prevblkhashs_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:TxMsgReq.prevBlkHashs)
+inline std::string* TxMsgAck::release_message() {
+  // @@protoc_insertion_point(field_release:TxMsgAck.message)
+  return _impl_.message_.Release();
 }
-inline void TxMsgReq::set_prevblkhashs(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.prevblkhashs_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:TxMsgReq.prevBlkHashs)
+inline void TxMsgAck::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TxMsgAck.message)
 }
-inline void TxMsgReq::set_prevblkhashs(int index, const char* value, size_t size) {
-  _impl_.prevblkhashs_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:TxMsgReq.prevBlkHashs)
+
+// bytes tx = 4;
+inline void TxMsgAck::clear_tx() {
+  _impl_.tx_.ClearToEmpty();
 }
-inline std::string* TxMsgReq::_internal_add_prevblkhashs() {
-  return _impl_.prevblkhashs_.Add();
+inline const std::string& TxMsgAck::tx() const {
+  // @@protoc_insertion_point(field_get:TxMsgAck.tx)
+  return _internal_tx();
 }
-inline void TxMsgReq::add_prevblkhashs(const std::string& value) {
-  _impl_.prevblkhashs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:TxMsgReq.prevBlkHashs)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TxMsgAck::set_tx(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tx_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TxMsgAck.tx)
 }
-inline void TxMsgReq::add_prevblkhashs(std::string&& value) {
-  _impl_.prevblkhashs_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:TxMsgReq.prevBlkHashs)
+inline std::string* TxMsgAck::mutable_tx() {
+  std::string* _s = _internal_mutable_tx();
+  // @@protoc_insertion_point(field_mutable:TxMsgAck.tx)
+  return _s;
 }
-inline void TxMsgReq::add_prevblkhashs(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.prevblkhashs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:TxMsgReq.prevBlkHashs)
+inline const std::string& TxMsgAck::_internal_tx() const {
+  return _impl_.tx_.Get();
 }
-inline void TxMsgReq::add_prevblkhashs(const char* value, size_t size) {
-  _impl_.prevblkhashs_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:TxMsgReq.prevBlkHashs)
+inline void TxMsgAck::_internal_set_tx(const std::string& value) {
+  
+  _impl_.tx_.Set(value, GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-TxMsgReq::prevblkhashs() const {
-  // @@protoc_insertion_point(field_list:TxMsgReq.prevBlkHashs)
-  return _impl_.prevblkhashs_;
+inline std::string* TxMsgAck::_internal_mutable_tx() {
+  
+  return _impl_.tx_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-TxMsgReq::mutable_prevblkhashs() {
-  // @@protoc_insertion_point(field_mutable_list:TxMsgReq.prevBlkHashs)
-  return &_impl_.prevblkhashs_;
+inline std::string* TxMsgAck::release_tx() {
+  // @@protoc_insertion_point(field_release:TxMsgAck.tx)
+  return _impl_.tx_.Release();
+}
+inline void TxMsgAck::set_allocated_tx(std::string* tx) {
+  if (tx != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tx_.SetAllocated(tx, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tx_.IsDefault()) {
+    _impl_.tx_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TxMsgAck.tx)
 }
 
 // -------------------------------------------------------------------
 
-// VrfData
+// BuildBlockBroadcastMsg
 
-// string hash = 1;
-inline void VrfData::clear_hash() {
-  _impl_.hash_.ClearToEmpty();
+// string version = 1;
+inline void BuildBlockBroadcastMsg::clear_version() {
+  _impl_.version_.ClearToEmpty();
 }
-inline const std::string& VrfData::hash() const {
-  // @@protoc_insertion_point(field_get:VrfData.hash)
-  return _internal_hash();
+inline const std::string& BuildBlockBroadcastMsg::version() const {
+  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.version)
+  return _internal_version();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void VrfData::set_hash(ArgT0&& arg0, ArgT... args) {
+void BuildBlockBroadcastMsg::set_version(ArgT0&& arg0, ArgT... args) {
  
- _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:VrfData.hash)
+ _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.version)
 }
-inline std::string* VrfData::mutable_hash() {
-  std::string* _s = _internal_mutable_hash();
-  // @@protoc_insertion_point(field_mutable:VrfData.hash)
+inline std::string* BuildBlockBroadcastMsg::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.version)
   return _s;
 }
-inline const std::string& VrfData::_internal_hash() const {
-  return _impl_.hash_.Get();
+inline const std::string& BuildBlockBroadcastMsg::_internal_version() const {
+  return _impl_.version_.Get();
 }
-inline void VrfData::_internal_set_hash(const std::string& value) {
+inline void BuildBlockBroadcastMsg::_internal_set_version(const std::string& value) {
   
-  _impl_.hash_.Set(value, GetArenaForAllocation());
+  _impl_.version_.Set(value, GetArenaForAllocation());
 }
-inline std::string* VrfData::_internal_mutable_hash() {
+inline std::string* BuildBlockBroadcastMsg::_internal_mutable_version() {
   
-  return _impl_.hash_.Mutable(GetArenaForAllocation());
+  return _impl_.version_.Mutable(GetArenaForAllocation());
 }
-inline std::string* VrfData::release_hash() {
-  // @@protoc_insertion_point(field_release:VrfData.hash)
-  return _impl_.hash_.Release();
+inline std::string* BuildBlockBroadcastMsg::release_version() {
+  // @@protoc_insertion_point(field_release:BuildBlockBroadcastMsg.version)
+  return _impl_.version_.Release();
 }
-inline void VrfData::set_allocated_hash(std::string* hash) {
-  if (hash != nullptr) {
+inline void BuildBlockBroadcastMsg::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
     
   } else {
     
   }
-  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.hash_.IsDefault()) {
-    _impl_.hash_.Set("", GetArenaForAllocation());
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:VrfData.hash)
+  // @@protoc_insertion_point(field_set_allocated:BuildBlockBroadcastMsg.version)
 }
 
-// uint64 range = 2;
-inline void VrfData::clear_range() {
-  _impl_.range_ = uint64_t{0u};
-}
-inline uint64_t VrfData::_internal_range() const {
-  return _impl_.range_;
-}
-inline uint64_t VrfData::range() const {
-  // @@protoc_insertion_point(field_get:VrfData.range)
-  return _internal_range();
-}
-inline void VrfData::_internal_set_range(uint64_t value) {
-  
-  _impl_.range_ = value;
+// string id = 2;
+inline void BuildBlockBroadcastMsg::clear_id() {
+  _impl_.id_.ClearToEmpty();
 }
-inline void VrfData::set_range(uint64_t value) {
-  _internal_set_range(value);
-  // @@protoc_insertion_point(field_set:VrfData.range)
+inline const std::string& BuildBlockBroadcastMsg::id() const {
+  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.id)
+  return _internal_id();
 }
-
-// uint64 percentage = 3;
-inline void VrfData::clear_percentage() {
-  _impl_.percentage_ = uint64_t{0u};
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BuildBlockBroadcastMsg::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.id)
 }
-inline uint64_t VrfData::_internal_percentage() const {
-  return _impl_.percentage_;
+inline std::string* BuildBlockBroadcastMsg::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.id)
+  return _s;
 }
-inline uint64_t VrfData::percentage() const {
-  // @@protoc_insertion_point(field_get:VrfData.percentage)
-  return _internal_percentage();
+inline const std::string& BuildBlockBroadcastMsg::_internal_id() const {
+  return _impl_.id_.Get();
 }
-inline void VrfData::_internal_set_percentage(uint64_t value) {
+inline void BuildBlockBroadcastMsg::_internal_set_id(const std::string& value) {
   
-  _impl_.percentage_ = value;
-}
-inline void VrfData::set_percentage(uint64_t value) {
-  _internal_set_percentage(value);
-  // @@protoc_insertion_point(field_set:VrfData.percentage)
-}
-
-// uint64 height = 4;
-inline void VrfData::clear_height() {
-  _impl_.height_ = uint64_t{0u};
-}
-inline uint64_t VrfData::_internal_height() const {
-  return _impl_.height_;
-}
-inline uint64_t VrfData::height() const {
-  // @@protoc_insertion_point(field_get:VrfData.height)
-  return _internal_height();
+  _impl_.id_.Set(value, GetArenaForAllocation());
 }
-inline void VrfData::_internal_set_height(uint64_t value) {
+inline std::string* BuildBlockBroadcastMsg::_internal_mutable_id() {
   
-  _impl_.height_ = value;
+  return _impl_.id_.Mutable(GetArenaForAllocation());
 }
-inline void VrfData::set_height(uint64_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:VrfData.height)
+inline std::string* BuildBlockBroadcastMsg::release_id() {
+  // @@protoc_insertion_point(field_release:BuildBlockBroadcastMsg.id)
+  return _impl_.id_.Release();
+}
+inline void BuildBlockBroadcastMsg::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:BuildBlockBroadcastMsg.id)
 }
 
-// string targetAddr = 5;
-inline void VrfData::clear_targetaddr() {
-  _impl_.targetaddr_.ClearToEmpty();
+// bytes blockRaw = 3;
+inline void BuildBlockBroadcastMsg::clear_blockraw() {
+  _impl_.blockraw_.ClearToEmpty();
 }
-inline const std::string& VrfData::targetaddr() const {
-  // @@protoc_insertion_point(field_get:VrfData.targetAddr)
-  return _internal_targetaddr();
+inline const std::string& BuildBlockBroadcastMsg::blockraw() const {
+  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.blockRaw)
+  return _internal_blockraw();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void VrfData::set_targetaddr(ArgT0&& arg0, ArgT... args) {
+void BuildBlockBroadcastMsg::set_blockraw(ArgT0&& arg0, ArgT... args) {
  
- _impl_.targetaddr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:VrfData.targetAddr)
+ _impl_.blockraw_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.blockRaw)
 }
-inline std::string* VrfData::mutable_targetaddr() {
-  std::string* _s = _internal_mutable_targetaddr();
-  // @@protoc_insertion_point(field_mutable:VrfData.targetAddr)
+inline std::string* BuildBlockBroadcastMsg::mutable_blockraw() {
+  std::string* _s = _internal_mutable_blockraw();
+  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.blockRaw)
   return _s;
 }
-inline const std::string& VrfData::_internal_targetaddr() const {
-  return _impl_.targetaddr_.Get();
+inline const std::string& BuildBlockBroadcastMsg::_internal_blockraw() const {
+  return _impl_.blockraw_.Get();
 }
-inline void VrfData::_internal_set_targetaddr(const std::string& value) {
+inline void BuildBlockBroadcastMsg::_internal_set_blockraw(const std::string& value) {
   
-  _impl_.targetaddr_.Set(value, GetArenaForAllocation());
+  _impl_.blockraw_.Set(value, GetArenaForAllocation());
 }
-inline std::string* VrfData::_internal_mutable_targetaddr() {
+inline std::string* BuildBlockBroadcastMsg::_internal_mutable_blockraw() {
   
-  return _impl_.targetaddr_.Mutable(GetArenaForAllocation());
+  return _impl_.blockraw_.Mutable(GetArenaForAllocation());
 }
-inline std::string* VrfData::release_targetaddr() {
-  // @@protoc_insertion_point(field_release:VrfData.targetAddr)
-  return _impl_.targetaddr_.Release();
+inline std::string* BuildBlockBroadcastMsg::release_blockraw() {
+  // @@protoc_insertion_point(field_release:BuildBlockBroadcastMsg.blockRaw)
+  return _impl_.blockraw_.Release();
 }
-inline void VrfData::set_allocated_targetaddr(std::string* targetaddr) {
-  if (targetaddr != nullptr) {
+inline void BuildBlockBroadcastMsg::set_allocated_blockraw(std::string* blockraw) {
+  if (blockraw != nullptr) {
     
   } else {
     
   }
-  _impl_.targetaddr_.SetAllocated(targetaddr, GetArenaForAllocation());
+  _impl_.blockraw_.SetAllocated(blockraw, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.targetaddr_.IsDefault()) {
-    _impl_.targetaddr_.Set("", GetArenaForAllocation());
+  if (_impl_.blockraw_.IsDefault()) {
+    _impl_.blockraw_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:VrfData.targetAddr)
+  // @@protoc_insertion_point(field_set_allocated:BuildBlockBroadcastMsg.blockRaw)
 }
 
-// repeated string vrfList = 6;
-inline int VrfData::_internal_vrflist_size() const {
-  return _impl_.vrflist_.size();
+// int32 flag = 4;
+inline void BuildBlockBroadcastMsg::clear_flag() {
+  _impl_.flag_ = 0;
 }
-inline int VrfData::vrflist_size() const {
-  return _internal_vrflist_size();
+inline int32_t BuildBlockBroadcastMsg::_internal_flag() const {
+  return _impl_.flag_;
 }
-inline void VrfData::clear_vrflist() {
-  _impl_.vrflist_.Clear();
+inline int32_t BuildBlockBroadcastMsg::flag() const {
+  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.flag)
+  return _internal_flag();
 }
-inline std::string* VrfData::add_vrflist() {
-  std::string* _s = _internal_add_vrflist();
-  // @@protoc_insertion_point(field_add_mutable:VrfData.vrfList)
+inline void BuildBlockBroadcastMsg::_internal_set_flag(int32_t value) {
+  
+  _impl_.flag_ = value;
+}
+inline void BuildBlockBroadcastMsg::set_flag(int32_t value) {
+  _internal_set_flag(value);
+  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.flag)
+}
+
+// int32 type = 5;
+inline void BuildBlockBroadcastMsg::clear_type() {
+  _impl_.type_ = 0;
+}
+inline int32_t BuildBlockBroadcastMsg::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t BuildBlockBroadcastMsg::type() const {
+  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.type)
+  return _internal_type();
+}
+inline void BuildBlockBroadcastMsg::_internal_set_type(int32_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void BuildBlockBroadcastMsg::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.type)
+}
+
+// repeated string castAddrs = 6;
+inline int BuildBlockBroadcastMsg::_internal_castaddrs_size() const {
+  return _impl_.castaddrs_.size();
+}
+inline int BuildBlockBroadcastMsg::castaddrs_size() const {
+  return _internal_castaddrs_size();
+}
+inline void BuildBlockBroadcastMsg::clear_castaddrs() {
+  _impl_.castaddrs_.Clear();
+}
+inline std::string* BuildBlockBroadcastMsg::add_castaddrs() {
+  std::string* _s = _internal_add_castaddrs();
+  // @@protoc_insertion_point(field_add_mutable:BuildBlockBroadcastMsg.castAddrs)
   return _s;
 }
-inline const std::string& VrfData::_internal_vrflist(int index) const {
-  return _impl_.vrflist_.Get(index);
+inline const std::string& BuildBlockBroadcastMsg::_internal_castaddrs(int index) const {
+  return _impl_.castaddrs_.Get(index);
 }
-inline const std::string& VrfData::vrflist(int index) const {
-  // @@protoc_insertion_point(field_get:VrfData.vrfList)
-  return _internal_vrflist(index);
+inline const std::string& BuildBlockBroadcastMsg::castaddrs(int index) const {
+  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.castAddrs)
+  return _internal_castaddrs(index);
 }
-inline std::string* VrfData::mutable_vrflist(int index) {
-  // @@protoc_insertion_point(field_mutable:VrfData.vrfList)
-  return _impl_.vrflist_.Mutable(index);
+inline std::string* BuildBlockBroadcastMsg::mutable_castaddrs(int index) {
+  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.castAddrs)
+  return _impl_.castaddrs_.Mutable(index);
 }
-inline void VrfData::set_vrflist(int index, const std::string& value) {
-  _impl_.vrflist_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:VrfData.vrfList)
+inline void BuildBlockBroadcastMsg::set_castaddrs(int index, const std::string& value) {
+  _impl_.castaddrs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.castAddrs)
 }
-inline void VrfData::set_vrflist(int index, std::string&& value) {
-  _impl_.vrflist_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:VrfData.vrfList)
+inline void BuildBlockBroadcastMsg::set_castaddrs(int index, std::string&& value) {
+  _impl_.castaddrs_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.castAddrs)
 }
-inline void VrfData::set_vrflist(int index, const char* value) {
+inline void BuildBlockBroadcastMsg::set_castaddrs(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.vrflist_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:VrfData.vrfList)
+  _impl_.castaddrs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:BuildBlockBroadcastMsg.castAddrs)
 }
-inline void VrfData::set_vrflist(int index, const char* value, size_t size) {
-  _impl_.vrflist_.Mutable(index)->assign(
+inline void BuildBlockBroadcastMsg::set_castaddrs(int index, const char* value, size_t size) {
+  _impl_.castaddrs_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:VrfData.vrfList)
+  // @@protoc_insertion_point(field_set_pointer:BuildBlockBroadcastMsg.castAddrs)
 }
-inline std::string* VrfData::_internal_add_vrflist() {
-  return _impl_.vrflist_.Add();
+inline std::string* BuildBlockBroadcastMsg::_internal_add_castaddrs() {
+  return _impl_.castaddrs_.Add();
 }
-inline void VrfData::add_vrflist(const std::string& value) {
-  _impl_.vrflist_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:VrfData.vrfList)
+inline void BuildBlockBroadcastMsg::add_castaddrs(const std::string& value) {
+  _impl_.castaddrs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:BuildBlockBroadcastMsg.castAddrs)
 }
-inline void VrfData::add_vrflist(std::string&& value) {
-  _impl_.vrflist_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:VrfData.vrfList)
+inline void BuildBlockBroadcastMsg::add_castaddrs(std::string&& value) {
+  _impl_.castaddrs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:BuildBlockBroadcastMsg.castAddrs)
 }
-inline void VrfData::add_vrflist(const char* value) {
+inline void BuildBlockBroadcastMsg::add_castaddrs(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.vrflist_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:VrfData.vrfList)
+  _impl_.castaddrs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:BuildBlockBroadcastMsg.castAddrs)
 }
-inline void VrfData::add_vrflist(const char* value, size_t size) {
-  _impl_.vrflist_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:VrfData.vrfList)
+inline void BuildBlockBroadcastMsg::add_castaddrs(const char* value, size_t size) {
+  _impl_.castaddrs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:BuildBlockBroadcastMsg.castAddrs)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-VrfData::vrflist() const {
-  // @@protoc_insertion_point(field_list:VrfData.vrfList)
-  return _impl_.vrflist_;
+BuildBlockBroadcastMsg::castaddrs() const {
+  // @@protoc_insertion_point(field_list:BuildBlockBroadcastMsg.castAddrs)
+  return _impl_.castaddrs_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-VrfData::mutable_vrflist() {
-  // @@protoc_insertion_point(field_mutable_list:VrfData.vrfList)
-  return &_impl_.vrflist_;
+BuildBlockBroadcastMsg::mutable_castaddrs() {
+  // @@protoc_insertion_point(field_mutable_list:BuildBlockBroadcastMsg.castAddrs)
+  return &_impl_.castaddrs_;
 }
 
-// string txvrfinfohash = 7;
-inline void VrfData::clear_txvrfinfohash() {
-  _impl_.txvrfinfohash_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// ContractTxMsgReq
+
+// string version = 1;
+inline void ContractTxMsgReq::clear_version() {
+  _impl_.version_.ClearToEmpty();
 }
-inline const std::string& VrfData::txvrfinfohash() const {
-  // @@protoc_insertion_point(field_get:VrfData.txvrfinfohash)
-  return _internal_txvrfinfohash();
+inline const std::string& ContractTxMsgReq::version() const {
+  // @@protoc_insertion_point(field_get:ContractTxMsgReq.version)
+  return _internal_version();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void VrfData::set_txvrfinfohash(ArgT0&& arg0, ArgT... args) {
+void ContractTxMsgReq::set_version(ArgT0&& arg0, ArgT... args) {
  
- _impl_.txvrfinfohash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:VrfData.txvrfinfohash)
+ _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ContractTxMsgReq.version)
 }
-inline std::string* VrfData::mutable_txvrfinfohash() {
-  std::string* _s = _internal_mutable_txvrfinfohash();
-  // @@protoc_insertion_point(field_mutable:VrfData.txvrfinfohash)
+inline std::string* ContractTxMsgReq::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:ContractTxMsgReq.version)
   return _s;
 }
-inline const std::string& VrfData::_internal_txvrfinfohash() const {
-  return _impl_.txvrfinfohash_.Get();
+inline const std::string& ContractTxMsgReq::_internal_version() const {
+  return _impl_.version_.Get();
 }
-inline void VrfData::_internal_set_txvrfinfohash(const std::string& value) {
+inline void ContractTxMsgReq::_internal_set_version(const std::string& value) {
   
-  _impl_.txvrfinfohash_.Set(value, GetArenaForAllocation());
+  _impl_.version_.Set(value, GetArenaForAllocation());
 }
-inline std::string* VrfData::_internal_mutable_txvrfinfohash() {
+inline std::string* ContractTxMsgReq::_internal_mutable_version() {
   
-  return _impl_.txvrfinfohash_.Mutable(GetArenaForAllocation());
+  return _impl_.version_.Mutable(GetArenaForAllocation());
 }
-inline std::string* VrfData::release_txvrfinfohash() {
-  // @@protoc_insertion_point(field_release:VrfData.txvrfinfohash)
-  return _impl_.txvrfinfohash_.Release();
+inline std::string* ContractTxMsgReq::release_version() {
+  // @@protoc_insertion_point(field_release:ContractTxMsgReq.version)
+  return _impl_.version_.Release();
 }
-inline void VrfData::set_allocated_txvrfinfohash(std::string* txvrfinfohash) {
-  if (txvrfinfohash != nullptr) {
+inline void ContractTxMsgReq::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
     
   } else {
     
   }
-  _impl_.txvrfinfohash_.SetAllocated(txvrfinfohash, GetArenaForAllocation());
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.txvrfinfohash_.IsDefault()) {
-    _impl_.txvrfinfohash_.Set("", GetArenaForAllocation());
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:VrfData.txvrfinfohash)
+  // @@protoc_insertion_point(field_set_allocated:ContractTxMsgReq.version)
 }
 
-// -------------------------------------------------------------------
-
-// Vrf
-
-// .VrfData vrfdata = 1;
-inline bool Vrf::_internal_has_vrfdata() const {
-  return this != internal_default_instance() && _impl_.vrfdata_ != nullptr;
+// .TxMsgReq txMsgReq = 2;
+inline bool ContractTxMsgReq::_internal_has_txmsgreq() const {
+  return this != internal_default_instance() && _impl_.txmsgreq_ != nullptr;
 }
-inline bool Vrf::has_vrfdata() const {
-  return _internal_has_vrfdata();
+inline bool ContractTxMsgReq::has_txmsgreq() const {
+  return _internal_has_txmsgreq();
 }
-inline void Vrf::clear_vrfdata() {
-  if (GetArenaForAllocation() == nullptr && _impl_.vrfdata_ != nullptr) {
-    delete _impl_.vrfdata_;
+inline void ContractTxMsgReq::clear_txmsgreq() {
+  if (GetArenaForAllocation() == nullptr && _impl_.txmsgreq_ != nullptr) {
+    delete _impl_.txmsgreq_;
   }
-  _impl_.vrfdata_ = nullptr;
+  _impl_.txmsgreq_ = nullptr;
 }
-inline const ::VrfData& Vrf::_internal_vrfdata() const {
-  const ::VrfData* p = _impl_.vrfdata_;
-  return p != nullptr ? *p : reinterpret_cast<const ::VrfData&>(
-      ::_VrfData_default_instance_);
+inline const ::TxMsgReq& ContractTxMsgReq::_internal_txmsgreq() const {
+  const ::TxMsgReq* p = _impl_.txmsgreq_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TxMsgReq&>(
+      ::_TxMsgReq_default_instance_);
 }
-inline const ::VrfData& Vrf::vrfdata() const {
-  // @@protoc_insertion_point(field_get:Vrf.vrfdata)
-  return _internal_vrfdata();
+inline const ::TxMsgReq& ContractTxMsgReq::txmsgreq() const {
+  // @@protoc_insertion_point(field_get:ContractTxMsgReq.txMsgReq)
+  return _internal_txmsgreq();
 }
-inline void Vrf::unsafe_arena_set_allocated_vrfdata(
-    ::VrfData* vrfdata) {
+inline void ContractTxMsgReq::unsafe_arena_set_allocated_txmsgreq(
+    ::TxMsgReq* txmsgreq) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfdata_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txmsgreq_);
   }
-  _impl_.vrfdata_ = vrfdata;
-  if (vrfdata) {
+  _impl_.txmsgreq_ = txmsgreq;
+  if (txmsgreq) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Vrf.vrfdata)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ContractTxMsgReq.txMsgReq)
 }
-inline ::VrfData* Vrf::release_vrfdata() {
+inline ::TxMsgReq* ContractTxMsgReq::release_txmsgreq() {
   
-  ::VrfData* temp = _impl_.vrfdata_;
-  _impl_.vrfdata_ = nullptr;
+  ::TxMsgReq* temp = _impl_.txmsgreq_;
+  _impl_.txmsgreq_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3615,79 +5271,133 @@ inline ::VrfData* Vrf::release_vrfdata() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::VrfData* Vrf::unsafe_arena_release_vrfdata() {
-  // @@protoc_insertion_point(field_release:Vrf.vrfdata)
+inline ::TxMsgReq* ContractTxMsgReq::unsafe_arena_release_txmsgreq() {
+  // @@protoc_insertion_point(field_release:ContractTxMsgReq.txMsgReq)
   
-  ::VrfData* temp = _impl_.vrfdata_;
-  _impl_.vrfdata_ = nullptr;
+  ::TxMsgReq* temp = _impl_.txmsgreq_;
+  _impl_.txmsgreq_ = nullptr;
   return temp;
 }
-inline ::VrfData* Vrf::_internal_mutable_vrfdata() {
+inline ::TxMsgReq* ContractTxMsgReq::_internal_mutable_txmsgreq() {
   
-  if (_impl_.vrfdata_ == nullptr) {
-    auto* p = CreateMaybeMessage<::VrfData>(GetArenaForAllocation());
-    _impl_.vrfdata_ = p;
+  if (_impl_.txmsgreq_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TxMsgReq>(GetArenaForAllocation());
+    _impl_.txmsgreq_ = p;
   }
-  return _impl_.vrfdata_;
+  return _impl_.txmsgreq_;
 }
-inline ::VrfData* Vrf::mutable_vrfdata() {
-  ::VrfData* _msg = _internal_mutable_vrfdata();
-  // @@protoc_insertion_point(field_mutable:Vrf.vrfdata)
+inline ::TxMsgReq* ContractTxMsgReq::mutable_txmsgreq() {
+  ::TxMsgReq* _msg = _internal_mutable_txmsgreq();
+  // @@protoc_insertion_point(field_mutable:ContractTxMsgReq.txMsgReq)
   return _msg;
 }
-inline void Vrf::set_allocated_vrfdata(::VrfData* vrfdata) {
+inline void ContractTxMsgReq::set_allocated_txmsgreq(::TxMsgReq* txmsgreq) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.vrfdata_;
+    delete _impl_.txmsgreq_;
   }
-  if (vrfdata) {
+  if (txmsgreq) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vrfdata);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txmsgreq);
     if (message_arena != submessage_arena) {
-      vrfdata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, vrfdata, submessage_arena);
+      txmsgreq = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, txmsgreq, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.vrfdata_ = vrfdata;
-  // @@protoc_insertion_point(field_set_allocated:Vrf.vrfdata)
+  _impl_.txmsgreq_ = txmsgreq;
+  // @@protoc_insertion_point(field_set_allocated:ContractTxMsgReq.txMsgReq)
 }
 
-// .CSign Vrfsign = 2;
-inline bool Vrf::_internal_has_vrfsign() const {
-  return this != internal_default_instance() && _impl_.vrfsign_ != nullptr;
+// -------------------------------------------------------------------
+
+// ContractPackagerMsg
+
+// string version = 1;
+inline void ContractPackagerMsg::clear_version() {
+  _impl_.version_.ClearToEmpty();
 }
-inline bool Vrf::has_vrfsign() const {
-  return _internal_has_vrfsign();
+inline const std::string& ContractPackagerMsg::version() const {
+  // @@protoc_insertion_point(field_get:ContractPackagerMsg.version)
+  return _internal_version();
 }
-inline const ::CSign& Vrf::_internal_vrfsign() const {
-  const ::CSign* p = _impl_.vrfsign_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ContractPackagerMsg::set_version(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ContractPackagerMsg.version)
+}
+inline std::string* ContractPackagerMsg::mutable_version() {
+  std::string* _s = _internal_mutable_version();
+  // @@protoc_insertion_point(field_mutable:ContractPackagerMsg.version)
+  return _s;
+}
+inline const std::string& ContractPackagerMsg::_internal_version() const {
+  return _impl_.version_.Get();
+}
+inline void ContractPackagerMsg::_internal_set_version(const std::string& value) {
+  
+  _impl_.version_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ContractPackagerMsg::_internal_mutable_version() {
+  
+  return _impl_.version_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ContractPackagerMsg::release_version() {
+  // @@protoc_insertion_point(field_release:ContractPackagerMsg.version)
+  return _impl_.version_.Release();
+}
+inline void ContractPackagerMsg::set_allocated_version(std::string* version) {
+  if (version != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.version_.IsDefault()) {
+    _impl_.version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ContractPackagerMsg.version)
+}
+
+// .CSign sign = 2;
+inline bool ContractPackagerMsg::_internal_has_sign() const {
+  return this != internal_default_instance() && _impl_.sign_ != nullptr;
+}
+inline bool ContractPackagerMsg::has_sign() const {
+  return _internal_has_sign();
+}
+inline const ::CSign& ContractPackagerMsg::_internal_sign() const {
+  const ::CSign* p = _impl_.sign_;
   return p != nullptr ? *p : reinterpret_cast<const ::CSign&>(
       ::_CSign_default_instance_);
 }
-inline const ::CSign& Vrf::vrfsign() const {
-  // @@protoc_insertion_point(field_get:Vrf.Vrfsign)
-  return _internal_vrfsign();
+inline const ::CSign& ContractPackagerMsg::sign() const {
+  // @@protoc_insertion_point(field_get:ContractPackagerMsg.sign)
+  return _internal_sign();
 }
-inline void Vrf::unsafe_arena_set_allocated_vrfsign(
-    ::CSign* vrfsign) {
+inline void ContractPackagerMsg::unsafe_arena_set_allocated_sign(
+    ::CSign* sign) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
   }
-  _impl_.vrfsign_ = vrfsign;
-  if (vrfsign) {
+  _impl_.sign_ = sign;
+  if (sign) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Vrf.Vrfsign)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ContractPackagerMsg.sign)
 }
-inline ::CSign* Vrf::release_vrfsign() {
+inline ::CSign* ContractPackagerMsg::release_sign() {
   
-  ::CSign* temp = _impl_.vrfsign_;
-  _impl_.vrfsign_ = nullptr;
+  ::CSign* temp = _impl_.sign_;
+  _impl_.sign_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3699,340 +5409,256 @@ inline ::CSign* Vrf::release_vrfsign() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::CSign* Vrf::unsafe_arena_release_vrfsign() {
-  // @@protoc_insertion_point(field_release:Vrf.Vrfsign)
+inline ::CSign* ContractPackagerMsg::unsafe_arena_release_sign() {
+  // @@protoc_insertion_point(field_release:ContractPackagerMsg.sign)
   
-  ::CSign* temp = _impl_.vrfsign_;
-  _impl_.vrfsign_ = nullptr;
+  ::CSign* temp = _impl_.sign_;
+  _impl_.sign_ = nullptr;
   return temp;
 }
-inline ::CSign* Vrf::_internal_mutable_vrfsign() {
+inline ::CSign* ContractPackagerMsg::_internal_mutable_sign() {
   
-  if (_impl_.vrfsign_ == nullptr) {
+  if (_impl_.sign_ == nullptr) {
     auto* p = CreateMaybeMessage<::CSign>(GetArenaForAllocation());
-    _impl_.vrfsign_ = p;
-  }
-  return _impl_.vrfsign_;
-}
-inline ::CSign* Vrf::mutable_vrfsign() {
-  ::CSign* _msg = _internal_mutable_vrfsign();
-  // @@protoc_insertion_point(field_mutable:Vrf.Vrfsign)
-  return _msg;
-}
-inline void Vrf::set_allocated_vrfsign(::CSign* vrfsign) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
-  }
-  if (vrfsign) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(vrfsign));
-    if (message_arena != submessage_arena) {
-      vrfsign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, vrfsign, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.vrfsign_ = vrfsign;
-  // @@protoc_insertion_point(field_set_allocated:Vrf.Vrfsign)
-}
-
-// -------------------------------------------------------------------
-
-// VRFBlockInfo
-
-// string blockHash = 1;
-inline void VRFBlockInfo::clear_blockhash() {
-  _impl_.blockhash_.ClearToEmpty();
-}
-inline const std::string& VRFBlockInfo::blockhash() const {
-  // @@protoc_insertion_point(field_get:VRFBlockInfo.blockHash)
-  return _internal_blockhash();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void VRFBlockInfo::set_blockhash(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.blockhash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:VRFBlockInfo.blockHash)
-}
-inline std::string* VRFBlockInfo::mutable_blockhash() {
-  std::string* _s = _internal_mutable_blockhash();
-  // @@protoc_insertion_point(field_mutable:VRFBlockInfo.blockHash)
-  return _s;
-}
-inline const std::string& VRFBlockInfo::_internal_blockhash() const {
-  return _impl_.blockhash_.Get();
-}
-inline void VRFBlockInfo::_internal_set_blockhash(const std::string& value) {
-  
-  _impl_.blockhash_.Set(value, GetArenaForAllocation());
-}
-inline std::string* VRFBlockInfo::_internal_mutable_blockhash() {
-  
-  return _impl_.blockhash_.Mutable(GetArenaForAllocation());
+    _impl_.sign_ = p;
+  }
+  return _impl_.sign_;
 }
-inline std::string* VRFBlockInfo::release_blockhash() {
-  // @@protoc_insertion_point(field_release:VRFBlockInfo.blockHash)
-  return _impl_.blockhash_.Release();
+inline ::CSign* ContractPackagerMsg::mutable_sign() {
+  ::CSign* _msg = _internal_mutable_sign();
+  // @@protoc_insertion_point(field_mutable:ContractPackagerMsg.sign)
+  return _msg;
 }
-inline void VRFBlockInfo::set_allocated_blockhash(std::string* blockhash) {
-  if (blockhash != nullptr) {
+inline void ContractPackagerMsg::set_allocated_sign(::CSign* sign) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
+  }
+  if (sign) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sign));
+    if (message_arena != submessage_arena) {
+      sign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sign, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.blockhash_.SetAllocated(blockhash, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.blockhash_.IsDefault()) {
-    _impl_.blockhash_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:VRFBlockInfo.blockHash)
+  _impl_.sign_ = sign;
+  // @@protoc_insertion_point(field_set_allocated:ContractPackagerMsg.sign)
 }
 
-// uint64 height = 2;
-inline void VRFBlockInfo::clear_height() {
-  _impl_.height_ = uint64_t{0u};
+// repeated .TxMsgReq txMsgReq = 3;
+inline int ContractPackagerMsg::_internal_txmsgreq_size() const {
+  return _impl_.txmsgreq_.size();
 }
-inline uint64_t VRFBlockInfo::_internal_height() const {
-  return _impl_.height_;
+inline int ContractPackagerMsg::txmsgreq_size() const {
+  return _internal_txmsgreq_size();
 }
-inline uint64_t VRFBlockInfo::height() const {
-  // @@protoc_insertion_point(field_get:VRFBlockInfo.height)
-  return _internal_height();
+inline void ContractPackagerMsg::clear_txmsgreq() {
+  _impl_.txmsgreq_.Clear();
 }
-inline void VRFBlockInfo::_internal_set_height(uint64_t value) {
-  
-  _impl_.height_ = value;
+inline ::TxMsgReq* ContractPackagerMsg::mutable_txmsgreq(int index) {
+  // @@protoc_insertion_point(field_mutable:ContractPackagerMsg.txMsgReq)
+  return _impl_.txmsgreq_.Mutable(index);
 }
-inline void VRFBlockInfo::set_height(uint64_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:VRFBlockInfo.height)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TxMsgReq >*
+ContractPackagerMsg::mutable_txmsgreq() {
+  // @@protoc_insertion_point(field_mutable_list:ContractPackagerMsg.txMsgReq)
+  return &_impl_.txmsgreq_;
+}
+inline const ::TxMsgReq& ContractPackagerMsg::_internal_txmsgreq(int index) const {
+  return _impl_.txmsgreq_.Get(index);
+}
+inline const ::TxMsgReq& ContractPackagerMsg::txmsgreq(int index) const {
+  // @@protoc_insertion_point(field_get:ContractPackagerMsg.txMsgReq)
+  return _internal_txmsgreq(index);
+}
+inline ::TxMsgReq* ContractPackagerMsg::_internal_add_txmsgreq() {
+  return _impl_.txmsgreq_.Add();
+}
+inline ::TxMsgReq* ContractPackagerMsg::add_txmsgreq() {
+  ::TxMsgReq* _add = _internal_add_txmsgreq();
+  // @@protoc_insertion_point(field_add:ContractPackagerMsg.txMsgReq)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TxMsgReq >&
+ContractPackagerMsg::txmsgreq() const {
+  // @@protoc_insertion_point(field_list:ContractPackagerMsg.txMsgReq)
+  return _impl_.txmsgreq_;
 }
 
 // -------------------------------------------------------------------
 
-// VRFConsensusInfo
+// ContractDependencyBroadcastMsg_DependencyInfo
 
-// string vrfSeed = 1;
-inline void VRFConsensusInfo::clear_vrfseed() {
-  _impl_.vrfseed_.ClearToEmpty();
+// string dependencyAddress = 1;
+inline void ContractDependencyBroadcastMsg_DependencyInfo::clear_dependencyaddress() {
+  _impl_.dependencyaddress_.ClearToEmpty();
 }
-inline const std::string& VRFConsensusInfo::vrfseed() const {
-  // @@protoc_insertion_point(field_get:VRFConsensusInfo.vrfSeed)
-  return _internal_vrfseed();
+inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::dependencyaddress() const {
+  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
+  return _internal_dependencyaddress();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void VRFConsensusInfo::set_vrfseed(ArgT0&& arg0, ArgT... args) {
+void ContractDependencyBroadcastMsg_DependencyInfo::set_dependencyaddress(ArgT0&& arg0, ArgT... args) {
  
- _impl_.vrfseed_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:VRFConsensusInfo.vrfSeed)
+ _impl_.dependencyaddress_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
 }
-inline std::string* VRFConsensusInfo::mutable_vrfseed() {
-  std::string* _s = _internal_mutable_vrfseed();
-  // @@protoc_insertion_point(field_mutable:VRFConsensusInfo.vrfSeed)
+inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::mutable_dependencyaddress() {
+  std::string* _s = _internal_mutable_dependencyaddress();
+  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
   return _s;
 }
-inline const std::string& VRFConsensusInfo::_internal_vrfseed() const {
-  return _impl_.vrfseed_.Get();
+inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::_internal_dependencyaddress() const {
+  return _impl_.dependencyaddress_.Get();
 }
-inline void VRFConsensusInfo::_internal_set_vrfseed(const std::string& value) {
+inline void ContractDependencyBroadcastMsg_DependencyInfo::_internal_set_dependencyaddress(const std::string& value) {
   
-  _impl_.vrfseed_.Set(value, GetArenaForAllocation());
+  _impl_.dependencyaddress_.Set(value, GetArenaForAllocation());
 }
-inline std::string* VRFConsensusInfo::_internal_mutable_vrfseed() {
+inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::_internal_mutable_dependencyaddress() {
   
-  return _impl_.vrfseed_.Mutable(GetArenaForAllocation());
+  return _impl_.dependencyaddress_.Mutable(GetArenaForAllocation());
 }
-inline std::string* VRFConsensusInfo::release_vrfseed() {
-  // @@protoc_insertion_point(field_release:VRFConsensusInfo.vrfSeed)
-  return _impl_.vrfseed_.Release();
+inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::release_dependencyaddress() {
+  // @@protoc_insertion_point(field_release:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
+  return _impl_.dependencyaddress_.Release();
 }
-inline void VRFConsensusInfo::set_allocated_vrfseed(std::string* vrfseed) {
-  if (vrfseed != nullptr) {
+inline void ContractDependencyBroadcastMsg_DependencyInfo::set_allocated_dependencyaddress(std::string* dependencyaddress) {
+  if (dependencyaddress != nullptr) {
     
   } else {
     
   }
-  _impl_.vrfseed_.SetAllocated(vrfseed, GetArenaForAllocation());
+  _impl_.dependencyaddress_.SetAllocated(dependencyaddress, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.vrfseed_.IsDefault()) {
-    _impl_.vrfseed_.Set("", GetArenaForAllocation());
+  if (_impl_.dependencyaddress_.IsDefault()) {
+    _impl_.dependencyaddress_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:VRFConsensusInfo.vrfSeed)
+  // @@protoc_insertion_point(field_set_allocated:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
 }
 
-// repeated .VRFBlockInfo blockinfo = 2;
-inline int VRFConsensusInfo::_internal_blockinfo_size() const {
-  return _impl_.blockinfo_.size();
-}
-inline int VRFConsensusInfo::blockinfo_size() const {
-  return _internal_blockinfo_size();
-}
-inline void VRFConsensusInfo::clear_blockinfo() {
-  _impl_.blockinfo_.Clear();
+// repeated string txHashes = 2;
+inline int ContractDependencyBroadcastMsg_DependencyInfo::_internal_txhashes_size() const {
+  return _impl_.txhashes_.size();
 }
-inline ::VRFBlockInfo* VRFConsensusInfo::mutable_blockinfo(int index) {
-  // @@protoc_insertion_point(field_mutable:VRFConsensusInfo.blockinfo)
-  return _impl_.blockinfo_.Mutable(index);
+inline int ContractDependencyBroadcastMsg_DependencyInfo::txhashes_size() const {
+  return _internal_txhashes_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VRFBlockInfo >*
-VRFConsensusInfo::mutable_blockinfo() {
-  // @@protoc_insertion_point(field_mutable_list:VRFConsensusInfo.blockinfo)
-  return &_impl_.blockinfo_;
+inline void ContractDependencyBroadcastMsg_DependencyInfo::clear_txhashes() {
+  _impl_.txhashes_.Clear();
 }
-inline const ::VRFBlockInfo& VRFConsensusInfo::_internal_blockinfo(int index) const {
-  return _impl_.blockinfo_.Get(index);
+inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes() {
+  std::string* _s = _internal_add_txhashes();
+  // @@protoc_insertion_point(field_add_mutable:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+  return _s;
 }
-inline const ::VRFBlockInfo& VRFConsensusInfo::blockinfo(int index) const {
-  // @@protoc_insertion_point(field_get:VRFConsensusInfo.blockinfo)
-  return _internal_blockinfo(index);
+inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::_internal_txhashes(int index) const {
+  return _impl_.txhashes_.Get(index);
 }
-inline ::VRFBlockInfo* VRFConsensusInfo::_internal_add_blockinfo() {
-  return _impl_.blockinfo_.Add();
+inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::txhashes(int index) const {
+  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+  return _internal_txhashes(index);
 }
-inline ::VRFBlockInfo* VRFConsensusInfo::add_blockinfo() {
-  ::VRFBlockInfo* _add = _internal_add_blockinfo();
-  // @@protoc_insertion_point(field_add:VRFConsensusInfo.blockinfo)
-  return _add;
+inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::mutable_txhashes(int index) {
+  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+  return _impl_.txhashes_.Mutable(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VRFBlockInfo >&
-VRFConsensusInfo::blockinfo() const {
-  // @@protoc_insertion_point(field_list:VRFConsensusInfo.blockinfo)
-  return _impl_.blockinfo_;
+inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, const std::string& value) {
+  _impl_.txhashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-
-// .CSign Vrfsign = 3;
-inline bool VRFConsensusInfo::_internal_has_vrfsign() const {
-  return this != internal_default_instance() && _impl_.vrfsign_ != nullptr;
+inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, std::string&& value) {
+  _impl_.txhashes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-inline bool VRFConsensusInfo::has_vrfsign() const {
-  return _internal_has_vrfsign();
+inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.txhashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-inline const ::CSign& VRFConsensusInfo::_internal_vrfsign() const {
-  const ::CSign* p = _impl_.vrfsign_;
-  return p != nullptr ? *p : reinterpret_cast<const ::CSign&>(
-      ::_CSign_default_instance_);
+inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, const char* value, size_t size) {
+  _impl_.txhashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-inline const ::CSign& VRFConsensusInfo::vrfsign() const {
-  // @@protoc_insertion_point(field_get:VRFConsensusInfo.Vrfsign)
-  return _internal_vrfsign();
+inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::_internal_add_txhashes() {
+  return _impl_.txhashes_.Add();
 }
-inline void VRFConsensusInfo::unsafe_arena_set_allocated_vrfsign(
-    ::CSign* vrfsign) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
-  }
-  _impl_.vrfsign_ = vrfsign;
-  if (vrfsign) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:VRFConsensusInfo.Vrfsign)
+inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(const std::string& value) {
+  _impl_.txhashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-inline ::CSign* VRFConsensusInfo::release_vrfsign() {
-  
-  ::CSign* temp = _impl_.vrfsign_;
-  _impl_.vrfsign_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(std::string&& value) {
+  _impl_.txhashes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-inline ::CSign* VRFConsensusInfo::unsafe_arena_release_vrfsign() {
-  // @@protoc_insertion_point(field_release:VRFConsensusInfo.Vrfsign)
-  
-  ::CSign* temp = _impl_.vrfsign_;
-  _impl_.vrfsign_ = nullptr;
-  return temp;
+inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.txhashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-inline ::CSign* VRFConsensusInfo::_internal_mutable_vrfsign() {
-  
-  if (_impl_.vrfsign_ == nullptr) {
-    auto* p = CreateMaybeMessage<::CSign>(GetArenaForAllocation());
-    _impl_.vrfsign_ = p;
-  }
-  return _impl_.vrfsign_;
+inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(const char* value, size_t size) {
+  _impl_.txhashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
 }
-inline ::CSign* VRFConsensusInfo::mutable_vrfsign() {
-  ::CSign* _msg = _internal_mutable_vrfsign();
-  // @@protoc_insertion_point(field_mutable:VRFConsensusInfo.Vrfsign)
-  return _msg;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ContractDependencyBroadcastMsg_DependencyInfo::txhashes() const {
+  // @@protoc_insertion_point(field_list:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+  return _impl_.txhashes_;
 }
-inline void VRFConsensusInfo::set_allocated_vrfsign(::CSign* vrfsign) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vrfsign_);
-  }
-  if (vrfsign) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(vrfsign));
-    if (message_arena != submessage_arena) {
-      vrfsign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, vrfsign, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.vrfsign_ = vrfsign;
-  // @@protoc_insertion_point(field_set_allocated:VRFConsensusInfo.Vrfsign)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ContractDependencyBroadcastMsg_DependencyInfo::mutable_txhashes() {
+  // @@protoc_insertion_point(field_mutable_list:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+  return &_impl_.txhashes_;
 }
 
 // -------------------------------------------------------------------
 
-// TxMsgAck
+// ContractDependencyBroadcastMsg
 
 // string version = 1;
-inline void TxMsgAck::clear_version() {
+inline void ContractDependencyBroadcastMsg::clear_version() {
   _impl_.version_.ClearToEmpty();
 }
-inline const std::string& TxMsgAck::version() const {
-  // @@protoc_insertion_point(field_get:TxMsgAck.version)
+inline const std::string& ContractDependencyBroadcastMsg::version() const {
+  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.version)
   return _internal_version();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void TxMsgAck::set_version(ArgT0&& arg0, ArgT... args) {
+void ContractDependencyBroadcastMsg::set_version(ArgT0&& arg0, ArgT... args) {
  
  _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TxMsgAck.version)
+  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.version)
 }
-inline std::string* TxMsgAck::mutable_version() {
+inline std::string* ContractDependencyBroadcastMsg::mutable_version() {
   std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:TxMsgAck.version)
+  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.version)
   return _s;
 }
-inline const std::string& TxMsgAck::_internal_version() const {
+inline const std::string& ContractDependencyBroadcastMsg::_internal_version() const {
   return _impl_.version_.Get();
 }
-inline void TxMsgAck::_internal_set_version(const std::string& value) {
+inline void ContractDependencyBroadcastMsg::_internal_set_version(const std::string& value) {
   
   _impl_.version_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TxMsgAck::_internal_mutable_version() {
+inline std::string* ContractDependencyBroadcastMsg::_internal_mutable_version() {
   
   return _impl_.version_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TxMsgAck::release_version() {
-  // @@protoc_insertion_point(field_release:TxMsgAck.version)
+inline std::string* ContractDependencyBroadcastMsg::release_version() {
+  // @@protoc_insertion_point(field_release:ContractDependencyBroadcastMsg.version)
   return _impl_.version_.Release();
 }
-inline void TxMsgAck::set_allocated_version(std::string* version) {
+inline void ContractDependencyBroadcastMsg::set_allocated_version(std::string* version) {
   if (version != nullptr) {
     
   } else {
@@ -4044,169 +5670,174 @@ inline void TxMsgAck::set_allocated_version(std::string* version) {
     _impl_.version_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TxMsgAck.version)
+  // @@protoc_insertion_point(field_set_allocated:ContractDependencyBroadcastMsg.version)
 }
 
-// int32 code = 2;
-inline void TxMsgAck::clear_code() {
-  _impl_.code_ = 0;
+// repeated .ContractDependencyBroadcastMsg.DependencyInfo dependencies = 2;
+inline int ContractDependencyBroadcastMsg::_internal_dependencies_size() const {
+  return _impl_.dependencies_.size();
 }
-inline int32_t TxMsgAck::_internal_code() const {
-  return _impl_.code_;
+inline int ContractDependencyBroadcastMsg::dependencies_size() const {
+  return _internal_dependencies_size();
 }
-inline int32_t TxMsgAck::code() const {
-  // @@protoc_insertion_point(field_get:TxMsgAck.code)
-  return _internal_code();
+inline void ContractDependencyBroadcastMsg::clear_dependencies() {
+  _impl_.dependencies_.Clear();
 }
-inline void TxMsgAck::_internal_set_code(int32_t value) {
-  
-  _impl_.code_ = value;
+inline ::ContractDependencyBroadcastMsg_DependencyInfo* ContractDependencyBroadcastMsg::mutable_dependencies(int index) {
+  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.dependencies)
+  return _impl_.dependencies_.Mutable(index);
 }
-inline void TxMsgAck::set_code(int32_t value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:TxMsgAck.code)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ContractDependencyBroadcastMsg_DependencyInfo >*
+ContractDependencyBroadcastMsg::mutable_dependencies() {
+  // @@protoc_insertion_point(field_mutable_list:ContractDependencyBroadcastMsg.dependencies)
+  return &_impl_.dependencies_;
 }
-
-// string message = 3;
-inline void TxMsgAck::clear_message() {
-  _impl_.message_.ClearToEmpty();
+inline const ::ContractDependencyBroadcastMsg_DependencyInfo& ContractDependencyBroadcastMsg::_internal_dependencies(int index) const {
+  return _impl_.dependencies_.Get(index);
 }
-inline const std::string& TxMsgAck::message() const {
-  // @@protoc_insertion_point(field_get:TxMsgAck.message)
-  return _internal_message();
+inline const ::ContractDependencyBroadcastMsg_DependencyInfo& ContractDependencyBroadcastMsg::dependencies(int index) const {
+  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.dependencies)
+  return _internal_dependencies(index);
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void TxMsgAck::set_message(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TxMsgAck.message)
+inline ::ContractDependencyBroadcastMsg_DependencyInfo* ContractDependencyBroadcastMsg::_internal_add_dependencies() {
+  return _impl_.dependencies_.Add();
 }
-inline std::string* TxMsgAck::mutable_message() {
-  std::string* _s = _internal_mutable_message();
-  // @@protoc_insertion_point(field_mutable:TxMsgAck.message)
-  return _s;
+inline ::ContractDependencyBroadcastMsg_DependencyInfo* ContractDependencyBroadcastMsg::add_dependencies() {
+  ::ContractDependencyBroadcastMsg_DependencyInfo* _add = _internal_add_dependencies();
+  // @@protoc_insertion_point(field_add:ContractDependencyBroadcastMsg.dependencies)
+  return _add;
 }
-inline const std::string& TxMsgAck::_internal_message() const {
-  return _impl_.message_.Get();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ContractDependencyBroadcastMsg_DependencyInfo >&
+ContractDependencyBroadcastMsg::dependencies() const {
+  // @@protoc_insertion_point(field_list:ContractDependencyBroadcastMsg.dependencies)
+  return _impl_.dependencies_;
 }
-inline void TxMsgAck::_internal_set_message(const std::string& value) {
-  
-  _impl_.message_.Set(value, GetArenaForAllocation());
+
+// .CSign sign = 3;
+inline bool ContractDependencyBroadcastMsg::_internal_has_sign() const {
+  return this != internal_default_instance() && _impl_.sign_ != nullptr;
 }
-inline std::string* TxMsgAck::_internal_mutable_message() {
-  
-  return _impl_.message_.Mutable(GetArenaForAllocation());
+inline bool ContractDependencyBroadcastMsg::has_sign() const {
+  return _internal_has_sign();
 }
-inline std::string* TxMsgAck::release_message() {
-  // @@protoc_insertion_point(field_release:TxMsgAck.message)
-  return _impl_.message_.Release();
+inline const ::CSign& ContractDependencyBroadcastMsg::_internal_sign() const {
+  const ::CSign* p = _impl_.sign_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CSign&>(
+      ::_CSign_default_instance_);
 }
-inline void TxMsgAck::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline const ::CSign& ContractDependencyBroadcastMsg::sign() const {
+  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.sign)
+  return _internal_sign();
+}
+inline void ContractDependencyBroadcastMsg::unsafe_arena_set_allocated_sign(
+    ::CSign* sign) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
+  }
+  _impl_.sign_ = sign;
+  if (sign) {
     
   } else {
     
   }
-  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.message_.IsDefault()) {
-    _impl_.message_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TxMsgAck.message)
-}
-
-// bytes tx = 4;
-inline void TxMsgAck::clear_tx() {
-  _impl_.tx_.ClearToEmpty();
-}
-inline const std::string& TxMsgAck::tx() const {
-  // @@protoc_insertion_point(field_get:TxMsgAck.tx)
-  return _internal_tx();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void TxMsgAck::set_tx(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.tx_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TxMsgAck.tx)
-}
-inline std::string* TxMsgAck::mutable_tx() {
-  std::string* _s = _internal_mutable_tx();
-  // @@protoc_insertion_point(field_mutable:TxMsgAck.tx)
-  return _s;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ContractDependencyBroadcastMsg.sign)
 }
-inline const std::string& TxMsgAck::_internal_tx() const {
-  return _impl_.tx_.Get();
+inline ::CSign* ContractDependencyBroadcastMsg::release_sign() {
+  
+  ::CSign* temp = _impl_.sign_;
+  _impl_.sign_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void TxMsgAck::_internal_set_tx(const std::string& value) {
+inline ::CSign* ContractDependencyBroadcastMsg::unsafe_arena_release_sign() {
+  // @@protoc_insertion_point(field_release:ContractDependencyBroadcastMsg.sign)
   
-  _impl_.tx_.Set(value, GetArenaForAllocation());
+  ::CSign* temp = _impl_.sign_;
+  _impl_.sign_ = nullptr;
+  return temp;
 }
-inline std::string* TxMsgAck::_internal_mutable_tx() {
+inline ::CSign* ContractDependencyBroadcastMsg::_internal_mutable_sign() {
   
-  return _impl_.tx_.Mutable(GetArenaForAllocation());
+  if (_impl_.sign_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CSign>(GetArenaForAllocation());
+    _impl_.sign_ = p;
+  }
+  return _impl_.sign_;
 }
-inline std::string* TxMsgAck::release_tx() {
-  // @@protoc_insertion_point(field_release:TxMsgAck.tx)
-  return _impl_.tx_.Release();
+inline ::CSign* ContractDependencyBroadcastMsg::mutable_sign() {
+  ::CSign* _msg = _internal_mutable_sign();
+  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.sign)
+  return _msg;
 }
-inline void TxMsgAck::set_allocated_tx(std::string* tx) {
-  if (tx != nullptr) {
-    
-  } else {
-    
+inline void ContractDependencyBroadcastMsg::set_allocated_sign(::CSign* sign) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
   }
-  _impl_.tx_.SetAllocated(tx, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.tx_.IsDefault()) {
-    _impl_.tx_.Set("", GetArenaForAllocation());
+  if (sign) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sign));
+    if (message_arena != submessage_arena) {
+      sign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sign, submessage_arena);
+    }
+    
+  } else {
+    
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TxMsgAck.tx)
+  _impl_.sign_ = sign;
+  // @@protoc_insertion_point(field_set_allocated:ContractDependencyBroadcastMsg.sign)
 }
 
 // -------------------------------------------------------------------
 
-// BuildBlockBroadcastMsg
+// CompactBlockBroadcastMsg
 
 // string version = 1;
-inline void BuildBlockBroadcastMsg::clear_version() {
+inline void CompactBlockBroadcastMsg::clear_version() {
   _impl_.version_.ClearToEmpty();
 }
-inline const std::string& BuildBlockBroadcastMsg::version() const {
-  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.version)
+inline const std::string& CompactBlockBroadcastMsg::version() const {
+  // @@protoc_insertion_point(field_get:CompactBlockBroadcastMsg.version)
   return _internal_version();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void BuildBlockBroadcastMsg::set_version(ArgT0&& arg0, ArgT... args) {
+void CompactBlockBroadcastMsg::set_version(ArgT0&& arg0, ArgT... args) {
  
  _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.version)
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.version)
 }
-inline std::string* BuildBlockBroadcastMsg::mutable_version() {
+inline std::string* CompactBlockBroadcastMsg::mutable_version() {
   std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.version)
+  // @@protoc_insertion_point(field_mutable:CompactBlockBroadcastMsg.version)
   return _s;
 }
-inline const std::string& BuildBlockBroadcastMsg::_internal_version() const {
+inline const std::string& CompactBlockBroadcastMsg::_internal_version() const {
   return _impl_.version_.Get();
 }
-inline void BuildBlockBroadcastMsg::_internal_set_version(const std::string& value) {
+inline void CompactBlockBroadcastMsg::_internal_set_version(const std::string& value) {
   
   _impl_.version_.Set(value, GetArenaForAllocation());
 }
-inline std::string* BuildBlockBroadcastMsg::_internal_mutable_version() {
+inline std::string* CompactBlockBroadcastMsg::_internal_mutable_version() {
   
   return _impl_.version_.Mutable(GetArenaForAllocation());
 }
-inline std::string* BuildBlockBroadcastMsg::release_version() {
-  // @@protoc_insertion_point(field_release:BuildBlockBroadcastMsg.version)
+inline std::string* CompactBlockBroadcastMsg::release_version() {
+  // @@protoc_insertion_point(field_release:CompactBlockBroadcastMsg.version)
   return _impl_.version_.Release();
 }
-inline void BuildBlockBroadcastMsg::set_allocated_version(std::string* version) {
+inline void CompactBlockBroadcastMsg::set_allocated_version(std::string* version) {
   if (version != nullptr) {
     
   } else {
@@ -4218,45 +5849,45 @@ inline void BuildBlockBroadcastMsg::set_allocated_version(std::string* version)
     _impl_.version_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:BuildBlockBroadcastMsg.version)
+  // @@protoc_insertion_point(field_set_allocated:CompactBlockBroadcastMsg.version)
 }
 
 // string id = 2;
-inline void BuildBlockBroadcastMsg::clear_id() {
+inline void CompactBlockBroadcastMsg::clear_id() {
   _impl_.id_.ClearToEmpty();
 }
-inline const std::string& BuildBlockBroadcastMsg::id() const {
-  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.id)
+inline const std::string& CompactBlockBroadcastMsg::id() const {
+  // @@protoc_insertion_point(field_get:CompactBlockBroadcastMsg.id)
   return _internal_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void BuildBlockBroadcastMsg::set_id(ArgT0&& arg0, ArgT... args) {
+void CompactBlockBroadcastMsg::set_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.id)
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.id)
 }
-inline std::string* BuildBlockBroadcastMsg::mutable_id() {
+inline std::string* CompactBlockBroadcastMsg::mutable_id() {
   std::string* _s = _internal_mutable_id();
-  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.id)
+  // @@protoc_insertion_point(field_mutable:CompactBlockBroadcastMsg.id)
   return _s;
 }
-inline const std::string& BuildBlockBroadcastMsg::_internal_id() const {
+inline const std::string& CompactBlockBroadcastMsg::_internal_id() const {
   return _impl_.id_.Get();
 }
-inline void BuildBlockBroadcastMsg::_internal_set_id(const std::string& value) {
+inline void CompactBlockBroadcastMsg::_internal_set_id(const std::string& value) {
   
   _impl_.id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* BuildBlockBroadcastMsg::_internal_mutable_id() {
+inline std::string* CompactBlockBroadcastMsg::_internal_mutable_id() {
   
   return _impl_.id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* BuildBlockBroadcastMsg::release_id() {
-  // @@protoc_insertion_point(field_release:BuildBlockBroadcastMsg.id)
+inline std::string* CompactBlockBroadcastMsg::release_id() {
+  // @@protoc_insertion_point(field_release:CompactBlockBroadcastMsg.id)
   return _impl_.id_.Release();
 }
-inline void BuildBlockBroadcastMsg::set_allocated_id(std::string* id) {
+inline void CompactBlockBroadcastMsg::set_allocated_id(std::string* id) {
   if (id != nullptr) {
     
   } else {
@@ -4268,358 +5899,261 @@ inline void BuildBlockBroadcastMsg::set_allocated_id(std::string* id) {
     _impl_.id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:BuildBlockBroadcastMsg.id)
+  // @@protoc_insertion_point(field_set_allocated:CompactBlockBroadcastMsg.id)
 }
 
-// bytes blockRaw = 3;
-inline void BuildBlockBroadcastMsg::clear_blockraw() {
-  _impl_.blockraw_.ClearToEmpty();
+// bytes header = 3;
+inline void CompactBlockBroadcastMsg::clear_header() {
+  _impl_.header_.ClearToEmpty();
 }
-inline const std::string& BuildBlockBroadcastMsg::blockraw() const {
-  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.blockRaw)
-  return _internal_blockraw();
+inline const std::string& CompactBlockBroadcastMsg::header() const {
+  // @@protoc_insertion_point(field_get:CompactBlockBroadcastMsg.header)
+  return _internal_header();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void BuildBlockBroadcastMsg::set_blockraw(ArgT0&& arg0, ArgT... args) {
+void CompactBlockBroadcastMsg::set_header(ArgT0&& arg0, ArgT... args) {
  
- _impl_.blockraw_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.blockRaw)
+ _impl_.header_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.header)
 }
-inline std::string* BuildBlockBroadcastMsg::mutable_blockraw() {
-  std::string* _s = _internal_mutable_blockraw();
-  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.blockRaw)
+inline std::string* CompactBlockBroadcastMsg::mutable_header() {
+  std::string* _s = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:CompactBlockBroadcastMsg.header)
   return _s;
 }
-inline const std::string& BuildBlockBroadcastMsg::_internal_blockraw() const {
-  return _impl_.blockraw_.Get();
+inline const std::string& CompactBlockBroadcastMsg::_internal_header() const {
+  return _impl_.header_.Get();
 }
-inline void BuildBlockBroadcastMsg::_internal_set_blockraw(const std::string& value) {
+inline void CompactBlockBroadcastMsg::_internal_set_header(const std::string& value) {
   
-  _impl_.blockraw_.Set(value, GetArenaForAllocation());
+  _impl_.header_.Set(value, GetArenaForAllocation());
 }
-inline std::string* BuildBlockBroadcastMsg::_internal_mutable_blockraw() {
+inline std::string* CompactBlockBroadcastMsg::_internal_mutable_header() {
   
-  return _impl_.blockraw_.Mutable(GetArenaForAllocation());
+  return _impl_.header_.Mutable(GetArenaForAllocation());
 }
-inline std::string* BuildBlockBroadcastMsg::release_blockraw() {
-  // @@protoc_insertion_point(field_release:BuildBlockBroadcastMsg.blockRaw)
-  return _impl_.blockraw_.Release();
+inline std::string* CompactBlockBroadcastMsg::release_header() {
+  // @@protoc_insertion_point(field_release:CompactBlockBroadcastMsg.header)
+  return _impl_.header_.Release();
 }
-inline void BuildBlockBroadcastMsg::set_allocated_blockraw(std::string* blockraw) {
-  if (blockraw != nullptr) {
+inline void CompactBlockBroadcastMsg::set_allocated_header(std::string* header) {
+  if (header != nullptr) {
     
   } else {
     
   }
-  _impl_.blockraw_.SetAllocated(blockraw, GetArenaForAllocation());
+  _impl_.header_.SetAllocated(header, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.blockraw_.IsDefault()) {
-    _impl_.blockraw_.Set("", GetArenaForAllocation());
+  if (_impl_.header_.IsDefault()) {
+    _impl_.header_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:BuildBlockBroadcastMsg.blockRaw)
+  // @@protoc_insertion_point(field_set_allocated:CompactBlockBroadcastMsg.header)
 }
 
-// int32 flag = 4;
-inline void BuildBlockBroadcastMsg::clear_flag() {
+// repeated fixed64 shortIds = 4;
+inline int CompactBlockBroadcastMsg::_internal_shortids_size() const {
+  return _impl_.shortids_.size();
+}
+inline int CompactBlockBroadcastMsg::shortids_size() const {
+  return _internal_shortids_size();
+}
+inline void CompactBlockBroadcastMsg::clear_shortids() {
+  _impl_.shortids_.Clear();
+}
+inline uint64_t CompactBlockBroadcastMsg::_internal_shortids(int index) const {
+  return _impl_.shortids_.Get(index);
+}
+inline uint64_t CompactBlockBroadcastMsg::shortids(int index) const {
+  // @@protoc_insertion_point(field_get:CompactBlockBroadcastMsg.shortIds)
+  return _internal_shortids(index);
+}
+inline void CompactBlockBroadcastMsg::set_shortids(int index, uint64_t value) {
+  _impl_.shortids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.shortIds)
+}
+inline void CompactBlockBroadcastMsg::_internal_add_shortids(uint64_t value) {
+  _impl_.shortids_.Add(value);
+}
+inline void CompactBlockBroadcastMsg::add_shortids(uint64_t value) {
+  _internal_add_shortids(value);
+  // @@protoc_insertion_point(field_add:CompactBlockBroadcastMsg.shortIds)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CompactBlockBroadcastMsg::_internal_shortids() const {
+  return _impl_.shortids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CompactBlockBroadcastMsg::shortids() const {
+  // @@protoc_insertion_point(field_list:CompactBlockBroadcastMsg.shortIds)
+  return _internal_shortids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CompactBlockBroadcastMsg::_internal_mutable_shortids() {
+  return &_impl_.shortids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CompactBlockBroadcastMsg::mutable_shortids() {
+  // @@protoc_insertion_point(field_mutable_list:CompactBlockBroadcastMsg.shortIds)
+  return _internal_mutable_shortids();
+}
+
+// int32 flag = 5;
+inline void CompactBlockBroadcastMsg::clear_flag() {
   _impl_.flag_ = 0;
 }
-inline int32_t BuildBlockBroadcastMsg::_internal_flag() const {
+inline int32_t CompactBlockBroadcastMsg::_internal_flag() const {
   return _impl_.flag_;
 }
-inline int32_t BuildBlockBroadcastMsg::flag() const {
-  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.flag)
+inline int32_t CompactBlockBroadcastMsg::flag() const {
+  // @@protoc_insertion_point(field_get:CompactBlockBroadcastMsg.flag)
   return _internal_flag();
 }
-inline void BuildBlockBroadcastMsg::_internal_set_flag(int32_t value) {
+inline void CompactBlockBroadcastMsg::_internal_set_flag(int32_t value) {
   
   _impl_.flag_ = value;
 }
-inline void BuildBlockBroadcastMsg::set_flag(int32_t value) {
+inline void CompactBlockBroadcastMsg::set_flag(int32_t value) {
   _internal_set_flag(value);
-  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.flag)
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.flag)
 }
 
-// int32 type = 5;
-inline void BuildBlockBroadcastMsg::clear_type() {
+// int32 type = 6;
+inline void CompactBlockBroadcastMsg::clear_type() {
   _impl_.type_ = 0;
 }
-inline int32_t BuildBlockBroadcastMsg::_internal_type() const {
+inline int32_t CompactBlockBroadcastMsg::_internal_type() const {
   return _impl_.type_;
 }
-inline int32_t BuildBlockBroadcastMsg::type() const {
-  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.type)
+inline int32_t CompactBlockBroadcastMsg::type() const {
+  // @@protoc_insertion_point(field_get:CompactBlockBroadcastMsg.type)
   return _internal_type();
 }
-inline void BuildBlockBroadcastMsg::_internal_set_type(int32_t value) {
+inline void CompactBlockBroadcastMsg::_internal_set_type(int32_t value) {
   
   _impl_.type_ = value;
 }
-inline void BuildBlockBroadcastMsg::set_type(int32_t value) {
+inline void CompactBlockBroadcastMsg::set_type(int32_t value) {
   _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.type)
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.type)
 }
 
-// repeated string castAddrs = 6;
-inline int BuildBlockBroadcastMsg::_internal_castaddrs_size() const {
+// repeated string castAddrs = 7;
+inline int CompactBlockBroadcastMsg::_internal_castaddrs_size() const {
   return _impl_.castaddrs_.size();
 }
-inline int BuildBlockBroadcastMsg::castaddrs_size() const {
+inline int CompactBlockBroadcastMsg::castaddrs_size() const {
   return _internal_castaddrs_size();
 }
-inline void BuildBlockBroadcastMsg::clear_castaddrs() {
+inline void CompactBlockBroadcastMsg::clear_castaddrs() {
   _impl_.castaddrs_.Clear();
 }
-inline std::string* BuildBlockBroadcastMsg::add_castaddrs() {
+inline std::string* CompactBlockBroadcastMsg::add_castaddrs() {
   std::string* _s = _internal_add_castaddrs();
-  // @@protoc_insertion_point(field_add_mutable:BuildBlockBroadcastMsg.castAddrs)
+  // @@protoc_insertion_point(field_add_mutable:CompactBlockBroadcastMsg.castAddrs)
   return _s;
 }
-inline const std::string& BuildBlockBroadcastMsg::_internal_castaddrs(int index) const {
+inline const std::string& CompactBlockBroadcastMsg::_internal_castaddrs(int index) const {
   return _impl_.castaddrs_.Get(index);
 }
-inline const std::string& BuildBlockBroadcastMsg::castaddrs(int index) const {
-  // @@protoc_insertion_point(field_get:BuildBlockBroadcastMsg.castAddrs)
+inline const std::string& CompactBlockBroadcastMsg::castaddrs(int index) const {
+  // @@protoc_insertion_point(field_get:CompactBlockBroadcastMsg.castAddrs)
   return _internal_castaddrs(index);
 }
-inline std::string* BuildBlockBroadcastMsg::mutable_castaddrs(int index) {
-  // @@protoc_insertion_point(field_mutable:BuildBlockBroadcastMsg.castAddrs)
+inline std::string* CompactBlockBroadcastMsg::mutable_castaddrs(int index) {
+  // @@protoc_insertion_point(field_mutable:CompactBlockBroadcastMsg.castAddrs)
   return _impl_.castaddrs_.Mutable(index);
 }
-inline void BuildBlockBroadcastMsg::set_castaddrs(int index, const std::string& value) {
+inline void CompactBlockBroadcastMsg::set_castaddrs(int index, const std::string& value) {
   _impl_.castaddrs_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.castAddrs)
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.castAddrs)
 }
-inline void BuildBlockBroadcastMsg::set_castaddrs(int index, std::string&& value) {
+inline void CompactBlockBroadcastMsg::set_castaddrs(int index, std::string&& value) {
   _impl_.castaddrs_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:BuildBlockBroadcastMsg.castAddrs)
+  // @@protoc_insertion_point(field_set:CompactBlockBroadcastMsg.castAddrs)
 }
-inline void BuildBlockBroadcastMsg::set_castaddrs(int index, const char* value) {
+inline void CompactBlockBroadcastMsg::set_castaddrs(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.castaddrs_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:BuildBlockBroadcastMsg.castAddrs)
+  // @@protoc_insertion_point(field_set_char:CompactBlockBroadcastMsg.castAddrs)
 }
-inline void BuildBlockBroadcastMsg::set_castaddrs(int index, const char* value, size_t size) {
+inline void CompactBlockBroadcastMsg::set_castaddrs(int index, const char* value, size_t size) {
   _impl_.castaddrs_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:BuildBlockBroadcastMsg.castAddrs)
+  // @@protoc_insertion_point(field_set_pointer:CompactBlockBroadcastMsg.castAddrs)
 }
-inline std::string* BuildBlockBroadcastMsg::_internal_add_castaddrs() {
+inline std::string* CompactBlockBroadcastMsg::_internal_add_castaddrs() {
   return _impl_.castaddrs_.Add();
 }
-inline void BuildBlockBroadcastMsg::add_castaddrs(const std::string& value) {
-  _impl_.castaddrs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:BuildBlockBroadcastMsg.castAddrs)
-}
-inline void BuildBlockBroadcastMsg::add_castaddrs(std::string&& value) {
-  _impl_.castaddrs_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:BuildBlockBroadcastMsg.castAddrs)
-}
-inline void BuildBlockBroadcastMsg::add_castaddrs(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline void CompactBlockBroadcastMsg::add_castaddrs(const std::string& value) {
   _impl_.castaddrs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:BuildBlockBroadcastMsg.castAddrs)
-}
-inline void BuildBlockBroadcastMsg::add_castaddrs(const char* value, size_t size) {
-  _impl_.castaddrs_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:BuildBlockBroadcastMsg.castAddrs)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-BuildBlockBroadcastMsg::castaddrs() const {
-  // @@protoc_insertion_point(field_list:BuildBlockBroadcastMsg.castAddrs)
-  return _impl_.castaddrs_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-BuildBlockBroadcastMsg::mutable_castaddrs() {
-  // @@protoc_insertion_point(field_mutable_list:BuildBlockBroadcastMsg.castAddrs)
-  return &_impl_.castaddrs_;
-}
-
-// -------------------------------------------------------------------
-
-// ContractTxMsgReq
-
-// string version = 1;
-inline void ContractTxMsgReq::clear_version() {
-  _impl_.version_.ClearToEmpty();
-}
-inline const std::string& ContractTxMsgReq::version() const {
-  // @@protoc_insertion_point(field_get:ContractTxMsgReq.version)
-  return _internal_version();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ContractTxMsgReq::set_version(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:ContractTxMsgReq.version)
-}
-inline std::string* ContractTxMsgReq::mutable_version() {
-  std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:ContractTxMsgReq.version)
-  return _s;
-}
-inline const std::string& ContractTxMsgReq::_internal_version() const {
-  return _impl_.version_.Get();
-}
-inline void ContractTxMsgReq::_internal_set_version(const std::string& value) {
-  
-  _impl_.version_.Set(value, GetArenaForAllocation());
-}
-inline std::string* ContractTxMsgReq::_internal_mutable_version() {
-  
-  return _impl_.version_.Mutable(GetArenaForAllocation());
-}
-inline std::string* ContractTxMsgReq::release_version() {
-  // @@protoc_insertion_point(field_release:ContractTxMsgReq.version)
-  return _impl_.version_.Release();
-}
-inline void ContractTxMsgReq::set_allocated_version(std::string* version) {
-  if (version != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.version_.SetAllocated(version, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.version_.IsDefault()) {
-    _impl_.version_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ContractTxMsgReq.version)
-}
-
-// .TxMsgReq txMsgReq = 2;
-inline bool ContractTxMsgReq::_internal_has_txmsgreq() const {
-  return this != internal_default_instance() && _impl_.txmsgreq_ != nullptr;
-}
-inline bool ContractTxMsgReq::has_txmsgreq() const {
-  return _internal_has_txmsgreq();
-}
-inline void ContractTxMsgReq::clear_txmsgreq() {
-  if (GetArenaForAllocation() == nullptr && _impl_.txmsgreq_ != nullptr) {
-    delete _impl_.txmsgreq_;
-  }
-  _impl_.txmsgreq_ = nullptr;
-}
-inline const ::TxMsgReq& ContractTxMsgReq::_internal_txmsgreq() const {
-  const ::TxMsgReq* p = _impl_.txmsgreq_;
-  return p != nullptr ? *p : reinterpret_cast<const ::TxMsgReq&>(
-      ::_TxMsgReq_default_instance_);
-}
-inline const ::TxMsgReq& ContractTxMsgReq::txmsgreq() const {
-  // @@protoc_insertion_point(field_get:ContractTxMsgReq.txMsgReq)
-  return _internal_txmsgreq();
-}
-inline void ContractTxMsgReq::unsafe_arena_set_allocated_txmsgreq(
-    ::TxMsgReq* txmsgreq) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.txmsgreq_);
-  }
-  _impl_.txmsgreq_ = txmsgreq;
-  if (txmsgreq) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ContractTxMsgReq.txMsgReq)
-}
-inline ::TxMsgReq* ContractTxMsgReq::release_txmsgreq() {
-  
-  ::TxMsgReq* temp = _impl_.txmsgreq_;
-  _impl_.txmsgreq_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::TxMsgReq* ContractTxMsgReq::unsafe_arena_release_txmsgreq() {
-  // @@protoc_insertion_point(field_release:ContractTxMsgReq.txMsgReq)
-  
-  ::TxMsgReq* temp = _impl_.txmsgreq_;
-  _impl_.txmsgreq_ = nullptr;
-  return temp;
-}
-inline ::TxMsgReq* ContractTxMsgReq::_internal_mutable_txmsgreq() {
-  
-  if (_impl_.txmsgreq_ == nullptr) {
-    auto* p = CreateMaybeMessage<::TxMsgReq>(GetArenaForAllocation());
-    _impl_.txmsgreq_ = p;
-  }
-  return _impl_.txmsgreq_;
+  // @@protoc_insertion_point(field_add:CompactBlockBroadcastMsg.castAddrs)
 }
-inline ::TxMsgReq* ContractTxMsgReq::mutable_txmsgreq() {
-  ::TxMsgReq* _msg = _internal_mutable_txmsgreq();
-  // @@protoc_insertion_point(field_mutable:ContractTxMsgReq.txMsgReq)
-  return _msg;
+inline void CompactBlockBroadcastMsg::add_castaddrs(std::string&& value) {
+  _impl_.castaddrs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:CompactBlockBroadcastMsg.castAddrs)
 }
-inline void ContractTxMsgReq::set_allocated_txmsgreq(::TxMsgReq* txmsgreq) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.txmsgreq_;
-  }
-  if (txmsgreq) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(txmsgreq);
-    if (message_arena != submessage_arena) {
-      txmsgreq = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, txmsgreq, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.txmsgreq_ = txmsgreq;
-  // @@protoc_insertion_point(field_set_allocated:ContractTxMsgReq.txMsgReq)
+inline void CompactBlockBroadcastMsg::add_castaddrs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.castaddrs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:CompactBlockBroadcastMsg.castAddrs)
+}
+inline void CompactBlockBroadcastMsg::add_castaddrs(const char* value, size_t size) {
+  _impl_.castaddrs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:CompactBlockBroadcastMsg.castAddrs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CompactBlockBroadcastMsg::castaddrs() const {
+  // @@protoc_insertion_point(field_list:CompactBlockBroadcastMsg.castAddrs)
+  return _impl_.castaddrs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CompactBlockBroadcastMsg::mutable_castaddrs() {
+  // @@protoc_insertion_point(field_mutable_list:CompactBlockBroadcastMsg.castAddrs)
+  return &_impl_.castaddrs_;
 }
 
 // -------------------------------------------------------------------
 
-// ContractPackagerMsg
+// GetBlockTxsReq
 
 // string version = 1;
-inline void ContractPackagerMsg::clear_version() {
+inline void GetBlockTxsReq::clear_version() {
   _impl_.version_.ClearToEmpty();
 }
-inline const std::string& ContractPackagerMsg::version() const {
-  // @@protoc_insertion_point(field_get:ContractPackagerMsg.version)
+inline const std::string& GetBlockTxsReq::version() const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsReq.version)
   return _internal_version();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ContractPackagerMsg::set_version(ArgT0&& arg0, ArgT... args) {
+void GetBlockTxsReq::set_version(ArgT0&& arg0, ArgT... args) {
  
  _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:ContractPackagerMsg.version)
+  // @@protoc_insertion_point(field_set:GetBlockTxsReq.version)
 }
-inline std::string* ContractPackagerMsg::mutable_version() {
+inline std::string* GetBlockTxsReq::mutable_version() {
   std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:ContractPackagerMsg.version)
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsReq.version)
   return _s;
 }
-inline const std::string& ContractPackagerMsg::_internal_version() const {
+inline const std::string& GetBlockTxsReq::_internal_version() const {
   return _impl_.version_.Get();
 }
-inline void ContractPackagerMsg::_internal_set_version(const std::string& value) {
+inline void GetBlockTxsReq::_internal_set_version(const std::string& value) {
   
   _impl_.version_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ContractPackagerMsg::_internal_mutable_version() {
+inline std::string* GetBlockTxsReq::_internal_mutable_version() {
   
   return _impl_.version_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ContractPackagerMsg::release_version() {
-  // @@protoc_insertion_point(field_release:ContractPackagerMsg.version)
+inline std::string* GetBlockTxsReq::release_version() {
+  // @@protoc_insertion_point(field_release:GetBlockTxsReq.version)
   return _impl_.version_.Release();
 }
-inline void ContractPackagerMsg::set_allocated_version(std::string* version) {
+inline void GetBlockTxsReq::set_allocated_version(std::string* version) {
   if (version != nullptr) {
     
   } else {
@@ -4631,303 +6165,196 @@ inline void ContractPackagerMsg::set_allocated_version(std::string* version) {
     _impl_.version_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ContractPackagerMsg.version)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockTxsReq.version)
 }
 
-// .CSign sign = 2;
-inline bool ContractPackagerMsg::_internal_has_sign() const {
-  return this != internal_default_instance() && _impl_.sign_ != nullptr;
-}
-inline bool ContractPackagerMsg::has_sign() const {
-  return _internal_has_sign();
+// string id = 2;
+inline void GetBlockTxsReq::clear_id() {
+  _impl_.id_.ClearToEmpty();
 }
-inline const ::CSign& ContractPackagerMsg::_internal_sign() const {
-  const ::CSign* p = _impl_.sign_;
-  return p != nullptr ? *p : reinterpret_cast<const ::CSign&>(
-      ::_CSign_default_instance_);
+inline const std::string& GetBlockTxsReq::id() const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsReq.id)
+  return _internal_id();
 }
-inline const ::CSign& ContractPackagerMsg::sign() const {
-  // @@protoc_insertion_point(field_get:ContractPackagerMsg.sign)
-  return _internal_sign();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockTxsReq::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockTxsReq.id)
 }
-inline void ContractPackagerMsg::unsafe_arena_set_allocated_sign(
-    ::CSign* sign) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
-  }
-  _impl_.sign_ = sign;
-  if (sign) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ContractPackagerMsg.sign)
+inline std::string* GetBlockTxsReq::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsReq.id)
+  return _s;
 }
-inline ::CSign* ContractPackagerMsg::release_sign() {
-  
-  ::CSign* temp = _impl_.sign_;
-  _impl_.sign_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& GetBlockTxsReq::_internal_id() const {
+  return _impl_.id_.Get();
 }
-inline ::CSign* ContractPackagerMsg::unsafe_arena_release_sign() {
-  // @@protoc_insertion_point(field_release:ContractPackagerMsg.sign)
+inline void GetBlockTxsReq::_internal_set_id(const std::string& value) {
   
-  ::CSign* temp = _impl_.sign_;
-  _impl_.sign_ = nullptr;
-  return temp;
+  _impl_.id_.Set(value, GetArenaForAllocation());
 }
-inline ::CSign* ContractPackagerMsg::_internal_mutable_sign() {
+inline std::string* GetBlockTxsReq::_internal_mutable_id() {
   
-  if (_impl_.sign_ == nullptr) {
-    auto* p = CreateMaybeMessage<::CSign>(GetArenaForAllocation());
-    _impl_.sign_ = p;
-  }
-  return _impl_.sign_;
+  return _impl_.id_.Mutable(GetArenaForAllocation());
 }
-inline ::CSign* ContractPackagerMsg::mutable_sign() {
-  ::CSign* _msg = _internal_mutable_sign();
-  // @@protoc_insertion_point(field_mutable:ContractPackagerMsg.sign)
-  return _msg;
+inline std::string* GetBlockTxsReq::release_id() {
+  // @@protoc_insertion_point(field_release:GetBlockTxsReq.id)
+  return _impl_.id_.Release();
 }
-inline void ContractPackagerMsg::set_allocated_sign(::CSign* sign) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
-  }
-  if (sign) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sign));
-    if (message_arena != submessage_arena) {
-      sign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, sign, submessage_arena);
-    }
+inline void GetBlockTxsReq::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
     
   } else {
     
   }
-  _impl_.sign_ = sign;
-  // @@protoc_insertion_point(field_set_allocated:ContractPackagerMsg.sign)
-}
-
-// repeated .TxMsgReq txMsgReq = 3;
-inline int ContractPackagerMsg::_internal_txmsgreq_size() const {
-  return _impl_.txmsgreq_.size();
-}
-inline int ContractPackagerMsg::txmsgreq_size() const {
-  return _internal_txmsgreq_size();
-}
-inline void ContractPackagerMsg::clear_txmsgreq() {
-  _impl_.txmsgreq_.Clear();
-}
-inline ::TxMsgReq* ContractPackagerMsg::mutable_txmsgreq(int index) {
-  // @@protoc_insertion_point(field_mutable:ContractPackagerMsg.txMsgReq)
-  return _impl_.txmsgreq_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TxMsgReq >*
-ContractPackagerMsg::mutable_txmsgreq() {
-  // @@protoc_insertion_point(field_mutable_list:ContractPackagerMsg.txMsgReq)
-  return &_impl_.txmsgreq_;
-}
-inline const ::TxMsgReq& ContractPackagerMsg::_internal_txmsgreq(int index) const {
-  return _impl_.txmsgreq_.Get(index);
-}
-inline const ::TxMsgReq& ContractPackagerMsg::txmsgreq(int index) const {
-  // @@protoc_insertion_point(field_get:ContractPackagerMsg.txMsgReq)
-  return _internal_txmsgreq(index);
-}
-inline ::TxMsgReq* ContractPackagerMsg::_internal_add_txmsgreq() {
-  return _impl_.txmsgreq_.Add();
-}
-inline ::TxMsgReq* ContractPackagerMsg::add_txmsgreq() {
-  ::TxMsgReq* _add = _internal_add_txmsgreq();
-  // @@protoc_insertion_point(field_add:ContractPackagerMsg.txMsgReq)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TxMsgReq >&
-ContractPackagerMsg::txmsgreq() const {
-  // @@protoc_insertion_point(field_list:ContractPackagerMsg.txMsgReq)
-  return _impl_.txmsgreq_;
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockTxsReq.id)
 }
 
-// -------------------------------------------------------------------
-
-// ContractDependencyBroadcastMsg_DependencyInfo
-
-// string dependencyAddress = 1;
-inline void ContractDependencyBroadcastMsg_DependencyInfo::clear_dependencyaddress() {
-  _impl_.dependencyaddress_.ClearToEmpty();
+// string blockHash = 3;
+inline void GetBlockTxsReq::clear_blockhash() {
+  _impl_.blockhash_.ClearToEmpty();
 }
-inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::dependencyaddress() const {
-  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
-  return _internal_dependencyaddress();
+inline const std::string& GetBlockTxsReq::blockhash() const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsReq.blockHash)
+  return _internal_blockhash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ContractDependencyBroadcastMsg_DependencyInfo::set_dependencyaddress(ArgT0&& arg0, ArgT... args) {
+void GetBlockTxsReq::set_blockhash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.dependencyaddress_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
+ _impl_.blockhash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockTxsReq.blockHash)
 }
-inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::mutable_dependencyaddress() {
-  std::string* _s = _internal_mutable_dependencyaddress();
-  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
+inline std::string* GetBlockTxsReq::mutable_blockhash() {
+  std::string* _s = _internal_mutable_blockhash();
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsReq.blockHash)
   return _s;
 }
-inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::_internal_dependencyaddress() const {
-  return _impl_.dependencyaddress_.Get();
+inline const std::string& GetBlockTxsReq::_internal_blockhash() const {
+  return _impl_.blockhash_.Get();
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::_internal_set_dependencyaddress(const std::string& value) {
+inline void GetBlockTxsReq::_internal_set_blockhash(const std::string& value) {
   
-  _impl_.dependencyaddress_.Set(value, GetArenaForAllocation());
+  _impl_.blockhash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::_internal_mutable_dependencyaddress() {
+inline std::string* GetBlockTxsReq::_internal_mutable_blockhash() {
   
-  return _impl_.dependencyaddress_.Mutable(GetArenaForAllocation());
+  return _impl_.blockhash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::release_dependencyaddress() {
-  // @@protoc_insertion_point(field_release:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
-  return _impl_.dependencyaddress_.Release();
+inline std::string* GetBlockTxsReq::release_blockhash() {
+  // @@protoc_insertion_point(field_release:GetBlockTxsReq.blockHash)
+  return _impl_.blockhash_.Release();
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::set_allocated_dependencyaddress(std::string* dependencyaddress) {
-  if (dependencyaddress != nullptr) {
+inline void GetBlockTxsReq::set_allocated_blockhash(std::string* blockhash) {
+  if (blockhash != nullptr) {
     
   } else {
     
   }
-  _impl_.dependencyaddress_.SetAllocated(dependencyaddress, GetArenaForAllocation());
+  _impl_.blockhash_.SetAllocated(blockhash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.dependencyaddress_.IsDefault()) {
-    _impl_.dependencyaddress_.Set("", GetArenaForAllocation());
+  if (_impl_.blockhash_.IsDefault()) {
+    _impl_.blockhash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ContractDependencyBroadcastMsg.DependencyInfo.dependencyAddress)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockTxsReq.blockHash)
 }
 
-// repeated string txHashes = 2;
-inline int ContractDependencyBroadcastMsg_DependencyInfo::_internal_txhashes_size() const {
-  return _impl_.txhashes_.size();
-}
-inline int ContractDependencyBroadcastMsg_DependencyInfo::txhashes_size() const {
-  return _internal_txhashes_size();
-}
-inline void ContractDependencyBroadcastMsg_DependencyInfo::clear_txhashes() {
-  _impl_.txhashes_.Clear();
-}
-inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes() {
-  std::string* _s = _internal_add_txhashes();
-  // @@protoc_insertion_point(field_add_mutable:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
-  return _s;
-}
-inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::_internal_txhashes(int index) const {
-  return _impl_.txhashes_.Get(index);
-}
-inline const std::string& ContractDependencyBroadcastMsg_DependencyInfo::txhashes(int index) const {
-  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
-  return _internal_txhashes(index);
-}
-inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::mutable_txhashes(int index) {
-  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
-  return _impl_.txhashes_.Mutable(index);
-}
-inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, const std::string& value) {
-  _impl_.txhashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+// repeated uint32 indexes = 4;
+inline int GetBlockTxsReq::_internal_indexes_size() const {
+  return _impl_.indexes_.size();
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, std::string&& value) {
-  _impl_.txhashes_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+inline int GetBlockTxsReq::indexes_size() const {
+  return _internal_indexes_size();
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.txhashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+inline void GetBlockTxsReq::clear_indexes() {
+  _impl_.indexes_.Clear();
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::set_txhashes(int index, const char* value, size_t size) {
-  _impl_.txhashes_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+inline uint32_t GetBlockTxsReq::_internal_indexes(int index) const {
+  return _impl_.indexes_.Get(index);
 }
-inline std::string* ContractDependencyBroadcastMsg_DependencyInfo::_internal_add_txhashes() {
-  return _impl_.txhashes_.Add();
+inline uint32_t GetBlockTxsReq::indexes(int index) const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsReq.indexes)
+  return _internal_indexes(index);
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(const std::string& value) {
-  _impl_.txhashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+inline void GetBlockTxsReq::set_indexes(int index, uint32_t value) {
+  _impl_.indexes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:GetBlockTxsReq.indexes)
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(std::string&& value) {
-  _impl_.txhashes_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+inline void GetBlockTxsReq::_internal_add_indexes(uint32_t value) {
+  _impl_.indexes_.Add(value);
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.txhashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+inline void GetBlockTxsReq::add_indexes(uint32_t value) {
+  _internal_add_indexes(value);
+  // @@protoc_insertion_point(field_add:GetBlockTxsReq.indexes)
 }
-inline void ContractDependencyBroadcastMsg_DependencyInfo::add_txhashes(const char* value, size_t size) {
-  _impl_.txhashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GetBlockTxsReq::_internal_indexes() const {
+  return _impl_.indexes_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-ContractDependencyBroadcastMsg_DependencyInfo::txhashes() const {
-  // @@protoc_insertion_point(field_list:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
-  return _impl_.txhashes_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GetBlockTxsReq::indexes() const {
+  // @@protoc_insertion_point(field_list:GetBlockTxsReq.indexes)
+  return _internal_indexes();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-ContractDependencyBroadcastMsg_DependencyInfo::mutable_txhashes() {
-  // @@protoc_insertion_point(field_mutable_list:ContractDependencyBroadcastMsg.DependencyInfo.txHashes)
-  return &_impl_.txhashes_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GetBlockTxsReq::_internal_mutable_indexes() {
+  return &_impl_.indexes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GetBlockTxsReq::mutable_indexes() {
+  // @@protoc_insertion_point(field_mutable_list:GetBlockTxsReq.indexes)
+  return _internal_mutable_indexes();
 }
 
 // -------------------------------------------------------------------
 
-// ContractDependencyBroadcastMsg
+// GetBlockTxsAck
 
 // string version = 1;
-inline void ContractDependencyBroadcastMsg::clear_version() {
+inline void GetBlockTxsAck::clear_version() {
   _impl_.version_.ClearToEmpty();
 }
-inline const std::string& ContractDependencyBroadcastMsg::version() const {
-  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.version)
+inline const std::string& GetBlockTxsAck::version() const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsAck.version)
   return _internal_version();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ContractDependencyBroadcastMsg::set_version(ArgT0&& arg0, ArgT... args) {
+void GetBlockTxsAck::set_version(ArgT0&& arg0, ArgT... args) {
  
  _impl_.version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:ContractDependencyBroadcastMsg.version)
+  // @@protoc_insertion_point(field_set:GetBlockTxsAck.version)
 }
-inline std::string* ContractDependencyBroadcastMsg::mutable_version() {
+inline std::string* GetBlockTxsAck::mutable_version() {
   std::string* _s = _internal_mutable_version();
-  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.version)
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsAck.version)
   return _s;
 }
-inline const std::string& ContractDependencyBroadcastMsg::_internal_version() const {
+inline const std::string& GetBlockTxsAck::_internal_version() const {
   return _impl_.version_.Get();
 }
-inline void ContractDependencyBroadcastMsg::_internal_set_version(const std::string& value) {
+inline void GetBlockTxsAck::_internal_set_version(const std::string& value) {
   
   _impl_.version_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ContractDependencyBroadcastMsg::_internal_mutable_version() {
+inline std::string* GetBlockTxsAck::_internal_mutable_version() {
   
   return _impl_.version_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ContractDependencyBroadcastMsg::release_version() {
-  // @@protoc_insertion_point(field_release:ContractDependencyBroadcastMsg.version)
+inline std::string* GetBlockTxsAck::release_version() {
+  // @@protoc_insertion_point(field_release:GetBlockTxsAck.version)
   return _impl_.version_.Release();
 }
-inline void ContractDependencyBroadcastMsg::set_allocated_version(std::string* version) {
+inline void GetBlockTxsAck::set_allocated_version(std::string* version) {
   if (version != nullptr) {
     
   } else {
@@ -4939,132 +6366,279 @@ inline void ContractDependencyBroadcastMsg::set_allocated_version(std::string* v
     _impl_.version_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:ContractDependencyBroadcastMsg.version)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockTxsAck.version)
 }
 
-// repeated .ContractDependencyBroadcastMsg.DependencyInfo dependencies = 2;
-inline int ContractDependencyBroadcastMsg::_internal_dependencies_size() const {
-  return _impl_.dependencies_.size();
-}
-inline int ContractDependencyBroadcastMsg::dependencies_size() const {
-  return _internal_dependencies_size();
+// string id = 2;
+inline void GetBlockTxsAck::clear_id() {
+  _impl_.id_.ClearToEmpty();
 }
-inline void ContractDependencyBroadcastMsg::clear_dependencies() {
-  _impl_.dependencies_.Clear();
+inline const std::string& GetBlockTxsAck::id() const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsAck.id)
+  return _internal_id();
 }
-inline ::ContractDependencyBroadcastMsg_DependencyInfo* ContractDependencyBroadcastMsg::mutable_dependencies(int index) {
-  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.dependencies)
-  return _impl_.dependencies_.Mutable(index);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockTxsAck::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockTxsAck.id)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ContractDependencyBroadcastMsg_DependencyInfo >*
-ContractDependencyBroadcastMsg::mutable_dependencies() {
-  // @@protoc_insertion_point(field_mutable_list:ContractDependencyBroadcastMsg.dependencies)
-  return &_impl_.dependencies_;
+inline std::string* GetBlockTxsAck::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsAck.id)
+  return _s;
 }
-inline const ::ContractDependencyBroadcastMsg_DependencyInfo& ContractDependencyBroadcastMsg::_internal_dependencies(int index) const {
-  return _impl_.dependencies_.Get(index);
+inline const std::string& GetBlockTxsAck::_internal_id() const {
+  return _impl_.id_.Get();
 }
-inline const ::ContractDependencyBroadcastMsg_DependencyInfo& ContractDependencyBroadcastMsg::dependencies(int index) const {
-  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.dependencies)
-  return _internal_dependencies(index);
+inline void GetBlockTxsAck::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
 }
-inline ::ContractDependencyBroadcastMsg_DependencyInfo* ContractDependencyBroadcastMsg::_internal_add_dependencies() {
-  return _impl_.dependencies_.Add();
+inline std::string* GetBlockTxsAck::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
 }
-inline ::ContractDependencyBroadcastMsg_DependencyInfo* ContractDependencyBroadcastMsg::add_dependencies() {
-  ::ContractDependencyBroadcastMsg_DependencyInfo* _add = _internal_add_dependencies();
-  // @@protoc_insertion_point(field_add:ContractDependencyBroadcastMsg.dependencies)
-  return _add;
+inline std::string* GetBlockTxsAck::release_id() {
+  // @@protoc_insertion_point(field_release:GetBlockTxsAck.id)
+  return _impl_.id_.Release();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ContractDependencyBroadcastMsg_DependencyInfo >&
-ContractDependencyBroadcastMsg::dependencies() const {
-  // @@protoc_insertion_point(field_list:ContractDependencyBroadcastMsg.dependencies)
-  return _impl_.dependencies_;
+inline void GetBlockTxsAck::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockTxsAck.id)
 }
 
-// .CSign sign = 3;
-inline bool ContractDependencyBroadcastMsg::_internal_has_sign() const {
-  return this != internal_default_instance() && _impl_.sign_ != nullptr;
+// string blockHash = 3;
+inline void GetBlockTxsAck::clear_blockhash() {
+  _impl_.blockhash_.ClearToEmpty();
 }
-inline bool ContractDependencyBroadcastMsg::has_sign() const {
-  return _internal_has_sign();
+inline const std::string& GetBlockTxsAck::blockhash() const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsAck.blockHash)
+  return _internal_blockhash();
 }
-inline const ::CSign& ContractDependencyBroadcastMsg::_internal_sign() const {
-  const ::CSign* p = _impl_.sign_;
-  return p != nullptr ? *p : reinterpret_cast<const ::CSign&>(
-      ::_CSign_default_instance_);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockTxsAck::set_blockhash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.blockhash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockTxsAck.blockHash)
 }
-inline const ::CSign& ContractDependencyBroadcastMsg::sign() const {
-  // @@protoc_insertion_point(field_get:ContractDependencyBroadcastMsg.sign)
-  return _internal_sign();
+inline std::string* GetBlockTxsAck::mutable_blockhash() {
+  std::string* _s = _internal_mutable_blockhash();
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsAck.blockHash)
+  return _s;
 }
-inline void ContractDependencyBroadcastMsg::unsafe_arena_set_allocated_sign(
-    ::CSign* sign) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
-  }
-  _impl_.sign_ = sign;
-  if (sign) {
+inline const std::string& GetBlockTxsAck::_internal_blockhash() const {
+  return _impl_.blockhash_.Get();
+}
+inline void GetBlockTxsAck::_internal_set_blockhash(const std::string& value) {
+  
+  _impl_.blockhash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetBlockTxsAck::_internal_mutable_blockhash() {
+  
+  return _impl_.blockhash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetBlockTxsAck::release_blockhash() {
+  // @@protoc_insertion_point(field_release:GetBlockTxsAck.blockHash)
+  return _impl_.blockhash_.Release();
+}
+inline void GetBlockTxsAck::set_allocated_blockhash(std::string* blockhash) {
+  if (blockhash != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ContractDependencyBroadcastMsg.sign)
-}
-inline ::CSign* ContractDependencyBroadcastMsg::release_sign() {
-  
-  ::CSign* temp = _impl_.sign_;
-  _impl_.sign_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  _impl_.blockhash_.SetAllocated(blockhash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.blockhash_.IsDefault()) {
+    _impl_.blockhash_.Set("", GetArenaForAllocation());
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockTxsAck.blockHash)
 }
-inline ::CSign* ContractDependencyBroadcastMsg::unsafe_arena_release_sign() {
-  // @@protoc_insertion_point(field_release:ContractDependencyBroadcastMsg.sign)
+
+// repeated uint32 indexes = 4;
+inline int GetBlockTxsAck::_internal_indexes_size() const {
+  return _impl_.indexes_.size();
+}
+inline int GetBlockTxsAck::indexes_size() const {
+  return _internal_indexes_size();
+}
+inline void GetBlockTxsAck::clear_indexes() {
+  _impl_.indexes_.Clear();
+}
+inline uint32_t GetBlockTxsAck::_internal_indexes(int index) const {
+  return _impl_.indexes_.Get(index);
+}
+inline uint32_t GetBlockTxsAck::indexes(int index) const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsAck.indexes)
+  return _internal_indexes(index);
+}
+inline void GetBlockTxsAck::set_indexes(int index, uint32_t value) {
+  _impl_.indexes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:GetBlockTxsAck.indexes)
+}
+inline void GetBlockTxsAck::_internal_add_indexes(uint32_t value) {
+  _impl_.indexes_.Add(value);
+}
+inline void GetBlockTxsAck::add_indexes(uint32_t value) {
+  _internal_add_indexes(value);
+  // @@protoc_insertion_point(field_add:GetBlockTxsAck.indexes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GetBlockTxsAck::_internal_indexes() const {
+  return _impl_.indexes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GetBlockTxsAck::indexes() const {
+  // @@protoc_insertion_point(field_list:GetBlockTxsAck.indexes)
+  return _internal_indexes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GetBlockTxsAck::_internal_mutable_indexes() {
+  return &_impl_.indexes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GetBlockTxsAck::mutable_indexes() {
+  // @@protoc_insertion_point(field_mutable_list:GetBlockTxsAck.indexes)
+  return _internal_mutable_indexes();
+}
+
+// repeated bytes txs = 5;
+inline int GetBlockTxsAck::_internal_txs_size() const {
+  return _impl_.txs_.size();
+}
+inline int GetBlockTxsAck::txs_size() const {
+  return _internal_txs_size();
+}
+inline void GetBlockTxsAck::clear_txs() {
+  _impl_.txs_.Clear();
+}
+inline std::string* GetBlockTxsAck::add_txs() {
+  std::string* _s = _internal_add_txs();
+  // @@protoc_insertion_point(field_add_mutable:GetBlockTxsAck.txs)
+  return _s;
+}
+inline const std::string& GetBlockTxsAck::_internal_txs(int index) const {
+  return _impl_.txs_.Get(index);
+}
+inline const std::string& GetBlockTxsAck::txs(int index) const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsAck.txs)
+  return _internal_txs(index);
+}
+inline std::string* GetBlockTxsAck::mutable_txs(int index) {
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsAck.txs)
+  return _impl_.txs_.Mutable(index);
+}
+inline void GetBlockTxsAck::set_txs(int index, const std::string& value) {
+  _impl_.txs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:GetBlockTxsAck.txs)
+}
+inline void GetBlockTxsAck::set_txs(int index, std::string&& value) {
+  _impl_.txs_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:GetBlockTxsAck.txs)
+}
+inline void GetBlockTxsAck::set_txs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.txs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:GetBlockTxsAck.txs)
+}
+inline void GetBlockTxsAck::set_txs(int index, const void* value, size_t size) {
+  _impl_.txs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:GetBlockTxsAck.txs)
+}
+inline std::string* GetBlockTxsAck::_internal_add_txs() {
+  return _impl_.txs_.Add();
+}
+inline void GetBlockTxsAck::add_txs(const std::string& value) {
+  _impl_.txs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:GetBlockTxsAck.txs)
+}
+inline void GetBlockTxsAck::add_txs(std::string&& value) {
+  _impl_.txs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:GetBlockTxsAck.txs)
+}
+inline void GetBlockTxsAck::add_txs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.txs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:GetBlockTxsAck.txs)
+}
+inline void GetBlockTxsAck::add_txs(const void* value, size_t size) {
+  _impl_.txs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:GetBlockTxsAck.txs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+GetBlockTxsAck::txs() const {
+  // @@protoc_insertion_point(field_list:GetBlockTxsAck.txs)
+  return _impl_.txs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+GetBlockTxsAck::mutable_txs() {
+  // @@protoc_insertion_point(field_mutable_list:GetBlockTxsAck.txs)
+  return &_impl_.txs_;
+}
+
+// bytes blockRaw = 6;
+inline void GetBlockTxsAck::clear_blockraw() {
+  _impl_.blockraw_.ClearToEmpty();
+}
+inline const std::string& GetBlockTxsAck::blockraw() const {
+  // @@protoc_insertion_point(field_get:GetBlockTxsAck.blockRaw)
+  return _internal_blockraw();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockTxsAck::set_blockraw(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.blockraw_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockTxsAck.blockRaw)
+}
+inline std::string* GetBlockTxsAck::mutable_blockraw() {
+  std::string* _s = _internal_mutable_blockraw();
+  // @@protoc_insertion_point(field_mutable:GetBlockTxsAck.blockRaw)
+  return _s;
+}
+inline const std::string& GetBlockTxsAck::_internal_blockraw() const {
+  return _impl_.blockraw_.Get();
+}
+inline void GetBlockTxsAck::_internal_set_blockraw(const std::string& value) {
   
-  ::CSign* temp = _impl_.sign_;
-  _impl_.sign_ = nullptr;
-  return temp;
+  _impl_.blockraw_.Set(value, GetArenaForAllocation());
 }
-inline ::CSign* ContractDependencyBroadcastMsg::_internal_mutable_sign() {
+inline std::string* GetBlockTxsAck::_internal_mutable_blockraw() {
   
-  if (_impl_.sign_ == nullptr) {
-    auto* p = CreateMaybeMessage<::CSign>(GetArenaForAllocation());
-    _impl_.sign_ = p;
-  }
-  return _impl_.sign_;
+  return _impl_.blockraw_.Mutable(GetArenaForAllocation());
 }
-inline ::CSign* ContractDependencyBroadcastMsg::mutable_sign() {
-  ::CSign* _msg = _internal_mutable_sign();
-  // @@protoc_insertion_point(field_mutable:ContractDependencyBroadcastMsg.sign)
-  return _msg;
+inline std::string* GetBlockTxsAck::release_blockraw() {
+  // @@protoc_insertion_point(field_release:GetBlockTxsAck.blockRaw)
+  return _impl_.blockraw_.Release();
 }
-inline void ContractDependencyBroadcastMsg::set_allocated_sign(::CSign* sign) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sign_);
-  }
-  if (sign) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sign));
-    if (message_arena != submessage_arena) {
-      sign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, sign, submessage_arena);
-    }
+inline void GetBlockTxsAck::set_allocated_blockraw(std::string* blockraw) {
+  if (blockraw != nullptr) {
     
   } else {
     
   }
-  _impl_.sign_ = sign;
-  // @@protoc_insertion_point(field_set_allocated:ContractDependencyBroadcastMsg.sign)
+  _impl_.blockraw_.SetAllocated(blockraw, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.blockraw_.IsDefault()) {
+    _impl_.blockraw_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockTxsAck.blockRaw)
 }
 
 #ifdef __GNUC__
@@ -5094,6 +6668,12 @@ inline void ContractDependencyBroadcastMsg::set_allocated_sign(::CSign* sign) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
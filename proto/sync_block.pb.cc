@@ -463,7 +463,189 @@ struct GetCheckSumHashAckDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCheckSumHashAckDefaultTypeInternal _GetCheckSumHashAck_default_instance_;
-static ::_pb::Metadata file_level_metadata_sync_5fblock_2eproto[29];
+PROTOBUF_CONSTEXPR SyncBlockSummary::SyncBlockSummary(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signers_)*/{}
+  , /*decltype(_impl_.hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prev_hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.merkle_root_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.height_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncBlockSummaryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncBlockSummaryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncBlockSummaryDefaultTypeInternal() {}
+  union {
+    SyncBlockSummary _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncBlockSummaryDefaultTypeInternal _SyncBlockSummary_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetBlockSummaryReq::SyncGetBlockSummaryReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_height_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_height_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetBlockSummaryReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetBlockSummaryReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetBlockSummaryReqDefaultTypeInternal() {}
+  union {
+    SyncGetBlockSummaryReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetBlockSummaryReqDefaultTypeInternal _SyncGetBlockSummaryReq_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetBlockSummaryAck::SyncGetBlockSummaryAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.summaries_)*/{}
+  , /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node_block_height_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetBlockSummaryAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetBlockSummaryAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetBlockSummaryAckDefaultTypeInternal() {}
+  union {
+    SyncGetBlockSummaryAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetBlockSummaryAckDefaultTypeInternal _SyncGetBlockSummaryAck_default_instance_;
+PROTOBUF_CONSTEXPR SyncSumTreeNode::SyncSumTreeNode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.index_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncSumTreeNodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncSumTreeNodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncSumTreeNodeDefaultTypeInternal() {}
+  union {
+    SyncSumTreeNode _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncSumTreeNodeDefaultTypeInternal _SyncSumTreeNode_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetSumTreeReq::SyncGetSumTreeReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.level_)*/0u
+  , /*decltype(_impl_.count_)*/0u
+  , /*decltype(_impl_.max_height_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetSumTreeReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetSumTreeReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetSumTreeReqDefaultTypeInternal() {}
+  union {
+    SyncGetSumTreeReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetSumTreeReqDefaultTypeInternal _SyncGetSumTreeReq_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetSumTreeAck::SyncGetSumTreeAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nodes_)*/{}
+  , /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.code_)*/0
+  , /*decltype(_impl_.level_)*/0u
+  , /*decltype(_impl_.node_block_height_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetSumTreeAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetSumTreeAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetSumTreeAckDefaultTypeInternal() {}
+  union {
+    SyncGetSumTreeAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetSumTreeAckDefaultTypeInternal _SyncGetSumTreeAck_default_instance_;
+PROTOBUF_CONSTEXPR SnapshotManifest::SnapshotManifest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.chunk_hashes_)*/{}
+  , /*decltype(_impl_.chain_hash_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.root_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.height_)*/uint64_t{0u}
+  , /*decltype(_impl_.key_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SnapshotManifestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SnapshotManifestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SnapshotManifestDefaultTypeInternal() {}
+  union {
+    SnapshotManifest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SnapshotManifestDefaultTypeInternal _SnapshotManifest_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetSnapshotManifestReq::SyncGetSnapshotManifestReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetSnapshotManifestReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetSnapshotManifestReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetSnapshotManifestReqDefaultTypeInternal() {}
+  union {
+    SyncGetSnapshotManifestReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetSnapshotManifestReqDefaultTypeInternal _SyncGetSnapshotManifestReq_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetSnapshotManifestAck::SyncGetSnapshotManifestAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.manifest_)*/nullptr
+  , /*decltype(_impl_.node_block_height_)*/uint64_t{0u}
+  , /*decltype(_impl_.code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetSnapshotManifestAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetSnapshotManifestAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetSnapshotManifestAckDefaultTypeInternal() {}
+  union {
+    SyncGetSnapshotManifestAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetSnapshotManifestAckDefaultTypeInternal _SyncGetSnapshotManifestAck_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetSnapshotChunkReq::SyncGetSnapshotChunkReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.height_)*/uint64_t{0u}
+  , /*decltype(_impl_.index_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetSnapshotChunkReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetSnapshotChunkReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetSnapshotChunkReqDefaultTypeInternal() {}
+  union {
+    SyncGetSnapshotChunkReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetSnapshotChunkReqDefaultTypeInternal _SyncGetSnapshotChunkReq_default_instance_;
+PROTOBUF_CONSTEXPR SyncGetSnapshotChunkAck::SyncGetSnapshotChunkAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.self_node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.code_)*/0
+  , /*decltype(_impl_.index_)*/0u
+  , /*decltype(_impl_.height_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncGetSnapshotChunkAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncGetSnapshotChunkAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncGetSnapshotChunkAckDefaultTypeInternal() {}
+  union {
+    SyncGetSnapshotChunkAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetSnapshotChunkAckDefaultTypeInternal _SyncGetSnapshotChunkAck_default_instance_;
+static ::_pb::Metadata file_level_metadata_sync_5fblock_2eproto[40];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_sync_5fblock_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_sync_5fblock_2eproto = nullptr;
 
@@ -736,6 +918,122 @@ const uint32_t TableStruct_sync_5fblock_2eproto::offsets[] PROTOBUF_SECTION_VARI
   PROTOBUF_FIELD_OFFSET(::GetCheckSumHashAck, _impl_.msg_id_),
   PROTOBUF_FIELD_OFFSET(::GetCheckSumHashAck, _impl_.success_),
   PROTOBUF_FIELD_OFFSET(::GetCheckSumHashAck, _impl_.self_node_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncBlockSummary, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncBlockSummary, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::SyncBlockSummary, _impl_.hash_),
+  PROTOBUF_FIELD_OFFSET(::SyncBlockSummary, _impl_.prev_hash_),
+  PROTOBUF_FIELD_OFFSET(::SyncBlockSummary, _impl_.merkle_root_),
+  PROTOBUF_FIELD_OFFSET(::SyncBlockSummary, _impl_.signers_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryReq, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryReq, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryReq, _impl_.start_height_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryReq, _impl_.end_height_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryAck, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryAck, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryAck, _impl_.node_block_height_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetBlockSummaryAck, _impl_.summaries_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncSumTreeNode, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncSumTreeNode, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::SyncSumTreeNode, _impl_.hash_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeReq, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeReq, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeReq, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeReq, _impl_.start_index_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeReq, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeReq, _impl_.max_height_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeAck, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeAck, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeAck, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeAck, _impl_.node_block_height_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeAck, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSumTreeAck, _impl_.nodes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SnapshotManifest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SnapshotManifest, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::SnapshotManifest, _impl_.chain_hash_),
+  PROTOBUF_FIELD_OFFSET(::SnapshotManifest, _impl_.chunk_hashes_),
+  PROTOBUF_FIELD_OFFSET(::SnapshotManifest, _impl_.key_count_),
+  PROTOBUF_FIELD_OFFSET(::SnapshotManifest, _impl_.total_bytes_),
+  PROTOBUF_FIELD_OFFSET(::SnapshotManifest, _impl_.root_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestReq, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestReq, _impl_.msg_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestAck, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestAck, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestAck, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestAck, _impl_.node_block_height_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotManifestAck, _impl_.manifest_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkReq, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkReq, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkReq, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkReq, _impl_.index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkAck, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkAck, _impl_.self_node_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkAck, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkAck, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkAck, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::SyncGetSnapshotChunkAck, _impl_.data_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::FastSyncGetHashReq)},
@@ -767,6 +1065,17 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 239, -1, -1, sizeof(::SyncNodeHashAck)},
   { 248, -1, -1, sizeof(::GetCheckSumHashReq)},
   { 257, -1, -1, sizeof(::GetCheckSumHashAck)},
+  { 268, -1, -1, sizeof(::SyncBlockSummary)},
+  { 279, -1, -1, sizeof(::SyncGetBlockSummaryReq)},
+  { 289, -1, -1, sizeof(::SyncGetBlockSummaryAck)},
+  { 299, -1, -1, sizeof(::SyncSumTreeNode)},
+  { 307, -1, -1, sizeof(::SyncGetSumTreeReq)},
+  { 319, -1, -1, sizeof(::SyncGetSumTreeAck)},
+  { 331, -1, -1, sizeof(::SnapshotManifest)},
+  { 343, -1, -1, sizeof(::SyncGetSnapshotManifestReq)},
+  { 351, -1, -1, sizeof(::SyncGetSnapshotManifestAck)},
+  { 362, -1, -1, sizeof(::SyncGetSnapshotChunkReq)},
+  { 372, -1, -1, sizeof(::SyncGetSnapshotChunkAck)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -799,6 +1108,17 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::_SyncNodeHashAck_default_instance_._instance,
   &::_GetCheckSumHashReq_default_instance_._instance,
   &::_GetCheckSumHashAck_default_instance_._instance,
+  &::_SyncBlockSummary_default_instance_._instance,
+  &::_SyncGetBlockSummaryReq_default_instance_._instance,
+  &::_SyncGetBlockSummaryAck_default_instance_._instance,
+  &::_SyncSumTreeNode_default_instance_._instance,
+  &::_SyncGetSumTreeReq_default_instance_._instance,
+  &::_SyncGetSumTreeAck_default_instance_._instance,
+  &::_SnapshotManifest_default_instance_._instance,
+  &::_SyncGetSnapshotManifestReq_default_instance_._instance,
+  &::_SyncGetSnapshotManifestAck_default_instance_._instance,
+  &::_SyncGetSnapshotChunkReq_default_instance_._instance,
+  &::_SyncGetSnapshotChunkAck_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_sync_5fblock_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -864,13 +1184,44 @@ const char descriptor_table_protodef_sync_5fblock_2eproto[] PROTOBUF_SECTION_VAR
   "\014self_node_id\030\003 \001(\t\"i\n\022GetCheckSumHashAc"
   "k\022\016\n\006height\030\001 \001(\004\022\014\n\004hash\030\002 \001(\t\022\016\n\006msg_i"
   "d\030\003 \001(\t\022\017\n\007success\030\004 \001(\010\022\024\n\014self_node_id"
-  "\030\005 \001(\tb\006proto3"
+  "\030\005 \001(\t\"i\n\020SyncBlockSummary\022\016\n\006height\030\001 \001"
+  "(\004\022\014\n\004hash\030\002 \001(\t\022\021\n\tprev_hash\030\003 \001(\t\022\023\n\013m"
+  "erkle_root\030\004 \001(\t\022\017\n\007signers\030\005 \003(\014\"h\n\026Syn"
+  "cGetBlockSummaryReq\022\024\n\014self_node_id\030\001 \001("
+  "\t\022\016\n\006msg_id\030\002 \001(\t\022\024\n\014start_height\030\003 \001(\004\022"
+  "\022\n\nend_height\030\004 \001(\004\"\177\n\026SyncGetBlockSumma"
+  "ryAck\022\024\n\014self_node_id\030\001 \001(\t\022\016\n\006msg_id\030\002 "
+  "\001(\t\022\031\n\021node_block_height\030\003 \001(\004\022$\n\tsummar"
+  "ies\030\004 \003(\0132\021.SyncBlockSummary\".\n\017SyncSumT"
+  "reeNode\022\r\n\005index\030\001 \001(\004\022\014\n\004hash\030\002 \001(\t\"\200\001\n"
+  "\021SyncGetSumTreeReq\022\024\n\014self_node_id\030\001 \001(\t"
+  "\022\016\n\006msg_id\030\002 \001(\t\022\r\n\005level\030\003 \001(\r\022\023\n\013start"
+  "_index\030\004 \001(\004\022\r\n\005count\030\005 \001(\r\022\022\n\nmax_heigh"
+  "t\030\006 \001(\004\"\222\001\n\021SyncGetSumTreeAck\022\014\n\004code\030\001 "
+  "\001(\005\022\024\n\014self_node_id\030\002 \001(\t\022\016\n\006msg_id\030\003 \001("
+  "\t\022\031\n\021node_block_height\030\004 \001(\004\022\r\n\005level\030\005 "
+  "\001(\r\022\037\n\005nodes\030\006 \003(\0132\020.SyncSumTreeNode\"\202\001\n"
+  "\020SnapshotManifest\022\016\n\006height\030\001 \001(\004\022\022\n\ncha"
+  "in_hash\030\002 \001(\t\022\024\n\014chunk_hashes\030\003 \003(\t\022\021\n\tk"
+  "ey_count\030\004 \001(\004\022\023\n\013total_bytes\030\005 \001(\004\022\014\n\004r"
+  "oot\030\006 \001(\t\"B\n\032SyncGetSnapshotManifestReq\022"
+  "\024\n\014self_node_id\030\001 \001(\t\022\016\n\006msg_id\030\002 \001(\t\"\220\001"
+  "\n\032SyncGetSnapshotManifestAck\022\014\n\004code\030\001 \001"
+  "(\005\022\024\n\014self_node_id\030\002 \001(\t\022\016\n\006msg_id\030\003 \001(\t"
+  "\022\031\n\021node_block_height\030\004 \001(\004\022#\n\010manifest\030"
+  "\005 \001(\0132\021.SnapshotManifest\"^\n\027SyncGetSnaps"
+  "hotChunkReq\022\024\n\014self_node_id\030\001 \001(\t\022\016\n\006msg"
+  "_id\030\002 \001(\t\022\016\n\006height\030\003 \001(\004\022\r\n\005index\030\004 \001(\r"
+  "\"z\n\027SyncGetSnapshotChunkAck\022\014\n\004code\030\001 \001("
+  "\005\022\024\n\014self_node_id\030\002 \001(\t\022\016\n\006msg_id\030\003 \001(\t\022"
+  "\016\n\006height\030\004 \001(\004\022\r\n\005index\030\005 \001(\r\022\014\n\004data\030\006"
+  " \001(\014b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_sync_5fblock_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_sync_5fblock_2eproto = {
-    false, false, 2494, descriptor_table_protodef_sync_5fblock_2eproto,
+    false, false, 3732, descriptor_table_protodef_sync_5fblock_2eproto,
     "sync_block.proto",
-    &descriptor_table_sync_5fblock_2eproto_once, nullptr, 0, 29,
+    &descriptor_table_sync_5fblock_2eproto_once, nullptr, 0, 40,
     schemas, file_default_instances, TableStruct_sync_5fblock_2eproto::offsets,
     file_level_metadata_sync_5fblock_2eproto, file_level_enum_descriptors_sync_5fblock_2eproto,
     file_level_service_descriptors_sync_5fblock_2eproto,
@@ -9277,50 +9628,3681 @@ void GetCheckSumHashAck::InternalSwap(GetCheckSumHashAck* other) {
       file_level_metadata_sync_5fblock_2eproto[28]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::FastSyncGetHashReq*
-Arena::CreateMaybeMessage< ::FastSyncGetHashReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::FastSyncGetHashReq >(arena);
-}
-template<> PROTOBUF_NOINLINE ::FastSyncBlockHashs*
-Arena::CreateMaybeMessage< ::FastSyncBlockHashs >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::FastSyncBlockHashs >(arena);
-}
-template<> PROTOBUF_NOINLINE ::FastSyncGetHashAck*
-Arena::CreateMaybeMessage< ::FastSyncGetHashAck >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::FastSyncGetHashAck >(arena);
-}
-template<> PROTOBUF_NOINLINE ::FastSyncGetBlockReq*
-Arena::CreateMaybeMessage< ::FastSyncGetBlockReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::FastSyncGetBlockReq >(arena);
+// ===================================================================
+
+class SyncBlockSummary::_Internal {
+ public:
+};
+
+SyncBlockSummary::SyncBlockSummary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncBlockSummary)
 }
-template<> PROTOBUF_NOINLINE ::FastSyncBlock*
-Arena::CreateMaybeMessage< ::FastSyncBlock >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::FastSyncBlock >(arena);
+SyncBlockSummary::SyncBlockSummary(const SyncBlockSummary& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncBlockSummary* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signers_){from._impl_.signers_}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.prev_hash_){}
+    , decltype(_impl_.merkle_root_){}
+    , decltype(_impl_.height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hash().empty()) {
+    _this->_impl_.hash_.Set(from._internal_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.prev_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prev_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prev_hash().empty()) {
+    _this->_impl_.prev_hash_.Set(from._internal_prev_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.merkle_root_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.merkle_root_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_merkle_root().empty()) {
+    _this->_impl_.merkle_root_.Set(from._internal_merkle_root(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.height_ = from._impl_.height_;
+  // @@protoc_insertion_point(copy_constructor:SyncBlockSummary)
 }
-template<> PROTOBUF_NOINLINE ::FastSyncGetBlockAck*
-Arena::CreateMaybeMessage< ::FastSyncGetBlockAck >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::FastSyncGetBlockAck >(arena);
+
+inline void SyncBlockSummary::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signers_){arena}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.prev_hash_){}
+    , decltype(_impl_.merkle_root_){}
+    , decltype(_impl_.height_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.prev_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prev_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.merkle_root_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.merkle_root_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-template<> PROTOBUF_NOINLINE ::SyncGetSumHashReq*
-Arena::CreateMaybeMessage< ::SyncGetSumHashReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::SyncGetSumHashReq >(arena);
+
+SyncBlockSummary::~SyncBlockSummary() {
+  // @@protoc_insertion_point(destructor:SyncBlockSummary)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::SyncSumHash*
-Arena::CreateMaybeMessage< ::SyncSumHash >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::SyncSumHash >(arena);
+
+inline void SyncBlockSummary::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signers_.~RepeatedPtrField();
+  _impl_.hash_.Destroy();
+  _impl_.prev_hash_.Destroy();
+  _impl_.merkle_root_.Destroy();
 }
-template<> PROTOBUF_NOINLINE ::SyncGetSumHashAck*
-Arena::CreateMaybeMessage< ::SyncGetSumHashAck >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::SyncGetSumHashAck >(arena);
+
+void SyncBlockSummary::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::SyncGetHeightHashReq*
-Arena::CreateMaybeMessage< ::SyncGetHeightHashReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::SyncGetHeightHashReq >(arena);
+
+void SyncBlockSummary::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncBlockSummary)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signers_.Clear();
+  _impl_.hash_.ClearToEmpty();
+  _impl_.prev_hash_.ClearToEmpty();
+  _impl_.merkle_root_.ClearToEmpty();
+  _impl_.height_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::SyncGetHeightHashAck*
-Arena::CreateMaybeMessage< ::SyncGetHeightHashAck >(Arena* arena) {
+
+const char* SyncBlockSummary::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 height = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncBlockSummary.hash"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string prev_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_prev_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncBlockSummary.prev_hash"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string merkle_root = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_merkle_root();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncBlockSummary.merkle_root"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes signers = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_signers();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncBlockSummary::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncBlockSummary)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 height = 1;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_height(), target);
+  }
+
+  // string hash = 2;
+  if (!this->_internal_hash().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_hash().data(), static_cast<int>(this->_internal_hash().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncBlockSummary.hash");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_hash(), target);
+  }
+
+  // string prev_hash = 3;
+  if (!this->_internal_prev_hash().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_prev_hash().data(), static_cast<int>(this->_internal_prev_hash().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncBlockSummary.prev_hash");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_prev_hash(), target);
+  }
+
+  // string merkle_root = 4;
+  if (!this->_internal_merkle_root().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_merkle_root().data(), static_cast<int>(this->_internal_merkle_root().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncBlockSummary.merkle_root");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_merkle_root(), target);
+  }
+
+  // repeated bytes signers = 5;
+  for (int i = 0, n = this->_internal_signers_size(); i < n; i++) {
+    const auto& s = this->_internal_signers(i);
+    target = stream->WriteBytes(5, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncBlockSummary)
+  return target;
+}
+
+size_t SyncBlockSummary::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncBlockSummary)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes signers = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.signers_.size());
+  for (int i = 0, n = _impl_.signers_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.signers_.Get(i));
+  }
+
+  // string hash = 2;
+  if (!this->_internal_hash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hash());
+  }
+
+  // string prev_hash = 3;
+  if (!this->_internal_prev_hash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_prev_hash());
+  }
+
+  // string merkle_root = 4;
+  if (!this->_internal_merkle_root().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_merkle_root());
+  }
+
+  // uint64 height = 1;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncBlockSummary::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncBlockSummary::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncBlockSummary::GetClassData() const { return &_class_data_; }
+
+
+void SyncBlockSummary::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncBlockSummary*>(&to_msg);
+  auto& from = static_cast<const SyncBlockSummary&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncBlockSummary)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.signers_.MergeFrom(from._impl_.signers_);
+  if (!from._internal_hash().empty()) {
+    _this->_internal_set_hash(from._internal_hash());
+  }
+  if (!from._internal_prev_hash().empty()) {
+    _this->_internal_set_prev_hash(from._internal_prev_hash());
+  }
+  if (!from._internal_merkle_root().empty()) {
+    _this->_internal_set_merkle_root(from._internal_merkle_root());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncBlockSummary::CopyFrom(const SyncBlockSummary& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncBlockSummary)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncBlockSummary::IsInitialized() const {
+  return true;
+}
+
+void SyncBlockSummary::InternalSwap(SyncBlockSummary* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.signers_.InternalSwap(&other->_impl_.signers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hash_, lhs_arena,
+      &other->_impl_.hash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prev_hash_, lhs_arena,
+      &other->_impl_.prev_hash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.merkle_root_, lhs_arena,
+      &other->_impl_.merkle_root_, rhs_arena
+  );
+  swap(_impl_.height_, other->_impl_.height_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncBlockSummary::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[29]);
+}
+
+// ===================================================================
+
+class SyncGetBlockSummaryReq::_Internal {
+ public:
+};
+
+SyncGetBlockSummaryReq::SyncGetBlockSummaryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetBlockSummaryReq)
+}
+SyncGetBlockSummaryReq::SyncGetBlockSummaryReq(const SyncGetBlockSummaryReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetBlockSummaryReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.start_height_){}
+    , decltype(_impl_.end_height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.start_height_, &from._impl_.start_height_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_height_) -
+    reinterpret_cast<char*>(&_impl_.start_height_)) + sizeof(_impl_.end_height_));
+  // @@protoc_insertion_point(copy_constructor:SyncGetBlockSummaryReq)
+}
+
+inline void SyncGetBlockSummaryReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.start_height_){uint64_t{0u}}
+    , decltype(_impl_.end_height_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetBlockSummaryReq::~SyncGetBlockSummaryReq() {
+  // @@protoc_insertion_point(destructor:SyncGetBlockSummaryReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetBlockSummaryReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+}
+
+void SyncGetBlockSummaryReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetBlockSummaryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetBlockSummaryReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  ::memset(&_impl_.start_height_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.end_height_) -
+      reinterpret_cast<char*>(&_impl_.start_height_)) + sizeof(_impl_.end_height_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetBlockSummaryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string self_node_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetBlockSummaryReq.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetBlockSummaryReq.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 start_height = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.start_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 end_height = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.end_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetBlockSummaryReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetBlockSummaryReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetBlockSummaryReq.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetBlockSummaryReq.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg_id(), target);
+  }
+
+  // uint64 start_height = 3;
+  if (this->_internal_start_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_start_height(), target);
+  }
+
+  // uint64 end_height = 4;
+  if (this->_internal_end_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_end_height(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetBlockSummaryReq)
+  return target;
+}
+
+size_t SyncGetBlockSummaryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetBlockSummaryReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  // uint64 start_height = 3;
+  if (this->_internal_start_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_height());
+  }
+
+  // uint64 end_height = 4;
+  if (this->_internal_end_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetBlockSummaryReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetBlockSummaryReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetBlockSummaryReq::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetBlockSummaryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetBlockSummaryReq*>(&to_msg);
+  auto& from = static_cast<const SyncGetBlockSummaryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetBlockSummaryReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  if (from._internal_start_height() != 0) {
+    _this->_internal_set_start_height(from._internal_start_height());
+  }
+  if (from._internal_end_height() != 0) {
+    _this->_internal_set_end_height(from._internal_end_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetBlockSummaryReq::CopyFrom(const SyncGetBlockSummaryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetBlockSummaryReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetBlockSummaryReq::IsInitialized() const {
+  return true;
+}
+
+void SyncGetBlockSummaryReq::InternalSwap(SyncGetBlockSummaryReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncGetBlockSummaryReq, _impl_.end_height_)
+      + sizeof(SyncGetBlockSummaryReq::_impl_.end_height_)
+      - PROTOBUF_FIELD_OFFSET(SyncGetBlockSummaryReq, _impl_.start_height_)>(
+          reinterpret_cast<char*>(&_impl_.start_height_),
+          reinterpret_cast<char*>(&other->_impl_.start_height_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetBlockSummaryReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[30]);
+}
+
+// ===================================================================
+
+class SyncGetBlockSummaryAck::_Internal {
+ public:
+};
+
+SyncGetBlockSummaryAck::SyncGetBlockSummaryAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetBlockSummaryAck)
+}
+SyncGetBlockSummaryAck::SyncGetBlockSummaryAck(const SyncGetBlockSummaryAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetBlockSummaryAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.summaries_){from._impl_.summaries_}
+    , decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.node_block_height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.node_block_height_ = from._impl_.node_block_height_;
+  // @@protoc_insertion_point(copy_constructor:SyncGetBlockSummaryAck)
+}
+
+inline void SyncGetBlockSummaryAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.summaries_){arena}
+    , decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.node_block_height_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetBlockSummaryAck::~SyncGetBlockSummaryAck() {
+  // @@protoc_insertion_point(destructor:SyncGetBlockSummaryAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetBlockSummaryAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.summaries_.~RepeatedPtrField();
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+}
+
+void SyncGetBlockSummaryAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetBlockSummaryAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetBlockSummaryAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.summaries_.Clear();
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  _impl_.node_block_height_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetBlockSummaryAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string self_node_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetBlockSummaryAck.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetBlockSummaryAck.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 node_block_height = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.node_block_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SyncBlockSummary summaries = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_summaries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetBlockSummaryAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetBlockSummaryAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetBlockSummaryAck.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetBlockSummaryAck.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg_id(), target);
+  }
+
+  // uint64 node_block_height = 3;
+  if (this->_internal_node_block_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_node_block_height(), target);
+  }
+
+  // repeated .SyncBlockSummary summaries = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_summaries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_summaries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetBlockSummaryAck)
+  return target;
+}
+
+size_t SyncGetBlockSummaryAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetBlockSummaryAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .SyncBlockSummary summaries = 4;
+  total_size += 1UL * this->_internal_summaries_size();
+  for (const auto& msg : this->_impl_.summaries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  // uint64 node_block_height = 3;
+  if (this->_internal_node_block_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_node_block_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetBlockSummaryAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetBlockSummaryAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetBlockSummaryAck::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetBlockSummaryAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetBlockSummaryAck*>(&to_msg);
+  auto& from = static_cast<const SyncGetBlockSummaryAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetBlockSummaryAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.summaries_.MergeFrom(from._impl_.summaries_);
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  if (from._internal_node_block_height() != 0) {
+    _this->_internal_set_node_block_height(from._internal_node_block_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetBlockSummaryAck::CopyFrom(const SyncGetBlockSummaryAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetBlockSummaryAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetBlockSummaryAck::IsInitialized() const {
+  return true;
+}
+
+void SyncGetBlockSummaryAck::InternalSwap(SyncGetBlockSummaryAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.summaries_.InternalSwap(&other->_impl_.summaries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+  swap(_impl_.node_block_height_, other->_impl_.node_block_height_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetBlockSummaryAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[31]);
+}
+
+// ===================================================================
+
+class SyncSumTreeNode::_Internal {
+ public:
+};
+
+SyncSumTreeNode::SyncSumTreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncSumTreeNode)
+}
+SyncSumTreeNode::SyncSumTreeNode(const SyncSumTreeNode& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncSumTreeNode* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hash_){}
+    , decltype(_impl_.index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hash().empty()) {
+    _this->_impl_.hash_.Set(from._internal_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.index_ = from._impl_.index_;
+  // @@protoc_insertion_point(copy_constructor:SyncSumTreeNode)
+}
+
+inline void SyncSumTreeNode::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hash_){}
+    , decltype(_impl_.index_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncSumTreeNode::~SyncSumTreeNode() {
+  // @@protoc_insertion_point(destructor:SyncSumTreeNode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncSumTreeNode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hash_.Destroy();
+}
+
+void SyncSumTreeNode::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncSumTreeNode::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncSumTreeNode)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hash_.ClearToEmpty();
+  _impl_.index_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncSumTreeNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncSumTreeNode.hash"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncSumTreeNode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncSumTreeNode)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_index(), target);
+  }
+
+  // string hash = 2;
+  if (!this->_internal_hash().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_hash().data(), static_cast<int>(this->_internal_hash().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncSumTreeNode.hash");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncSumTreeNode)
+  return target;
+}
+
+size_t SyncSumTreeNode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncSumTreeNode)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string hash = 2;
+  if (!this->_internal_hash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hash());
+  }
+
+  // uint64 index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncSumTreeNode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncSumTreeNode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncSumTreeNode::GetClassData() const { return &_class_data_; }
+
+
+void SyncSumTreeNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncSumTreeNode*>(&to_msg);
+  auto& from = static_cast<const SyncSumTreeNode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncSumTreeNode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_hash().empty()) {
+    _this->_internal_set_hash(from._internal_hash());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncSumTreeNode::CopyFrom(const SyncSumTreeNode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncSumTreeNode)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncSumTreeNode::IsInitialized() const {
+  return true;
+}
+
+void SyncSumTreeNode::InternalSwap(SyncSumTreeNode* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hash_, lhs_arena,
+      &other->_impl_.hash_, rhs_arena
+  );
+  swap(_impl_.index_, other->_impl_.index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncSumTreeNode::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[32]);
+}
+
+// ===================================================================
+
+class SyncGetSumTreeReq::_Internal {
+ public:
+};
+
+SyncGetSumTreeReq::SyncGetSumTreeReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetSumTreeReq)
+}
+SyncGetSumTreeReq::SyncGetSumTreeReq(const SyncGetSumTreeReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetSumTreeReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.start_index_){}
+    , decltype(_impl_.level_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.max_height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.start_index_, &from._impl_.start_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_height_) -
+    reinterpret_cast<char*>(&_impl_.start_index_)) + sizeof(_impl_.max_height_));
+  // @@protoc_insertion_point(copy_constructor:SyncGetSumTreeReq)
+}
+
+inline void SyncGetSumTreeReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.start_index_){uint64_t{0u}}
+    , decltype(_impl_.level_){0u}
+    , decltype(_impl_.count_){0u}
+    , decltype(_impl_.max_height_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetSumTreeReq::~SyncGetSumTreeReq() {
+  // @@protoc_insertion_point(destructor:SyncGetSumTreeReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetSumTreeReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+}
+
+void SyncGetSumTreeReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetSumTreeReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetSumTreeReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  ::memset(&_impl_.start_index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_height_) -
+      reinterpret_cast<char*>(&_impl_.start_index_)) + sizeof(_impl_.max_height_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetSumTreeReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string self_node_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSumTreeReq.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSumTreeReq.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 level = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 start_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.start_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_height = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.max_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetSumTreeReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetSumTreeReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSumTreeReq.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSumTreeReq.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg_id(), target);
+  }
+
+  // uint32 level = 3;
+  if (this->_internal_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_level(), target);
+  }
+
+  // uint64 start_index = 4;
+  if (this->_internal_start_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_start_index(), target);
+  }
+
+  // uint32 count = 5;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_count(), target);
+  }
+
+  // uint64 max_height = 6;
+  if (this->_internal_max_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_max_height(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetSumTreeReq)
+  return target;
+}
+
+size_t SyncGetSumTreeReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetSumTreeReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  // uint64 start_index = 4;
+  if (this->_internal_start_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_index());
+  }
+
+  // uint32 level = 3;
+  if (this->_internal_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+  }
+
+  // uint32 count = 5;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 max_height = 6;
+  if (this->_internal_max_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetSumTreeReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetSumTreeReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetSumTreeReq::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetSumTreeReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetSumTreeReq*>(&to_msg);
+  auto& from = static_cast<const SyncGetSumTreeReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetSumTreeReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  if (from._internal_start_index() != 0) {
+    _this->_internal_set_start_index(from._internal_start_index());
+  }
+  if (from._internal_level() != 0) {
+    _this->_internal_set_level(from._internal_level());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_max_height() != 0) {
+    _this->_internal_set_max_height(from._internal_max_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetSumTreeReq::CopyFrom(const SyncGetSumTreeReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetSumTreeReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetSumTreeReq::IsInitialized() const {
+  return true;
+}
+
+void SyncGetSumTreeReq::InternalSwap(SyncGetSumTreeReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncGetSumTreeReq, _impl_.max_height_)
+      + sizeof(SyncGetSumTreeReq::_impl_.max_height_)
+      - PROTOBUF_FIELD_OFFSET(SyncGetSumTreeReq, _impl_.start_index_)>(
+          reinterpret_cast<char*>(&_impl_.start_index_),
+          reinterpret_cast<char*>(&other->_impl_.start_index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetSumTreeReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[33]);
+}
+
+// ===================================================================
+
+class SyncGetSumTreeAck::_Internal {
+ public:
+};
+
+SyncGetSumTreeAck::SyncGetSumTreeAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetSumTreeAck)
+}
+SyncGetSumTreeAck::SyncGetSumTreeAck(const SyncGetSumTreeAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetSumTreeAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){from._impl_.nodes_}
+    , decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.level_){}
+    , decltype(_impl_.node_block_height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.code_, &from._impl_.code_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.node_block_height_) -
+    reinterpret_cast<char*>(&_impl_.code_)) + sizeof(_impl_.node_block_height_));
+  // @@protoc_insertion_point(copy_constructor:SyncGetSumTreeAck)
+}
+
+inline void SyncGetSumTreeAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){arena}
+    , decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.code_){0}
+    , decltype(_impl_.level_){0u}
+    , decltype(_impl_.node_block_height_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetSumTreeAck::~SyncGetSumTreeAck() {
+  // @@protoc_insertion_point(destructor:SyncGetSumTreeAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetSumTreeAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_.~RepeatedPtrField();
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+}
+
+void SyncGetSumTreeAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetSumTreeAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetSumTreeAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_.Clear();
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  ::memset(&_impl_.code_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.node_block_height_) -
+      reinterpret_cast<char*>(&_impl_.code_)) + sizeof(_impl_.node_block_height_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetSumTreeAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string self_node_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSumTreeAck.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSumTreeAck.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 node_block_height = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.node_block_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 level = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SyncSumTreeNode nodes = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_nodes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetSumTreeAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetSumTreeAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_code(), target);
+  }
+
+  // string self_node_id = 2;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSumTreeAck.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 3;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSumTreeAck.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_msg_id(), target);
+  }
+
+  // uint64 node_block_height = 4;
+  if (this->_internal_node_block_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_node_block_height(), target);
+  }
+
+  // uint32 level = 5;
+  if (this->_internal_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_level(), target);
+  }
+
+  // repeated .SyncSumTreeNode nodes = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nodes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetSumTreeAck)
+  return target;
+}
+
+size_t SyncGetSumTreeAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetSumTreeAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .SyncSumTreeNode nodes = 6;
+  total_size += 1UL * this->_internal_nodes_size();
+  for (const auto& msg : this->_impl_.nodes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string self_node_id = 2;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 3;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_code());
+  }
+
+  // uint32 level = 5;
+  if (this->_internal_level() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+  }
+
+  // uint64 node_block_height = 4;
+  if (this->_internal_node_block_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_node_block_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetSumTreeAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetSumTreeAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetSumTreeAck::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetSumTreeAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetSumTreeAck*>(&to_msg);
+  auto& from = static_cast<const SyncGetSumTreeAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetSumTreeAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodes_.MergeFrom(from._impl_.nodes_);
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  if (from._internal_code() != 0) {
+    _this->_internal_set_code(from._internal_code());
+  }
+  if (from._internal_level() != 0) {
+    _this->_internal_set_level(from._internal_level());
+  }
+  if (from._internal_node_block_height() != 0) {
+    _this->_internal_set_node_block_height(from._internal_node_block_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetSumTreeAck::CopyFrom(const SyncGetSumTreeAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetSumTreeAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetSumTreeAck::IsInitialized() const {
+  return true;
+}
+
+void SyncGetSumTreeAck::InternalSwap(SyncGetSumTreeAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncGetSumTreeAck, _impl_.node_block_height_)
+      + sizeof(SyncGetSumTreeAck::_impl_.node_block_height_)
+      - PROTOBUF_FIELD_OFFSET(SyncGetSumTreeAck, _impl_.code_)>(
+          reinterpret_cast<char*>(&_impl_.code_),
+          reinterpret_cast<char*>(&other->_impl_.code_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetSumTreeAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[34]);
+}
+
+// ===================================================================
+
+class SnapshotManifest::_Internal {
+ public:
+};
+
+SnapshotManifest::SnapshotManifest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SnapshotManifest)
+}
+SnapshotManifest::SnapshotManifest(const SnapshotManifest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SnapshotManifest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chunk_hashes_){from._impl_.chunk_hashes_}
+    , decltype(_impl_.chain_hash_){}
+    , decltype(_impl_.root_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.key_count_){}
+    , decltype(_impl_.total_bytes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.chain_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.chain_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_chain_hash().empty()) {
+    _this->_impl_.chain_hash_.Set(from._internal_chain_hash(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.root_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.root_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_root().empty()) {
+    _this->_impl_.root_.Set(from._internal_root(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.height_, &from._impl_.height_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_bytes_) -
+    reinterpret_cast<char*>(&_impl_.height_)) + sizeof(_impl_.total_bytes_));
+  // @@protoc_insertion_point(copy_constructor:SnapshotManifest)
+}
+
+inline void SnapshotManifest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.chunk_hashes_){arena}
+    , decltype(_impl_.chain_hash_){}
+    , decltype(_impl_.root_){}
+    , decltype(_impl_.height_){uint64_t{0u}}
+    , decltype(_impl_.key_count_){uint64_t{0u}}
+    , decltype(_impl_.total_bytes_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.chain_hash_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.chain_hash_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.root_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.root_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SnapshotManifest::~SnapshotManifest() {
+  // @@protoc_insertion_point(destructor:SnapshotManifest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SnapshotManifest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.chunk_hashes_.~RepeatedPtrField();
+  _impl_.chain_hash_.Destroy();
+  _impl_.root_.Destroy();
+}
+
+void SnapshotManifest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SnapshotManifest::Clear() {
+// @@protoc_insertion_point(message_clear_start:SnapshotManifest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.chunk_hashes_.Clear();
+  _impl_.chain_hash_.ClearToEmpty();
+  _impl_.root_.ClearToEmpty();
+  ::memset(&_impl_.height_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.total_bytes_) -
+      reinterpret_cast<char*>(&_impl_.height_)) + sizeof(_impl_.total_bytes_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SnapshotManifest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 height = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string chain_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_chain_hash();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SnapshotManifest.chain_hash"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string chunk_hashes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_chunk_hashes();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "SnapshotManifest.chunk_hashes"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 key_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.key_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_bytes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.total_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string root = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_root();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SnapshotManifest.root"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SnapshotManifest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SnapshotManifest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 height = 1;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_height(), target);
+  }
+
+  // string chain_hash = 2;
+  if (!this->_internal_chain_hash().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_chain_hash().data(), static_cast<int>(this->_internal_chain_hash().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SnapshotManifest.chain_hash");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_chain_hash(), target);
+  }
+
+  // repeated string chunk_hashes = 3;
+  for (int i = 0, n = this->_internal_chunk_hashes_size(); i < n; i++) {
+    const auto& s = this->_internal_chunk_hashes(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SnapshotManifest.chunk_hashes");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // uint64 key_count = 4;
+  if (this->_internal_key_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_key_count(), target);
+  }
+
+  // uint64 total_bytes = 5;
+  if (this->_internal_total_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_total_bytes(), target);
+  }
+
+  // string root = 6;
+  if (!this->_internal_root().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_root().data(), static_cast<int>(this->_internal_root().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SnapshotManifest.root");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_root(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SnapshotManifest)
+  return target;
+}
+
+size_t SnapshotManifest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SnapshotManifest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string chunk_hashes = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.chunk_hashes_.size());
+  for (int i = 0, n = _impl_.chunk_hashes_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.chunk_hashes_.Get(i));
+  }
+
+  // string chain_hash = 2;
+  if (!this->_internal_chain_hash().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_chain_hash());
+  }
+
+  // string root = 6;
+  if (!this->_internal_root().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_root());
+  }
+
+  // uint64 height = 1;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_height());
+  }
+
+  // uint64 key_count = 4;
+  if (this->_internal_key_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_key_count());
+  }
+
+  // uint64 total_bytes = 5;
+  if (this->_internal_total_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_bytes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SnapshotManifest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SnapshotManifest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SnapshotManifest::GetClassData() const { return &_class_data_; }
+
+
+void SnapshotManifest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SnapshotManifest*>(&to_msg);
+  auto& from = static_cast<const SnapshotManifest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SnapshotManifest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.chunk_hashes_.MergeFrom(from._impl_.chunk_hashes_);
+  if (!from._internal_chain_hash().empty()) {
+    _this->_internal_set_chain_hash(from._internal_chain_hash());
+  }
+  if (!from._internal_root().empty()) {
+    _this->_internal_set_root(from._internal_root());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  if (from._internal_key_count() != 0) {
+    _this->_internal_set_key_count(from._internal_key_count());
+  }
+  if (from._internal_total_bytes() != 0) {
+    _this->_internal_set_total_bytes(from._internal_total_bytes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SnapshotManifest::CopyFrom(const SnapshotManifest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SnapshotManifest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SnapshotManifest::IsInitialized() const {
+  return true;
+}
+
+void SnapshotManifest::InternalSwap(SnapshotManifest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.chunk_hashes_.InternalSwap(&other->_impl_.chunk_hashes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.chain_hash_, lhs_arena,
+      &other->_impl_.chain_hash_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.root_, lhs_arena,
+      &other->_impl_.root_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SnapshotManifest, _impl_.total_bytes_)
+      + sizeof(SnapshotManifest::_impl_.total_bytes_)
+      - PROTOBUF_FIELD_OFFSET(SnapshotManifest, _impl_.height_)>(
+          reinterpret_cast<char*>(&_impl_.height_),
+          reinterpret_cast<char*>(&other->_impl_.height_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SnapshotManifest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[35]);
+}
+
+// ===================================================================
+
+class SyncGetSnapshotManifestReq::_Internal {
+ public:
+};
+
+SyncGetSnapshotManifestReq::SyncGetSnapshotManifestReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetSnapshotManifestReq)
+}
+SyncGetSnapshotManifestReq::SyncGetSnapshotManifestReq(const SyncGetSnapshotManifestReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetSnapshotManifestReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:SyncGetSnapshotManifestReq)
+}
+
+inline void SyncGetSnapshotManifestReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetSnapshotManifestReq::~SyncGetSnapshotManifestReq() {
+  // @@protoc_insertion_point(destructor:SyncGetSnapshotManifestReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetSnapshotManifestReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+}
+
+void SyncGetSnapshotManifestReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetSnapshotManifestReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetSnapshotManifestReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetSnapshotManifestReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string self_node_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotManifestReq.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotManifestReq.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetSnapshotManifestReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetSnapshotManifestReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotManifestReq.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotManifestReq.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetSnapshotManifestReq)
+  return target;
+}
+
+size_t SyncGetSnapshotManifestReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetSnapshotManifestReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetSnapshotManifestReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetSnapshotManifestReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetSnapshotManifestReq::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetSnapshotManifestReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetSnapshotManifestReq*>(&to_msg);
+  auto& from = static_cast<const SyncGetSnapshotManifestReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetSnapshotManifestReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetSnapshotManifestReq::CopyFrom(const SyncGetSnapshotManifestReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetSnapshotManifestReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetSnapshotManifestReq::IsInitialized() const {
+  return true;
+}
+
+void SyncGetSnapshotManifestReq::InternalSwap(SyncGetSnapshotManifestReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetSnapshotManifestReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[36]);
+}
+
+// ===================================================================
+
+class SyncGetSnapshotManifestAck::_Internal {
+ public:
+  static const ::SnapshotManifest& manifest(const SyncGetSnapshotManifestAck* msg);
+};
+
+const ::SnapshotManifest&
+SyncGetSnapshotManifestAck::_Internal::manifest(const SyncGetSnapshotManifestAck* msg) {
+  return *msg->_impl_.manifest_;
+}
+SyncGetSnapshotManifestAck::SyncGetSnapshotManifestAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetSnapshotManifestAck)
+}
+SyncGetSnapshotManifestAck::SyncGetSnapshotManifestAck(const SyncGetSnapshotManifestAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetSnapshotManifestAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.manifest_){nullptr}
+    , decltype(_impl_.node_block_height_){}
+    , decltype(_impl_.code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_manifest()) {
+    _this->_impl_.manifest_ = new ::SnapshotManifest(*from._impl_.manifest_);
+  }
+  ::memcpy(&_impl_.node_block_height_, &from._impl_.node_block_height_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.code_) -
+    reinterpret_cast<char*>(&_impl_.node_block_height_)) + sizeof(_impl_.code_));
+  // @@protoc_insertion_point(copy_constructor:SyncGetSnapshotManifestAck)
+}
+
+inline void SyncGetSnapshotManifestAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.manifest_){nullptr}
+    , decltype(_impl_.node_block_height_){uint64_t{0u}}
+    , decltype(_impl_.code_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetSnapshotManifestAck::~SyncGetSnapshotManifestAck() {
+  // @@protoc_insertion_point(destructor:SyncGetSnapshotManifestAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetSnapshotManifestAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.manifest_;
+}
+
+void SyncGetSnapshotManifestAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetSnapshotManifestAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetSnapshotManifestAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.manifest_ != nullptr) {
+    delete _impl_.manifest_;
+  }
+  _impl_.manifest_ = nullptr;
+  ::memset(&_impl_.node_block_height_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.code_) -
+      reinterpret_cast<char*>(&_impl_.node_block_height_)) + sizeof(_impl_.code_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetSnapshotManifestAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string self_node_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotManifestAck.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotManifestAck.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 node_block_height = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.node_block_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .SnapshotManifest manifest = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_manifest(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetSnapshotManifestAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetSnapshotManifestAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_code(), target);
+  }
+
+  // string self_node_id = 2;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotManifestAck.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 3;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotManifestAck.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_msg_id(), target);
+  }
+
+  // uint64 node_block_height = 4;
+  if (this->_internal_node_block_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_node_block_height(), target);
+  }
+
+  // .SnapshotManifest manifest = 5;
+  if (this->_internal_has_manifest()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::manifest(this),
+        _Internal::manifest(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetSnapshotManifestAck)
+  return target;
+}
+
+size_t SyncGetSnapshotManifestAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetSnapshotManifestAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string self_node_id = 2;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 3;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  // .SnapshotManifest manifest = 5;
+  if (this->_internal_has_manifest()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.manifest_);
+  }
+
+  // uint64 node_block_height = 4;
+  if (this->_internal_node_block_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_node_block_height());
+  }
+
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetSnapshotManifestAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetSnapshotManifestAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetSnapshotManifestAck::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetSnapshotManifestAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetSnapshotManifestAck*>(&to_msg);
+  auto& from = static_cast<const SyncGetSnapshotManifestAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetSnapshotManifestAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  if (from._internal_has_manifest()) {
+    _this->_internal_mutable_manifest()->::SnapshotManifest::MergeFrom(
+        from._internal_manifest());
+  }
+  if (from._internal_node_block_height() != 0) {
+    _this->_internal_set_node_block_height(from._internal_node_block_height());
+  }
+  if (from._internal_code() != 0) {
+    _this->_internal_set_code(from._internal_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetSnapshotManifestAck::CopyFrom(const SyncGetSnapshotManifestAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetSnapshotManifestAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetSnapshotManifestAck::IsInitialized() const {
+  return true;
+}
+
+void SyncGetSnapshotManifestAck::InternalSwap(SyncGetSnapshotManifestAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncGetSnapshotManifestAck, _impl_.code_)
+      + sizeof(SyncGetSnapshotManifestAck::_impl_.code_)
+      - PROTOBUF_FIELD_OFFSET(SyncGetSnapshotManifestAck, _impl_.manifest_)>(
+          reinterpret_cast<char*>(&_impl_.manifest_),
+          reinterpret_cast<char*>(&other->_impl_.manifest_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetSnapshotManifestAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[37]);
+}
+
+// ===================================================================
+
+class SyncGetSnapshotChunkReq::_Internal {
+ public:
+};
+
+SyncGetSnapshotChunkReq::SyncGetSnapshotChunkReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetSnapshotChunkReq)
+}
+SyncGetSnapshotChunkReq::SyncGetSnapshotChunkReq(const SyncGetSnapshotChunkReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetSnapshotChunkReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.height_, &from._impl_.height_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_) -
+    reinterpret_cast<char*>(&_impl_.height_)) + sizeof(_impl_.index_));
+  // @@protoc_insertion_point(copy_constructor:SyncGetSnapshotChunkReq)
+}
+
+inline void SyncGetSnapshotChunkReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.height_){uint64_t{0u}}
+    , decltype(_impl_.index_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetSnapshotChunkReq::~SyncGetSnapshotChunkReq() {
+  // @@protoc_insertion_point(destructor:SyncGetSnapshotChunkReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetSnapshotChunkReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+}
+
+void SyncGetSnapshotChunkReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetSnapshotChunkReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetSnapshotChunkReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  ::memset(&_impl_.height_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.index_) -
+      reinterpret_cast<char*>(&_impl_.height_)) + sizeof(_impl_.index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetSnapshotChunkReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string self_node_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotChunkReq.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotChunkReq.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 height = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetSnapshotChunkReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetSnapshotChunkReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotChunkReq.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotChunkReq.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_msg_id(), target);
+  }
+
+  // uint64 height = 3;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_height(), target);
+  }
+
+  // uint32 index = 4;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetSnapshotChunkReq)
+  return target;
+}
+
+size_t SyncGetSnapshotChunkReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetSnapshotChunkReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string self_node_id = 1;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 2;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  // uint64 height = 3;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_height());
+  }
+
+  // uint32 index = 4;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetSnapshotChunkReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetSnapshotChunkReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetSnapshotChunkReq::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetSnapshotChunkReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetSnapshotChunkReq*>(&to_msg);
+  auto& from = static_cast<const SyncGetSnapshotChunkReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetSnapshotChunkReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetSnapshotChunkReq::CopyFrom(const SyncGetSnapshotChunkReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetSnapshotChunkReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetSnapshotChunkReq::IsInitialized() const {
+  return true;
+}
+
+void SyncGetSnapshotChunkReq::InternalSwap(SyncGetSnapshotChunkReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncGetSnapshotChunkReq, _impl_.index_)
+      + sizeof(SyncGetSnapshotChunkReq::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(SyncGetSnapshotChunkReq, _impl_.height_)>(
+          reinterpret_cast<char*>(&_impl_.height_),
+          reinterpret_cast<char*>(&other->_impl_.height_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetSnapshotChunkReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[38]);
+}
+
+// ===================================================================
+
+class SyncGetSnapshotChunkAck::_Internal {
+ public:
+};
+
+SyncGetSnapshotChunkAck::SyncGetSnapshotChunkAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SyncGetSnapshotChunkAck)
+}
+SyncGetSnapshotChunkAck::SyncGetSnapshotChunkAck(const SyncGetSnapshotChunkAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncGetSnapshotChunkAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_self_node_id().empty()) {
+    _this->_impl_.self_node_id_.Set(from._internal_self_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_msg_id().empty()) {
+    _this->_impl_.msg_id_.Set(from._internal_msg_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.code_, &from._impl_.code_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.code_)) + sizeof(_impl_.height_));
+  // @@protoc_insertion_point(copy_constructor:SyncGetSnapshotChunkAck)
+}
+
+inline void SyncGetSnapshotChunkAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.self_node_id_){}
+    , decltype(_impl_.msg_id_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.code_){0}
+    , decltype(_impl_.index_){0u}
+    , decltype(_impl_.height_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.self_node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.msg_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncGetSnapshotChunkAck::~SyncGetSnapshotChunkAck() {
+  // @@protoc_insertion_point(destructor:SyncGetSnapshotChunkAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncGetSnapshotChunkAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.self_node_id_.Destroy();
+  _impl_.msg_id_.Destroy();
+  _impl_.data_.Destroy();
+}
+
+void SyncGetSnapshotChunkAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncGetSnapshotChunkAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:SyncGetSnapshotChunkAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.self_node_id_.ClearToEmpty();
+  _impl_.msg_id_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.code_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.height_) -
+      reinterpret_cast<char*>(&_impl_.code_)) + sizeof(_impl_.height_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncGetSnapshotChunkAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string self_node_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_self_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotChunkAck.self_node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string msg_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_msg_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "SyncGetSnapshotChunkAck.msg_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 height = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncGetSnapshotChunkAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SyncGetSnapshotChunkAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_code(), target);
+  }
+
+  // string self_node_id = 2;
+  if (!this->_internal_self_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_self_node_id().data(), static_cast<int>(this->_internal_self_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotChunkAck.self_node_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_self_node_id(), target);
+  }
+
+  // string msg_id = 3;
+  if (!this->_internal_msg_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_msg_id().data(), static_cast<int>(this->_internal_msg_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SyncGetSnapshotChunkAck.msg_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_msg_id(), target);
+  }
+
+  // uint64 height = 4;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_height(), target);
+  }
+
+  // uint32 index = 5;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_index(), target);
+  }
+
+  // bytes data = 6;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SyncGetSnapshotChunkAck)
+  return target;
+}
+
+size_t SyncGetSnapshotChunkAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SyncGetSnapshotChunkAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string self_node_id = 2;
+  if (!this->_internal_self_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_self_node_id());
+  }
+
+  // string msg_id = 3;
+  if (!this->_internal_msg_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_msg_id());
+  }
+
+  // bytes data = 6;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // int32 code = 1;
+  if (this->_internal_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_code());
+  }
+
+  // uint32 index = 5;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index());
+  }
+
+  // uint64 height = 4;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncGetSnapshotChunkAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncGetSnapshotChunkAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncGetSnapshotChunkAck::GetClassData() const { return &_class_data_; }
+
+
+void SyncGetSnapshotChunkAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncGetSnapshotChunkAck*>(&to_msg);
+  auto& from = static_cast<const SyncGetSnapshotChunkAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SyncGetSnapshotChunkAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_self_node_id().empty()) {
+    _this->_internal_set_self_node_id(from._internal_self_node_id());
+  }
+  if (!from._internal_msg_id().empty()) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_code() != 0) {
+    _this->_internal_set_code(from._internal_code());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncGetSnapshotChunkAck::CopyFrom(const SyncGetSnapshotChunkAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SyncGetSnapshotChunkAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncGetSnapshotChunkAck::IsInitialized() const {
+  return true;
+}
+
+void SyncGetSnapshotChunkAck::InternalSwap(SyncGetSnapshotChunkAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.self_node_id_, lhs_arena,
+      &other->_impl_.self_node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_id_, lhs_arena,
+      &other->_impl_.msg_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncGetSnapshotChunkAck, _impl_.height_)
+      + sizeof(SyncGetSnapshotChunkAck::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(SyncGetSnapshotChunkAck, _impl_.code_)>(
+          reinterpret_cast<char*>(&_impl_.code_),
+          reinterpret_cast<char*>(&other->_impl_.code_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncGetSnapshotChunkAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sync_5fblock_2eproto_getter, &descriptor_table_sync_5fblock_2eproto_once,
+      file_level_metadata_sync_5fblock_2eproto[39]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::FastSyncGetHashReq*
+Arena::CreateMaybeMessage< ::FastSyncGetHashReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::FastSyncGetHashReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::FastSyncBlockHashs*
+Arena::CreateMaybeMessage< ::FastSyncBlockHashs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::FastSyncBlockHashs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::FastSyncGetHashAck*
+Arena::CreateMaybeMessage< ::FastSyncGetHashAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::FastSyncGetHashAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::FastSyncGetBlockReq*
+Arena::CreateMaybeMessage< ::FastSyncGetBlockReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::FastSyncGetBlockReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::FastSyncBlock*
+Arena::CreateMaybeMessage< ::FastSyncBlock >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::FastSyncBlock >(arena);
+}
+template<> PROTOBUF_NOINLINE ::FastSyncGetBlockAck*
+Arena::CreateMaybeMessage< ::FastSyncGetBlockAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::FastSyncGetBlockAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSumHashReq*
+Arena::CreateMaybeMessage< ::SyncGetSumHashReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSumHashReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncSumHash*
+Arena::CreateMaybeMessage< ::SyncSumHash >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncSumHash >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSumHashAck*
+Arena::CreateMaybeMessage< ::SyncGetSumHashAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSumHashAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetHeightHashReq*
+Arena::CreateMaybeMessage< ::SyncGetHeightHashReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetHeightHashReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetHeightHashAck*
+Arena::CreateMaybeMessage< ::SyncGetHeightHashAck >(Arena* arena) {
   return Arena::CreateMessageInternal< ::SyncGetHeightHashAck >(arena);
 }
 template<> PROTOBUF_NOINLINE ::SyncGetBlockHeightAndHashReq*
@@ -9395,6 +13377,50 @@ template<> PROTOBUF_NOINLINE ::GetCheckSumHashAck*
 Arena::CreateMaybeMessage< ::GetCheckSumHashAck >(Arena* arena) {
   return Arena::CreateMessageInternal< ::GetCheckSumHashAck >(arena);
 }
+template<> PROTOBUF_NOINLINE ::SyncBlockSummary*
+Arena::CreateMaybeMessage< ::SyncBlockSummary >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncBlockSummary >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetBlockSummaryReq*
+Arena::CreateMaybeMessage< ::SyncGetBlockSummaryReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetBlockSummaryReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetBlockSummaryAck*
+Arena::CreateMaybeMessage< ::SyncGetBlockSummaryAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetBlockSummaryAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncSumTreeNode*
+Arena::CreateMaybeMessage< ::SyncSumTreeNode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncSumTreeNode >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSumTreeReq*
+Arena::CreateMaybeMessage< ::SyncGetSumTreeReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSumTreeReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSumTreeAck*
+Arena::CreateMaybeMessage< ::SyncGetSumTreeAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSumTreeAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SnapshotManifest*
+Arena::CreateMaybeMessage< ::SnapshotManifest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SnapshotManifest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSnapshotManifestReq*
+Arena::CreateMaybeMessage< ::SyncGetSnapshotManifestReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSnapshotManifestReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSnapshotManifestAck*
+Arena::CreateMaybeMessage< ::SyncGetSnapshotManifestAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSnapshotManifestAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSnapshotChunkReq*
+Arena::CreateMaybeMessage< ::SyncGetSnapshotChunkReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSnapshotChunkReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SyncGetSnapshotChunkAck*
+Arena::CreateMaybeMessage< ::SyncGetSnapshotChunkAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SyncGetSnapshotChunkAck >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -83,6 +83,12 @@ extern GetCheckSumHashReqDefaultTypeInternal _GetCheckSumHashReq_default_instanc
 class HashType;
 struct HashTypeDefaultTypeInternal;
 extern HashTypeDefaultTypeInternal _HashType_default_instance_;
+class SnapshotManifest;
+struct SnapshotManifestDefaultTypeInternal;
+extern SnapshotManifestDefaultTypeInternal _SnapshotManifest_default_instance_;
+class SyncBlockSummary;
+struct SyncBlockSummaryDefaultTypeInternal;
+extern SyncBlockSummaryDefaultTypeInternal _SyncBlockSummary_default_instance_;
 class SyncFromZeroGetBlockAck;
 struct SyncFromZeroGetBlockAckDefaultTypeInternal;
 extern SyncFromZeroGetBlockAckDefaultTypeInternal _SyncFromZeroGetBlockAck_default_instance_;
@@ -110,18 +116,42 @@ extern SyncGetBlockHeightAndHashReqDefaultTypeInternal _SyncGetBlockHeightAndHas
 class SyncGetBlockReq;
 struct SyncGetBlockReqDefaultTypeInternal;
 extern SyncGetBlockReqDefaultTypeInternal _SyncGetBlockReq_default_instance_;
+class SyncGetBlockSummaryAck;
+struct SyncGetBlockSummaryAckDefaultTypeInternal;
+extern SyncGetBlockSummaryAckDefaultTypeInternal _SyncGetBlockSummaryAck_default_instance_;
+class SyncGetBlockSummaryReq;
+struct SyncGetBlockSummaryReqDefaultTypeInternal;
+extern SyncGetBlockSummaryReqDefaultTypeInternal _SyncGetBlockSummaryReq_default_instance_;
 class SyncGetHeightHashAck;
 struct SyncGetHeightHashAckDefaultTypeInternal;
 extern SyncGetHeightHashAckDefaultTypeInternal _SyncGetHeightHashAck_default_instance_;
 class SyncGetHeightHashReq;
 struct SyncGetHeightHashReqDefaultTypeInternal;
 extern SyncGetHeightHashReqDefaultTypeInternal _SyncGetHeightHashReq_default_instance_;
+class SyncGetSnapshotChunkAck;
+struct SyncGetSnapshotChunkAckDefaultTypeInternal;
+extern SyncGetSnapshotChunkAckDefaultTypeInternal _SyncGetSnapshotChunkAck_default_instance_;
+class SyncGetSnapshotChunkReq;
+struct SyncGetSnapshotChunkReqDefaultTypeInternal;
+extern SyncGetSnapshotChunkReqDefaultTypeInternal _SyncGetSnapshotChunkReq_default_instance_;
+class SyncGetSnapshotManifestAck;
+struct SyncGetSnapshotManifestAckDefaultTypeInternal;
+extern SyncGetSnapshotManifestAckDefaultTypeInternal _SyncGetSnapshotManifestAck_default_instance_;
+class SyncGetSnapshotManifestReq;
+struct SyncGetSnapshotManifestReqDefaultTypeInternal;
+extern SyncGetSnapshotManifestReqDefaultTypeInternal _SyncGetSnapshotManifestReq_default_instance_;
 class SyncGetSumHashAck;
 struct SyncGetSumHashAckDefaultTypeInternal;
 extern SyncGetSumHashAckDefaultTypeInternal _SyncGetSumHashAck_default_instance_;
 class SyncGetSumHashReq;
 struct SyncGetSumHashReqDefaultTypeInternal;
 extern SyncGetSumHashReqDefaultTypeInternal _SyncGetSumHashReq_default_instance_;
+class SyncGetSumTreeAck;
+struct SyncGetSumTreeAckDefaultTypeInternal;
+extern SyncGetSumTreeAckDefaultTypeInternal _SyncGetSumTreeAck_default_instance_;
+class SyncGetSumTreeReq;
+struct SyncGetSumTreeReqDefaultTypeInternal;
+extern SyncGetSumTreeReqDefaultTypeInternal _SyncGetSumTreeReq_default_instance_;
 class SyncNodeHashAck;
 struct SyncNodeHashAckDefaultTypeInternal;
 extern SyncNodeHashAckDefaultTypeInternal _SyncNodeHashAck_default_instance_;
@@ -131,6 +161,9 @@ extern SyncNodeHashReqDefaultTypeInternal _SyncNodeHashReq_default_instance_;
 class SyncSumHash;
 struct SyncSumHashDefaultTypeInternal;
 extern SyncSumHashDefaultTypeInternal _SyncSumHash_default_instance_;
+class SyncSumTreeNode;
+struct SyncSumTreeNodeDefaultTypeInternal;
+extern SyncSumTreeNodeDefaultTypeInternal _SyncSumTreeNode_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
 template<> ::FastSyncBlock* Arena::CreateMaybeMessage<::FastSyncBlock>(Arena*);
 template<> ::FastSyncBlockHashs* Arena::CreateMaybeMessage<::FastSyncBlockHashs>(Arena*);
@@ -145,6 +178,8 @@ template<> ::GetBlockByUtxoReq* Arena::CreateMaybeMessage<::GetBlockByUtxoReq>(A
 template<> ::GetCheckSumHashAck* Arena::CreateMaybeMessage<::GetCheckSumHashAck>(Arena*);
 template<> ::GetCheckSumHashReq* Arena::CreateMaybeMessage<::GetCheckSumHashReq>(Arena*);
 template<> ::HashType* Arena::CreateMaybeMessage<::HashType>(Arena*);
+template<> ::SnapshotManifest* Arena::CreateMaybeMessage<::SnapshotManifest>(Arena*);
+template<> ::SyncBlockSummary* Arena::CreateMaybeMessage<::SyncBlockSummary>(Arena*);
 template<> ::SyncFromZeroGetBlockAck* Arena::CreateMaybeMessage<::SyncFromZeroGetBlockAck>(Arena*);
 template<> ::SyncFromZeroGetBlockReq* Arena::CreateMaybeMessage<::SyncFromZeroGetBlockReq>(Arena*);
 template<> ::SyncFromZeroGetSumHashAck* Arena::CreateMaybeMessage<::SyncFromZeroGetSumHashAck>(Arena*);
@@ -154,13 +189,22 @@ template<> ::SyncGetBlockAck* Arena::CreateMaybeMessage<::SyncGetBlockAck>(Arena
 template<> ::SyncGetBlockHeightAndHashAck* Arena::CreateMaybeMessage<::SyncGetBlockHeightAndHashAck>(Arena*);
 template<> ::SyncGetBlockHeightAndHashReq* Arena::CreateMaybeMessage<::SyncGetBlockHeightAndHashReq>(Arena*);
 template<> ::SyncGetBlockReq* Arena::CreateMaybeMessage<::SyncGetBlockReq>(Arena*);
+template<> ::SyncGetBlockSummaryAck* Arena::CreateMaybeMessage<::SyncGetBlockSummaryAck>(Arena*);
+template<> ::SyncGetBlockSummaryReq* Arena::CreateMaybeMessage<::SyncGetBlockSummaryReq>(Arena*);
 template<> ::SyncGetHeightHashAck* Arena::CreateMaybeMessage<::SyncGetHeightHashAck>(Arena*);
 template<> ::SyncGetHeightHashReq* Arena::CreateMaybeMessage<::SyncGetHeightHashReq>(Arena*);
+template<> ::SyncGetSnapshotChunkAck* Arena::CreateMaybeMessage<::SyncGetSnapshotChunkAck>(Arena*);
+template<> ::SyncGetSnapshotChunkReq* Arena::CreateMaybeMessage<::SyncGetSnapshotChunkReq>(Arena*);
+template<> ::SyncGetSnapshotManifestAck* Arena::CreateMaybeMessage<::SyncGetSnapshotManifestAck>(Arena*);
+template<> ::SyncGetSnapshotManifestReq* Arena::CreateMaybeMessage<::SyncGetSnapshotManifestReq>(Arena*);
 template<> ::SyncGetSumHashAck* Arena::CreateMaybeMessage<::SyncGetSumHashAck>(Arena*);
 template<> ::SyncGetSumHashReq* Arena::CreateMaybeMessage<::SyncGetSumHashReq>(Arena*);
+template<> ::SyncGetSumTreeAck* Arena::CreateMaybeMessage<::SyncGetSumTreeAck>(Arena*);
+template<> ::SyncGetSumTreeReq* Arena::CreateMaybeMessage<::SyncGetSumTreeReq>(Arena*);
 template<> ::SyncNodeHashAck* Arena::CreateMaybeMessage<::SyncNodeHashAck>(Arena*);
 template<> ::SyncNodeHashReq* Arena::CreateMaybeMessage<::SyncNodeHashReq>(Arena*);
 template<> ::SyncSumHash* Arena::CreateMaybeMessage<::SyncSumHash>(Arena*);
+template<> ::SyncSumTreeNode* Arena::CreateMaybeMessage<::SyncSumTreeNode>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
@@ -5627,53 +5671,3771 @@ class GetCheckSumHashAck final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_sync_5fblock_2eproto;
 };
+// -------------------------------------------------------------------
+
+class SyncBlockSummary final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncBlockSummary) */ {
+ public:
+  inline SyncBlockSummary() : SyncBlockSummary(nullptr) {}
+  ~SyncBlockSummary() override;
+  explicit PROTOBUF_CONSTEXPR SyncBlockSummary(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncBlockSummary(const SyncBlockSummary& from);
+  SyncBlockSummary(SyncBlockSummary&& from) noexcept
+    : SyncBlockSummary() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncBlockSummary& operator=(const SyncBlockSummary& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncBlockSummary& operator=(SyncBlockSummary&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncBlockSummary& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncBlockSummary* internal_default_instance() {
+    return reinterpret_cast<const SyncBlockSummary*>(
+               &_SyncBlockSummary_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(SyncBlockSummary& a, SyncBlockSummary& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncBlockSummary* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncBlockSummary* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncBlockSummary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncBlockSummary>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncBlockSummary& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncBlockSummary& from) {
+    SyncBlockSummary::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncBlockSummary* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncBlockSummary";
+  }
+  protected:
+  explicit SyncBlockSummary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignersFieldNumber = 5,
+    kHashFieldNumber = 2,
+    kPrevHashFieldNumber = 3,
+    kMerkleRootFieldNumber = 4,
+    kHeightFieldNumber = 1,
+  };
+  // repeated bytes signers = 5;
+  int signers_size() const;
+  private:
+  int _internal_signers_size() const;
+  public:
+  void clear_signers();
+  const std::string& signers(int index) const;
+  std::string* mutable_signers(int index);
+  void set_signers(int index, const std::string& value);
+  void set_signers(int index, std::string&& value);
+  void set_signers(int index, const char* value);
+  void set_signers(int index, const void* value, size_t size);
+  std::string* add_signers();
+  void add_signers(const std::string& value);
+  void add_signers(std::string&& value);
+  void add_signers(const char* value);
+  void add_signers(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& signers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_signers();
+  private:
+  const std::string& _internal_signers(int index) const;
+  std::string* _internal_add_signers();
+  public:
+
+  // string hash = 2;
+  void clear_hash();
+  const std::string& hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hash();
+  PROTOBUF_NODISCARD std::string* release_hash();
+  void set_allocated_hash(std::string* hash);
+  private:
+  const std::string& _internal_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hash(const std::string& value);
+  std::string* _internal_mutable_hash();
+  public:
+
+  // string prev_hash = 3;
+  void clear_prev_hash();
+  const std::string& prev_hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prev_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prev_hash();
+  PROTOBUF_NODISCARD std::string* release_prev_hash();
+  void set_allocated_prev_hash(std::string* prev_hash);
+  private:
+  const std::string& _internal_prev_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prev_hash(const std::string& value);
+  std::string* _internal_mutable_prev_hash();
+  public:
+
+  // string merkle_root = 4;
+  void clear_merkle_root();
+  const std::string& merkle_root() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_merkle_root(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_merkle_root();
+  PROTOBUF_NODISCARD std::string* release_merkle_root();
+  void set_allocated_merkle_root(std::string* merkle_root);
+  private:
+  const std::string& _internal_merkle_root() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_merkle_root(const std::string& value);
+  std::string* _internal_mutable_merkle_root();
+  public:
+
+  // uint64 height = 1;
+  void clear_height();
+  uint64_t height() const;
+  void set_height(uint64_t value);
+  private:
+  uint64_t _internal_height() const;
+  void _internal_set_height(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncBlockSummary)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> signers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prev_hash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr merkle_root_;
+    uint64_t height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetBlockSummaryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetBlockSummaryReq) */ {
+ public:
+  inline SyncGetBlockSummaryReq() : SyncGetBlockSummaryReq(nullptr) {}
+  ~SyncGetBlockSummaryReq() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetBlockSummaryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetBlockSummaryReq(const SyncGetBlockSummaryReq& from);
+  SyncGetBlockSummaryReq(SyncGetBlockSummaryReq&& from) noexcept
+    : SyncGetBlockSummaryReq() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetBlockSummaryReq& operator=(const SyncGetBlockSummaryReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetBlockSummaryReq& operator=(SyncGetBlockSummaryReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetBlockSummaryReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetBlockSummaryReq* internal_default_instance() {
+    return reinterpret_cast<const SyncGetBlockSummaryReq*>(
+               &_SyncGetBlockSummaryReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(SyncGetBlockSummaryReq& a, SyncGetBlockSummaryReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetBlockSummaryReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetBlockSummaryReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetBlockSummaryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetBlockSummaryReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetBlockSummaryReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetBlockSummaryReq& from) {
+    SyncGetBlockSummaryReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetBlockSummaryReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetBlockSummaryReq";
+  }
+  protected:
+  explicit SyncGetBlockSummaryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSelfNodeIdFieldNumber = 1,
+    kMsgIdFieldNumber = 2,
+    kStartHeightFieldNumber = 3,
+    kEndHeightFieldNumber = 4,
+  };
+  // string self_node_id = 1;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 2;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // uint64 start_height = 3;
+  void clear_start_height();
+  uint64_t start_height() const;
+  void set_start_height(uint64_t value);
+  private:
+  uint64_t _internal_start_height() const;
+  void _internal_set_start_height(uint64_t value);
+  public:
+
+  // uint64 end_height = 4;
+  void clear_end_height();
+  uint64_t end_height() const;
+  void set_end_height(uint64_t value);
+  private:
+  uint64_t _internal_end_height() const;
+  void _internal_set_end_height(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetBlockSummaryReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    uint64_t start_height_;
+    uint64_t end_height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetBlockSummaryAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetBlockSummaryAck) */ {
+ public:
+  inline SyncGetBlockSummaryAck() : SyncGetBlockSummaryAck(nullptr) {}
+  ~SyncGetBlockSummaryAck() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetBlockSummaryAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetBlockSummaryAck(const SyncGetBlockSummaryAck& from);
+  SyncGetBlockSummaryAck(SyncGetBlockSummaryAck&& from) noexcept
+    : SyncGetBlockSummaryAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetBlockSummaryAck& operator=(const SyncGetBlockSummaryAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetBlockSummaryAck& operator=(SyncGetBlockSummaryAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetBlockSummaryAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetBlockSummaryAck* internal_default_instance() {
+    return reinterpret_cast<const SyncGetBlockSummaryAck*>(
+               &_SyncGetBlockSummaryAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(SyncGetBlockSummaryAck& a, SyncGetBlockSummaryAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetBlockSummaryAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetBlockSummaryAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetBlockSummaryAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetBlockSummaryAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetBlockSummaryAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetBlockSummaryAck& from) {
+    SyncGetBlockSummaryAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetBlockSummaryAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetBlockSummaryAck";
+  }
+  protected:
+  explicit SyncGetBlockSummaryAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSummariesFieldNumber = 4,
+    kSelfNodeIdFieldNumber = 1,
+    kMsgIdFieldNumber = 2,
+    kNodeBlockHeightFieldNumber = 3,
+  };
+  // repeated .SyncBlockSummary summaries = 4;
+  int summaries_size() const;
+  private:
+  int _internal_summaries_size() const;
+  public:
+  void clear_summaries();
+  ::SyncBlockSummary* mutable_summaries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncBlockSummary >*
+      mutable_summaries();
+  private:
+  const ::SyncBlockSummary& _internal_summaries(int index) const;
+  ::SyncBlockSummary* _internal_add_summaries();
+  public:
+  const ::SyncBlockSummary& summaries(int index) const;
+  ::SyncBlockSummary* add_summaries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncBlockSummary >&
+      summaries() const;
+
+  // string self_node_id = 1;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 2;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // uint64 node_block_height = 3;
+  void clear_node_block_height();
+  uint64_t node_block_height() const;
+  void set_node_block_height(uint64_t value);
+  private:
+  uint64_t _internal_node_block_height() const;
+  void _internal_set_node_block_height(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetBlockSummaryAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncBlockSummary > summaries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    uint64_t node_block_height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncSumTreeNode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncSumTreeNode) */ {
+ public:
+  inline SyncSumTreeNode() : SyncSumTreeNode(nullptr) {}
+  ~SyncSumTreeNode() override;
+  explicit PROTOBUF_CONSTEXPR SyncSumTreeNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncSumTreeNode(const SyncSumTreeNode& from);
+  SyncSumTreeNode(SyncSumTreeNode&& from) noexcept
+    : SyncSumTreeNode() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncSumTreeNode& operator=(const SyncSumTreeNode& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncSumTreeNode& operator=(SyncSumTreeNode&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncSumTreeNode& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncSumTreeNode* internal_default_instance() {
+    return reinterpret_cast<const SyncSumTreeNode*>(
+               &_SyncSumTreeNode_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(SyncSumTreeNode& a, SyncSumTreeNode& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncSumTreeNode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncSumTreeNode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncSumTreeNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncSumTreeNode>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncSumTreeNode& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncSumTreeNode& from) {
+    SyncSumTreeNode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncSumTreeNode* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncSumTreeNode";
+  }
+  protected:
+  explicit SyncSumTreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHashFieldNumber = 2,
+    kIndexFieldNumber = 1,
+  };
+  // string hash = 2;
+  void clear_hash();
+  const std::string& hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hash();
+  PROTOBUF_NODISCARD std::string* release_hash();
+  void set_allocated_hash(std::string* hash);
+  private:
+  const std::string& _internal_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hash(const std::string& value);
+  std::string* _internal_mutable_hash();
+  public:
+
+  // uint64 index = 1;
+  void clear_index();
+  uint64_t index() const;
+  void set_index(uint64_t value);
+  private:
+  uint64_t _internal_index() const;
+  void _internal_set_index(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncSumTreeNode)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hash_;
+    uint64_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetSumTreeReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetSumTreeReq) */ {
+ public:
+  inline SyncGetSumTreeReq() : SyncGetSumTreeReq(nullptr) {}
+  ~SyncGetSumTreeReq() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetSumTreeReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetSumTreeReq(const SyncGetSumTreeReq& from);
+  SyncGetSumTreeReq(SyncGetSumTreeReq&& from) noexcept
+    : SyncGetSumTreeReq() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetSumTreeReq& operator=(const SyncGetSumTreeReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetSumTreeReq& operator=(SyncGetSumTreeReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetSumTreeReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetSumTreeReq* internal_default_instance() {
+    return reinterpret_cast<const SyncGetSumTreeReq*>(
+               &_SyncGetSumTreeReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(SyncGetSumTreeReq& a, SyncGetSumTreeReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetSumTreeReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetSumTreeReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetSumTreeReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetSumTreeReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetSumTreeReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetSumTreeReq& from) {
+    SyncGetSumTreeReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetSumTreeReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetSumTreeReq";
+  }
+  protected:
+  explicit SyncGetSumTreeReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSelfNodeIdFieldNumber = 1,
+    kMsgIdFieldNumber = 2,
+    kStartIndexFieldNumber = 4,
+    kLevelFieldNumber = 3,
+    kCountFieldNumber = 5,
+    kMaxHeightFieldNumber = 6,
+  };
+  // string self_node_id = 1;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 2;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // uint64 start_index = 4;
+  void clear_start_index();
+  uint64_t start_index() const;
+  void set_start_index(uint64_t value);
+  private:
+  uint64_t _internal_start_index() const;
+  void _internal_set_start_index(uint64_t value);
+  public:
+
+  // uint32 level = 3;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // uint32 count = 5;
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // uint64 max_height = 6;
+  void clear_max_height();
+  uint64_t max_height() const;
+  void set_max_height(uint64_t value);
+  private:
+  uint64_t _internal_max_height() const;
+  void _internal_set_max_height(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetSumTreeReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    uint64_t start_index_;
+    uint32_t level_;
+    uint32_t count_;
+    uint64_t max_height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetSumTreeAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetSumTreeAck) */ {
+ public:
+  inline SyncGetSumTreeAck() : SyncGetSumTreeAck(nullptr) {}
+  ~SyncGetSumTreeAck() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetSumTreeAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetSumTreeAck(const SyncGetSumTreeAck& from);
+  SyncGetSumTreeAck(SyncGetSumTreeAck&& from) noexcept
+    : SyncGetSumTreeAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetSumTreeAck& operator=(const SyncGetSumTreeAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetSumTreeAck& operator=(SyncGetSumTreeAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetSumTreeAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetSumTreeAck* internal_default_instance() {
+    return reinterpret_cast<const SyncGetSumTreeAck*>(
+               &_SyncGetSumTreeAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(SyncGetSumTreeAck& a, SyncGetSumTreeAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetSumTreeAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetSumTreeAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetSumTreeAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetSumTreeAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetSumTreeAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetSumTreeAck& from) {
+    SyncGetSumTreeAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetSumTreeAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetSumTreeAck";
+  }
+  protected:
+  explicit SyncGetSumTreeAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodesFieldNumber = 6,
+    kSelfNodeIdFieldNumber = 2,
+    kMsgIdFieldNumber = 3,
+    kCodeFieldNumber = 1,
+    kLevelFieldNumber = 5,
+    kNodeBlockHeightFieldNumber = 4,
+  };
+  // repeated .SyncSumTreeNode nodes = 6;
+  int nodes_size() const;
+  private:
+  int _internal_nodes_size() const;
+  public:
+  void clear_nodes();
+  ::SyncSumTreeNode* mutable_nodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumTreeNode >*
+      mutable_nodes();
+  private:
+  const ::SyncSumTreeNode& _internal_nodes(int index) const;
+  ::SyncSumTreeNode* _internal_add_nodes();
+  public:
+  const ::SyncSumTreeNode& nodes(int index) const;
+  ::SyncSumTreeNode* add_nodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumTreeNode >&
+      nodes() const;
+
+  // string self_node_id = 2;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 3;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // int32 code = 1;
+  void clear_code();
+  int32_t code() const;
+  void set_code(int32_t value);
+  private:
+  int32_t _internal_code() const;
+  void _internal_set_code(int32_t value);
+  public:
+
+  // uint32 level = 5;
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // uint64 node_block_height = 4;
+  void clear_node_block_height();
+  uint64_t node_block_height() const;
+  void set_node_block_height(uint64_t value);
+  private:
+  uint64_t _internal_node_block_height() const;
+  void _internal_set_node_block_height(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetSumTreeAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumTreeNode > nodes_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    int32_t code_;
+    uint32_t level_;
+    uint64_t node_block_height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SnapshotManifest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SnapshotManifest) */ {
+ public:
+  inline SnapshotManifest() : SnapshotManifest(nullptr) {}
+  ~SnapshotManifest() override;
+  explicit PROTOBUF_CONSTEXPR SnapshotManifest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SnapshotManifest(const SnapshotManifest& from);
+  SnapshotManifest(SnapshotManifest&& from) noexcept
+    : SnapshotManifest() {
+    *this = ::std::move(from);
+  }
+
+  inline SnapshotManifest& operator=(const SnapshotManifest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SnapshotManifest& operator=(SnapshotManifest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SnapshotManifest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SnapshotManifest* internal_default_instance() {
+    return reinterpret_cast<const SnapshotManifest*>(
+               &_SnapshotManifest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(SnapshotManifest& a, SnapshotManifest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SnapshotManifest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SnapshotManifest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SnapshotManifest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SnapshotManifest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SnapshotManifest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SnapshotManifest& from) {
+    SnapshotManifest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SnapshotManifest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SnapshotManifest";
+  }
+  protected:
+  explicit SnapshotManifest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChunkHashesFieldNumber = 3,
+    kChainHashFieldNumber = 2,
+    kRootFieldNumber = 6,
+    kHeightFieldNumber = 1,
+    kKeyCountFieldNumber = 4,
+    kTotalBytesFieldNumber = 5,
+  };
+  // repeated string chunk_hashes = 3;
+  int chunk_hashes_size() const;
+  private:
+  int _internal_chunk_hashes_size() const;
+  public:
+  void clear_chunk_hashes();
+  const std::string& chunk_hashes(int index) const;
+  std::string* mutable_chunk_hashes(int index);
+  void set_chunk_hashes(int index, const std::string& value);
+  void set_chunk_hashes(int index, std::string&& value);
+  void set_chunk_hashes(int index, const char* value);
+  void set_chunk_hashes(int index, const char* value, size_t size);
+  std::string* add_chunk_hashes();
+  void add_chunk_hashes(const std::string& value);
+  void add_chunk_hashes(std::string&& value);
+  void add_chunk_hashes(const char* value);
+  void add_chunk_hashes(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& chunk_hashes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_chunk_hashes();
+  private:
+  const std::string& _internal_chunk_hashes(int index) const;
+  std::string* _internal_add_chunk_hashes();
+  public:
+
+  // string chain_hash = 2;
+  void clear_chain_hash();
+  const std::string& chain_hash() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_chain_hash(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_chain_hash();
+  PROTOBUF_NODISCARD std::string* release_chain_hash();
+  void set_allocated_chain_hash(std::string* chain_hash);
+  private:
+  const std::string& _internal_chain_hash() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_chain_hash(const std::string& value);
+  std::string* _internal_mutable_chain_hash();
+  public:
+
+  // string root = 6;
+  void clear_root();
+  const std::string& root() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_root(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_root();
+  PROTOBUF_NODISCARD std::string* release_root();
+  void set_allocated_root(std::string* root);
+  private:
+  const std::string& _internal_root() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_root(const std::string& value);
+  std::string* _internal_mutable_root();
+  public:
+
+  // uint64 height = 1;
+  void clear_height();
+  uint64_t height() const;
+  void set_height(uint64_t value);
+  private:
+  uint64_t _internal_height() const;
+  void _internal_set_height(uint64_t value);
+  public:
+
+  // uint64 key_count = 4;
+  void clear_key_count();
+  uint64_t key_count() const;
+  void set_key_count(uint64_t value);
+  private:
+  uint64_t _internal_key_count() const;
+  void _internal_set_key_count(uint64_t value);
+  public:
+
+  // uint64 total_bytes = 5;
+  void clear_total_bytes();
+  uint64_t total_bytes() const;
+  void set_total_bytes(uint64_t value);
+  private:
+  uint64_t _internal_total_bytes() const;
+  void _internal_set_total_bytes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SnapshotManifest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> chunk_hashes_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr chain_hash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr root_;
+    uint64_t height_;
+    uint64_t key_count_;
+    uint64_t total_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetSnapshotManifestReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetSnapshotManifestReq) */ {
+ public:
+  inline SyncGetSnapshotManifestReq() : SyncGetSnapshotManifestReq(nullptr) {}
+  ~SyncGetSnapshotManifestReq() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetSnapshotManifestReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetSnapshotManifestReq(const SyncGetSnapshotManifestReq& from);
+  SyncGetSnapshotManifestReq(SyncGetSnapshotManifestReq&& from) noexcept
+    : SyncGetSnapshotManifestReq() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetSnapshotManifestReq& operator=(const SyncGetSnapshotManifestReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetSnapshotManifestReq& operator=(SyncGetSnapshotManifestReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetSnapshotManifestReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetSnapshotManifestReq* internal_default_instance() {
+    return reinterpret_cast<const SyncGetSnapshotManifestReq*>(
+               &_SyncGetSnapshotManifestReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(SyncGetSnapshotManifestReq& a, SyncGetSnapshotManifestReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetSnapshotManifestReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetSnapshotManifestReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetSnapshotManifestReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetSnapshotManifestReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetSnapshotManifestReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetSnapshotManifestReq& from) {
+    SyncGetSnapshotManifestReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetSnapshotManifestReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetSnapshotManifestReq";
+  }
+  protected:
+  explicit SyncGetSnapshotManifestReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSelfNodeIdFieldNumber = 1,
+    kMsgIdFieldNumber = 2,
+  };
+  // string self_node_id = 1;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 2;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetSnapshotManifestReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetSnapshotManifestAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetSnapshotManifestAck) */ {
+ public:
+  inline SyncGetSnapshotManifestAck() : SyncGetSnapshotManifestAck(nullptr) {}
+  ~SyncGetSnapshotManifestAck() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetSnapshotManifestAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetSnapshotManifestAck(const SyncGetSnapshotManifestAck& from);
+  SyncGetSnapshotManifestAck(SyncGetSnapshotManifestAck&& from) noexcept
+    : SyncGetSnapshotManifestAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetSnapshotManifestAck& operator=(const SyncGetSnapshotManifestAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetSnapshotManifestAck& operator=(SyncGetSnapshotManifestAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetSnapshotManifestAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetSnapshotManifestAck* internal_default_instance() {
+    return reinterpret_cast<const SyncGetSnapshotManifestAck*>(
+               &_SyncGetSnapshotManifestAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(SyncGetSnapshotManifestAck& a, SyncGetSnapshotManifestAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetSnapshotManifestAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetSnapshotManifestAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetSnapshotManifestAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetSnapshotManifestAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetSnapshotManifestAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetSnapshotManifestAck& from) {
+    SyncGetSnapshotManifestAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetSnapshotManifestAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetSnapshotManifestAck";
+  }
+  protected:
+  explicit SyncGetSnapshotManifestAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSelfNodeIdFieldNumber = 2,
+    kMsgIdFieldNumber = 3,
+    kManifestFieldNumber = 5,
+    kNodeBlockHeightFieldNumber = 4,
+    kCodeFieldNumber = 1,
+  };
+  // string self_node_id = 2;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 3;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // .SnapshotManifest manifest = 5;
+  bool has_manifest() const;
+  private:
+  bool _internal_has_manifest() const;
+  public:
+  void clear_manifest();
+  const ::SnapshotManifest& manifest() const;
+  PROTOBUF_NODISCARD ::SnapshotManifest* release_manifest();
+  ::SnapshotManifest* mutable_manifest();
+  void set_allocated_manifest(::SnapshotManifest* manifest);
+  private:
+  const ::SnapshotManifest& _internal_manifest() const;
+  ::SnapshotManifest* _internal_mutable_manifest();
+  public:
+  void unsafe_arena_set_allocated_manifest(
+      ::SnapshotManifest* manifest);
+  ::SnapshotManifest* unsafe_arena_release_manifest();
+
+  // uint64 node_block_height = 4;
+  void clear_node_block_height();
+  uint64_t node_block_height() const;
+  void set_node_block_height(uint64_t value);
+  private:
+  uint64_t _internal_node_block_height() const;
+  void _internal_set_node_block_height(uint64_t value);
+  public:
+
+  // int32 code = 1;
+  void clear_code();
+  int32_t code() const;
+  void set_code(int32_t value);
+  private:
+  int32_t _internal_code() const;
+  void _internal_set_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetSnapshotManifestAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    ::SnapshotManifest* manifest_;
+    uint64_t node_block_height_;
+    int32_t code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetSnapshotChunkReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetSnapshotChunkReq) */ {
+ public:
+  inline SyncGetSnapshotChunkReq() : SyncGetSnapshotChunkReq(nullptr) {}
+  ~SyncGetSnapshotChunkReq() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetSnapshotChunkReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetSnapshotChunkReq(const SyncGetSnapshotChunkReq& from);
+  SyncGetSnapshotChunkReq(SyncGetSnapshotChunkReq&& from) noexcept
+    : SyncGetSnapshotChunkReq() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetSnapshotChunkReq& operator=(const SyncGetSnapshotChunkReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetSnapshotChunkReq& operator=(SyncGetSnapshotChunkReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetSnapshotChunkReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetSnapshotChunkReq* internal_default_instance() {
+    return reinterpret_cast<const SyncGetSnapshotChunkReq*>(
+               &_SyncGetSnapshotChunkReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(SyncGetSnapshotChunkReq& a, SyncGetSnapshotChunkReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetSnapshotChunkReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetSnapshotChunkReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetSnapshotChunkReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetSnapshotChunkReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetSnapshotChunkReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetSnapshotChunkReq& from) {
+    SyncGetSnapshotChunkReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetSnapshotChunkReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetSnapshotChunkReq";
+  }
+  protected:
+  explicit SyncGetSnapshotChunkReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSelfNodeIdFieldNumber = 1,
+    kMsgIdFieldNumber = 2,
+    kHeightFieldNumber = 3,
+    kIndexFieldNumber = 4,
+  };
+  // string self_node_id = 1;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 2;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // uint64 height = 3;
+  void clear_height();
+  uint64_t height() const;
+  void set_height(uint64_t value);
+  private:
+  uint64_t _internal_height() const;
+  void _internal_set_height(uint64_t value);
+  public:
+
+  // uint32 index = 4;
+  void clear_index();
+  uint32_t index() const;
+  void set_index(uint32_t value);
+  private:
+  uint32_t _internal_index() const;
+  void _internal_set_index(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetSnapshotChunkReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    uint64_t height_;
+    uint32_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetSnapshotChunkAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SyncGetSnapshotChunkAck) */ {
+ public:
+  inline SyncGetSnapshotChunkAck() : SyncGetSnapshotChunkAck(nullptr) {}
+  ~SyncGetSnapshotChunkAck() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetSnapshotChunkAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetSnapshotChunkAck(const SyncGetSnapshotChunkAck& from);
+  SyncGetSnapshotChunkAck(SyncGetSnapshotChunkAck&& from) noexcept
+    : SyncGetSnapshotChunkAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetSnapshotChunkAck& operator=(const SyncGetSnapshotChunkAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetSnapshotChunkAck& operator=(SyncGetSnapshotChunkAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetSnapshotChunkAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetSnapshotChunkAck* internal_default_instance() {
+    return reinterpret_cast<const SyncGetSnapshotChunkAck*>(
+               &_SyncGetSnapshotChunkAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(SyncGetSnapshotChunkAck& a, SyncGetSnapshotChunkAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetSnapshotChunkAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetSnapshotChunkAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetSnapshotChunkAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetSnapshotChunkAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetSnapshotChunkAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetSnapshotChunkAck& from) {
+    SyncGetSnapshotChunkAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetSnapshotChunkAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SyncGetSnapshotChunkAck";
+  }
+  protected:
+  explicit SyncGetSnapshotChunkAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSelfNodeIdFieldNumber = 2,
+    kMsgIdFieldNumber = 3,
+    kDataFieldNumber = 6,
+    kCodeFieldNumber = 1,
+    kIndexFieldNumber = 5,
+    kHeightFieldNumber = 4,
+  };
+  // string self_node_id = 2;
+  void clear_self_node_id();
+  const std::string& self_node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_self_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_self_node_id();
+  PROTOBUF_NODISCARD std::string* release_self_node_id();
+  void set_allocated_self_node_id(std::string* self_node_id);
+  private:
+  const std::string& _internal_self_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_self_node_id(const std::string& value);
+  std::string* _internal_mutable_self_node_id();
+  public:
+
+  // string msg_id = 3;
+  void clear_msg_id();
+  const std::string& msg_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_id();
+  PROTOBUF_NODISCARD std::string* release_msg_id();
+  void set_allocated_msg_id(std::string* msg_id);
+  private:
+  const std::string& _internal_msg_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_id(const std::string& value);
+  std::string* _internal_mutable_msg_id();
+  public:
+
+  // bytes data = 6;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // int32 code = 1;
+  void clear_code();
+  int32_t code() const;
+  void set_code(int32_t value);
+  private:
+  int32_t _internal_code() const;
+  void _internal_set_code(int32_t value);
+  public:
+
+  // uint32 index = 5;
+  void clear_index();
+  uint32_t index() const;
+  void set_index(uint32_t value);
+  private:
+  uint32_t _internal_index() const;
+  void _internal_set_index(uint32_t value);
+  public:
+
+  // uint64 height = 4;
+  void clear_height();
+  uint64_t height() const;
+  void set_height(uint64_t value);
+  private:
+  uint64_t _internal_height() const;
+  void _internal_set_height(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SyncGetSnapshotChunkAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr self_node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t code_;
+    uint32_t index_;
+    uint64_t height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sync_5fblock_2eproto;
+};
+// ===================================================================
+
+
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// FastSyncGetHashReq
+
+// string self_node_id = 1;
+inline void FastSyncGetHashReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& FastSyncGetHashReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FastSyncGetHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.self_node_id)
+}
+inline std::string* FastSyncGetHashReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:FastSyncGetHashReq.self_node_id)
+  return _s;
+}
+inline const std::string& FastSyncGetHashReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void FastSyncGetHashReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashReq::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:FastSyncGetHashReq.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void FastSyncGetHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashReq.self_node_id)
+}
+
+// string msg_id = 2;
+inline void FastSyncGetHashReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& FastSyncGetHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FastSyncGetHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.msg_id)
+}
+inline std::string* FastSyncGetHashReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:FastSyncGetHashReq.msg_id)
+  return _s;
+}
+inline const std::string& FastSyncGetHashReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void FastSyncGetHashReq::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashReq::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:FastSyncGetHashReq.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void FastSyncGetHashReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashReq.msg_id)
+}
+
+// uint64 start_height = 3;
+inline void FastSyncGetHashReq::clear_start_height() {
+  _impl_.start_height_ = uint64_t{0u};
+}
+inline uint64_t FastSyncGetHashReq::_internal_start_height() const {
+  return _impl_.start_height_;
+}
+inline uint64_t FastSyncGetHashReq::start_height() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.start_height)
+  return _internal_start_height();
+}
+inline void FastSyncGetHashReq::_internal_set_start_height(uint64_t value) {
+  
+  _impl_.start_height_ = value;
+}
+inline void FastSyncGetHashReq::set_start_height(uint64_t value) {
+  _internal_set_start_height(value);
+  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.start_height)
+}
+
+// uint64 end_height = 4;
+inline void FastSyncGetHashReq::clear_end_height() {
+  _impl_.end_height_ = uint64_t{0u};
+}
+inline uint64_t FastSyncGetHashReq::_internal_end_height() const {
+  return _impl_.end_height_;
+}
+inline uint64_t FastSyncGetHashReq::end_height() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.end_height)
+  return _internal_end_height();
+}
+inline void FastSyncGetHashReq::_internal_set_end_height(uint64_t value) {
+  
+  _impl_.end_height_ = value;
+}
+inline void FastSyncGetHashReq::set_end_height(uint64_t value) {
+  _internal_set_end_height(value);
+  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.end_height)
+}
+
+// -------------------------------------------------------------------
+
+// FastSyncBlockHashs
+
+// uint64 height = 1;
+inline void FastSyncBlockHashs::clear_height() {
+  _impl_.height_ = uint64_t{0u};
+}
+inline uint64_t FastSyncBlockHashs::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint64_t FastSyncBlockHashs::height() const {
+  // @@protoc_insertion_point(field_get:FastSyncBlockHashs.height)
+  return _internal_height();
+}
+inline void FastSyncBlockHashs::_internal_set_height(uint64_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void FastSyncBlockHashs::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:FastSyncBlockHashs.height)
+}
+
+// repeated string hashs = 2;
+inline int FastSyncBlockHashs::_internal_hashs_size() const {
+  return _impl_.hashs_.size();
+}
+inline int FastSyncBlockHashs::hashs_size() const {
+  return _internal_hashs_size();
+}
+inline void FastSyncBlockHashs::clear_hashs() {
+  _impl_.hashs_.Clear();
+}
+inline std::string* FastSyncBlockHashs::add_hashs() {
+  std::string* _s = _internal_add_hashs();
+  // @@protoc_insertion_point(field_add_mutable:FastSyncBlockHashs.hashs)
+  return _s;
+}
+inline const std::string& FastSyncBlockHashs::_internal_hashs(int index) const {
+  return _impl_.hashs_.Get(index);
+}
+inline const std::string& FastSyncBlockHashs::hashs(int index) const {
+  // @@protoc_insertion_point(field_get:FastSyncBlockHashs.hashs)
+  return _internal_hashs(index);
+}
+inline std::string* FastSyncBlockHashs::mutable_hashs(int index) {
+  // @@protoc_insertion_point(field_mutable:FastSyncBlockHashs.hashs)
+  return _impl_.hashs_.Mutable(index);
+}
+inline void FastSyncBlockHashs::set_hashs(int index, const std::string& value) {
+  _impl_.hashs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:FastSyncBlockHashs.hashs)
+}
+inline void FastSyncBlockHashs::set_hashs(int index, std::string&& value) {
+  _impl_.hashs_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:FastSyncBlockHashs.hashs)
+}
+inline void FastSyncBlockHashs::set_hashs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.hashs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:FastSyncBlockHashs.hashs)
+}
+inline void FastSyncBlockHashs::set_hashs(int index, const char* value, size_t size) {
+  _impl_.hashs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:FastSyncBlockHashs.hashs)
+}
+inline std::string* FastSyncBlockHashs::_internal_add_hashs() {
+  return _impl_.hashs_.Add();
+}
+inline void FastSyncBlockHashs::add_hashs(const std::string& value) {
+  _impl_.hashs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:FastSyncBlockHashs.hashs)
+}
+inline void FastSyncBlockHashs::add_hashs(std::string&& value) {
+  _impl_.hashs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:FastSyncBlockHashs.hashs)
+}
+inline void FastSyncBlockHashs::add_hashs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.hashs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:FastSyncBlockHashs.hashs)
+}
+inline void FastSyncBlockHashs::add_hashs(const char* value, size_t size) {
+  _impl_.hashs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:FastSyncBlockHashs.hashs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+FastSyncBlockHashs::hashs() const {
+  // @@protoc_insertion_point(field_list:FastSyncBlockHashs.hashs)
+  return _impl_.hashs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+FastSyncBlockHashs::mutable_hashs() {
+  // @@protoc_insertion_point(field_mutable_list:FastSyncBlockHashs.hashs)
+  return &_impl_.hashs_;
+}
+
+// -------------------------------------------------------------------
+
+// FastSyncGetHashAck
+
+// string self_node_id = 1;
+inline void FastSyncGetHashAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& FastSyncGetHashAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FastSyncGetHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:FastSyncGetHashAck.self_node_id)
+}
+inline std::string* FastSyncGetHashAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:FastSyncGetHashAck.self_node_id)
+  return _s;
+}
+inline const std::string& FastSyncGetHashAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void FastSyncGetHashAck::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashAck::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:FastSyncGetHashAck.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void FastSyncGetHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashAck.self_node_id)
+}
+
+// string msg_id = 2;
+inline void FastSyncGetHashAck::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& FastSyncGetHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FastSyncGetHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:FastSyncGetHashAck.msg_id)
+}
+inline std::string* FastSyncGetHashAck::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:FastSyncGetHashAck.msg_id)
+  return _s;
+}
+inline const std::string& FastSyncGetHashAck::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void FastSyncGetHashAck::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashAck::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FastSyncGetHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:FastSyncGetHashAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void FastSyncGetHashAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashAck.msg_id)
+}
+
+// uint64 node_block_height = 3;
+inline void FastSyncGetHashAck::clear_node_block_height() {
+  _impl_.node_block_height_ = uint64_t{0u};
+}
+inline uint64_t FastSyncGetHashAck::_internal_node_block_height() const {
+  return _impl_.node_block_height_;
+}
+inline uint64_t FastSyncGetHashAck::node_block_height() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.node_block_height)
+  return _internal_node_block_height();
+}
+inline void FastSyncGetHashAck::_internal_set_node_block_height(uint64_t value) {
+  
+  _impl_.node_block_height_ = value;
+}
+inline void FastSyncGetHashAck::set_node_block_height(uint64_t value) {
+  _internal_set_node_block_height(value);
+  // @@protoc_insertion_point(field_set:FastSyncGetHashAck.node_block_height)
+}
+
+// repeated .FastSyncBlockHashs hashs = 4;
+inline int FastSyncGetHashAck::_internal_hashs_size() const {
+  return _impl_.hashs_.size();
+}
+inline int FastSyncGetHashAck::hashs_size() const {
+  return _internal_hashs_size();
+}
+inline void FastSyncGetHashAck::clear_hashs() {
+  _impl_.hashs_.Clear();
+}
+inline ::FastSyncBlockHashs* FastSyncGetHashAck::mutable_hashs(int index) {
+  // @@protoc_insertion_point(field_mutable:FastSyncGetHashAck.hashs)
+  return _impl_.hashs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >*
+FastSyncGetHashAck::mutable_hashs() {
+  // @@protoc_insertion_point(field_mutable_list:FastSyncGetHashAck.hashs)
+  return &_impl_.hashs_;
+}
+inline const ::FastSyncBlockHashs& FastSyncGetHashAck::_internal_hashs(int index) const {
+  return _impl_.hashs_.Get(index);
+}
+inline const ::FastSyncBlockHashs& FastSyncGetHashAck::hashs(int index) const {
+  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.hashs)
+  return _internal_hashs(index);
+}
+inline ::FastSyncBlockHashs* FastSyncGetHashAck::_internal_add_hashs() {
+  return _impl_.hashs_.Add();
+}
+inline ::FastSyncBlockHashs* FastSyncGetHashAck::add_hashs() {
+  ::FastSyncBlockHashs* _add = _internal_add_hashs();
+  // @@protoc_insertion_point(field_add:FastSyncGetHashAck.hashs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >&
+FastSyncGetHashAck::hashs() const {
+  // @@protoc_insertion_point(field_list:FastSyncGetHashAck.hashs)
+  return _impl_.hashs_;
+}
+
+// -------------------------------------------------------------------
+
+// FastSyncGetBlockReq
+
+// string self_node_id = 1;
+inline void FastSyncGetBlockReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& FastSyncGetBlockReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetBlockReq.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FastSyncGetBlockReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:FastSyncGetBlockReq.self_node_id)
+}
+inline std::string* FastSyncGetBlockReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockReq.self_node_id)
+  return _s;
+}
+inline const std::string& FastSyncGetBlockReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void FastSyncGetBlockReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FastSyncGetBlockReq::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FastSyncGetBlockReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:FastSyncGetBlockReq.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void FastSyncGetBlockReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:FastSyncGetBlockReq.self_node_id)
+}
+
+// string msg_id = 2;
+inline void FastSyncGetBlockReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& FastSyncGetBlockReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetBlockReq.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FastSyncGetBlockReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:FastSyncGetBlockReq.msg_id)
+}
+inline std::string* FastSyncGetBlockReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockReq.msg_id)
+  return _s;
+}
+inline const std::string& FastSyncGetBlockReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void FastSyncGetBlockReq::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FastSyncGetBlockReq::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FastSyncGetBlockReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:FastSyncGetBlockReq.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void FastSyncGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:FastSyncGetBlockReq.msg_id)
+}
+
+// repeated .FastSyncBlockHashs hashs = 3;
+inline int FastSyncGetBlockReq::_internal_hashs_size() const {
+  return _impl_.hashs_.size();
+}
+inline int FastSyncGetBlockReq::hashs_size() const {
+  return _internal_hashs_size();
+}
+inline void FastSyncGetBlockReq::clear_hashs() {
+  _impl_.hashs_.Clear();
+}
+inline ::FastSyncBlockHashs* FastSyncGetBlockReq::mutable_hashs(int index) {
+  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockReq.hashs)
+  return _impl_.hashs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >*
+FastSyncGetBlockReq::mutable_hashs() {
+  // @@protoc_insertion_point(field_mutable_list:FastSyncGetBlockReq.hashs)
+  return &_impl_.hashs_;
+}
+inline const ::FastSyncBlockHashs& FastSyncGetBlockReq::_internal_hashs(int index) const {
+  return _impl_.hashs_.Get(index);
+}
+inline const ::FastSyncBlockHashs& FastSyncGetBlockReq::hashs(int index) const {
+  // @@protoc_insertion_point(field_get:FastSyncGetBlockReq.hashs)
+  return _internal_hashs(index);
+}
+inline ::FastSyncBlockHashs* FastSyncGetBlockReq::_internal_add_hashs() {
+  return _impl_.hashs_.Add();
+}
+inline ::FastSyncBlockHashs* FastSyncGetBlockReq::add_hashs() {
+  ::FastSyncBlockHashs* _add = _internal_add_hashs();
+  // @@protoc_insertion_point(field_add:FastSyncGetBlockReq.hashs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >&
+FastSyncGetBlockReq::hashs() const {
+  // @@protoc_insertion_point(field_list:FastSyncGetBlockReq.hashs)
+  return _impl_.hashs_;
+}
+
+// -------------------------------------------------------------------
+
+// FastSyncBlock
+
+// uint64 height = 1;
+inline void FastSyncBlock::clear_height() {
+  _impl_.height_ = uint64_t{0u};
+}
+inline uint64_t FastSyncBlock::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint64_t FastSyncBlock::height() const {
+  // @@protoc_insertion_point(field_get:FastSyncBlock.height)
+  return _internal_height();
+}
+inline void FastSyncBlock::_internal_set_height(uint64_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void FastSyncBlock::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:FastSyncBlock.height)
+}
+
+// repeated bytes blocks = 2;
+inline int FastSyncBlock::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
+}
+inline int FastSyncBlock::blocks_size() const {
+  return _internal_blocks_size();
+}
+inline void FastSyncBlock::clear_blocks() {
+  _impl_.blocks_.Clear();
+}
+inline std::string* FastSyncBlock::add_blocks() {
+  std::string* _s = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add_mutable:FastSyncBlock.blocks)
+  return _s;
+}
+inline const std::string& FastSyncBlock::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
+}
+inline const std::string& FastSyncBlock::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:FastSyncBlock.blocks)
+  return _internal_blocks(index);
+}
+inline std::string* FastSyncBlock::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:FastSyncBlock.blocks)
+  return _impl_.blocks_.Mutable(index);
+}
+inline void FastSyncBlock::set_blocks(int index, const std::string& value) {
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:FastSyncBlock.blocks)
+}
+inline void FastSyncBlock::set_blocks(int index, std::string&& value) {
+  _impl_.blocks_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:FastSyncBlock.blocks)
+}
+inline void FastSyncBlock::set_blocks(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:FastSyncBlock.blocks)
+}
+inline void FastSyncBlock::set_blocks(int index, const void* value, size_t size) {
+  _impl_.blocks_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:FastSyncBlock.blocks)
+}
+inline std::string* FastSyncBlock::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
+}
+inline void FastSyncBlock::add_blocks(const std::string& value) {
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:FastSyncBlock.blocks)
+}
+inline void FastSyncBlock::add_blocks(std::string&& value) {
+  _impl_.blocks_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:FastSyncBlock.blocks)
+}
+inline void FastSyncBlock::add_blocks(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:FastSyncBlock.blocks)
+}
+inline void FastSyncBlock::add_blocks(const void* value, size_t size) {
+  _impl_.blocks_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:FastSyncBlock.blocks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+FastSyncBlock::blocks() const {
+  // @@protoc_insertion_point(field_list:FastSyncBlock.blocks)
+  return _impl_.blocks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+FastSyncBlock::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:FastSyncBlock.blocks)
+  return &_impl_.blocks_;
+}
+
+// -------------------------------------------------------------------
+
+// FastSyncGetBlockAck
+
+// string msg_id = 1;
+inline void FastSyncGetBlockAck::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& FastSyncGetBlockAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:FastSyncGetBlockAck.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FastSyncGetBlockAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:FastSyncGetBlockAck.msg_id)
+}
+inline std::string* FastSyncGetBlockAck::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockAck.msg_id)
+  return _s;
+}
+inline const std::string& FastSyncGetBlockAck::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void FastSyncGetBlockAck::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FastSyncGetBlockAck::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FastSyncGetBlockAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:FastSyncGetBlockAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void FastSyncGetBlockAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:FastSyncGetBlockAck.msg_id)
+}
+
+// repeated .FastSyncBlock blocks = 2;
+inline int FastSyncGetBlockAck::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
+}
+inline int FastSyncGetBlockAck::blocks_size() const {
+  return _internal_blocks_size();
+}
+inline void FastSyncGetBlockAck::clear_blocks() {
+  _impl_.blocks_.Clear();
+}
+inline ::FastSyncBlock* FastSyncGetBlockAck::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockAck.blocks)
+  return _impl_.blocks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlock >*
+FastSyncGetBlockAck::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:FastSyncGetBlockAck.blocks)
+  return &_impl_.blocks_;
+}
+inline const ::FastSyncBlock& FastSyncGetBlockAck::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
+}
+inline const ::FastSyncBlock& FastSyncGetBlockAck::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:FastSyncGetBlockAck.blocks)
+  return _internal_blocks(index);
+}
+inline ::FastSyncBlock* FastSyncGetBlockAck::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
+}
+inline ::FastSyncBlock* FastSyncGetBlockAck::add_blocks() {
+  ::FastSyncBlock* _add = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add:FastSyncGetBlockAck.blocks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlock >&
+FastSyncGetBlockAck::blocks() const {
+  // @@protoc_insertion_point(field_list:FastSyncGetBlockAck.blocks)
+  return _impl_.blocks_;
+}
+
+// -------------------------------------------------------------------
+
+// SyncGetSumHashReq
+
+// string self_node_id = 1;
+inline void SyncGetSumHashReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetSumHashReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetSumHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.self_node_id)
+}
+inline std::string* SyncGetSumHashReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSumHashReq.self_node_id)
+  return _s;
+}
+inline const std::string& SyncGetSumHashReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void SyncGetSumHashReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashReq::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumHashReq.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void SyncGetSumHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashReq.self_node_id)
+}
+
+// string msg_id = 2;
+inline void SyncGetSumHashReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetSumHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetSumHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.msg_id)
+}
+inline std::string* SyncGetSumHashReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSumHashReq.msg_id)
+  return _s;
+}
+inline const std::string& SyncGetSumHashReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void SyncGetSumHashReq::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashReq::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumHashReq.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void SyncGetSumHashReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashReq.msg_id)
+}
+
+// uint64 start_height = 3;
+inline void SyncGetSumHashReq::clear_start_height() {
+  _impl_.start_height_ = uint64_t{0u};
+}
+inline uint64_t SyncGetSumHashReq::_internal_start_height() const {
+  return _impl_.start_height_;
+}
+inline uint64_t SyncGetSumHashReq::start_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.start_height)
+  return _internal_start_height();
+}
+inline void SyncGetSumHashReq::_internal_set_start_height(uint64_t value) {
+  
+  _impl_.start_height_ = value;
+}
+inline void SyncGetSumHashReq::set_start_height(uint64_t value) {
+  _internal_set_start_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.start_height)
+}
+
+// uint64 end_height = 4;
+inline void SyncGetSumHashReq::clear_end_height() {
+  _impl_.end_height_ = uint64_t{0u};
+}
+inline uint64_t SyncGetSumHashReq::_internal_end_height() const {
+  return _impl_.end_height_;
+}
+inline uint64_t SyncGetSumHashReq::end_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.end_height)
+  return _internal_end_height();
+}
+inline void SyncGetSumHashReq::_internal_set_end_height(uint64_t value) {
+  
+  _impl_.end_height_ = value;
+}
+inline void SyncGetSumHashReq::set_end_height(uint64_t value) {
+  _internal_set_end_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.end_height)
+}
+
+// -------------------------------------------------------------------
+
+// SyncSumHash
+
+// uint64 start_height = 1;
+inline void SyncSumHash::clear_start_height() {
+  _impl_.start_height_ = uint64_t{0u};
+}
+inline uint64_t SyncSumHash::_internal_start_height() const {
+  return _impl_.start_height_;
+}
+inline uint64_t SyncSumHash::start_height() const {
+  // @@protoc_insertion_point(field_get:SyncSumHash.start_height)
+  return _internal_start_height();
+}
+inline void SyncSumHash::_internal_set_start_height(uint64_t value) {
+  
+  _impl_.start_height_ = value;
+}
+inline void SyncSumHash::set_start_height(uint64_t value) {
+  _internal_set_start_height(value);
+  // @@protoc_insertion_point(field_set:SyncSumHash.start_height)
+}
+
+// uint64 end_height = 2;
+inline void SyncSumHash::clear_end_height() {
+  _impl_.end_height_ = uint64_t{0u};
+}
+inline uint64_t SyncSumHash::_internal_end_height() const {
+  return _impl_.end_height_;
+}
+inline uint64_t SyncSumHash::end_height() const {
+  // @@protoc_insertion_point(field_get:SyncSumHash.end_height)
+  return _internal_end_height();
+}
+inline void SyncSumHash::_internal_set_end_height(uint64_t value) {
+  
+  _impl_.end_height_ = value;
+}
+inline void SyncSumHash::set_end_height(uint64_t value) {
+  _internal_set_end_height(value);
+  // @@protoc_insertion_point(field_set:SyncSumHash.end_height)
+}
+
+// string hash = 3;
+inline void SyncSumHash::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
+}
+inline const std::string& SyncSumHash::hash() const {
+  // @@protoc_insertion_point(field_get:SyncSumHash.hash)
+  return _internal_hash();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncSumHash::set_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncSumHash.hash)
+}
+inline std::string* SyncSumHash::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:SyncSumHash.hash)
+  return _s;
+}
+inline const std::string& SyncSumHash::_internal_hash() const {
+  return _impl_.hash_.Get();
+}
+inline void SyncSumHash::_internal_set_hash(const std::string& value) {
+  
+  _impl_.hash_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncSumHash::_internal_mutable_hash() {
+  
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncSumHash::release_hash() {
+  // @@protoc_insertion_point(field_release:SyncSumHash.hash)
+  return _impl_.hash_.Release();
+}
+inline void SyncSumHash::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncSumHash.hash)
+}
+
+// -------------------------------------------------------------------
+
+// SyncGetSumHashAck
+
+// string self_node_id = 1;
+inline void SyncGetSumHashAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetSumHashAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetSumHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSumHashAck.self_node_id)
+}
+inline std::string* SyncGetSumHashAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSumHashAck.self_node_id)
+  return _s;
+}
+inline const std::string& SyncGetSumHashAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void SyncGetSumHashAck::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashAck::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumHashAck.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void SyncGetSumHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashAck.self_node_id)
+}
+
+// string msg_id = 2;
+inline void SyncGetSumHashAck::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetSumHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetSumHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSumHashAck.msg_id)
+}
+inline std::string* SyncGetSumHashAck::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSumHashAck.msg_id)
+  return _s;
+}
+inline const std::string& SyncGetSumHashAck::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void SyncGetSumHashAck::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashAck::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetSumHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumHashAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void SyncGetSumHashAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashAck.msg_id)
+}
+
+// uint64 node_block_height = 3;
+inline void SyncGetSumHashAck::clear_node_block_height() {
+  _impl_.node_block_height_ = uint64_t{0u};
+}
+inline uint64_t SyncGetSumHashAck::_internal_node_block_height() const {
+  return _impl_.node_block_height_;
+}
+inline uint64_t SyncGetSumHashAck::node_block_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.node_block_height)
+  return _internal_node_block_height();
+}
+inline void SyncGetSumHashAck::_internal_set_node_block_height(uint64_t value) {
+  
+  _impl_.node_block_height_ = value;
+}
+inline void SyncGetSumHashAck::set_node_block_height(uint64_t value) {
+  _internal_set_node_block_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumHashAck.node_block_height)
+}
+
+// repeated .SyncSumHash sync_sum_hashes = 4;
+inline int SyncGetSumHashAck::_internal_sync_sum_hashes_size() const {
+  return _impl_.sync_sum_hashes_.size();
+}
+inline int SyncGetSumHashAck::sync_sum_hashes_size() const {
+  return _internal_sync_sum_hashes_size();
+}
+inline void SyncGetSumHashAck::clear_sync_sum_hashes() {
+  _impl_.sync_sum_hashes_.Clear();
+}
+inline ::SyncSumHash* SyncGetSumHashAck::mutable_sync_sum_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncGetSumHashAck.sync_sum_hashes)
+  return _impl_.sync_sum_hashes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumHash >*
+SyncGetSumHashAck::mutable_sync_sum_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:SyncGetSumHashAck.sync_sum_hashes)
+  return &_impl_.sync_sum_hashes_;
+}
+inline const ::SyncSumHash& SyncGetSumHashAck::_internal_sync_sum_hashes(int index) const {
+  return _impl_.sync_sum_hashes_.Get(index);
+}
+inline const ::SyncSumHash& SyncGetSumHashAck::sync_sum_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.sync_sum_hashes)
+  return _internal_sync_sum_hashes(index);
+}
+inline ::SyncSumHash* SyncGetSumHashAck::_internal_add_sync_sum_hashes() {
+  return _impl_.sync_sum_hashes_.Add();
+}
+inline ::SyncSumHash* SyncGetSumHashAck::add_sync_sum_hashes() {
+  ::SyncSumHash* _add = _internal_add_sync_sum_hashes();
+  // @@protoc_insertion_point(field_add:SyncGetSumHashAck.sync_sum_hashes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumHash >&
+SyncGetSumHashAck::sync_sum_hashes() const {
+  // @@protoc_insertion_point(field_list:SyncGetSumHashAck.sync_sum_hashes)
+  return _impl_.sync_sum_hashes_;
+}
+
+// -------------------------------------------------------------------
+
+// SyncGetHeightHashReq
+
+// string self_node_id = 1;
+inline void SyncGetHeightHashReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetHeightHashReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetHeightHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.self_node_id)
+}
+inline std::string* SyncGetHeightHashReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashReq.self_node_id)
+  return _s;
+}
+inline const std::string& SyncGetHeightHashReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void SyncGetHeightHashReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashReq::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetHeightHashReq.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void SyncGetHeightHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashReq.self_node_id)
+}
+
+// string msg_id = 2;
+inline void SyncGetHeightHashReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetHeightHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetHeightHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.msg_id)
+}
+inline std::string* SyncGetHeightHashReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashReq.msg_id)
+  return _s;
+}
+inline const std::string& SyncGetHeightHashReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void SyncGetHeightHashReq::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashReq::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetHeightHashReq.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void SyncGetHeightHashReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashReq.msg_id)
+}
+
+// uint64 start_height = 3;
+inline void SyncGetHeightHashReq::clear_start_height() {
+  _impl_.start_height_ = uint64_t{0u};
+}
+inline uint64_t SyncGetHeightHashReq::_internal_start_height() const {
+  return _impl_.start_height_;
+}
+inline uint64_t SyncGetHeightHashReq::start_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.start_height)
+  return _internal_start_height();
+}
+inline void SyncGetHeightHashReq::_internal_set_start_height(uint64_t value) {
+  
+  _impl_.start_height_ = value;
+}
+inline void SyncGetHeightHashReq::set_start_height(uint64_t value) {
+  _internal_set_start_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.start_height)
+}
 
-// ===================================================================
+// uint64 end_height = 4;
+inline void SyncGetHeightHashReq::clear_end_height() {
+  _impl_.end_height_ = uint64_t{0u};
+}
+inline uint64_t SyncGetHeightHashReq::_internal_end_height() const {
+  return _impl_.end_height_;
+}
+inline uint64_t SyncGetHeightHashReq::end_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.end_height)
+  return _internal_end_height();
+}
+inline void SyncGetHeightHashReq::_internal_set_end_height(uint64_t value) {
+  
+  _impl_.end_height_ = value;
+}
+inline void SyncGetHeightHashReq::set_end_height(uint64_t value) {
+  _internal_set_end_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.end_height)
+}
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// FastSyncGetHashReq
+// -------------------------------------------------------------------
+
+// SyncGetHeightHashAck
+
+// int32 code = 1;
+inline void SyncGetHeightHashAck::clear_code() {
+  _impl_.code_ = 0;
+}
+inline int32_t SyncGetHeightHashAck::_internal_code() const {
+  return _impl_.code_;
+}
+inline int32_t SyncGetHeightHashAck::code() const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.code)
+  return _internal_code();
+}
+inline void SyncGetHeightHashAck::_internal_set_code(int32_t value) {
+  
+  _impl_.code_ = value;
+}
+inline void SyncGetHeightHashAck::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.code)
+}
+
+// string self_node_id = 2;
+inline void SyncGetHeightHashAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetHeightHashAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetHeightHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.self_node_id)
+}
+inline std::string* SyncGetHeightHashAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashAck.self_node_id)
+  return _s;
+}
+inline const std::string& SyncGetHeightHashAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void SyncGetHeightHashAck::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashAck::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetHeightHashAck.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void SyncGetHeightHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashAck.self_node_id)
+}
+
+// string msg_id = 3;
+inline void SyncGetHeightHashAck::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetHeightHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetHeightHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.msg_id)
+}
+inline std::string* SyncGetHeightHashAck::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashAck.msg_id)
+  return _s;
+}
+inline const std::string& SyncGetHeightHashAck::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void SyncGetHeightHashAck::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashAck::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetHeightHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetHeightHashAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void SyncGetHeightHashAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashAck.msg_id)
+}
+
+// repeated string block_hashes = 4;
+inline int SyncGetHeightHashAck::_internal_block_hashes_size() const {
+  return _impl_.block_hashes_.size();
+}
+inline int SyncGetHeightHashAck::block_hashes_size() const {
+  return _internal_block_hashes_size();
+}
+inline void SyncGetHeightHashAck::clear_block_hashes() {
+  _impl_.block_hashes_.Clear();
+}
+inline std::string* SyncGetHeightHashAck::add_block_hashes() {
+  std::string* _s = _internal_add_block_hashes();
+  // @@protoc_insertion_point(field_add_mutable:SyncGetHeightHashAck.block_hashes)
+  return _s;
+}
+inline const std::string& SyncGetHeightHashAck::_internal_block_hashes(int index) const {
+  return _impl_.block_hashes_.Get(index);
+}
+inline const std::string& SyncGetHeightHashAck::block_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.block_hashes)
+  return _internal_block_hashes(index);
+}
+inline std::string* SyncGetHeightHashAck::mutable_block_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashAck.block_hashes)
+  return _impl_.block_hashes_.Mutable(index);
+}
+inline void SyncGetHeightHashAck::set_block_hashes(int index, const std::string& value) {
+  _impl_.block_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.block_hashes)
+}
+inline void SyncGetHeightHashAck::set_block_hashes(int index, std::string&& value) {
+  _impl_.block_hashes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.block_hashes)
+}
+inline void SyncGetHeightHashAck::set_block_hashes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.block_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SyncGetHeightHashAck.block_hashes)
+}
+inline void SyncGetHeightHashAck::set_block_hashes(int index, const char* value, size_t size) {
+  _impl_.block_hashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SyncGetHeightHashAck.block_hashes)
+}
+inline std::string* SyncGetHeightHashAck::_internal_add_block_hashes() {
+  return _impl_.block_hashes_.Add();
+}
+inline void SyncGetHeightHashAck::add_block_hashes(const std::string& value) {
+  _impl_.block_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SyncGetHeightHashAck.block_hashes)
+}
+inline void SyncGetHeightHashAck::add_block_hashes(std::string&& value) {
+  _impl_.block_hashes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SyncGetHeightHashAck.block_hashes)
+}
+inline void SyncGetHeightHashAck::add_block_hashes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.block_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SyncGetHeightHashAck.block_hashes)
+}
+inline void SyncGetHeightHashAck::add_block_hashes(const char* value, size_t size) {
+  _impl_.block_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SyncGetHeightHashAck.block_hashes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SyncGetHeightHashAck::block_hashes() const {
+  // @@protoc_insertion_point(field_list:SyncGetHeightHashAck.block_hashes)
+  return _impl_.block_hashes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SyncGetHeightHashAck::mutable_block_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:SyncGetHeightHashAck.block_hashes)
+  return &_impl_.block_hashes_;
+}
+
+// -------------------------------------------------------------------
+
+// SyncGetBlockHeightAndHashReq
 
 // string self_node_id = 1;
-inline void FastSyncGetHashReq::clear_self_node_id() {
+inline void SyncGetBlockHeightAndHashReq::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& FastSyncGetHashReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.self_node_id)
+inline const std::string& SyncGetBlockHeightAndHashReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FastSyncGetHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockHeightAndHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.self_node_id)
 }
-inline std::string* FastSyncGetHashReq::mutable_self_node_id() {
+inline std::string* SyncGetBlockHeightAndHashReq::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:FastSyncGetHashReq.self_node_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashReq.self_node_id)
   return _s;
 }
-inline const std::string& FastSyncGetHashReq::_internal_self_node_id() const {
+inline const std::string& SyncGetBlockHeightAndHashReq::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void FastSyncGetHashReq::_internal_set_self_node_id(const std::string& value) {
+inline void SyncGetBlockHeightAndHashReq::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashReq::_internal_mutable_self_node_id() {
+inline std::string* SyncGetBlockHeightAndHashReq::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:FastSyncGetHashReq.self_node_id)
+inline std::string* SyncGetBlockHeightAndHashReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashReq.self_node_id)
   return _impl_.self_node_id_.Release();
 }
-inline void FastSyncGetHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+inline void SyncGetBlockHeightAndHashReq::set_allocated_self_node_id(std::string* self_node_id) {
   if (self_node_id != nullptr) {
     
   } else {
@@ -5685,45 +9447,45 @@ inline void FastSyncGetHashReq::set_allocated_self_node_id(std::string* self_nod
     _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashReq.self_node_id)
 }
 
 // string msg_id = 2;
-inline void FastSyncGetHashReq::clear_msg_id() {
+inline void SyncGetBlockHeightAndHashReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& FastSyncGetHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.msg_id)
+inline const std::string& SyncGetBlockHeightAndHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FastSyncGetHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockHeightAndHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.msg_id)
 }
-inline std::string* FastSyncGetHashReq::mutable_msg_id() {
+inline std::string* SyncGetBlockHeightAndHashReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:FastSyncGetHashReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashReq.msg_id)
   return _s;
 }
-inline const std::string& FastSyncGetHashReq::_internal_msg_id() const {
+inline const std::string& SyncGetBlockHeightAndHashReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void FastSyncGetHashReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetBlockHeightAndHashReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashReq::_internal_mutable_msg_id() {
+inline std::string* SyncGetBlockHeightAndHashReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:FastSyncGetHashReq.msg_id)
+inline std::string* SyncGetBlockHeightAndHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void FastSyncGetHashReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetBlockHeightAndHashReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -5735,188 +9497,288 @@ inline void FastSyncGetHashReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashReq.msg_id)
 }
 
 // uint64 start_height = 3;
-inline void FastSyncGetHashReq::clear_start_height() {
+inline void SyncGetBlockHeightAndHashReq::clear_start_height() {
   _impl_.start_height_ = uint64_t{0u};
 }
-inline uint64_t FastSyncGetHashReq::_internal_start_height() const {
+inline uint64_t SyncGetBlockHeightAndHashReq::_internal_start_height() const {
   return _impl_.start_height_;
 }
-inline uint64_t FastSyncGetHashReq::start_height() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.start_height)
+inline uint64_t SyncGetBlockHeightAndHashReq::start_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.start_height)
   return _internal_start_height();
 }
-inline void FastSyncGetHashReq::_internal_set_start_height(uint64_t value) {
+inline void SyncGetBlockHeightAndHashReq::_internal_set_start_height(uint64_t value) {
   
   _impl_.start_height_ = value;
 }
-inline void FastSyncGetHashReq::set_start_height(uint64_t value) {
+inline void SyncGetBlockHeightAndHashReq::set_start_height(uint64_t value) {
   _internal_set_start_height(value);
-  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.start_height)
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.start_height)
 }
 
 // uint64 end_height = 4;
-inline void FastSyncGetHashReq::clear_end_height() {
+inline void SyncGetBlockHeightAndHashReq::clear_end_height() {
   _impl_.end_height_ = uint64_t{0u};
 }
-inline uint64_t FastSyncGetHashReq::_internal_end_height() const {
+inline uint64_t SyncGetBlockHeightAndHashReq::_internal_end_height() const {
   return _impl_.end_height_;
 }
-inline uint64_t FastSyncGetHashReq::end_height() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashReq.end_height)
+inline uint64_t SyncGetBlockHeightAndHashReq::end_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.end_height)
   return _internal_end_height();
 }
-inline void FastSyncGetHashReq::_internal_set_end_height(uint64_t value) {
+inline void SyncGetBlockHeightAndHashReq::_internal_set_end_height(uint64_t value) {
   
   _impl_.end_height_ = value;
 }
-inline void FastSyncGetHashReq::set_end_height(uint64_t value) {
+inline void SyncGetBlockHeightAndHashReq::set_end_height(uint64_t value) {
   _internal_set_end_height(value);
-  // @@protoc_insertion_point(field_set:FastSyncGetHashReq.end_height)
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.end_height)
 }
 
 // -------------------------------------------------------------------
 
-// FastSyncBlockHashs
+// SyncGetBlockHeightAndHashAck
 
-// uint64 height = 1;
-inline void FastSyncBlockHashs::clear_height() {
-  _impl_.height_ = uint64_t{0u};
+// int32 code = 1;
+inline void SyncGetBlockHeightAndHashAck::clear_code() {
+  _impl_.code_ = 0;
 }
-inline uint64_t FastSyncBlockHashs::_internal_height() const {
-  return _impl_.height_;
+inline int32_t SyncGetBlockHeightAndHashAck::_internal_code() const {
+  return _impl_.code_;
 }
-inline uint64_t FastSyncBlockHashs::height() const {
-  // @@protoc_insertion_point(field_get:FastSyncBlockHashs.height)
-  return _internal_height();
+inline int32_t SyncGetBlockHeightAndHashAck::code() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.code)
+  return _internal_code();
 }
-inline void FastSyncBlockHashs::_internal_set_height(uint64_t value) {
+inline void SyncGetBlockHeightAndHashAck::_internal_set_code(int32_t value) {
   
-  _impl_.height_ = value;
+  _impl_.code_ = value;
 }
-inline void FastSyncBlockHashs::set_height(uint64_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:FastSyncBlockHashs.height)
+inline void SyncGetBlockHeightAndHashAck::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.code)
 }
 
-// repeated string hashs = 2;
-inline int FastSyncBlockHashs::_internal_hashs_size() const {
-  return _impl_.hashs_.size();
+// string self_node_id = 2;
+inline void SyncGetBlockHeightAndHashAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline int FastSyncBlockHashs::hashs_size() const {
-  return _internal_hashs_size();
+inline const std::string& SyncGetBlockHeightAndHashAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.self_node_id)
+  return _internal_self_node_id();
 }
-inline void FastSyncBlockHashs::clear_hashs() {
-  _impl_.hashs_.Clear();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetBlockHeightAndHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.self_node_id)
 }
-inline std::string* FastSyncBlockHashs::add_hashs() {
-  std::string* _s = _internal_add_hashs();
-  // @@protoc_insertion_point(field_add_mutable:FastSyncBlockHashs.hashs)
+inline std::string* SyncGetBlockHeightAndHashAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashAck.self_node_id)
   return _s;
 }
-inline const std::string& FastSyncBlockHashs::_internal_hashs(int index) const {
-  return _impl_.hashs_.Get(index);
+inline const std::string& SyncGetBlockHeightAndHashAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline const std::string& FastSyncBlockHashs::hashs(int index) const {
-  // @@protoc_insertion_point(field_get:FastSyncBlockHashs.hashs)
-  return _internal_hashs(index);
+inline void SyncGetBlockHeightAndHashAck::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncBlockHashs::mutable_hashs(int index) {
-  // @@protoc_insertion_point(field_mutable:FastSyncBlockHashs.hashs)
-  return _impl_.hashs_.Mutable(index);
+inline std::string* SyncGetBlockHeightAndHashAck::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline void FastSyncBlockHashs::set_hashs(int index, const std::string& value) {
-  _impl_.hashs_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:FastSyncBlockHashs.hashs)
+inline std::string* SyncGetBlockHeightAndHashAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashAck.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void FastSyncBlockHashs::set_hashs(int index, std::string&& value) {
-  _impl_.hashs_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:FastSyncBlockHashs.hashs)
+inline void SyncGetBlockHeightAndHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashAck.self_node_id)
 }
-inline void FastSyncBlockHashs::set_hashs(int index, const char* value) {
+
+// string msg_id = 3;
+inline void SyncGetBlockHeightAndHashAck::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetBlockHeightAndHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.msg_id)
+  return _internal_msg_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetBlockHeightAndHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.msg_id)
+}
+inline std::string* SyncGetBlockHeightAndHashAck::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashAck.msg_id)
+  return _s;
+}
+inline const std::string& SyncGetBlockHeightAndHashAck::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
+}
+inline void SyncGetBlockHeightAndHashAck::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetBlockHeightAndHashAck::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetBlockHeightAndHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void SyncGetBlockHeightAndHashAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashAck.msg_id)
+}
+
+// repeated string block_hashes = 4;
+inline int SyncGetBlockHeightAndHashAck::_internal_block_hashes_size() const {
+  return _impl_.block_hashes_.size();
+}
+inline int SyncGetBlockHeightAndHashAck::block_hashes_size() const {
+  return _internal_block_hashes_size();
+}
+inline void SyncGetBlockHeightAndHashAck::clear_block_hashes() {
+  _impl_.block_hashes_.Clear();
+}
+inline std::string* SyncGetBlockHeightAndHashAck::add_block_hashes() {
+  std::string* _s = _internal_add_block_hashes();
+  // @@protoc_insertion_point(field_add_mutable:SyncGetBlockHeightAndHashAck.block_hashes)
+  return _s;
+}
+inline const std::string& SyncGetBlockHeightAndHashAck::_internal_block_hashes(int index) const {
+  return _impl_.block_hashes_.Get(index);
+}
+inline const std::string& SyncGetBlockHeightAndHashAck::block_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.block_hashes)
+  return _internal_block_hashes(index);
+}
+inline std::string* SyncGetBlockHeightAndHashAck::mutable_block_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashAck.block_hashes)
+  return _impl_.block_hashes_.Mutable(index);
+}
+inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, const std::string& value) {
+  _impl_.block_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.block_hashes)
+}
+inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, std::string&& value) {
+  _impl_.block_hashes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.block_hashes)
+}
+inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.hashs_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:FastSyncBlockHashs.hashs)
+  _impl_.block_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SyncGetBlockHeightAndHashAck.block_hashes)
 }
-inline void FastSyncBlockHashs::set_hashs(int index, const char* value, size_t size) {
-  _impl_.hashs_.Mutable(index)->assign(
+inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, const char* value, size_t size) {
+  _impl_.block_hashes_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:FastSyncBlockHashs.hashs)
+  // @@protoc_insertion_point(field_set_pointer:SyncGetBlockHeightAndHashAck.block_hashes)
 }
-inline std::string* FastSyncBlockHashs::_internal_add_hashs() {
-  return _impl_.hashs_.Add();
+inline std::string* SyncGetBlockHeightAndHashAck::_internal_add_block_hashes() {
+  return _impl_.block_hashes_.Add();
 }
-inline void FastSyncBlockHashs::add_hashs(const std::string& value) {
-  _impl_.hashs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:FastSyncBlockHashs.hashs)
+inline void SyncGetBlockHeightAndHashAck::add_block_hashes(const std::string& value) {
+  _impl_.block_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SyncGetBlockHeightAndHashAck.block_hashes)
 }
-inline void FastSyncBlockHashs::add_hashs(std::string&& value) {
-  _impl_.hashs_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:FastSyncBlockHashs.hashs)
+inline void SyncGetBlockHeightAndHashAck::add_block_hashes(std::string&& value) {
+  _impl_.block_hashes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SyncGetBlockHeightAndHashAck.block_hashes)
 }
-inline void FastSyncBlockHashs::add_hashs(const char* value) {
+inline void SyncGetBlockHeightAndHashAck::add_block_hashes(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.hashs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:FastSyncBlockHashs.hashs)
+  _impl_.block_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SyncGetBlockHeightAndHashAck.block_hashes)
 }
-inline void FastSyncBlockHashs::add_hashs(const char* value, size_t size) {
-  _impl_.hashs_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:FastSyncBlockHashs.hashs)
+inline void SyncGetBlockHeightAndHashAck::add_block_hashes(const char* value, size_t size) {
+  _impl_.block_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SyncGetBlockHeightAndHashAck.block_hashes)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-FastSyncBlockHashs::hashs() const {
-  // @@protoc_insertion_point(field_list:FastSyncBlockHashs.hashs)
-  return _impl_.hashs_;
+SyncGetBlockHeightAndHashAck::block_hashes() const {
+  // @@protoc_insertion_point(field_list:SyncGetBlockHeightAndHashAck.block_hashes)
+  return _impl_.block_hashes_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-FastSyncBlockHashs::mutable_hashs() {
-  // @@protoc_insertion_point(field_mutable_list:FastSyncBlockHashs.hashs)
-  return &_impl_.hashs_;
+SyncGetBlockHeightAndHashAck::mutable_block_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:SyncGetBlockHeightAndHashAck.block_hashes)
+  return &_impl_.block_hashes_;
 }
 
 // -------------------------------------------------------------------
 
-// FastSyncGetHashAck
+// SyncGetBlockReq
 
 // string self_node_id = 1;
-inline void FastSyncGetHashAck::clear_self_node_id() {
+inline void SyncGetBlockReq::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& FastSyncGetHashAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.self_node_id)
+inline const std::string& SyncGetBlockReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockReq.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FastSyncGetHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:FastSyncGetHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set:SyncGetBlockReq.self_node_id)
 }
-inline std::string* FastSyncGetHashAck::mutable_self_node_id() {
+inline std::string* SyncGetBlockReq::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:FastSyncGetHashAck.self_node_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockReq.self_node_id)
   return _s;
 }
-inline const std::string& FastSyncGetHashAck::_internal_self_node_id() const {
+inline const std::string& SyncGetBlockReq::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void FastSyncGetHashAck::_internal_set_self_node_id(const std::string& value) {
+inline void SyncGetBlockReq::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashAck::_internal_mutable_self_node_id() {
+inline std::string* SyncGetBlockReq::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:FastSyncGetHashAck.self_node_id)
+inline std::string* SyncGetBlockReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockReq.self_node_id)
   return _impl_.self_node_id_.Release();
 }
-inline void FastSyncGetHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+inline void SyncGetBlockReq::set_allocated_self_node_id(std::string* self_node_id) {
   if (self_node_id != nullptr) {
     
   } else {
@@ -5928,45 +9790,45 @@ inline void FastSyncGetHashAck::set_allocated_self_node_id(std::string* self_nod
     _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockReq.self_node_id)
 }
 
 // string msg_id = 2;
-inline void FastSyncGetHashAck::clear_msg_id() {
+inline void SyncGetBlockReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& FastSyncGetHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.msg_id)
+inline const std::string& SyncGetBlockReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FastSyncGetHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:FastSyncGetHashAck.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetBlockReq.msg_id)
 }
-inline std::string* FastSyncGetHashAck::mutable_msg_id() {
+inline std::string* SyncGetBlockReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:FastSyncGetHashAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockReq.msg_id)
   return _s;
 }
-inline const std::string& FastSyncGetHashAck::_internal_msg_id() const {
+inline const std::string& SyncGetBlockReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void FastSyncGetHashAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetBlockReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashAck::_internal_mutable_msg_id() {
+inline std::string* SyncGetBlockReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FastSyncGetHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:FastSyncGetHashAck.msg_id)
+inline std::string* SyncGetBlockReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void FastSyncGetHashAck::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -5978,159 +9840,124 @@ inline void FastSyncGetHashAck::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:FastSyncGetHashAck.msg_id)
-}
-
-// uint64 node_block_height = 3;
-inline void FastSyncGetHashAck::clear_node_block_height() {
-  _impl_.node_block_height_ = uint64_t{0u};
-}
-inline uint64_t FastSyncGetHashAck::_internal_node_block_height() const {
-  return _impl_.node_block_height_;
-}
-inline uint64_t FastSyncGetHashAck::node_block_height() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.node_block_height)
-  return _internal_node_block_height();
-}
-inline void FastSyncGetHashAck::_internal_set_node_block_height(uint64_t value) {
-  
-  _impl_.node_block_height_ = value;
-}
-inline void FastSyncGetHashAck::set_node_block_height(uint64_t value) {
-  _internal_set_node_block_height(value);
-  // @@protoc_insertion_point(field_set:FastSyncGetHashAck.node_block_height)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockReq.msg_id)
 }
 
-// repeated .FastSyncBlockHashs hashs = 4;
-inline int FastSyncGetHashAck::_internal_hashs_size() const {
-  return _impl_.hashs_.size();
-}
-inline int FastSyncGetHashAck::hashs_size() const {
-  return _internal_hashs_size();
-}
-inline void FastSyncGetHashAck::clear_hashs() {
-  _impl_.hashs_.Clear();
+// repeated string block_hashes = 3;
+inline int SyncGetBlockReq::_internal_block_hashes_size() const {
+  return _impl_.block_hashes_.size();
 }
-inline ::FastSyncBlockHashs* FastSyncGetHashAck::mutable_hashs(int index) {
-  // @@protoc_insertion_point(field_mutable:FastSyncGetHashAck.hashs)
-  return _impl_.hashs_.Mutable(index);
+inline int SyncGetBlockReq::block_hashes_size() const {
+  return _internal_block_hashes_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >*
-FastSyncGetHashAck::mutable_hashs() {
-  // @@protoc_insertion_point(field_mutable_list:FastSyncGetHashAck.hashs)
-  return &_impl_.hashs_;
+inline void SyncGetBlockReq::clear_block_hashes() {
+  _impl_.block_hashes_.Clear();
 }
-inline const ::FastSyncBlockHashs& FastSyncGetHashAck::_internal_hashs(int index) const {
-  return _impl_.hashs_.Get(index);
+inline std::string* SyncGetBlockReq::add_block_hashes() {
+  std::string* _s = _internal_add_block_hashes();
+  // @@protoc_insertion_point(field_add_mutable:SyncGetBlockReq.block_hashes)
+  return _s;
 }
-inline const ::FastSyncBlockHashs& FastSyncGetHashAck::hashs(int index) const {
-  // @@protoc_insertion_point(field_get:FastSyncGetHashAck.hashs)
-  return _internal_hashs(index);
+inline const std::string& SyncGetBlockReq::_internal_block_hashes(int index) const {
+  return _impl_.block_hashes_.Get(index);
 }
-inline ::FastSyncBlockHashs* FastSyncGetHashAck::_internal_add_hashs() {
-  return _impl_.hashs_.Add();
+inline const std::string& SyncGetBlockReq::block_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockReq.block_hashes)
+  return _internal_block_hashes(index);
 }
-inline ::FastSyncBlockHashs* FastSyncGetHashAck::add_hashs() {
-  ::FastSyncBlockHashs* _add = _internal_add_hashs();
-  // @@protoc_insertion_point(field_add:FastSyncGetHashAck.hashs)
-  return _add;
+inline std::string* SyncGetBlockReq::mutable_block_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockReq.block_hashes)
+  return _impl_.block_hashes_.Mutable(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >&
-FastSyncGetHashAck::hashs() const {
-  // @@protoc_insertion_point(field_list:FastSyncGetHashAck.hashs)
-  return _impl_.hashs_;
+inline void SyncGetBlockReq::set_block_hashes(int index, const std::string& value) {
+  _impl_.block_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SyncGetBlockReq.block_hashes)
 }
-
-// -------------------------------------------------------------------
-
-// FastSyncGetBlockReq
-
-// string self_node_id = 1;
-inline void FastSyncGetBlockReq::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+inline void SyncGetBlockReq::set_block_hashes(int index, std::string&& value) {
+  _impl_.block_hashes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SyncGetBlockReq.block_hashes)
 }
-inline const std::string& FastSyncGetBlockReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetBlockReq.self_node_id)
-  return _internal_self_node_id();
+inline void SyncGetBlockReq::set_block_hashes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.block_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SyncGetBlockReq.block_hashes)
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void FastSyncGetBlockReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:FastSyncGetBlockReq.self_node_id)
+inline void SyncGetBlockReq::set_block_hashes(int index, const char* value, size_t size) {
+  _impl_.block_hashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SyncGetBlockReq.block_hashes)
 }
-inline std::string* FastSyncGetBlockReq::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockReq.self_node_id)
-  return _s;
+inline std::string* SyncGetBlockReq::_internal_add_block_hashes() {
+  return _impl_.block_hashes_.Add();
 }
-inline const std::string& FastSyncGetBlockReq::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline void SyncGetBlockReq::add_block_hashes(const std::string& value) {
+  _impl_.block_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SyncGetBlockReq.block_hashes)
 }
-inline void FastSyncGetBlockReq::_internal_set_self_node_id(const std::string& value) {
-  
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+inline void SyncGetBlockReq::add_block_hashes(std::string&& value) {
+  _impl_.block_hashes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SyncGetBlockReq.block_hashes)
 }
-inline std::string* FastSyncGetBlockReq::_internal_mutable_self_node_id() {
-  
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+inline void SyncGetBlockReq::add_block_hashes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.block_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SyncGetBlockReq.block_hashes)
 }
-inline std::string* FastSyncGetBlockReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:FastSyncGetBlockReq.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline void SyncGetBlockReq::add_block_hashes(const char* value, size_t size) {
+  _impl_.block_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SyncGetBlockReq.block_hashes)
 }
-inline void FastSyncGetBlockReq::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:FastSyncGetBlockReq.self_node_id)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SyncGetBlockReq::block_hashes() const {
+  // @@protoc_insertion_point(field_list:SyncGetBlockReq.block_hashes)
+  return _impl_.block_hashes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SyncGetBlockReq::mutable_block_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:SyncGetBlockReq.block_hashes)
+  return &_impl_.block_hashes_;
 }
 
-// string msg_id = 2;
-inline void FastSyncGetBlockReq::clear_msg_id() {
+// -------------------------------------------------------------------
+
+// SyncGetBlockAck
+
+// string msg_id = 1;
+inline void SyncGetBlockAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& FastSyncGetBlockReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetBlockReq.msg_id)
+inline const std::string& SyncGetBlockAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FastSyncGetBlockReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:FastSyncGetBlockReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetBlockAck.msg_id)
 }
-inline std::string* FastSyncGetBlockReq::mutable_msg_id() {
+inline std::string* SyncGetBlockAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockAck.msg_id)
   return _s;
 }
-inline const std::string& FastSyncGetBlockReq::_internal_msg_id() const {
+inline const std::string& SyncGetBlockAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void FastSyncGetBlockReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetBlockAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncGetBlockReq::_internal_mutable_msg_id() {
+inline std::string* SyncGetBlockAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FastSyncGetBlockReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:FastSyncGetBlockReq.msg_id)
+inline std::string* SyncGetBlockAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void FastSyncGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetBlockAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -6142,188 +9969,248 @@ inline void FastSyncGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:FastSyncGetBlockReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockAck.msg_id)
 }
 
-// repeated .FastSyncBlockHashs hashs = 3;
-inline int FastSyncGetBlockReq::_internal_hashs_size() const {
-  return _impl_.hashs_.size();
+// repeated bytes blocks = 2;
+inline int SyncGetBlockAck::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
 }
-inline int FastSyncGetBlockReq::hashs_size() const {
-  return _internal_hashs_size();
+inline int SyncGetBlockAck::blocks_size() const {
+  return _internal_blocks_size();
 }
-inline void FastSyncGetBlockReq::clear_hashs() {
-  _impl_.hashs_.Clear();
+inline void SyncGetBlockAck::clear_blocks() {
+  _impl_.blocks_.Clear();
 }
-inline ::FastSyncBlockHashs* FastSyncGetBlockReq::mutable_hashs(int index) {
-  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockReq.hashs)
-  return _impl_.hashs_.Mutable(index);
+inline std::string* SyncGetBlockAck::add_blocks() {
+  std::string* _s = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add_mutable:SyncGetBlockAck.blocks)
+  return _s;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >*
-FastSyncGetBlockReq::mutable_hashs() {
-  // @@protoc_insertion_point(field_mutable_list:FastSyncGetBlockReq.hashs)
-  return &_impl_.hashs_;
+inline const std::string& SyncGetBlockAck::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
 }
-inline const ::FastSyncBlockHashs& FastSyncGetBlockReq::_internal_hashs(int index) const {
-  return _impl_.hashs_.Get(index);
+inline const std::string& SyncGetBlockAck::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockAck.blocks)
+  return _internal_blocks(index);
 }
-inline const ::FastSyncBlockHashs& FastSyncGetBlockReq::hashs(int index) const {
-  // @@protoc_insertion_point(field_get:FastSyncGetBlockReq.hashs)
-  return _internal_hashs(index);
+inline std::string* SyncGetBlockAck::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockAck.blocks)
+  return _impl_.blocks_.Mutable(index);
 }
-inline ::FastSyncBlockHashs* FastSyncGetBlockReq::_internal_add_hashs() {
-  return _impl_.hashs_.Add();
+inline void SyncGetBlockAck::set_blocks(int index, const std::string& value) {
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SyncGetBlockAck.blocks)
 }
-inline ::FastSyncBlockHashs* FastSyncGetBlockReq::add_hashs() {
-  ::FastSyncBlockHashs* _add = _internal_add_hashs();
-  // @@protoc_insertion_point(field_add:FastSyncGetBlockReq.hashs)
-  return _add;
+inline void SyncGetBlockAck::set_blocks(int index, std::string&& value) {
+  _impl_.blocks_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SyncGetBlockAck.blocks)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlockHashs >&
-FastSyncGetBlockReq::hashs() const {
-  // @@protoc_insertion_point(field_list:FastSyncGetBlockReq.hashs)
-  return _impl_.hashs_;
+inline void SyncGetBlockAck::set_blocks(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SyncGetBlockAck.blocks)
+}
+inline void SyncGetBlockAck::set_blocks(int index, const void* value, size_t size) {
+  _impl_.blocks_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SyncGetBlockAck.blocks)
+}
+inline std::string* SyncGetBlockAck::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
+}
+inline void SyncGetBlockAck::add_blocks(const std::string& value) {
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SyncGetBlockAck.blocks)
+}
+inline void SyncGetBlockAck::add_blocks(std::string&& value) {
+  _impl_.blocks_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SyncGetBlockAck.blocks)
+}
+inline void SyncGetBlockAck::add_blocks(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SyncGetBlockAck.blocks)
+}
+inline void SyncGetBlockAck::add_blocks(const void* value, size_t size) {
+  _impl_.blocks_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SyncGetBlockAck.blocks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SyncGetBlockAck::blocks() const {
+  // @@protoc_insertion_point(field_list:SyncGetBlockAck.blocks)
+  return _impl_.blocks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SyncGetBlockAck::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:SyncGetBlockAck.blocks)
+  return &_impl_.blocks_;
 }
 
 // -------------------------------------------------------------------
 
-// FastSyncBlock
+// SyncFromZeroSumHash
 
 // uint64 height = 1;
-inline void FastSyncBlock::clear_height() {
+inline void SyncFromZeroSumHash::clear_height() {
   _impl_.height_ = uint64_t{0u};
 }
-inline uint64_t FastSyncBlock::_internal_height() const {
+inline uint64_t SyncFromZeroSumHash::_internal_height() const {
   return _impl_.height_;
 }
-inline uint64_t FastSyncBlock::height() const {
-  // @@protoc_insertion_point(field_get:FastSyncBlock.height)
+inline uint64_t SyncFromZeroSumHash::height() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroSumHash.height)
   return _internal_height();
 }
-inline void FastSyncBlock::_internal_set_height(uint64_t value) {
+inline void SyncFromZeroSumHash::_internal_set_height(uint64_t value) {
   
   _impl_.height_ = value;
 }
-inline void FastSyncBlock::set_height(uint64_t value) {
+inline void SyncFromZeroSumHash::set_height(uint64_t value) {
   _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:FastSyncBlock.height)
+  // @@protoc_insertion_point(field_set:SyncFromZeroSumHash.height)
 }
 
-// repeated bytes blocks = 2;
-inline int FastSyncBlock::_internal_blocks_size() const {
-  return _impl_.blocks_.size();
+// string hash = 2;
+inline void SyncFromZeroSumHash::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
 }
-inline int FastSyncBlock::blocks_size() const {
-  return _internal_blocks_size();
+inline const std::string& SyncFromZeroSumHash::hash() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroSumHash.hash)
+  return _internal_hash();
 }
-inline void FastSyncBlock::clear_blocks() {
-  _impl_.blocks_.Clear();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncFromZeroSumHash::set_hash(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncFromZeroSumHash.hash)
 }
-inline std::string* FastSyncBlock::add_blocks() {
-  std::string* _s = _internal_add_blocks();
-  // @@protoc_insertion_point(field_add_mutable:FastSyncBlock.blocks)
+inline std::string* SyncFromZeroSumHash::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroSumHash.hash)
   return _s;
 }
-inline const std::string& FastSyncBlock::_internal_blocks(int index) const {
-  return _impl_.blocks_.Get(index);
+inline const std::string& SyncFromZeroSumHash::_internal_hash() const {
+  return _impl_.hash_.Get();
 }
-inline const std::string& FastSyncBlock::blocks(int index) const {
-  // @@protoc_insertion_point(field_get:FastSyncBlock.blocks)
-  return _internal_blocks(index);
+inline void SyncFromZeroSumHash::_internal_set_hash(const std::string& value) {
+  
+  _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncBlock::mutable_blocks(int index) {
-  // @@protoc_insertion_point(field_mutable:FastSyncBlock.blocks)
-  return _impl_.blocks_.Mutable(index);
+inline std::string* SyncFromZeroSumHash::_internal_mutable_hash() {
+  
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline void FastSyncBlock::set_blocks(int index, const std::string& value) {
-  _impl_.blocks_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:FastSyncBlock.blocks)
+inline std::string* SyncFromZeroSumHash::release_hash() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroSumHash.hash)
+  return _impl_.hash_.Release();
 }
-inline void FastSyncBlock::set_blocks(int index, std::string&& value) {
-  _impl_.blocks_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:FastSyncBlock.blocks)
+inline void SyncFromZeroSumHash::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroSumHash.hash)
 }
-inline void FastSyncBlock::set_blocks(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocks_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:FastSyncBlock.blocks)
+
+// -------------------------------------------------------------------
+
+// SyncFromZeroGetSumHashReq
+
+// string self_node_id = 1;
+inline void SyncFromZeroGetSumHashReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline void FastSyncBlock::set_blocks(int index, const void* value, size_t size) {
-  _impl_.blocks_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:FastSyncBlock.blocks)
+inline const std::string& SyncFromZeroGetSumHashReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashReq.self_node_id)
+  return _internal_self_node_id();
 }
-inline std::string* FastSyncBlock::_internal_add_blocks() {
-  return _impl_.blocks_.Add();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncFromZeroGetSumHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashReq.self_node_id)
 }
-inline void FastSyncBlock::add_blocks(const std::string& value) {
-  _impl_.blocks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:FastSyncBlock.blocks)
+inline std::string* SyncFromZeroGetSumHashReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashReq.self_node_id)
+  return _s;
 }
-inline void FastSyncBlock::add_blocks(std::string&& value) {
-  _impl_.blocks_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:FastSyncBlock.blocks)
+inline const std::string& SyncFromZeroGetSumHashReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline void FastSyncBlock::add_blocks(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:FastSyncBlock.blocks)
+inline void SyncFromZeroGetSumHashReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline void FastSyncBlock::add_blocks(const void* value, size_t size) {
-  _impl_.blocks_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:FastSyncBlock.blocks)
+inline std::string* SyncFromZeroGetSumHashReq::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-FastSyncBlock::blocks() const {
-  // @@protoc_insertion_point(field_list:FastSyncBlock.blocks)
-  return _impl_.blocks_;
+inline std::string* SyncFromZeroGetSumHashReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashReq.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-FastSyncBlock::mutable_blocks() {
-  // @@protoc_insertion_point(field_mutable_list:FastSyncBlock.blocks)
-  return &_impl_.blocks_;
+inline void SyncFromZeroGetSumHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashReq.self_node_id)
 }
 
-// -------------------------------------------------------------------
-
-// FastSyncGetBlockAck
-
-// string msg_id = 1;
-inline void FastSyncGetBlockAck::clear_msg_id() {
+// string msg_id = 2;
+inline void SyncFromZeroGetSumHashReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& FastSyncGetBlockAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:FastSyncGetBlockAck.msg_id)
+inline const std::string& SyncFromZeroGetSumHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FastSyncGetBlockAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncFromZeroGetSumHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:FastSyncGetBlockAck.msg_id)
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashReq.msg_id)
 }
-inline std::string* FastSyncGetBlockAck::mutable_msg_id() {
+inline std::string* SyncFromZeroGetSumHashReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashReq.msg_id)
   return _s;
 }
-inline const std::string& FastSyncGetBlockAck::_internal_msg_id() const {
+inline const std::string& SyncFromZeroGetSumHashReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void FastSyncGetBlockAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncFromZeroGetSumHashReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FastSyncGetBlockAck::_internal_mutable_msg_id() {
+inline std::string* SyncFromZeroGetSumHashReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FastSyncGetBlockAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:FastSyncGetBlockAck.msg_id)
+inline std::string* SyncFromZeroGetSumHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void FastSyncGetBlockAck::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncFromZeroGetSumHashReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -6335,89 +10222,116 @@ inline void FastSyncGetBlockAck::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:FastSyncGetBlockAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashReq.msg_id)
 }
 
-// repeated .FastSyncBlock blocks = 2;
-inline int FastSyncGetBlockAck::_internal_blocks_size() const {
-  return _impl_.blocks_.size();
+// repeated uint64 heights = 3;
+inline int SyncFromZeroGetSumHashReq::_internal_heights_size() const {
+  return _impl_.heights_.size();
 }
-inline int FastSyncGetBlockAck::blocks_size() const {
-  return _internal_blocks_size();
+inline int SyncFromZeroGetSumHashReq::heights_size() const {
+  return _internal_heights_size();
 }
-inline void FastSyncGetBlockAck::clear_blocks() {
-  _impl_.blocks_.Clear();
+inline void SyncFromZeroGetSumHashReq::clear_heights() {
+  _impl_.heights_.Clear();
 }
-inline ::FastSyncBlock* FastSyncGetBlockAck::mutable_blocks(int index) {
-  // @@protoc_insertion_point(field_mutable:FastSyncGetBlockAck.blocks)
-  return _impl_.blocks_.Mutable(index);
+inline uint64_t SyncFromZeroGetSumHashReq::_internal_heights(int index) const {
+  return _impl_.heights_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlock >*
-FastSyncGetBlockAck::mutable_blocks() {
-  // @@protoc_insertion_point(field_mutable_list:FastSyncGetBlockAck.blocks)
-  return &_impl_.blocks_;
+inline uint64_t SyncFromZeroGetSumHashReq::heights(int index) const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashReq.heights)
+  return _internal_heights(index);
 }
-inline const ::FastSyncBlock& FastSyncGetBlockAck::_internal_blocks(int index) const {
-  return _impl_.blocks_.Get(index);
+inline void SyncFromZeroGetSumHashReq::set_heights(int index, uint64_t value) {
+  _impl_.heights_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashReq.heights)
 }
-inline const ::FastSyncBlock& FastSyncGetBlockAck::blocks(int index) const {
-  // @@protoc_insertion_point(field_get:FastSyncGetBlockAck.blocks)
-  return _internal_blocks(index);
+inline void SyncFromZeroGetSumHashReq::_internal_add_heights(uint64_t value) {
+  _impl_.heights_.Add(value);
 }
-inline ::FastSyncBlock* FastSyncGetBlockAck::_internal_add_blocks() {
-  return _impl_.blocks_.Add();
+inline void SyncFromZeroGetSumHashReq::add_heights(uint64_t value) {
+  _internal_add_heights(value);
+  // @@protoc_insertion_point(field_add:SyncFromZeroGetSumHashReq.heights)
 }
-inline ::FastSyncBlock* FastSyncGetBlockAck::add_blocks() {
-  ::FastSyncBlock* _add = _internal_add_blocks();
-  // @@protoc_insertion_point(field_add:FastSyncGetBlockAck.blocks)
-  return _add;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SyncFromZeroGetSumHashReq::_internal_heights() const {
+  return _impl_.heights_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::FastSyncBlock >&
-FastSyncGetBlockAck::blocks() const {
-  // @@protoc_insertion_point(field_list:FastSyncGetBlockAck.blocks)
-  return _impl_.blocks_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SyncFromZeroGetSumHashReq::heights() const {
+  // @@protoc_insertion_point(field_list:SyncFromZeroGetSumHashReq.heights)
+  return _internal_heights();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SyncFromZeroGetSumHashReq::_internal_mutable_heights() {
+  return &_impl_.heights_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SyncFromZeroGetSumHashReq::mutable_heights() {
+  // @@protoc_insertion_point(field_mutable_list:SyncFromZeroGetSumHashReq.heights)
+  return _internal_mutable_heights();
 }
 
 // -------------------------------------------------------------------
 
-// SyncGetSumHashReq
+// SyncFromZeroGetSumHashAck
 
-// string self_node_id = 1;
-inline void SyncGetSumHashReq::clear_self_node_id() {
+// int32 code = 1;
+inline void SyncFromZeroGetSumHashAck::clear_code() {
+  _impl_.code_ = 0;
+}
+inline int32_t SyncFromZeroGetSumHashAck::_internal_code() const {
+  return _impl_.code_;
+}
+inline int32_t SyncFromZeroGetSumHashAck::code() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.code)
+  return _internal_code();
+}
+inline void SyncFromZeroGetSumHashAck::_internal_set_code(int32_t value) {
+  
+  _impl_.code_ = value;
+}
+inline void SyncFromZeroGetSumHashAck::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashAck.code)
+}
+
+// string self_node_id = 2;
+inline void SyncFromZeroGetSumHashAck::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetSumHashReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.self_node_id)
+inline const std::string& SyncFromZeroGetSumHashAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetSumHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncFromZeroGetSumHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashAck.self_node_id)
 }
-inline std::string* SyncGetSumHashReq::mutable_self_node_id() {
+inline std::string* SyncFromZeroGetSumHashAck::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetSumHashReq.self_node_id)
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashAck.self_node_id)
   return _s;
 }
-inline const std::string& SyncGetSumHashReq::_internal_self_node_id() const {
+inline const std::string& SyncFromZeroGetSumHashAck::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void SyncGetSumHashReq::_internal_set_self_node_id(const std::string& value) {
+inline void SyncFromZeroGetSumHashAck::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashReq::_internal_mutable_self_node_id() {
+inline std::string* SyncFromZeroGetSumHashAck::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncGetSumHashReq.self_node_id)
+inline std::string* SyncFromZeroGetSumHashAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashAck.self_node_id)
   return _impl_.self_node_id_.Release();
 }
-inline void SyncGetSumHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+inline void SyncFromZeroGetSumHashAck::set_allocated_self_node_id(std::string* self_node_id) {
   if (self_node_id != nullptr) {
     
   } else {
@@ -6429,45 +10343,45 @@ inline void SyncGetSumHashReq::set_allocated_self_node_id(std::string* self_node
     _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashAck.self_node_id)
 }
 
-// string msg_id = 2;
-inline void SyncGetSumHashReq::clear_msg_id() {
+// string msg_id = 3;
+inline void SyncFromZeroGetSumHashAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetSumHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.msg_id)
+inline const std::string& SyncFromZeroGetSumHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetSumHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncFromZeroGetSumHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashAck.msg_id)
 }
-inline std::string* SyncGetSumHashReq::mutable_msg_id() {
+inline std::string* SyncFromZeroGetSumHashAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashAck.msg_id)
   return _s;
 }
-inline const std::string& SyncGetSumHashReq::_internal_msg_id() const {
+inline const std::string& SyncFromZeroGetSumHashAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncGetSumHashReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncFromZeroGetSumHashAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashReq::_internal_mutable_msg_id() {
+inline std::string* SyncFromZeroGetSumHashAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetSumHashReq.msg_id)
+inline std::string* SyncFromZeroGetSumHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void SyncGetSumHashReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncFromZeroGetSumHashAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -6479,183 +10393,213 @@ inline void SyncGetSumHashReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashAck.msg_id)
 }
 
-// uint64 start_height = 3;
-inline void SyncGetSumHashReq::clear_start_height() {
-  _impl_.start_height_ = uint64_t{0u};
-}
-inline uint64_t SyncGetSumHashReq::_internal_start_height() const {
-  return _impl_.start_height_;
+// repeated .SyncFromZeroSumHash sum_hashes = 4;
+inline int SyncFromZeroGetSumHashAck::_internal_sum_hashes_size() const {
+  return _impl_.sum_hashes_.size();
 }
-inline uint64_t SyncGetSumHashReq::start_height() const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.start_height)
-  return _internal_start_height();
+inline int SyncFromZeroGetSumHashAck::sum_hashes_size() const {
+  return _internal_sum_hashes_size();
 }
-inline void SyncGetSumHashReq::_internal_set_start_height(uint64_t value) {
-  
-  _impl_.start_height_ = value;
+inline void SyncFromZeroGetSumHashAck::clear_sum_hashes() {
+  _impl_.sum_hashes_.Clear();
 }
-inline void SyncGetSumHashReq::set_start_height(uint64_t value) {
-  _internal_set_start_height(value);
-  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.start_height)
+inline ::SyncFromZeroSumHash* SyncFromZeroGetSumHashAck::mutable_sum_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashAck.sum_hashes)
+  return _impl_.sum_hashes_.Mutable(index);
 }
-
-// uint64 end_height = 4;
-inline void SyncGetSumHashReq::clear_end_height() {
-  _impl_.end_height_ = uint64_t{0u};
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncFromZeroSumHash >*
+SyncFromZeroGetSumHashAck::mutable_sum_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:SyncFromZeroGetSumHashAck.sum_hashes)
+  return &_impl_.sum_hashes_;
 }
-inline uint64_t SyncGetSumHashReq::_internal_end_height() const {
-  return _impl_.end_height_;
+inline const ::SyncFromZeroSumHash& SyncFromZeroGetSumHashAck::_internal_sum_hashes(int index) const {
+  return _impl_.sum_hashes_.Get(index);
 }
-inline uint64_t SyncGetSumHashReq::end_height() const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashReq.end_height)
-  return _internal_end_height();
+inline const ::SyncFromZeroSumHash& SyncFromZeroGetSumHashAck::sum_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.sum_hashes)
+  return _internal_sum_hashes(index);
 }
-inline void SyncGetSumHashReq::_internal_set_end_height(uint64_t value) {
-  
-  _impl_.end_height_ = value;
+inline ::SyncFromZeroSumHash* SyncFromZeroGetSumHashAck::_internal_add_sum_hashes() {
+  return _impl_.sum_hashes_.Add();
 }
-inline void SyncGetSumHashReq::set_end_height(uint64_t value) {
-  _internal_set_end_height(value);
-  // @@protoc_insertion_point(field_set:SyncGetSumHashReq.end_height)
+inline ::SyncFromZeroSumHash* SyncFromZeroGetSumHashAck::add_sum_hashes() {
+  ::SyncFromZeroSumHash* _add = _internal_add_sum_hashes();
+  // @@protoc_insertion_point(field_add:SyncFromZeroGetSumHashAck.sum_hashes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncFromZeroSumHash >&
+SyncFromZeroGetSumHashAck::sum_hashes() const {
+  // @@protoc_insertion_point(field_list:SyncFromZeroGetSumHashAck.sum_hashes)
+  return _impl_.sum_hashes_;
 }
 
 // -------------------------------------------------------------------
 
-// SyncSumHash
+// SyncFromZeroGetBlockReq
 
-// uint64 start_height = 1;
-inline void SyncSumHash::clear_start_height() {
-  _impl_.start_height_ = uint64_t{0u};
-}
-inline uint64_t SyncSumHash::_internal_start_height() const {
-  return _impl_.start_height_;
-}
-inline uint64_t SyncSumHash::start_height() const {
-  // @@protoc_insertion_point(field_get:SyncSumHash.start_height)
-  return _internal_start_height();
+// string self_node_id = 1;
+inline void SyncFromZeroGetBlockReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline void SyncSumHash::_internal_set_start_height(uint64_t value) {
-  
-  _impl_.start_height_ = value;
+inline const std::string& SyncFromZeroGetBlockReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockReq.self_node_id)
+  return _internal_self_node_id();
 }
-inline void SyncSumHash::set_start_height(uint64_t value) {
-  _internal_set_start_height(value);
-  // @@protoc_insertion_point(field_set:SyncSumHash.start_height)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncFromZeroGetBlockReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockReq.self_node_id)
 }
-
-// uint64 end_height = 2;
-inline void SyncSumHash::clear_end_height() {
-  _impl_.end_height_ = uint64_t{0u};
+inline std::string* SyncFromZeroGetBlockReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockReq.self_node_id)
+  return _s;
 }
-inline uint64_t SyncSumHash::_internal_end_height() const {
-  return _impl_.end_height_;
+inline const std::string& SyncFromZeroGetBlockReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline uint64_t SyncSumHash::end_height() const {
-  // @@protoc_insertion_point(field_get:SyncSumHash.end_height)
-  return _internal_end_height();
+inline void SyncFromZeroGetBlockReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline void SyncSumHash::_internal_set_end_height(uint64_t value) {
+inline std::string* SyncFromZeroGetBlockReq::_internal_mutable_self_node_id() {
   
-  _impl_.end_height_ = value;
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline void SyncSumHash::set_end_height(uint64_t value) {
-  _internal_set_end_height(value);
-  // @@protoc_insertion_point(field_set:SyncSumHash.end_height)
+inline std::string* SyncFromZeroGetBlockReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockReq.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void SyncFromZeroGetBlockReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockReq.self_node_id)
 }
 
-// string hash = 3;
-inline void SyncSumHash::clear_hash() {
-  _impl_.hash_.ClearToEmpty();
+// string msg_id = 2;
+inline void SyncFromZeroGetBlockReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncSumHash::hash() const {
-  // @@protoc_insertion_point(field_get:SyncSumHash.hash)
-  return _internal_hash();
+inline const std::string& SyncFromZeroGetBlockReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockReq.msg_id)
+  return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncSumHash::set_hash(ArgT0&& arg0, ArgT... args) {
+void SyncFromZeroGetBlockReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncSumHash.hash)
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockReq.msg_id)
 }
-inline std::string* SyncSumHash::mutable_hash() {
-  std::string* _s = _internal_mutable_hash();
-  // @@protoc_insertion_point(field_mutable:SyncSumHash.hash)
+inline std::string* SyncFromZeroGetBlockReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockReq.msg_id)
   return _s;
 }
-inline const std::string& SyncSumHash::_internal_hash() const {
-  return _impl_.hash_.Get();
+inline const std::string& SyncFromZeroGetBlockReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
 }
-inline void SyncSumHash::_internal_set_hash(const std::string& value) {
+inline void SyncFromZeroGetBlockReq::_internal_set_msg_id(const std::string& value) {
   
-  _impl_.hash_.Set(value, GetArenaForAllocation());
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncSumHash::_internal_mutable_hash() {
+inline std::string* SyncFromZeroGetBlockReq::_internal_mutable_msg_id() {
   
-  return _impl_.hash_.Mutable(GetArenaForAllocation());
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncSumHash::release_hash() {
-  // @@protoc_insertion_point(field_release:SyncSumHash.hash)
-  return _impl_.hash_.Release();
+inline std::string* SyncFromZeroGetBlockReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockReq.msg_id)
+  return _impl_.msg_id_.Release();
 }
-inline void SyncSumHash::set_allocated_hash(std::string* hash) {
-  if (hash != nullptr) {
+inline void SyncFromZeroGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
     
   } else {
     
   }
-  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.hash_.IsDefault()) {
-    _impl_.hash_.Set("", GetArenaForAllocation());
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncSumHash.hash)
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockReq.msg_id)
+}
+
+// uint64 height = 3;
+inline void SyncFromZeroGetBlockReq::clear_height() {
+  _impl_.height_ = uint64_t{0u};
+}
+inline uint64_t SyncFromZeroGetBlockReq::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint64_t SyncFromZeroGetBlockReq::height() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockReq.height)
+  return _internal_height();
+}
+inline void SyncFromZeroGetBlockReq::_internal_set_height(uint64_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void SyncFromZeroGetBlockReq::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockReq.height)
 }
 
 // -------------------------------------------------------------------
 
-// SyncGetSumHashAck
+// SyncFromZeroGetBlockAck
 
 // string self_node_id = 1;
-inline void SyncGetSumHashAck::clear_self_node_id() {
+inline void SyncFromZeroGetBlockAck::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetSumHashAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.self_node_id)
+inline const std::string& SyncFromZeroGetBlockAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetSumHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncFromZeroGetBlockAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetSumHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.self_node_id)
 }
-inline std::string* SyncGetSumHashAck::mutable_self_node_id() {
+inline std::string* SyncFromZeroGetBlockAck::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetSumHashAck.self_node_id)
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockAck.self_node_id)
   return _s;
 }
-inline const std::string& SyncGetSumHashAck::_internal_self_node_id() const {
+inline const std::string& SyncFromZeroGetBlockAck::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void SyncGetSumHashAck::_internal_set_self_node_id(const std::string& value) {
+inline void SyncFromZeroGetBlockAck::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashAck::_internal_mutable_self_node_id() {
+inline std::string* SyncFromZeroGetBlockAck::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncGetSumHashAck.self_node_id)
+inline std::string* SyncFromZeroGetBlockAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockAck.self_node_id)
   return _impl_.self_node_id_.Release();
 }
-inline void SyncGetSumHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+inline void SyncFromZeroGetBlockAck::set_allocated_self_node_id(std::string* self_node_id) {
   if (self_node_id != nullptr) {
     
   } else {
@@ -6667,373 +10611,448 @@ inline void SyncGetSumHashAck::set_allocated_self_node_id(std::string* self_node
     _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockAck.self_node_id)
 }
 
 // string msg_id = 2;
-inline void SyncGetSumHashAck::clear_msg_id() {
+inline void SyncFromZeroGetBlockAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetSumHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.msg_id)
+inline const std::string& SyncFromZeroGetBlockAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetSumHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncFromZeroGetBlockAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.msg_id)
 }
-inline std::string* SyncGetSumHashAck::mutable_msg_id() {
+inline std::string* SyncFromZeroGetBlockAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockAck.msg_id)
   return _s;
 }
-inline const std::string& SyncGetSumHashAck::_internal_msg_id() const {
+inline const std::string& SyncFromZeroGetBlockAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncGetSumHashAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncFromZeroGetBlockAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashAck::_internal_mutable_msg_id() {
+inline std::string* SyncFromZeroGetBlockAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetSumHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetSumHashAck.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* SyncFromZeroGetBlockAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void SyncFromZeroGetBlockAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockAck.msg_id)
+}
+
+// uint64 height = 3;
+inline void SyncFromZeroGetBlockAck::clear_height() {
+  _impl_.height_ = uint64_t{0u};
+}
+inline uint64_t SyncFromZeroGetBlockAck::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint64_t SyncFromZeroGetBlockAck::height() const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.height)
+  return _internal_height();
+}
+inline void SyncFromZeroGetBlockAck::_internal_set_height(uint64_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void SyncFromZeroGetBlockAck::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.height)
+}
+
+// repeated bytes blocks = 4;
+inline int SyncFromZeroGetBlockAck::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
+}
+inline int SyncFromZeroGetBlockAck::blocks_size() const {
+  return _internal_blocks_size();
 }
-inline void SyncGetSumHashAck::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetSumHashAck.msg_id)
+inline void SyncFromZeroGetBlockAck::clear_blocks() {
+  _impl_.blocks_.Clear();
 }
-
-// uint64 node_block_height = 3;
-inline void SyncGetSumHashAck::clear_node_block_height() {
-  _impl_.node_block_height_ = uint64_t{0u};
+inline std::string* SyncFromZeroGetBlockAck::add_blocks() {
+  std::string* _s = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add_mutable:SyncFromZeroGetBlockAck.blocks)
+  return _s;
 }
-inline uint64_t SyncGetSumHashAck::_internal_node_block_height() const {
-  return _impl_.node_block_height_;
+inline const std::string& SyncFromZeroGetBlockAck::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
 }
-inline uint64_t SyncGetSumHashAck::node_block_height() const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.node_block_height)
-  return _internal_node_block_height();
+inline const std::string& SyncFromZeroGetBlockAck::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.blocks)
+  return _internal_blocks(index);
 }
-inline void SyncGetSumHashAck::_internal_set_node_block_height(uint64_t value) {
-  
-  _impl_.node_block_height_ = value;
+inline std::string* SyncFromZeroGetBlockAck::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockAck.blocks)
+  return _impl_.blocks_.Mutable(index);
 }
-inline void SyncGetSumHashAck::set_node_block_height(uint64_t value) {
-  _internal_set_node_block_height(value);
-  // @@protoc_insertion_point(field_set:SyncGetSumHashAck.node_block_height)
+inline void SyncFromZeroGetBlockAck::set_blocks(int index, const std::string& value) {
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.blocks)
 }
-
-// repeated .SyncSumHash sync_sum_hashes = 4;
-inline int SyncGetSumHashAck::_internal_sync_sum_hashes_size() const {
-  return _impl_.sync_sum_hashes_.size();
+inline void SyncFromZeroGetBlockAck::set_blocks(int index, std::string&& value) {
+  _impl_.blocks_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.blocks)
 }
-inline int SyncGetSumHashAck::sync_sum_hashes_size() const {
-  return _internal_sync_sum_hashes_size();
+inline void SyncFromZeroGetBlockAck::set_blocks(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SyncFromZeroGetBlockAck.blocks)
 }
-inline void SyncGetSumHashAck::clear_sync_sum_hashes() {
-  _impl_.sync_sum_hashes_.Clear();
+inline void SyncFromZeroGetBlockAck::set_blocks(int index, const void* value, size_t size) {
+  _impl_.blocks_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SyncFromZeroGetBlockAck.blocks)
 }
-inline ::SyncSumHash* SyncGetSumHashAck::mutable_sync_sum_hashes(int index) {
-  // @@protoc_insertion_point(field_mutable:SyncGetSumHashAck.sync_sum_hashes)
-  return _impl_.sync_sum_hashes_.Mutable(index);
+inline std::string* SyncFromZeroGetBlockAck::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumHash >*
-SyncGetSumHashAck::mutable_sync_sum_hashes() {
-  // @@protoc_insertion_point(field_mutable_list:SyncGetSumHashAck.sync_sum_hashes)
-  return &_impl_.sync_sum_hashes_;
+inline void SyncFromZeroGetBlockAck::add_blocks(const std::string& value) {
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SyncFromZeroGetBlockAck.blocks)
 }
-inline const ::SyncSumHash& SyncGetSumHashAck::_internal_sync_sum_hashes(int index) const {
-  return _impl_.sync_sum_hashes_.Get(index);
+inline void SyncFromZeroGetBlockAck::add_blocks(std::string&& value) {
+  _impl_.blocks_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SyncFromZeroGetBlockAck.blocks)
 }
-inline const ::SyncSumHash& SyncGetSumHashAck::sync_sum_hashes(int index) const {
-  // @@protoc_insertion_point(field_get:SyncGetSumHashAck.sync_sum_hashes)
-  return _internal_sync_sum_hashes(index);
+inline void SyncFromZeroGetBlockAck::add_blocks(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.blocks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SyncFromZeroGetBlockAck.blocks)
 }
-inline ::SyncSumHash* SyncGetSumHashAck::_internal_add_sync_sum_hashes() {
-  return _impl_.sync_sum_hashes_.Add();
+inline void SyncFromZeroGetBlockAck::add_blocks(const void* value, size_t size) {
+  _impl_.blocks_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SyncFromZeroGetBlockAck.blocks)
 }
-inline ::SyncSumHash* SyncGetSumHashAck::add_sync_sum_hashes() {
-  ::SyncSumHash* _add = _internal_add_sync_sum_hashes();
-  // @@protoc_insertion_point(field_add:SyncGetSumHashAck.sync_sum_hashes)
-  return _add;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SyncFromZeroGetBlockAck::blocks() const {
+  // @@protoc_insertion_point(field_list:SyncFromZeroGetBlockAck.blocks)
+  return _impl_.blocks_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumHash >&
-SyncGetSumHashAck::sync_sum_hashes() const {
-  // @@protoc_insertion_point(field_list:SyncGetSumHashAck.sync_sum_hashes)
-  return _impl_.sync_sum_hashes_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SyncFromZeroGetBlockAck::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:SyncFromZeroGetBlockAck.blocks)
+  return &_impl_.blocks_;
 }
 
 // -------------------------------------------------------------------
 
-// SyncGetHeightHashReq
+// GetBlockByUtxoReq
 
-// string self_node_id = 1;
-inline void SyncGetHeightHashReq::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// string addr = 1;
+inline void GetBlockByUtxoReq::clear_addr() {
+  _impl_.addr_.ClearToEmpty();
 }
-inline const std::string& SyncGetHeightHashReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.self_node_id)
-  return _internal_self_node_id();
+inline const std::string& GetBlockByUtxoReq::addr() const {
+  // @@protoc_insertion_point(field_get:GetBlockByUtxoReq.addr)
+  return _internal_addr();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetHeightHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void GetBlockByUtxoReq::set_addr(ArgT0&& arg0, ArgT... args) {
  
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.self_node_id)
+ _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByUtxoReq.addr)
 }
-inline std::string* SyncGetHeightHashReq::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashReq.self_node_id)
+inline std::string* GetBlockByUtxoReq::mutable_addr() {
+  std::string* _s = _internal_mutable_addr();
+  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoReq.addr)
   return _s;
 }
-inline const std::string& SyncGetHeightHashReq::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline const std::string& GetBlockByUtxoReq::_internal_addr() const {
+  return _impl_.addr_.Get();
 }
-inline void SyncGetHeightHashReq::_internal_set_self_node_id(const std::string& value) {
+inline void GetBlockByUtxoReq::_internal_set_addr(const std::string& value) {
   
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+  _impl_.addr_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashReq::_internal_mutable_self_node_id() {
+inline std::string* GetBlockByUtxoReq::_internal_mutable_addr() {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+  return _impl_.addr_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncGetHeightHashReq.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline std::string* GetBlockByUtxoReq::release_addr() {
+  // @@protoc_insertion_point(field_release:GetBlockByUtxoReq.addr)
+  return _impl_.addr_.Release();
 }
-inline void SyncGetHeightHashReq::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
+inline void GetBlockByUtxoReq::set_allocated_addr(std::string* addr) {
+  if (addr != nullptr) {
     
   } else {
     
   }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  if (_impl_.addr_.IsDefault()) {
+    _impl_.addr_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoReq.addr)
 }
 
-// string msg_id = 2;
-inline void SyncGetHeightHashReq::clear_msg_id() {
-  _impl_.msg_id_.ClearToEmpty();
+// string utxo = 2;
+inline void GetBlockByUtxoReq::clear_utxo() {
+  _impl_.utxo_.ClearToEmpty();
 }
-inline const std::string& SyncGetHeightHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.msg_id)
-  return _internal_msg_id();
+inline const std::string& GetBlockByUtxoReq::utxo() const {
+  // @@protoc_insertion_point(field_get:GetBlockByUtxoReq.utxo)
+  return _internal_utxo();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetHeightHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void GetBlockByUtxoReq::set_utxo(ArgT0&& arg0, ArgT... args) {
  
- _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.msg_id)
+ _impl_.utxo_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByUtxoReq.utxo)
 }
-inline std::string* SyncGetHeightHashReq::mutable_msg_id() {
-  std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashReq.msg_id)
+inline std::string* GetBlockByUtxoReq::mutable_utxo() {
+  std::string* _s = _internal_mutable_utxo();
+  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoReq.utxo)
   return _s;
 }
-inline const std::string& SyncGetHeightHashReq::_internal_msg_id() const {
-  return _impl_.msg_id_.Get();
+inline const std::string& GetBlockByUtxoReq::_internal_utxo() const {
+  return _impl_.utxo_.Get();
 }
-inline void SyncGetHeightHashReq::_internal_set_msg_id(const std::string& value) {
+inline void GetBlockByUtxoReq::_internal_set_utxo(const std::string& value) {
   
-  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+  _impl_.utxo_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashReq::_internal_mutable_msg_id() {
+inline std::string* GetBlockByUtxoReq::_internal_mutable_utxo() {
   
-  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+  return _impl_.utxo_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetHeightHashReq.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* GetBlockByUtxoReq::release_utxo() {
+  // @@protoc_insertion_point(field_release:GetBlockByUtxoReq.utxo)
+  return _impl_.utxo_.Release();
 }
-inline void SyncGetHeightHashReq::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
+inline void GetBlockByUtxoReq::set_allocated_utxo(std::string* utxo) {
+  if (utxo != nullptr) {
     
   } else {
     
   }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+  _impl_.utxo_.SetAllocated(utxo, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  if (_impl_.utxo_.IsDefault()) {
+    _impl_.utxo_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoReq.utxo)
 }
 
-// uint64 start_height = 3;
-inline void SyncGetHeightHashReq::clear_start_height() {
-  _impl_.start_height_ = uint64_t{0u};
-}
-inline uint64_t SyncGetHeightHashReq::_internal_start_height() const {
-  return _impl_.start_height_;
-}
-inline uint64_t SyncGetHeightHashReq::start_height() const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.start_height)
-  return _internal_start_height();
+// string msg_id = 3;
+inline void GetBlockByUtxoReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
 }
-inline void SyncGetHeightHashReq::_internal_set_start_height(uint64_t value) {
-  
-  _impl_.start_height_ = value;
+inline const std::string& GetBlockByUtxoReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:GetBlockByUtxoReq.msg_id)
+  return _internal_msg_id();
 }
-inline void SyncGetHeightHashReq::set_start_height(uint64_t value) {
-  _internal_set_start_height(value);
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.start_height)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockByUtxoReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByUtxoReq.msg_id)
 }
-
-// uint64 end_height = 4;
-inline void SyncGetHeightHashReq::clear_end_height() {
-  _impl_.end_height_ = uint64_t{0u};
+inline std::string* GetBlockByUtxoReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoReq.msg_id)
+  return _s;
 }
-inline uint64_t SyncGetHeightHashReq::_internal_end_height() const {
-  return _impl_.end_height_;
+inline const std::string& GetBlockByUtxoReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
 }
-inline uint64_t SyncGetHeightHashReq::end_height() const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashReq.end_height)
-  return _internal_end_height();
+inline void GetBlockByUtxoReq::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline void SyncGetHeightHashReq::_internal_set_end_height(uint64_t value) {
+inline std::string* GetBlockByUtxoReq::_internal_mutable_msg_id() {
   
-  _impl_.end_height_ = value;
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline void SyncGetHeightHashReq::set_end_height(uint64_t value) {
-  _internal_set_end_height(value);
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashReq.end_height)
+inline std::string* GetBlockByUtxoReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:GetBlockByUtxoReq.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void GetBlockByUtxoReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoReq.msg_id)
 }
 
 // -------------------------------------------------------------------
 
-// SyncGetHeightHashAck
+// GetBlockByUtxoAck
 
-// int32 code = 1;
-inline void SyncGetHeightHashAck::clear_code() {
-  _impl_.code_ = 0;
+// string addr = 1;
+inline void GetBlockByUtxoAck::clear_addr() {
+  _impl_.addr_.ClearToEmpty();
 }
-inline int32_t SyncGetHeightHashAck::_internal_code() const {
-  return _impl_.code_;
+inline const std::string& GetBlockByUtxoAck::addr() const {
+  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.addr)
+  return _internal_addr();
 }
-inline int32_t SyncGetHeightHashAck::code() const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.code)
-  return _internal_code();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockByUtxoAck::set_addr(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.addr)
 }
-inline void SyncGetHeightHashAck::_internal_set_code(int32_t value) {
+inline std::string* GetBlockByUtxoAck::mutable_addr() {
+  std::string* _s = _internal_mutable_addr();
+  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.addr)
+  return _s;
+}
+inline const std::string& GetBlockByUtxoAck::_internal_addr() const {
+  return _impl_.addr_.Get();
+}
+inline void GetBlockByUtxoAck::_internal_set_addr(const std::string& value) {
   
-  _impl_.code_ = value;
+  _impl_.addr_.Set(value, GetArenaForAllocation());
 }
-inline void SyncGetHeightHashAck::set_code(int32_t value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.code)
+inline std::string* GetBlockByUtxoAck::_internal_mutable_addr() {
+  
+  return _impl_.addr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetBlockByUtxoAck::release_addr() {
+  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.addr)
+  return _impl_.addr_.Release();
+}
+inline void GetBlockByUtxoAck::set_allocated_addr(std::string* addr) {
+  if (addr != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.addr_.IsDefault()) {
+    _impl_.addr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.addr)
 }
 
-// string self_node_id = 2;
-inline void SyncGetHeightHashAck::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// string utxo = 2;
+inline void GetBlockByUtxoAck::clear_utxo() {
+  _impl_.utxo_.ClearToEmpty();
 }
-inline const std::string& SyncGetHeightHashAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.self_node_id)
-  return _internal_self_node_id();
+inline const std::string& GetBlockByUtxoAck::utxo() const {
+  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.utxo)
+  return _internal_utxo();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetHeightHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void GetBlockByUtxoAck::set_utxo(ArgT0&& arg0, ArgT... args) {
  
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.self_node_id)
+ _impl_.utxo_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.utxo)
 }
-inline std::string* SyncGetHeightHashAck::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashAck.self_node_id)
+inline std::string* GetBlockByUtxoAck::mutable_utxo() {
+  std::string* _s = _internal_mutable_utxo();
+  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.utxo)
   return _s;
 }
-inline const std::string& SyncGetHeightHashAck::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline const std::string& GetBlockByUtxoAck::_internal_utxo() const {
+  return _impl_.utxo_.Get();
 }
-inline void SyncGetHeightHashAck::_internal_set_self_node_id(const std::string& value) {
+inline void GetBlockByUtxoAck::_internal_set_utxo(const std::string& value) {
   
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+  _impl_.utxo_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashAck::_internal_mutable_self_node_id() {
+inline std::string* GetBlockByUtxoAck::_internal_mutable_utxo() {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+  return _impl_.utxo_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncGetHeightHashAck.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline std::string* GetBlockByUtxoAck::release_utxo() {
+  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.utxo)
+  return _impl_.utxo_.Release();
 }
-inline void SyncGetHeightHashAck::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
+inline void GetBlockByUtxoAck::set_allocated_utxo(std::string* utxo) {
+  if (utxo != nullptr) {
     
   } else {
     
   }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+  _impl_.utxo_.SetAllocated(utxo, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  if (_impl_.utxo_.IsDefault()) {
+    _impl_.utxo_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.utxo)
 }
 
 // string msg_id = 3;
-inline void SyncGetHeightHashAck::clear_msg_id() {
+inline void GetBlockByUtxoAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetHeightHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.msg_id)
+inline const std::string& GetBlockByUtxoAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetHeightHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void GetBlockByUtxoAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.msg_id)
+  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.msg_id)
 }
-inline std::string* SyncGetHeightHashAck::mutable_msg_id() {
+inline std::string* GetBlockByUtxoAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.msg_id)
   return _s;
 }
-inline const std::string& SyncGetHeightHashAck::_internal_msg_id() const {
+inline const std::string& GetBlockByUtxoAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncGetHeightHashAck::_internal_set_msg_id(const std::string& value) {
+inline void GetBlockByUtxoAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashAck::_internal_mutable_msg_id() {
+inline std::string* GetBlockByUtxoAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetHeightHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetHeightHashAck.msg_id)
+inline std::string* GetBlockByUtxoAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void SyncGetHeightHashAck::set_allocated_msg_id(std::string* msg_id) {
+inline void GetBlockByUtxoAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -7045,467 +11064,511 @@ inline void SyncGetHeightHashAck::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetHeightHashAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.msg_id)
 }
 
-// repeated string block_hashes = 4;
-inline int SyncGetHeightHashAck::_internal_block_hashes_size() const {
-  return _impl_.block_hashes_.size();
+// bytes block_raw = 4;
+inline void GetBlockByUtxoAck::clear_block_raw() {
+  _impl_.block_raw_.ClearToEmpty();
 }
-inline int SyncGetHeightHashAck::block_hashes_size() const {
-  return _internal_block_hashes_size();
+inline const std::string& GetBlockByUtxoAck::block_raw() const {
+  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.block_raw)
+  return _internal_block_raw();
 }
-inline void SyncGetHeightHashAck::clear_block_hashes() {
-  _impl_.block_hashes_.Clear();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockByUtxoAck::set_block_raw(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.block_raw_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.block_raw)
 }
-inline std::string* SyncGetHeightHashAck::add_block_hashes() {
-  std::string* _s = _internal_add_block_hashes();
-  // @@protoc_insertion_point(field_add_mutable:SyncGetHeightHashAck.block_hashes)
+inline std::string* GetBlockByUtxoAck::mutable_block_raw() {
+  std::string* _s = _internal_mutable_block_raw();
+  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.block_raw)
   return _s;
 }
-inline const std::string& SyncGetHeightHashAck::_internal_block_hashes(int index) const {
-  return _impl_.block_hashes_.Get(index);
-}
-inline const std::string& SyncGetHeightHashAck::block_hashes(int index) const {
-  // @@protoc_insertion_point(field_get:SyncGetHeightHashAck.block_hashes)
-  return _internal_block_hashes(index);
-}
-inline std::string* SyncGetHeightHashAck::mutable_block_hashes(int index) {
-  // @@protoc_insertion_point(field_mutable:SyncGetHeightHashAck.block_hashes)
-  return _impl_.block_hashes_.Mutable(index);
-}
-inline void SyncGetHeightHashAck::set_block_hashes(int index, const std::string& value) {
-  _impl_.block_hashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.block_hashes)
-}
-inline void SyncGetHeightHashAck::set_block_hashes(int index, std::string&& value) {
-  _impl_.block_hashes_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:SyncGetHeightHashAck.block_hashes)
-}
-inline void SyncGetHeightHashAck::set_block_hashes(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.block_hashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:SyncGetHeightHashAck.block_hashes)
-}
-inline void SyncGetHeightHashAck::set_block_hashes(int index, const char* value, size_t size) {
-  _impl_.block_hashes_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:SyncGetHeightHashAck.block_hashes)
-}
-inline std::string* SyncGetHeightHashAck::_internal_add_block_hashes() {
-  return _impl_.block_hashes_.Add();
-}
-inline void SyncGetHeightHashAck::add_block_hashes(const std::string& value) {
-  _impl_.block_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:SyncGetHeightHashAck.block_hashes)
-}
-inline void SyncGetHeightHashAck::add_block_hashes(std::string&& value) {
-  _impl_.block_hashes_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:SyncGetHeightHashAck.block_hashes)
+inline const std::string& GetBlockByUtxoAck::_internal_block_raw() const {
+  return _impl_.block_raw_.Get();
 }
-inline void SyncGetHeightHashAck::add_block_hashes(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.block_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:SyncGetHeightHashAck.block_hashes)
+inline void GetBlockByUtxoAck::_internal_set_block_raw(const std::string& value) {
+  
+  _impl_.block_raw_.Set(value, GetArenaForAllocation());
 }
-inline void SyncGetHeightHashAck::add_block_hashes(const char* value, size_t size) {
-  _impl_.block_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:SyncGetHeightHashAck.block_hashes)
+inline std::string* GetBlockByUtxoAck::_internal_mutable_block_raw() {
+  
+  return _impl_.block_raw_.Mutable(GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-SyncGetHeightHashAck::block_hashes() const {
-  // @@protoc_insertion_point(field_list:SyncGetHeightHashAck.block_hashes)
-  return _impl_.block_hashes_;
+inline std::string* GetBlockByUtxoAck::release_block_raw() {
+  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.block_raw)
+  return _impl_.block_raw_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-SyncGetHeightHashAck::mutable_block_hashes() {
-  // @@protoc_insertion_point(field_mutable_list:SyncGetHeightHashAck.block_hashes)
-  return &_impl_.block_hashes_;
+inline void GetBlockByUtxoAck::set_allocated_block_raw(std::string* block_raw) {
+  if (block_raw != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.block_raw_.SetAllocated(block_raw, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.block_raw_.IsDefault()) {
+    _impl_.block_raw_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.block_raw)
 }
 
 // -------------------------------------------------------------------
 
-// SyncGetBlockHeightAndHashReq
+// HashType
 
-// string self_node_id = 1;
-inline void SyncGetBlockHeightAndHashReq::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// string hash = 1;
+inline void HashType::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
 }
-inline const std::string& SyncGetBlockHeightAndHashReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.self_node_id)
-  return _internal_self_node_id();
+inline const std::string& HashType::hash() const {
+  // @@protoc_insertion_point(field_get:HashType.hash)
+  return _internal_hash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetBlockHeightAndHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void HashType::set_hash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.self_node_id)
+ _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HashType.hash)
 }
-inline std::string* SyncGetBlockHeightAndHashReq::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashReq.self_node_id)
+inline std::string* HashType::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:HashType.hash)
   return _s;
 }
-inline const std::string& SyncGetBlockHeightAndHashReq::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline const std::string& HashType::_internal_hash() const {
+  return _impl_.hash_.Get();
 }
-inline void SyncGetBlockHeightAndHashReq::_internal_set_self_node_id(const std::string& value) {
+inline void HashType::_internal_set_hash(const std::string& value) {
   
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+  _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashReq::_internal_mutable_self_node_id() {
+inline std::string* HashType::_internal_mutable_hash() {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashReq.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline std::string* HashType::release_hash() {
+  // @@protoc_insertion_point(field_release:HashType.hash)
+  return _impl_.hash_.Release();
 }
-inline void SyncGetBlockHeightAndHashReq::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
+inline void HashType::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
     
   } else {
     
   }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:HashType.hash)
 }
 
-// string msg_id = 2;
-inline void SyncGetBlockHeightAndHashReq::clear_msg_id() {
-  _impl_.msg_id_.ClearToEmpty();
+// bool tx_or_block = 2;
+inline void HashType::clear_tx_or_block() {
+  _impl_.tx_or_block_ = false;
 }
-inline const std::string& SyncGetBlockHeightAndHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.msg_id)
-  return _internal_msg_id();
+inline bool HashType::_internal_tx_or_block() const {
+  return _impl_.tx_or_block_;
+}
+inline bool HashType::tx_or_block() const {
+  // @@protoc_insertion_point(field_get:HashType.tx_or_block)
+  return _internal_tx_or_block();
+}
+inline void HashType::_internal_set_tx_or_block(bool value) {
+  
+  _impl_.tx_or_block_ = value;
+}
+inline void HashType::set_tx_or_block(bool value) {
+  _internal_set_tx_or_block(value);
+  // @@protoc_insertion_point(field_set:HashType.tx_or_block)
+}
+
+// bytes block_raw = 3;
+inline void HashType::clear_block_raw() {
+  _impl_.block_raw_.ClearToEmpty();
+}
+inline const std::string& HashType::block_raw() const {
+  // @@protoc_insertion_point(field_get:HashType.block_raw)
+  return _internal_block_raw();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetBlockHeightAndHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void HashType::set_block_raw(ArgT0&& arg0, ArgT... args) {
  
- _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.msg_id)
+ _impl_.block_raw_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HashType.block_raw)
 }
-inline std::string* SyncGetBlockHeightAndHashReq::mutable_msg_id() {
-  std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashReq.msg_id)
+inline std::string* HashType::mutable_block_raw() {
+  std::string* _s = _internal_mutable_block_raw();
+  // @@protoc_insertion_point(field_mutable:HashType.block_raw)
   return _s;
 }
-inline const std::string& SyncGetBlockHeightAndHashReq::_internal_msg_id() const {
-  return _impl_.msg_id_.Get();
+inline const std::string& HashType::_internal_block_raw() const {
+  return _impl_.block_raw_.Get();
 }
-inline void SyncGetBlockHeightAndHashReq::_internal_set_msg_id(const std::string& value) {
+inline void HashType::_internal_set_block_raw(const std::string& value) {
   
-  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+  _impl_.block_raw_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashReq::_internal_mutable_msg_id() {
+inline std::string* HashType::_internal_mutable_block_raw() {
   
-  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+  return _impl_.block_raw_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashReq.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* HashType::release_block_raw() {
+  // @@protoc_insertion_point(field_release:HashType.block_raw)
+  return _impl_.block_raw_.Release();
 }
-inline void SyncGetBlockHeightAndHashReq::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
+inline void HashType::set_allocated_block_raw(std::string* block_raw) {
+  if (block_raw != nullptr) {
     
   } else {
     
   }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+  _impl_.block_raw_.SetAllocated(block_raw, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  if (_impl_.block_raw_.IsDefault()) {
+    _impl_.block_raw_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:HashType.block_raw)
 }
 
-// uint64 start_height = 3;
-inline void SyncGetBlockHeightAndHashReq::clear_start_height() {
-  _impl_.start_height_ = uint64_t{0u};
+// -------------------------------------------------------------------
+
+// GetBlockByHashReq
+
+// string addr = 1;
+inline void GetBlockByHashReq::clear_addr() {
+  _impl_.addr_.ClearToEmpty();
 }
-inline uint64_t SyncGetBlockHeightAndHashReq::_internal_start_height() const {
-  return _impl_.start_height_;
+inline const std::string& GetBlockByHashReq::addr() const {
+  // @@protoc_insertion_point(field_get:GetBlockByHashReq.addr)
+  return _internal_addr();
 }
-inline uint64_t SyncGetBlockHeightAndHashReq::start_height() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.start_height)
-  return _internal_start_height();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockByHashReq::set_addr(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByHashReq.addr)
 }
-inline void SyncGetBlockHeightAndHashReq::_internal_set_start_height(uint64_t value) {
+inline std::string* GetBlockByHashReq::mutable_addr() {
+  std::string* _s = _internal_mutable_addr();
+  // @@protoc_insertion_point(field_mutable:GetBlockByHashReq.addr)
+  return _s;
+}
+inline const std::string& GetBlockByHashReq::_internal_addr() const {
+  return _impl_.addr_.Get();
+}
+inline void GetBlockByHashReq::_internal_set_addr(const std::string& value) {
   
-  _impl_.start_height_ = value;
+  _impl_.addr_.Set(value, GetArenaForAllocation());
 }
-inline void SyncGetBlockHeightAndHashReq::set_start_height(uint64_t value) {
-  _internal_set_start_height(value);
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.start_height)
+inline std::string* GetBlockByHashReq::_internal_mutable_addr() {
+  
+  return _impl_.addr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetBlockByHashReq::release_addr() {
+  // @@protoc_insertion_point(field_release:GetBlockByHashReq.addr)
+  return _impl_.addr_.Release();
+}
+inline void GetBlockByHashReq::set_allocated_addr(std::string* addr) {
+  if (addr != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.addr_.IsDefault()) {
+    _impl_.addr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashReq.addr)
 }
 
-// uint64 end_height = 4;
-inline void SyncGetBlockHeightAndHashReq::clear_end_height() {
-  _impl_.end_height_ = uint64_t{0u};
+// repeated .HashType missingHashs = 2;
+inline int GetBlockByHashReq::_internal_missinghashs_size() const {
+  return _impl_.missinghashs_.size();
 }
-inline uint64_t SyncGetBlockHeightAndHashReq::_internal_end_height() const {
-  return _impl_.end_height_;
+inline int GetBlockByHashReq::missinghashs_size() const {
+  return _internal_missinghashs_size();
 }
-inline uint64_t SyncGetBlockHeightAndHashReq::end_height() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashReq.end_height)
-  return _internal_end_height();
+inline void GetBlockByHashReq::clear_missinghashs() {
+  _impl_.missinghashs_.Clear();
 }
-inline void SyncGetBlockHeightAndHashReq::_internal_set_end_height(uint64_t value) {
-  
-  _impl_.end_height_ = value;
+inline ::HashType* GetBlockByHashReq::mutable_missinghashs(int index) {
+  // @@protoc_insertion_point(field_mutable:GetBlockByHashReq.missingHashs)
+  return _impl_.missinghashs_.Mutable(index);
 }
-inline void SyncGetBlockHeightAndHashReq::set_end_height(uint64_t value) {
-  _internal_set_end_height(value);
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashReq.end_height)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >*
+GetBlockByHashReq::mutable_missinghashs() {
+  // @@protoc_insertion_point(field_mutable_list:GetBlockByHashReq.missingHashs)
+  return &_impl_.missinghashs_;
 }
-
-// -------------------------------------------------------------------
-
-// SyncGetBlockHeightAndHashAck
-
-// int32 code = 1;
-inline void SyncGetBlockHeightAndHashAck::clear_code() {
-  _impl_.code_ = 0;
+inline const ::HashType& GetBlockByHashReq::_internal_missinghashs(int index) const {
+  return _impl_.missinghashs_.Get(index);
 }
-inline int32_t SyncGetBlockHeightAndHashAck::_internal_code() const {
-  return _impl_.code_;
+inline const ::HashType& GetBlockByHashReq::missinghashs(int index) const {
+  // @@protoc_insertion_point(field_get:GetBlockByHashReq.missingHashs)
+  return _internal_missinghashs(index);
 }
-inline int32_t SyncGetBlockHeightAndHashAck::code() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.code)
-  return _internal_code();
+inline ::HashType* GetBlockByHashReq::_internal_add_missinghashs() {
+  return _impl_.missinghashs_.Add();
 }
-inline void SyncGetBlockHeightAndHashAck::_internal_set_code(int32_t value) {
-  
-  _impl_.code_ = value;
+inline ::HashType* GetBlockByHashReq::add_missinghashs() {
+  ::HashType* _add = _internal_add_missinghashs();
+  // @@protoc_insertion_point(field_add:GetBlockByHashReq.missingHashs)
+  return _add;
 }
-inline void SyncGetBlockHeightAndHashAck::set_code(int32_t value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.code)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >&
+GetBlockByHashReq::missinghashs() const {
+  // @@protoc_insertion_point(field_list:GetBlockByHashReq.missingHashs)
+  return _impl_.missinghashs_;
 }
 
-// string self_node_id = 2;
-inline void SyncGetBlockHeightAndHashAck::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// string msg_id = 3;
+inline void GetBlockByHashReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetBlockHeightAndHashAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.self_node_id)
-  return _internal_self_node_id();
+inline const std::string& GetBlockByHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:GetBlockByHashReq.msg_id)
+  return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetBlockHeightAndHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void GetBlockByHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.self_node_id)
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByHashReq.msg_id)
 }
-inline std::string* SyncGetBlockHeightAndHashAck::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashAck.self_node_id)
+inline std::string* GetBlockByHashReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:GetBlockByHashReq.msg_id)
   return _s;
 }
-inline const std::string& SyncGetBlockHeightAndHashAck::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline const std::string& GetBlockByHashReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
 }
-inline void SyncGetBlockHeightAndHashAck::_internal_set_self_node_id(const std::string& value) {
+inline void GetBlockByHashReq::_internal_set_msg_id(const std::string& value) {
   
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashAck::_internal_mutable_self_node_id() {
+inline std::string* GetBlockByHashReq::_internal_mutable_msg_id() {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashAck.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline std::string* GetBlockByHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:GetBlockByHashReq.msg_id)
+  return _impl_.msg_id_.Release();
 }
-inline void SyncGetBlockHeightAndHashAck::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
+inline void GetBlockByHashReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
     
   } else {
     
   }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashReq.msg_id)
 }
 
-// string msg_id = 3;
-inline void SyncGetBlockHeightAndHashAck::clear_msg_id() {
-  _impl_.msg_id_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// GetBlockByHashAck
+
+// string addr = 1;
+inline void GetBlockByHashAck::clear_addr() {
+  _impl_.addr_.ClearToEmpty();
 }
-inline const std::string& SyncGetBlockHeightAndHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.msg_id)
-  return _internal_msg_id();
+inline const std::string& GetBlockByHashAck::addr() const {
+  // @@protoc_insertion_point(field_get:GetBlockByHashAck.addr)
+  return _internal_addr();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetBlockHeightAndHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void GetBlockByHashAck::set_addr(ArgT0&& arg0, ArgT... args) {
  
- _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.msg_id)
+ _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByHashAck.addr)
 }
-inline std::string* SyncGetBlockHeightAndHashAck::mutable_msg_id() {
-  std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashAck.msg_id)
+inline std::string* GetBlockByHashAck::mutable_addr() {
+  std::string* _s = _internal_mutable_addr();
+  // @@protoc_insertion_point(field_mutable:GetBlockByHashAck.addr)
   return _s;
 }
-inline const std::string& SyncGetBlockHeightAndHashAck::_internal_msg_id() const {
-  return _impl_.msg_id_.Get();
+inline const std::string& GetBlockByHashAck::_internal_addr() const {
+  return _impl_.addr_.Get();
 }
-inline void SyncGetBlockHeightAndHashAck::_internal_set_msg_id(const std::string& value) {
+inline void GetBlockByHashAck::_internal_set_addr(const std::string& value) {
   
-  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+  _impl_.addr_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashAck::_internal_mutable_msg_id() {
+inline std::string* GetBlockByHashAck::_internal_mutable_addr() {
   
-  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+  return _impl_.addr_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockHeightAndHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetBlockHeightAndHashAck.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* GetBlockByHashAck::release_addr() {
+  // @@protoc_insertion_point(field_release:GetBlockByHashAck.addr)
+  return _impl_.addr_.Release();
 }
-inline void SyncGetBlockHeightAndHashAck::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
+inline void GetBlockByHashAck::set_allocated_addr(std::string* addr) {
+  if (addr != nullptr) {
     
   } else {
     
   }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  if (_impl_.addr_.IsDefault()) {
+    _impl_.addr_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockHeightAndHashAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashAck.addr)
 }
 
-// repeated string block_hashes = 4;
-inline int SyncGetBlockHeightAndHashAck::_internal_block_hashes_size() const {
-  return _impl_.block_hashes_.size();
+// repeated .HashType blocks = 2;
+inline int GetBlockByHashAck::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
 }
-inline int SyncGetBlockHeightAndHashAck::block_hashes_size() const {
-  return _internal_block_hashes_size();
+inline int GetBlockByHashAck::blocks_size() const {
+  return _internal_blocks_size();
 }
-inline void SyncGetBlockHeightAndHashAck::clear_block_hashes() {
-  _impl_.block_hashes_.Clear();
+inline void GetBlockByHashAck::clear_blocks() {
+  _impl_.blocks_.Clear();
 }
-inline std::string* SyncGetBlockHeightAndHashAck::add_block_hashes() {
-  std::string* _s = _internal_add_block_hashes();
-  // @@protoc_insertion_point(field_add_mutable:SyncGetBlockHeightAndHashAck.block_hashes)
-  return _s;
+inline ::HashType* GetBlockByHashAck::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:GetBlockByHashAck.blocks)
+  return _impl_.blocks_.Mutable(index);
 }
-inline const std::string& SyncGetBlockHeightAndHashAck::_internal_block_hashes(int index) const {
-  return _impl_.block_hashes_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >*
+GetBlockByHashAck::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:GetBlockByHashAck.blocks)
+  return &_impl_.blocks_;
 }
-inline const std::string& SyncGetBlockHeightAndHashAck::block_hashes(int index) const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockHeightAndHashAck.block_hashes)
-  return _internal_block_hashes(index);
+inline const ::HashType& GetBlockByHashAck::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
 }
-inline std::string* SyncGetBlockHeightAndHashAck::mutable_block_hashes(int index) {
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockHeightAndHashAck.block_hashes)
-  return _impl_.block_hashes_.Mutable(index);
+inline const ::HashType& GetBlockByHashAck::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:GetBlockByHashAck.blocks)
+  return _internal_blocks(index);
 }
-inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, const std::string& value) {
-  _impl_.block_hashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.block_hashes)
+inline ::HashType* GetBlockByHashAck::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
 }
-inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, std::string&& value) {
-  _impl_.block_hashes_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:SyncGetBlockHeightAndHashAck.block_hashes)
+inline ::HashType* GetBlockByHashAck::add_blocks() {
+  ::HashType* _add = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add:GetBlockByHashAck.blocks)
+  return _add;
 }
-inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.block_hashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:SyncGetBlockHeightAndHashAck.block_hashes)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >&
+GetBlockByHashAck::blocks() const {
+  // @@protoc_insertion_point(field_list:GetBlockByHashAck.blocks)
+  return _impl_.blocks_;
 }
-inline void SyncGetBlockHeightAndHashAck::set_block_hashes(int index, const char* value, size_t size) {
-  _impl_.block_hashes_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:SyncGetBlockHeightAndHashAck.block_hashes)
+
+// string msg_id = 3;
+inline void GetBlockByHashAck::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
 }
-inline std::string* SyncGetBlockHeightAndHashAck::_internal_add_block_hashes() {
-  return _impl_.block_hashes_.Add();
+inline const std::string& GetBlockByHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:GetBlockByHashAck.msg_id)
+  return _internal_msg_id();
 }
-inline void SyncGetBlockHeightAndHashAck::add_block_hashes(const std::string& value) {
-  _impl_.block_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:SyncGetBlockHeightAndHashAck.block_hashes)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetBlockByHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetBlockByHashAck.msg_id)
 }
-inline void SyncGetBlockHeightAndHashAck::add_block_hashes(std::string&& value) {
-  _impl_.block_hashes_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:SyncGetBlockHeightAndHashAck.block_hashes)
+inline std::string* GetBlockByHashAck::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:GetBlockByHashAck.msg_id)
+  return _s;
 }
-inline void SyncGetBlockHeightAndHashAck::add_block_hashes(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.block_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:SyncGetBlockHeightAndHashAck.block_hashes)
+inline const std::string& GetBlockByHashAck::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
 }
-inline void SyncGetBlockHeightAndHashAck::add_block_hashes(const char* value, size_t size) {
-  _impl_.block_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:SyncGetBlockHeightAndHashAck.block_hashes)
+inline void GetBlockByHashAck::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-SyncGetBlockHeightAndHashAck::block_hashes() const {
-  // @@protoc_insertion_point(field_list:SyncGetBlockHeightAndHashAck.block_hashes)
-  return _impl_.block_hashes_;
+inline std::string* GetBlockByHashAck::_internal_mutable_msg_id() {
+  
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-SyncGetBlockHeightAndHashAck::mutable_block_hashes() {
-  // @@protoc_insertion_point(field_mutable_list:SyncGetBlockHeightAndHashAck.block_hashes)
-  return &_impl_.block_hashes_;
+inline std::string* GetBlockByHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:GetBlockByHashAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void GetBlockByHashAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashAck.msg_id)
 }
 
 // -------------------------------------------------------------------
 
-// SyncGetBlockReq
+// SyncNodeHashReq
 
 // string self_node_id = 1;
-inline void SyncGetBlockReq::clear_self_node_id() {
+inline void SyncNodeHashReq::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetBlockReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockReq.self_node_id)
+inline const std::string& SyncNodeHashReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncNodeHashReq.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetBlockReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncNodeHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetBlockReq.self_node_id)
+  // @@protoc_insertion_point(field_set:SyncNodeHashReq.self_node_id)
 }
-inline std::string* SyncGetBlockReq::mutable_self_node_id() {
+inline std::string* SyncNodeHashReq::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockReq.self_node_id)
+  // @@protoc_insertion_point(field_mutable:SyncNodeHashReq.self_node_id)
   return _s;
 }
-inline const std::string& SyncGetBlockReq::_internal_self_node_id() const {
+inline const std::string& SyncNodeHashReq::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void SyncGetBlockReq::_internal_set_self_node_id(const std::string& value) {
+inline void SyncNodeHashReq::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockReq::_internal_mutable_self_node_id() {
+inline std::string* SyncNodeHashReq::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncGetBlockReq.self_node_id)
+inline std::string* SyncNodeHashReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncNodeHashReq.self_node_id)
   return _impl_.self_node_id_.Release();
 }
-inline void SyncGetBlockReq::set_allocated_self_node_id(std::string* self_node_id) {
+inline void SyncNodeHashReq::set_allocated_self_node_id(std::string* self_node_id) {
   if (self_node_id != nullptr) {
     
   } else {
@@ -7517,45 +11580,45 @@ inline void SyncGetBlockReq::set_allocated_self_node_id(std::string* self_node_i
     _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockReq.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashReq.self_node_id)
 }
 
 // string msg_id = 2;
-inline void SyncGetBlockReq::clear_msg_id() {
+inline void SyncNodeHashReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetBlockReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockReq.msg_id)
+inline const std::string& SyncNodeHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncNodeHashReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetBlockReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncNodeHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetBlockReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncNodeHashReq.msg_id)
 }
-inline std::string* SyncGetBlockReq::mutable_msg_id() {
+inline std::string* SyncNodeHashReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncNodeHashReq.msg_id)
   return _s;
 }
-inline const std::string& SyncGetBlockReq::_internal_msg_id() const {
+inline const std::string& SyncNodeHashReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncGetBlockReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncNodeHashReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockReq::_internal_mutable_msg_id() {
+inline std::string* SyncNodeHashReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetBlockReq.msg_id)
+inline std::string* SyncNodeHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncNodeHashReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void SyncGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncNodeHashReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -7567,273 +11630,149 @@ inline void SyncGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockReq.msg_id)
-}
-
-// repeated string block_hashes = 3;
-inline int SyncGetBlockReq::_internal_block_hashes_size() const {
-  return _impl_.block_hashes_.size();
-}
-inline int SyncGetBlockReq::block_hashes_size() const {
-  return _internal_block_hashes_size();
-}
-inline void SyncGetBlockReq::clear_block_hashes() {
-  _impl_.block_hashes_.Clear();
-}
-inline std::string* SyncGetBlockReq::add_block_hashes() {
-  std::string* _s = _internal_add_block_hashes();
-  // @@protoc_insertion_point(field_add_mutable:SyncGetBlockReq.block_hashes)
-  return _s;
-}
-inline const std::string& SyncGetBlockReq::_internal_block_hashes(int index) const {
-  return _impl_.block_hashes_.Get(index);
-}
-inline const std::string& SyncGetBlockReq::block_hashes(int index) const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockReq.block_hashes)
-  return _internal_block_hashes(index);
-}
-inline std::string* SyncGetBlockReq::mutable_block_hashes(int index) {
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockReq.block_hashes)
-  return _impl_.block_hashes_.Mutable(index);
-}
-inline void SyncGetBlockReq::set_block_hashes(int index, const std::string& value) {
-  _impl_.block_hashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:SyncGetBlockReq.block_hashes)
-}
-inline void SyncGetBlockReq::set_block_hashes(int index, std::string&& value) {
-  _impl_.block_hashes_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:SyncGetBlockReq.block_hashes)
-}
-inline void SyncGetBlockReq::set_block_hashes(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.block_hashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:SyncGetBlockReq.block_hashes)
-}
-inline void SyncGetBlockReq::set_block_hashes(int index, const char* value, size_t size) {
-  _impl_.block_hashes_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:SyncGetBlockReq.block_hashes)
-}
-inline std::string* SyncGetBlockReq::_internal_add_block_hashes() {
-  return _impl_.block_hashes_.Add();
-}
-inline void SyncGetBlockReq::add_block_hashes(const std::string& value) {
-  _impl_.block_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:SyncGetBlockReq.block_hashes)
-}
-inline void SyncGetBlockReq::add_block_hashes(std::string&& value) {
-  _impl_.block_hashes_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:SyncGetBlockReq.block_hashes)
-}
-inline void SyncGetBlockReq::add_block_hashes(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.block_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:SyncGetBlockReq.block_hashes)
-}
-inline void SyncGetBlockReq::add_block_hashes(const char* value, size_t size) {
-  _impl_.block_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:SyncGetBlockReq.block_hashes)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-SyncGetBlockReq::block_hashes() const {
-  // @@protoc_insertion_point(field_list:SyncGetBlockReq.block_hashes)
-  return _impl_.block_hashes_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-SyncGetBlockReq::mutable_block_hashes() {
-  // @@protoc_insertion_point(field_mutable_list:SyncGetBlockReq.block_hashes)
-  return &_impl_.block_hashes_;
+  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashReq.msg_id)
 }
 
 // -------------------------------------------------------------------
 
-// SyncGetBlockAck
+// SyncNodeHashAck
 
-// string msg_id = 1;
-inline void SyncGetBlockAck::clear_msg_id() {
-  _impl_.msg_id_.ClearToEmpty();
+// string self_node_id = 1;
+inline void SyncNodeHashAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& SyncGetBlockAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockAck.msg_id)
-  return _internal_msg_id();
+inline const std::string& SyncNodeHashAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncNodeHashAck.self_node_id)
+  return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncGetBlockAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncNodeHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncGetBlockAck.msg_id)
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncNodeHashAck.self_node_id)
 }
-inline std::string* SyncGetBlockAck::mutable_msg_id() {
-  std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockAck.msg_id)
+inline std::string* SyncNodeHashAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncNodeHashAck.self_node_id)
   return _s;
 }
-inline const std::string& SyncGetBlockAck::_internal_msg_id() const {
-  return _impl_.msg_id_.Get();
+inline const std::string& SyncNodeHashAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline void SyncGetBlockAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncNodeHashAck::_internal_set_self_node_id(const std::string& value) {
   
-  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockAck::_internal_mutable_msg_id() {
+inline std::string* SyncNodeHashAck::_internal_mutable_self_node_id() {
   
-  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncGetBlockAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncGetBlockAck.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* SyncNodeHashAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncNodeHashAck.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void SyncGetBlockAck::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
-    
-  } else {
+inline void SyncNodeHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
     
-  }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockAck.msg_id)
-}
-
-// repeated bytes blocks = 2;
-inline int SyncGetBlockAck::_internal_blocks_size() const {
-  return _impl_.blocks_.size();
-}
-inline int SyncGetBlockAck::blocks_size() const {
-  return _internal_blocks_size();
-}
-inline void SyncGetBlockAck::clear_blocks() {
-  _impl_.blocks_.Clear();
-}
-inline std::string* SyncGetBlockAck::add_blocks() {
-  std::string* _s = _internal_add_blocks();
-  // @@protoc_insertion_point(field_add_mutable:SyncGetBlockAck.blocks)
-  return _s;
-}
-inline const std::string& SyncGetBlockAck::_internal_blocks(int index) const {
-  return _impl_.blocks_.Get(index);
-}
-inline const std::string& SyncGetBlockAck::blocks(int index) const {
-  // @@protoc_insertion_point(field_get:SyncGetBlockAck.blocks)
-  return _internal_blocks(index);
-}
-inline std::string* SyncGetBlockAck::mutable_blocks(int index) {
-  // @@protoc_insertion_point(field_mutable:SyncGetBlockAck.blocks)
-  return _impl_.blocks_.Mutable(index);
-}
-inline void SyncGetBlockAck::set_blocks(int index, const std::string& value) {
-  _impl_.blocks_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:SyncGetBlockAck.blocks)
-}
-inline void SyncGetBlockAck::set_blocks(int index, std::string&& value) {
-  _impl_.blocks_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:SyncGetBlockAck.blocks)
-}
-inline void SyncGetBlockAck::set_blocks(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocks_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:SyncGetBlockAck.blocks)
-}
-inline void SyncGetBlockAck::set_blocks(int index, const void* value, size_t size) {
-  _impl_.blocks_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:SyncGetBlockAck.blocks)
-}
-inline std::string* SyncGetBlockAck::_internal_add_blocks() {
-  return _impl_.blocks_.Add();
-}
-inline void SyncGetBlockAck::add_blocks(const std::string& value) {
-  _impl_.blocks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:SyncGetBlockAck.blocks)
-}
-inline void SyncGetBlockAck::add_blocks(std::string&& value) {
-  _impl_.blocks_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:SyncGetBlockAck.blocks)
-}
-inline void SyncGetBlockAck::add_blocks(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:SyncGetBlockAck.blocks)
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashAck.self_node_id)
 }
-inline void SyncGetBlockAck::add_blocks(const void* value, size_t size) {
-  _impl_.blocks_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:SyncGetBlockAck.blocks)
+
+// string msg_id = 2;
+inline void SyncNodeHashAck::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-SyncGetBlockAck::blocks() const {
-  // @@protoc_insertion_point(field_list:SyncGetBlockAck.blocks)
-  return _impl_.blocks_;
+inline const std::string& SyncNodeHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncNodeHashAck.msg_id)
+  return _internal_msg_id();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-SyncGetBlockAck::mutable_blocks() {
-  // @@protoc_insertion_point(field_mutable_list:SyncGetBlockAck.blocks)
-  return &_impl_.blocks_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncNodeHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncNodeHashAck.msg_id)
 }
-
-// -------------------------------------------------------------------
-
-// SyncFromZeroSumHash
-
-// uint64 height = 1;
-inline void SyncFromZeroSumHash::clear_height() {
-  _impl_.height_ = uint64_t{0u};
+inline std::string* SyncNodeHashAck::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncNodeHashAck.msg_id)
+  return _s;
 }
-inline uint64_t SyncFromZeroSumHash::_internal_height() const {
-  return _impl_.height_;
+inline const std::string& SyncNodeHashAck::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
 }
-inline uint64_t SyncFromZeroSumHash::height() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroSumHash.height)
-  return _internal_height();
+inline void SyncNodeHashAck::_internal_set_msg_id(const std::string& value) {
+  
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline void SyncFromZeroSumHash::_internal_set_height(uint64_t value) {
+inline std::string* SyncNodeHashAck::_internal_mutable_msg_id() {
   
-  _impl_.height_ = value;
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline void SyncFromZeroSumHash::set_height(uint64_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:SyncFromZeroSumHash.height)
+inline std::string* SyncNodeHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncNodeHashAck.msg_id)
+  return _impl_.msg_id_.Release();
+}
+inline void SyncNodeHashAck::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashAck.msg_id)
 }
 
-// string hash = 2;
-inline void SyncFromZeroSumHash::clear_hash() {
+// string hash = 3;
+inline void SyncNodeHashAck::clear_hash() {
   _impl_.hash_.ClearToEmpty();
 }
-inline const std::string& SyncFromZeroSumHash::hash() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroSumHash.hash)
+inline const std::string& SyncNodeHashAck::hash() const {
+  // @@protoc_insertion_point(field_get:SyncNodeHashAck.hash)
   return _internal_hash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroSumHash::set_hash(ArgT0&& arg0, ArgT... args) {
+void SyncNodeHashAck::set_hash(ArgT0&& arg0, ArgT... args) {
  
  _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroSumHash.hash)
+  // @@protoc_insertion_point(field_set:SyncNodeHashAck.hash)
 }
-inline std::string* SyncFromZeroSumHash::mutable_hash() {
+inline std::string* SyncNodeHashAck::mutable_hash() {
   std::string* _s = _internal_mutable_hash();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroSumHash.hash)
+  // @@protoc_insertion_point(field_mutable:SyncNodeHashAck.hash)
   return _s;
 }
-inline const std::string& SyncFromZeroSumHash::_internal_hash() const {
+inline const std::string& SyncNodeHashAck::_internal_hash() const {
   return _impl_.hash_.Get();
 }
-inline void SyncFromZeroSumHash::_internal_set_hash(const std::string& value) {
+inline void SyncNodeHashAck::_internal_set_hash(const std::string& value) {
   
   _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroSumHash::_internal_mutable_hash() {
+inline std::string* SyncNodeHashAck::_internal_mutable_hash() {
   
   return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroSumHash::release_hash() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroSumHash.hash)
+inline std::string* SyncNodeHashAck::release_hash() {
+  // @@protoc_insertion_point(field_release:SyncNodeHashAck.hash)
   return _impl_.hash_.Release();
 }
-inline void SyncFromZeroSumHash::set_allocated_hash(std::string* hash) {
+inline void SyncNodeHashAck::set_allocated_hash(std::string* hash) {
   if (hash != nullptr) {
     
   } else {
@@ -7845,99 +11784,69 @@ inline void SyncFromZeroSumHash::set_allocated_hash(std::string* hash) {
     _impl_.hash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroSumHash.hash)
+  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashAck.hash)
 }
 
 // -------------------------------------------------------------------
 
-// SyncFromZeroGetSumHashReq
+// GetCheckSumHashReq
 
-// string self_node_id = 1;
-inline void SyncFromZeroGetSumHashReq::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
-}
-inline const std::string& SyncFromZeroGetSumHashReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashReq.self_node_id)
-  return _internal_self_node_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetSumHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashReq.self_node_id)
-}
-inline std::string* SyncFromZeroGetSumHashReq::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashReq.self_node_id)
-  return _s;
+// uint64 height = 1;
+inline void GetCheckSumHashReq::clear_height() {
+  _impl_.height_ = uint64_t{0u};
 }
-inline const std::string& SyncFromZeroGetSumHashReq::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline uint64_t GetCheckSumHashReq::_internal_height() const {
+  return _impl_.height_;
 }
-inline void SyncFromZeroGetSumHashReq::_internal_set_self_node_id(const std::string& value) {
-  
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+inline uint64_t GetCheckSumHashReq::height() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashReq.height)
+  return _internal_height();
 }
-inline std::string* SyncFromZeroGetSumHashReq::_internal_mutable_self_node_id() {
+inline void GetCheckSumHashReq::_internal_set_height(uint64_t value) {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
-}
-inline std::string* SyncFromZeroGetSumHashReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashReq.self_node_id)
-  return _impl_.self_node_id_.Release();
+  _impl_.height_ = value;
 }
-inline void SyncFromZeroGetSumHashReq::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashReq.self_node_id)
+inline void GetCheckSumHashReq::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:GetCheckSumHashReq.height)
 }
 
 // string msg_id = 2;
-inline void SyncFromZeroGetSumHashReq::clear_msg_id() {
+inline void GetCheckSumHashReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncFromZeroGetSumHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashReq.msg_id)
+inline const std::string& GetCheckSumHashReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetSumHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void GetCheckSumHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_set:GetCheckSumHashReq.msg_id)
 }
-inline std::string* SyncFromZeroGetSumHashReq::mutable_msg_id() {
+inline std::string* GetCheckSumHashReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:GetCheckSumHashReq.msg_id)
   return _s;
 }
-inline const std::string& SyncFromZeroGetSumHashReq::_internal_msg_id() const {
+inline const std::string& GetCheckSumHashReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncFromZeroGetSumHashReq::_internal_set_msg_id(const std::string& value) {
+inline void GetCheckSumHashReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetSumHashReq::_internal_mutable_msg_id() {
+inline std::string* GetCheckSumHashReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetSumHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashReq.msg_id)
+inline std::string* GetCheckSumHashReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:GetCheckSumHashReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void SyncFromZeroGetSumHashReq::set_allocated_msg_id(std::string* msg_id) {
+inline void GetCheckSumHashReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -7949,166 +11858,169 @@ inline void SyncFromZeroGetSumHashReq::set_allocated_msg_id(std::string* msg_id)
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashReq.msg_id)
 }
 
-// repeated uint64 heights = 3;
-inline int SyncFromZeroGetSumHashReq::_internal_heights_size() const {
-  return _impl_.heights_.size();
-}
-inline int SyncFromZeroGetSumHashReq::heights_size() const {
-  return _internal_heights_size();
-}
-inline void SyncFromZeroGetSumHashReq::clear_heights() {
-  _impl_.heights_.Clear();
-}
-inline uint64_t SyncFromZeroGetSumHashReq::_internal_heights(int index) const {
-  return _impl_.heights_.Get(index);
+// string self_node_id = 3;
+inline void GetCheckSumHashReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline uint64_t SyncFromZeroGetSumHashReq::heights(int index) const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashReq.heights)
-  return _internal_heights(index);
+inline const std::string& GetCheckSumHashReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashReq.self_node_id)
+  return _internal_self_node_id();
 }
-inline void SyncFromZeroGetSumHashReq::set_heights(int index, uint64_t value) {
-  _impl_.heights_.Set(index, value);
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashReq.heights)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCheckSumHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetCheckSumHashReq.self_node_id)
 }
-inline void SyncFromZeroGetSumHashReq::_internal_add_heights(uint64_t value) {
-  _impl_.heights_.Add(value);
+inline std::string* GetCheckSumHashReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:GetCheckSumHashReq.self_node_id)
+  return _s;
 }
-inline void SyncFromZeroGetSumHashReq::add_heights(uint64_t value) {
-  _internal_add_heights(value);
-  // @@protoc_insertion_point(field_add:SyncFromZeroGetSumHashReq.heights)
+inline const std::string& GetCheckSumHashReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-SyncFromZeroGetSumHashReq::_internal_heights() const {
-  return _impl_.heights_;
+inline void GetCheckSumHashReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-SyncFromZeroGetSumHashReq::heights() const {
-  // @@protoc_insertion_point(field_list:SyncFromZeroGetSumHashReq.heights)
-  return _internal_heights();
+inline std::string* GetCheckSumHashReq::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-SyncFromZeroGetSumHashReq::_internal_mutable_heights() {
-  return &_impl_.heights_;
+inline std::string* GetCheckSumHashReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:GetCheckSumHashReq.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-SyncFromZeroGetSumHashReq::mutable_heights() {
-  // @@protoc_insertion_point(field_mutable_list:SyncFromZeroGetSumHashReq.heights)
-  return _internal_mutable_heights();
+inline void GetCheckSumHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashReq.self_node_id)
 }
 
 // -------------------------------------------------------------------
 
-// SyncFromZeroGetSumHashAck
+// GetCheckSumHashAck
 
-// int32 code = 1;
-inline void SyncFromZeroGetSumHashAck::clear_code() {
-  _impl_.code_ = 0;
+// uint64 height = 1;
+inline void GetCheckSumHashAck::clear_height() {
+  _impl_.height_ = uint64_t{0u};
 }
-inline int32_t SyncFromZeroGetSumHashAck::_internal_code() const {
-  return _impl_.code_;
+inline uint64_t GetCheckSumHashAck::_internal_height() const {
+  return _impl_.height_;
 }
-inline int32_t SyncFromZeroGetSumHashAck::code() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.code)
-  return _internal_code();
+inline uint64_t GetCheckSumHashAck::height() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.height)
+  return _internal_height();
 }
-inline void SyncFromZeroGetSumHashAck::_internal_set_code(int32_t value) {
+inline void GetCheckSumHashAck::_internal_set_height(uint64_t value) {
   
-  _impl_.code_ = value;
+  _impl_.height_ = value;
 }
-inline void SyncFromZeroGetSumHashAck::set_code(int32_t value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashAck.code)
+inline void GetCheckSumHashAck::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.height)
 }
 
-// string self_node_id = 2;
-inline void SyncFromZeroGetSumHashAck::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// string hash = 2;
+inline void GetCheckSumHashAck::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
 }
-inline const std::string& SyncFromZeroGetSumHashAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.self_node_id)
-  return _internal_self_node_id();
+inline const std::string& GetCheckSumHashAck::hash() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.hash)
+  return _internal_hash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetSumHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void GetCheckSumHashAck::set_hash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashAck.self_node_id)
+ _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.hash)
 }
-inline std::string* SyncFromZeroGetSumHashAck::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashAck.self_node_id)
+inline std::string* GetCheckSumHashAck::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:GetCheckSumHashAck.hash)
   return _s;
 }
-inline const std::string& SyncFromZeroGetSumHashAck::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline const std::string& GetCheckSumHashAck::_internal_hash() const {
+  return _impl_.hash_.Get();
 }
-inline void SyncFromZeroGetSumHashAck::_internal_set_self_node_id(const std::string& value) {
+inline void GetCheckSumHashAck::_internal_set_hash(const std::string& value) {
   
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+  _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetSumHashAck::_internal_mutable_self_node_id() {
+inline std::string* GetCheckSumHashAck::_internal_mutable_hash() {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetSumHashAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashAck.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline std::string* GetCheckSumHashAck::release_hash() {
+  // @@protoc_insertion_point(field_release:GetCheckSumHashAck.hash)
+  return _impl_.hash_.Release();
 }
-inline void SyncFromZeroGetSumHashAck::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
+inline void GetCheckSumHashAck::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
     
   } else {
     
   }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashAck.hash)
 }
 
 // string msg_id = 3;
-inline void SyncFromZeroGetSumHashAck::clear_msg_id() {
+inline void GetCheckSumHashAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncFromZeroGetSumHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.msg_id)
+inline const std::string& GetCheckSumHashAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetSumHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void GetCheckSumHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.msg_id)
 }
-inline std::string* SyncFromZeroGetSumHashAck::mutable_msg_id() {
+inline std::string* GetCheckSumHashAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:GetCheckSumHashAck.msg_id)
   return _s;
 }
-inline const std::string& SyncFromZeroGetSumHashAck::_internal_msg_id() const {
+inline const std::string& GetCheckSumHashAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncFromZeroGetSumHashAck::_internal_set_msg_id(const std::string& value) {
+inline void GetCheckSumHashAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetSumHashAck::_internal_mutable_msg_id() {
+inline std::string* GetCheckSumHashAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetSumHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetSumHashAck.msg_id)
+inline std::string* GetCheckSumHashAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:GetCheckSumHashAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void SyncFromZeroGetSumHashAck::set_allocated_msg_id(std::string* msg_id) {
+inline void GetCheckSumHashAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -8120,512 +12032,418 @@ inline void SyncFromZeroGetSumHashAck::set_allocated_msg_id(std::string* msg_id)
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashAck.msg_id)
 }
 
-// repeated .SyncFromZeroSumHash sum_hashes = 4;
-inline int SyncFromZeroGetSumHashAck::_internal_sum_hashes_size() const {
-  return _impl_.sum_hashes_.size();
-}
-inline int SyncFromZeroGetSumHashAck::sum_hashes_size() const {
-  return _internal_sum_hashes_size();
-}
-inline void SyncFromZeroGetSumHashAck::clear_sum_hashes() {
-  _impl_.sum_hashes_.Clear();
-}
-inline ::SyncFromZeroSumHash* SyncFromZeroGetSumHashAck::mutable_sum_hashes(int index) {
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetSumHashAck.sum_hashes)
-  return _impl_.sum_hashes_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncFromZeroSumHash >*
-SyncFromZeroGetSumHashAck::mutable_sum_hashes() {
-  // @@protoc_insertion_point(field_mutable_list:SyncFromZeroGetSumHashAck.sum_hashes)
-  return &_impl_.sum_hashes_;
-}
-inline const ::SyncFromZeroSumHash& SyncFromZeroGetSumHashAck::_internal_sum_hashes(int index) const {
-  return _impl_.sum_hashes_.Get(index);
+// bool success = 4;
+inline void GetCheckSumHashAck::clear_success() {
+  _impl_.success_ = false;
 }
-inline const ::SyncFromZeroSumHash& SyncFromZeroGetSumHashAck::sum_hashes(int index) const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetSumHashAck.sum_hashes)
-  return _internal_sum_hashes(index);
+inline bool GetCheckSumHashAck::_internal_success() const {
+  return _impl_.success_;
 }
-inline ::SyncFromZeroSumHash* SyncFromZeroGetSumHashAck::_internal_add_sum_hashes() {
-  return _impl_.sum_hashes_.Add();
+inline bool GetCheckSumHashAck::success() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.success)
+  return _internal_success();
 }
-inline ::SyncFromZeroSumHash* SyncFromZeroGetSumHashAck::add_sum_hashes() {
-  ::SyncFromZeroSumHash* _add = _internal_add_sum_hashes();
-  // @@protoc_insertion_point(field_add:SyncFromZeroGetSumHashAck.sum_hashes)
-  return _add;
+inline void GetCheckSumHashAck::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncFromZeroSumHash >&
-SyncFromZeroGetSumHashAck::sum_hashes() const {
-  // @@protoc_insertion_point(field_list:SyncFromZeroGetSumHashAck.sum_hashes)
-  return _impl_.sum_hashes_;
+inline void GetCheckSumHashAck::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.success)
 }
 
-// -------------------------------------------------------------------
-
-// SyncFromZeroGetBlockReq
-
-// string self_node_id = 1;
-inline void SyncFromZeroGetBlockReq::clear_self_node_id() {
+// string self_node_id = 5;
+inline void GetCheckSumHashAck::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& SyncFromZeroGetBlockReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockReq.self_node_id)
+inline const std::string& GetCheckSumHashAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetBlockReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void GetCheckSumHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockReq.self_node_id)
+  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.self_node_id)
 }
-inline std::string* SyncFromZeroGetBlockReq::mutable_self_node_id() {
+inline std::string* GetCheckSumHashAck::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockReq.self_node_id)
+  // @@protoc_insertion_point(field_mutable:GetCheckSumHashAck.self_node_id)
   return _s;
 }
-inline const std::string& SyncFromZeroGetBlockReq::_internal_self_node_id() const {
+inline const std::string& GetCheckSumHashAck::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void SyncFromZeroGetBlockReq::_internal_set_self_node_id(const std::string& value) {
+inline void GetCheckSumHashAck::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetBlockReq::_internal_mutable_self_node_id() {
+inline std::string* GetCheckSumHashAck::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetBlockReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockReq.self_node_id)
-  return _impl_.self_node_id_.Release();
-}
-inline void SyncFromZeroGetBlockReq::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockReq.self_node_id)
-}
-
-// string msg_id = 2;
-inline void SyncFromZeroGetBlockReq::clear_msg_id() {
-  _impl_.msg_id_.ClearToEmpty();
-}
-inline const std::string& SyncFromZeroGetBlockReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockReq.msg_id)
-  return _internal_msg_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetBlockReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockReq.msg_id)
-}
-inline std::string* SyncFromZeroGetBlockReq::mutable_msg_id() {
-  std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockReq.msg_id)
-  return _s;
-}
-inline const std::string& SyncFromZeroGetBlockReq::_internal_msg_id() const {
-  return _impl_.msg_id_.Get();
-}
-inline void SyncFromZeroGetBlockReq::_internal_set_msg_id(const std::string& value) {
-  
-  _impl_.msg_id_.Set(value, GetArenaForAllocation());
-}
-inline std::string* SyncFromZeroGetBlockReq::_internal_mutable_msg_id() {
-  
-  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
-}
-inline std::string* SyncFromZeroGetBlockReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockReq.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* GetCheckSumHashAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:GetCheckSumHashAck.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void SyncFromZeroGetBlockReq::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
+inline void GetCheckSumHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
     
   } else {
     
   }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashAck.self_node_id)
 }
 
-// uint64 height = 3;
-inline void SyncFromZeroGetBlockReq::clear_height() {
+// -------------------------------------------------------------------
+
+// SyncBlockSummary
+
+// uint64 height = 1;
+inline void SyncBlockSummary::clear_height() {
   _impl_.height_ = uint64_t{0u};
 }
-inline uint64_t SyncFromZeroGetBlockReq::_internal_height() const {
+inline uint64_t SyncBlockSummary::_internal_height() const {
   return _impl_.height_;
 }
-inline uint64_t SyncFromZeroGetBlockReq::height() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockReq.height)
+inline uint64_t SyncBlockSummary::height() const {
+  // @@protoc_insertion_point(field_get:SyncBlockSummary.height)
   return _internal_height();
 }
-inline void SyncFromZeroGetBlockReq::_internal_set_height(uint64_t value) {
+inline void SyncBlockSummary::_internal_set_height(uint64_t value) {
   
   _impl_.height_ = value;
 }
-inline void SyncFromZeroGetBlockReq::set_height(uint64_t value) {
+inline void SyncBlockSummary::set_height(uint64_t value) {
   _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockReq.height)
+  // @@protoc_insertion_point(field_set:SyncBlockSummary.height)
 }
 
-// -------------------------------------------------------------------
-
-// SyncFromZeroGetBlockAck
-
-// string self_node_id = 1;
-inline void SyncFromZeroGetBlockAck::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// string hash = 2;
+inline void SyncBlockSummary::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
 }
-inline const std::string& SyncFromZeroGetBlockAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.self_node_id)
-  return _internal_self_node_id();
+inline const std::string& SyncBlockSummary::hash() const {
+  // @@protoc_insertion_point(field_get:SyncBlockSummary.hash)
+  return _internal_hash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetBlockAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncBlockSummary::set_hash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.self_node_id)
+ _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncBlockSummary.hash)
 }
-inline std::string* SyncFromZeroGetBlockAck::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockAck.self_node_id)
+inline std::string* SyncBlockSummary::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:SyncBlockSummary.hash)
   return _s;
 }
-inline const std::string& SyncFromZeroGetBlockAck::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline const std::string& SyncBlockSummary::_internal_hash() const {
+  return _impl_.hash_.Get();
 }
-inline void SyncFromZeroGetBlockAck::_internal_set_self_node_id(const std::string& value) {
+inline void SyncBlockSummary::_internal_set_hash(const std::string& value) {
   
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+  _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetBlockAck::_internal_mutable_self_node_id() {
+inline std::string* SyncBlockSummary::_internal_mutable_hash() {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetBlockAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockAck.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline std::string* SyncBlockSummary::release_hash() {
+  // @@protoc_insertion_point(field_release:SyncBlockSummary.hash)
+  return _impl_.hash_.Release();
 }
-inline void SyncFromZeroGetBlockAck::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
+inline void SyncBlockSummary::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
     
   } else {
     
   }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncBlockSummary.hash)
 }
 
-// string msg_id = 2;
-inline void SyncFromZeroGetBlockAck::clear_msg_id() {
-  _impl_.msg_id_.ClearToEmpty();
+// string prev_hash = 3;
+inline void SyncBlockSummary::clear_prev_hash() {
+  _impl_.prev_hash_.ClearToEmpty();
 }
-inline const std::string& SyncFromZeroGetBlockAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.msg_id)
-  return _internal_msg_id();
+inline const std::string& SyncBlockSummary::prev_hash() const {
+  // @@protoc_insertion_point(field_get:SyncBlockSummary.prev_hash)
+  return _internal_prev_hash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncFromZeroGetBlockAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncBlockSummary::set_prev_hash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.msg_id)
+ _impl_.prev_hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncBlockSummary.prev_hash)
 }
-inline std::string* SyncFromZeroGetBlockAck::mutable_msg_id() {
-  std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockAck.msg_id)
+inline std::string* SyncBlockSummary::mutable_prev_hash() {
+  std::string* _s = _internal_mutable_prev_hash();
+  // @@protoc_insertion_point(field_mutable:SyncBlockSummary.prev_hash)
   return _s;
 }
-inline const std::string& SyncFromZeroGetBlockAck::_internal_msg_id() const {
-  return _impl_.msg_id_.Get();
+inline const std::string& SyncBlockSummary::_internal_prev_hash() const {
+  return _impl_.prev_hash_.Get();
 }
-inline void SyncFromZeroGetBlockAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncBlockSummary::_internal_set_prev_hash(const std::string& value) {
   
-  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+  _impl_.prev_hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetBlockAck::_internal_mutable_msg_id() {
+inline std::string* SyncBlockSummary::_internal_mutable_prev_hash() {
   
-  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+  return _impl_.prev_hash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncFromZeroGetBlockAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncFromZeroGetBlockAck.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* SyncBlockSummary::release_prev_hash() {
+  // @@protoc_insertion_point(field_release:SyncBlockSummary.prev_hash)
+  return _impl_.prev_hash_.Release();
 }
-inline void SyncFromZeroGetBlockAck::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
+inline void SyncBlockSummary::set_allocated_prev_hash(std::string* prev_hash) {
+  if (prev_hash != nullptr) {
     
   } else {
     
   }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+  _impl_.prev_hash_.SetAllocated(prev_hash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  if (_impl_.prev_hash_.IsDefault()) {
+    _impl_.prev_hash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncFromZeroGetBlockAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncBlockSummary.prev_hash)
 }
 
-// uint64 height = 3;
-inline void SyncFromZeroGetBlockAck::clear_height() {
-  _impl_.height_ = uint64_t{0u};
+// string merkle_root = 4;
+inline void SyncBlockSummary::clear_merkle_root() {
+  _impl_.merkle_root_.ClearToEmpty();
 }
-inline uint64_t SyncFromZeroGetBlockAck::_internal_height() const {
-  return _impl_.height_;
+inline const std::string& SyncBlockSummary::merkle_root() const {
+  // @@protoc_insertion_point(field_get:SyncBlockSummary.merkle_root)
+  return _internal_merkle_root();
 }
-inline uint64_t SyncFromZeroGetBlockAck::height() const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.height)
-  return _internal_height();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncBlockSummary::set_merkle_root(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.merkle_root_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncBlockSummary.merkle_root)
 }
-inline void SyncFromZeroGetBlockAck::_internal_set_height(uint64_t value) {
+inline std::string* SyncBlockSummary::mutable_merkle_root() {
+  std::string* _s = _internal_mutable_merkle_root();
+  // @@protoc_insertion_point(field_mutable:SyncBlockSummary.merkle_root)
+  return _s;
+}
+inline const std::string& SyncBlockSummary::_internal_merkle_root() const {
+  return _impl_.merkle_root_.Get();
+}
+inline void SyncBlockSummary::_internal_set_merkle_root(const std::string& value) {
   
-  _impl_.height_ = value;
+  _impl_.merkle_root_.Set(value, GetArenaForAllocation());
 }
-inline void SyncFromZeroGetBlockAck::set_height(uint64_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.height)
+inline std::string* SyncBlockSummary::_internal_mutable_merkle_root() {
+  
+  return _impl_.merkle_root_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncBlockSummary::release_merkle_root() {
+  // @@protoc_insertion_point(field_release:SyncBlockSummary.merkle_root)
+  return _impl_.merkle_root_.Release();
+}
+inline void SyncBlockSummary::set_allocated_merkle_root(std::string* merkle_root) {
+  if (merkle_root != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.merkle_root_.SetAllocated(merkle_root, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.merkle_root_.IsDefault()) {
+    _impl_.merkle_root_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncBlockSummary.merkle_root)
 }
 
-// repeated bytes blocks = 4;
-inline int SyncFromZeroGetBlockAck::_internal_blocks_size() const {
-  return _impl_.blocks_.size();
+// repeated bytes signers = 5;
+inline int SyncBlockSummary::_internal_signers_size() const {
+  return _impl_.signers_.size();
 }
-inline int SyncFromZeroGetBlockAck::blocks_size() const {
-  return _internal_blocks_size();
+inline int SyncBlockSummary::signers_size() const {
+  return _internal_signers_size();
 }
-inline void SyncFromZeroGetBlockAck::clear_blocks() {
-  _impl_.blocks_.Clear();
+inline void SyncBlockSummary::clear_signers() {
+  _impl_.signers_.Clear();
 }
-inline std::string* SyncFromZeroGetBlockAck::add_blocks() {
-  std::string* _s = _internal_add_blocks();
-  // @@protoc_insertion_point(field_add_mutable:SyncFromZeroGetBlockAck.blocks)
+inline std::string* SyncBlockSummary::add_signers() {
+  std::string* _s = _internal_add_signers();
+  // @@protoc_insertion_point(field_add_mutable:SyncBlockSummary.signers)
   return _s;
 }
-inline const std::string& SyncFromZeroGetBlockAck::_internal_blocks(int index) const {
-  return _impl_.blocks_.Get(index);
+inline const std::string& SyncBlockSummary::_internal_signers(int index) const {
+  return _impl_.signers_.Get(index);
 }
-inline const std::string& SyncFromZeroGetBlockAck::blocks(int index) const {
-  // @@protoc_insertion_point(field_get:SyncFromZeroGetBlockAck.blocks)
-  return _internal_blocks(index);
+inline const std::string& SyncBlockSummary::signers(int index) const {
+  // @@protoc_insertion_point(field_get:SyncBlockSummary.signers)
+  return _internal_signers(index);
 }
-inline std::string* SyncFromZeroGetBlockAck::mutable_blocks(int index) {
-  // @@protoc_insertion_point(field_mutable:SyncFromZeroGetBlockAck.blocks)
-  return _impl_.blocks_.Mutable(index);
+inline std::string* SyncBlockSummary::mutable_signers(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncBlockSummary.signers)
+  return _impl_.signers_.Mutable(index);
 }
-inline void SyncFromZeroGetBlockAck::set_blocks(int index, const std::string& value) {
-  _impl_.blocks_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.blocks)
+inline void SyncBlockSummary::set_signers(int index, const std::string& value) {
+  _impl_.signers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SyncBlockSummary.signers)
 }
-inline void SyncFromZeroGetBlockAck::set_blocks(int index, std::string&& value) {
-  _impl_.blocks_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:SyncFromZeroGetBlockAck.blocks)
+inline void SyncBlockSummary::set_signers(int index, std::string&& value) {
+  _impl_.signers_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SyncBlockSummary.signers)
 }
-inline void SyncFromZeroGetBlockAck::set_blocks(int index, const char* value) {
+inline void SyncBlockSummary::set_signers(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocks_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:SyncFromZeroGetBlockAck.blocks)
+  _impl_.signers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SyncBlockSummary.signers)
 }
-inline void SyncFromZeroGetBlockAck::set_blocks(int index, const void* value, size_t size) {
-  _impl_.blocks_.Mutable(index)->assign(
+inline void SyncBlockSummary::set_signers(int index, const void* value, size_t size) {
+  _impl_.signers_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:SyncFromZeroGetBlockAck.blocks)
+  // @@protoc_insertion_point(field_set_pointer:SyncBlockSummary.signers)
 }
-inline std::string* SyncFromZeroGetBlockAck::_internal_add_blocks() {
-  return _impl_.blocks_.Add();
+inline std::string* SyncBlockSummary::_internal_add_signers() {
+  return _impl_.signers_.Add();
 }
-inline void SyncFromZeroGetBlockAck::add_blocks(const std::string& value) {
-  _impl_.blocks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:SyncFromZeroGetBlockAck.blocks)
+inline void SyncBlockSummary::add_signers(const std::string& value) {
+  _impl_.signers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SyncBlockSummary.signers)
 }
-inline void SyncFromZeroGetBlockAck::add_blocks(std::string&& value) {
-  _impl_.blocks_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:SyncFromZeroGetBlockAck.blocks)
+inline void SyncBlockSummary::add_signers(std::string&& value) {
+  _impl_.signers_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SyncBlockSummary.signers)
 }
-inline void SyncFromZeroGetBlockAck::add_blocks(const char* value) {
+inline void SyncBlockSummary::add_signers(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _impl_.blocks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:SyncFromZeroGetBlockAck.blocks)
+  _impl_.signers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SyncBlockSummary.signers)
 }
-inline void SyncFromZeroGetBlockAck::add_blocks(const void* value, size_t size) {
-  _impl_.blocks_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:SyncFromZeroGetBlockAck.blocks)
+inline void SyncBlockSummary::add_signers(const void* value, size_t size) {
+  _impl_.signers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SyncBlockSummary.signers)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-SyncFromZeroGetBlockAck::blocks() const {
-  // @@protoc_insertion_point(field_list:SyncFromZeroGetBlockAck.blocks)
-  return _impl_.blocks_;
+SyncBlockSummary::signers() const {
+  // @@protoc_insertion_point(field_list:SyncBlockSummary.signers)
+  return _impl_.signers_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-SyncFromZeroGetBlockAck::mutable_blocks() {
-  // @@protoc_insertion_point(field_mutable_list:SyncFromZeroGetBlockAck.blocks)
-  return &_impl_.blocks_;
+SyncBlockSummary::mutable_signers() {
+  // @@protoc_insertion_point(field_mutable_list:SyncBlockSummary.signers)
+  return &_impl_.signers_;
 }
 
 // -------------------------------------------------------------------
 
-// GetBlockByUtxoReq
-
-// string addr = 1;
-inline void GetBlockByUtxoReq::clear_addr() {
-  _impl_.addr_.ClearToEmpty();
-}
-inline const std::string& GetBlockByUtxoReq::addr() const {
-  // @@protoc_insertion_point(field_get:GetBlockByUtxoReq.addr)
-  return _internal_addr();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByUtxoReq::set_addr(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByUtxoReq.addr)
-}
-inline std::string* GetBlockByUtxoReq::mutable_addr() {
-  std::string* _s = _internal_mutable_addr();
-  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoReq.addr)
-  return _s;
-}
-inline const std::string& GetBlockByUtxoReq::_internal_addr() const {
-  return _impl_.addr_.Get();
-}
-inline void GetBlockByUtxoReq::_internal_set_addr(const std::string& value) {
-  
-  _impl_.addr_.Set(value, GetArenaForAllocation());
-}
-inline std::string* GetBlockByUtxoReq::_internal_mutable_addr() {
-  
-  return _impl_.addr_.Mutable(GetArenaForAllocation());
-}
-inline std::string* GetBlockByUtxoReq::release_addr() {
-  // @@protoc_insertion_point(field_release:GetBlockByUtxoReq.addr)
-  return _impl_.addr_.Release();
-}
-inline void GetBlockByUtxoReq::set_allocated_addr(std::string* addr) {
-  if (addr != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.addr_.IsDefault()) {
-    _impl_.addr_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoReq.addr)
-}
+// SyncGetBlockSummaryReq
 
-// string utxo = 2;
-inline void GetBlockByUtxoReq::clear_utxo() {
-  _impl_.utxo_.ClearToEmpty();
+// string self_node_id = 1;
+inline void SyncGetBlockSummaryReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& GetBlockByUtxoReq::utxo() const {
-  // @@protoc_insertion_point(field_get:GetBlockByUtxoReq.utxo)
-  return _internal_utxo();
+inline const std::string& SyncGetBlockSummaryReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryReq.self_node_id)
+  return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByUtxoReq::set_utxo(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockSummaryReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.utxo_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByUtxoReq.utxo)
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetBlockSummaryReq.self_node_id)
 }
-inline std::string* GetBlockByUtxoReq::mutable_utxo() {
-  std::string* _s = _internal_mutable_utxo();
-  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoReq.utxo)
+inline std::string* SyncGetBlockSummaryReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockSummaryReq.self_node_id)
   return _s;
 }
-inline const std::string& GetBlockByUtxoReq::_internal_utxo() const {
-  return _impl_.utxo_.Get();
+inline const std::string& SyncGetBlockSummaryReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline void GetBlockByUtxoReq::_internal_set_utxo(const std::string& value) {
+inline void SyncGetBlockSummaryReq::_internal_set_self_node_id(const std::string& value) {
   
-  _impl_.utxo_.Set(value, GetArenaForAllocation());
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoReq::_internal_mutable_utxo() {
+inline std::string* SyncGetBlockSummaryReq::_internal_mutable_self_node_id() {
   
-  return _impl_.utxo_.Mutable(GetArenaForAllocation());
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoReq::release_utxo() {
-  // @@protoc_insertion_point(field_release:GetBlockByUtxoReq.utxo)
-  return _impl_.utxo_.Release();
+inline std::string* SyncGetBlockSummaryReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockSummaryReq.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void GetBlockByUtxoReq::set_allocated_utxo(std::string* utxo) {
-  if (utxo != nullptr) {
+inline void SyncGetBlockSummaryReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
     
   } else {
     
   }
-  _impl_.utxo_.SetAllocated(utxo, GetArenaForAllocation());
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.utxo_.IsDefault()) {
-    _impl_.utxo_.Set("", GetArenaForAllocation());
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoReq.utxo)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockSummaryReq.self_node_id)
 }
 
-// string msg_id = 3;
-inline void GetBlockByUtxoReq::clear_msg_id() {
+// string msg_id = 2;
+inline void SyncGetBlockSummaryReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& GetBlockByUtxoReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:GetBlockByUtxoReq.msg_id)
+inline const std::string& SyncGetBlockSummaryReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByUtxoReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockSummaryReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByUtxoReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetBlockSummaryReq.msg_id)
 }
-inline std::string* GetBlockByUtxoReq::mutable_msg_id() {
+inline std::string* SyncGetBlockSummaryReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockSummaryReq.msg_id)
   return _s;
 }
-inline const std::string& GetBlockByUtxoReq::_internal_msg_id() const {
+inline const std::string& SyncGetBlockSummaryReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void GetBlockByUtxoReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetBlockSummaryReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoReq::_internal_mutable_msg_id() {
+inline std::string* SyncGetBlockSummaryReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:GetBlockByUtxoReq.msg_id)
+inline std::string* SyncGetBlockSummaryReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockSummaryReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void GetBlockByUtxoReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetBlockSummaryReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -8637,149 +12455,139 @@ inline void GetBlockByUtxoReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockSummaryReq.msg_id)
 }
 
-// -------------------------------------------------------------------
-
-// GetBlockByUtxoAck
-
-// string addr = 1;
-inline void GetBlockByUtxoAck::clear_addr() {
-  _impl_.addr_.ClearToEmpty();
+// uint64 start_height = 3;
+inline void SyncGetBlockSummaryReq::clear_start_height() {
+  _impl_.start_height_ = uint64_t{0u};
 }
-inline const std::string& GetBlockByUtxoAck::addr() const {
-  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.addr)
-  return _internal_addr();
+inline uint64_t SyncGetBlockSummaryReq::_internal_start_height() const {
+  return _impl_.start_height_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByUtxoAck::set_addr(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.addr)
+inline uint64_t SyncGetBlockSummaryReq::start_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryReq.start_height)
+  return _internal_start_height();
 }
-inline std::string* GetBlockByUtxoAck::mutable_addr() {
-  std::string* _s = _internal_mutable_addr();
-  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.addr)
-  return _s;
+inline void SyncGetBlockSummaryReq::_internal_set_start_height(uint64_t value) {
+  
+  _impl_.start_height_ = value;
 }
-inline const std::string& GetBlockByUtxoAck::_internal_addr() const {
-  return _impl_.addr_.Get();
+inline void SyncGetBlockSummaryReq::set_start_height(uint64_t value) {
+  _internal_set_start_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetBlockSummaryReq.start_height)
 }
-inline void GetBlockByUtxoAck::_internal_set_addr(const std::string& value) {
-  
-  _impl_.addr_.Set(value, GetArenaForAllocation());
+
+// uint64 end_height = 4;
+inline void SyncGetBlockSummaryReq::clear_end_height() {
+  _impl_.end_height_ = uint64_t{0u};
 }
-inline std::string* GetBlockByUtxoAck::_internal_mutable_addr() {
-  
-  return _impl_.addr_.Mutable(GetArenaForAllocation());
+inline uint64_t SyncGetBlockSummaryReq::_internal_end_height() const {
+  return _impl_.end_height_;
 }
-inline std::string* GetBlockByUtxoAck::release_addr() {
-  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.addr)
-  return _impl_.addr_.Release();
+inline uint64_t SyncGetBlockSummaryReq::end_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryReq.end_height)
+  return _internal_end_height();
 }
-inline void GetBlockByUtxoAck::set_allocated_addr(std::string* addr) {
-  if (addr != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.addr_.IsDefault()) {
-    _impl_.addr_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.addr)
+inline void SyncGetBlockSummaryReq::_internal_set_end_height(uint64_t value) {
+  
+  _impl_.end_height_ = value;
+}
+inline void SyncGetBlockSummaryReq::set_end_height(uint64_t value) {
+  _internal_set_end_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetBlockSummaryReq.end_height)
 }
 
-// string utxo = 2;
-inline void GetBlockByUtxoAck::clear_utxo() {
-  _impl_.utxo_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// SyncGetBlockSummaryAck
+
+// string self_node_id = 1;
+inline void SyncGetBlockSummaryAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& GetBlockByUtxoAck::utxo() const {
-  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.utxo)
-  return _internal_utxo();
+inline const std::string& SyncGetBlockSummaryAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryAck.self_node_id)
+  return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByUtxoAck::set_utxo(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockSummaryAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.utxo_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.utxo)
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetBlockSummaryAck.self_node_id)
 }
-inline std::string* GetBlockByUtxoAck::mutable_utxo() {
-  std::string* _s = _internal_mutable_utxo();
-  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.utxo)
+inline std::string* SyncGetBlockSummaryAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockSummaryAck.self_node_id)
   return _s;
 }
-inline const std::string& GetBlockByUtxoAck::_internal_utxo() const {
-  return _impl_.utxo_.Get();
+inline const std::string& SyncGetBlockSummaryAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline void GetBlockByUtxoAck::_internal_set_utxo(const std::string& value) {
+inline void SyncGetBlockSummaryAck::_internal_set_self_node_id(const std::string& value) {
   
-  _impl_.utxo_.Set(value, GetArenaForAllocation());
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoAck::_internal_mutable_utxo() {
+inline std::string* SyncGetBlockSummaryAck::_internal_mutable_self_node_id() {
   
-  return _impl_.utxo_.Mutable(GetArenaForAllocation());
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoAck::release_utxo() {
-  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.utxo)
-  return _impl_.utxo_.Release();
+inline std::string* SyncGetBlockSummaryAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockSummaryAck.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void GetBlockByUtxoAck::set_allocated_utxo(std::string* utxo) {
-  if (utxo != nullptr) {
+inline void SyncGetBlockSummaryAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
     
   } else {
     
   }
-  _impl_.utxo_.SetAllocated(utxo, GetArenaForAllocation());
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.utxo_.IsDefault()) {
-    _impl_.utxo_.Set("", GetArenaForAllocation());
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.utxo)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockSummaryAck.self_node_id)
 }
 
-// string msg_id = 3;
-inline void GetBlockByUtxoAck::clear_msg_id() {
+// string msg_id = 2;
+inline void SyncGetBlockSummaryAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& GetBlockByUtxoAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.msg_id)
+inline const std::string& SyncGetBlockSummaryAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByUtxoAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetBlockSummaryAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetBlockSummaryAck.msg_id)
 }
-inline std::string* GetBlockByUtxoAck::mutable_msg_id() {
+inline std::string* SyncGetBlockSummaryAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockSummaryAck.msg_id)
   return _s;
 }
-inline const std::string& GetBlockByUtxoAck::_internal_msg_id() const {
+inline const std::string& SyncGetBlockSummaryAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void GetBlockByUtxoAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetBlockSummaryAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoAck::_internal_mutable_msg_id() {
+inline std::string* SyncGetBlockSummaryAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.msg_id)
+inline std::string* SyncGetBlockSummaryAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetBlockSummaryAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void GetBlockByUtxoAck::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetBlockSummaryAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -8791,313 +12599,437 @@ inline void GetBlockByUtxoAck::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetBlockSummaryAck.msg_id)
 }
 
-// bytes block_raw = 4;
-inline void GetBlockByUtxoAck::clear_block_raw() {
-  _impl_.block_raw_.ClearToEmpty();
+// uint64 node_block_height = 3;
+inline void SyncGetBlockSummaryAck::clear_node_block_height() {
+  _impl_.node_block_height_ = uint64_t{0u};
 }
-inline const std::string& GetBlockByUtxoAck::block_raw() const {
-  // @@protoc_insertion_point(field_get:GetBlockByUtxoAck.block_raw)
-  return _internal_block_raw();
+inline uint64_t SyncGetBlockSummaryAck::_internal_node_block_height() const {
+  return _impl_.node_block_height_;
+}
+inline uint64_t SyncGetBlockSummaryAck::node_block_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryAck.node_block_height)
+  return _internal_node_block_height();
+}
+inline void SyncGetBlockSummaryAck::_internal_set_node_block_height(uint64_t value) {
+  
+  _impl_.node_block_height_ = value;
+}
+inline void SyncGetBlockSummaryAck::set_node_block_height(uint64_t value) {
+  _internal_set_node_block_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetBlockSummaryAck.node_block_height)
+}
+
+// repeated .SyncBlockSummary summaries = 4;
+inline int SyncGetBlockSummaryAck::_internal_summaries_size() const {
+  return _impl_.summaries_.size();
+}
+inline int SyncGetBlockSummaryAck::summaries_size() const {
+  return _internal_summaries_size();
+}
+inline void SyncGetBlockSummaryAck::clear_summaries() {
+  _impl_.summaries_.Clear();
+}
+inline ::SyncBlockSummary* SyncGetBlockSummaryAck::mutable_summaries(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncGetBlockSummaryAck.summaries)
+  return _impl_.summaries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncBlockSummary >*
+SyncGetBlockSummaryAck::mutable_summaries() {
+  // @@protoc_insertion_point(field_mutable_list:SyncGetBlockSummaryAck.summaries)
+  return &_impl_.summaries_;
+}
+inline const ::SyncBlockSummary& SyncGetBlockSummaryAck::_internal_summaries(int index) const {
+  return _impl_.summaries_.Get(index);
+}
+inline const ::SyncBlockSummary& SyncGetBlockSummaryAck::summaries(int index) const {
+  // @@protoc_insertion_point(field_get:SyncGetBlockSummaryAck.summaries)
+  return _internal_summaries(index);
+}
+inline ::SyncBlockSummary* SyncGetBlockSummaryAck::_internal_add_summaries() {
+  return _impl_.summaries_.Add();
+}
+inline ::SyncBlockSummary* SyncGetBlockSummaryAck::add_summaries() {
+  ::SyncBlockSummary* _add = _internal_add_summaries();
+  // @@protoc_insertion_point(field_add:SyncGetBlockSummaryAck.summaries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncBlockSummary >&
+SyncGetBlockSummaryAck::summaries() const {
+  // @@protoc_insertion_point(field_list:SyncGetBlockSummaryAck.summaries)
+  return _impl_.summaries_;
+}
+
+// -------------------------------------------------------------------
+
+// SyncSumTreeNode
+
+// uint64 index = 1;
+inline void SyncSumTreeNode::clear_index() {
+  _impl_.index_ = uint64_t{0u};
+}
+inline uint64_t SyncSumTreeNode::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint64_t SyncSumTreeNode::index() const {
+  // @@protoc_insertion_point(field_get:SyncSumTreeNode.index)
+  return _internal_index();
+}
+inline void SyncSumTreeNode::_internal_set_index(uint64_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void SyncSumTreeNode::set_index(uint64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:SyncSumTreeNode.index)
+}
+
+// string hash = 2;
+inline void SyncSumTreeNode::clear_hash() {
+  _impl_.hash_.ClearToEmpty();
+}
+inline const std::string& SyncSumTreeNode::hash() const {
+  // @@protoc_insertion_point(field_get:SyncSumTreeNode.hash)
+  return _internal_hash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByUtxoAck::set_block_raw(ArgT0&& arg0, ArgT... args) {
+void SyncSumTreeNode::set_hash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.block_raw_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByUtxoAck.block_raw)
+ _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncSumTreeNode.hash)
 }
-inline std::string* GetBlockByUtxoAck::mutable_block_raw() {
-  std::string* _s = _internal_mutable_block_raw();
-  // @@protoc_insertion_point(field_mutable:GetBlockByUtxoAck.block_raw)
+inline std::string* SyncSumTreeNode::mutable_hash() {
+  std::string* _s = _internal_mutable_hash();
+  // @@protoc_insertion_point(field_mutable:SyncSumTreeNode.hash)
   return _s;
 }
-inline const std::string& GetBlockByUtxoAck::_internal_block_raw() const {
-  return _impl_.block_raw_.Get();
+inline const std::string& SyncSumTreeNode::_internal_hash() const {
+  return _impl_.hash_.Get();
 }
-inline void GetBlockByUtxoAck::_internal_set_block_raw(const std::string& value) {
+inline void SyncSumTreeNode::_internal_set_hash(const std::string& value) {
   
-  _impl_.block_raw_.Set(value, GetArenaForAllocation());
+  _impl_.hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoAck::_internal_mutable_block_raw() {
+inline std::string* SyncSumTreeNode::_internal_mutable_hash() {
   
-  return _impl_.block_raw_.Mutable(GetArenaForAllocation());
+  return _impl_.hash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByUtxoAck::release_block_raw() {
-  // @@protoc_insertion_point(field_release:GetBlockByUtxoAck.block_raw)
-  return _impl_.block_raw_.Release();
+inline std::string* SyncSumTreeNode::release_hash() {
+  // @@protoc_insertion_point(field_release:SyncSumTreeNode.hash)
+  return _impl_.hash_.Release();
 }
-inline void GetBlockByUtxoAck::set_allocated_block_raw(std::string* block_raw) {
-  if (block_raw != nullptr) {
+inline void SyncSumTreeNode::set_allocated_hash(std::string* hash) {
+  if (hash != nullptr) {
     
   } else {
     
   }
-  _impl_.block_raw_.SetAllocated(block_raw, GetArenaForAllocation());
+  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.block_raw_.IsDefault()) {
-    _impl_.block_raw_.Set("", GetArenaForAllocation());
+  if (_impl_.hash_.IsDefault()) {
+    _impl_.hash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByUtxoAck.block_raw)
+  // @@protoc_insertion_point(field_set_allocated:SyncSumTreeNode.hash)
 }
 
 // -------------------------------------------------------------------
 
-// HashType
+// SyncGetSumTreeReq
+
+// string self_node_id = 1;
+inline void SyncGetSumTreeReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetSumTreeReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeReq.self_node_id)
+  return _internal_self_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncGetSumTreeReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeReq.self_node_id)
+}
+inline std::string* SyncGetSumTreeReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSumTreeReq.self_node_id)
+  return _s;
+}
+inline const std::string& SyncGetSumTreeReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
+}
+inline void SyncGetSumTreeReq::_internal_set_self_node_id(const std::string& value) {
+  
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncGetSumTreeReq::_internal_mutable_self_node_id() {
+  
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncGetSumTreeReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumTreeReq.self_node_id)
+  return _impl_.self_node_id_.Release();
+}
+inline void SyncGetSumTreeReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumTreeReq.self_node_id)
+}
 
-// string hash = 1;
-inline void HashType::clear_hash() {
-  _impl_.hash_.ClearToEmpty();
+// string msg_id = 2;
+inline void SyncGetSumTreeReq::clear_msg_id() {
+  _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& HashType::hash() const {
-  // @@protoc_insertion_point(field_get:HashType.hash)
-  return _internal_hash();
+inline const std::string& SyncGetSumTreeReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeReq.msg_id)
+  return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void HashType::set_hash(ArgT0&& arg0, ArgT... args) {
+void SyncGetSumTreeReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:HashType.hash)
+ _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeReq.msg_id)
 }
-inline std::string* HashType::mutable_hash() {
-  std::string* _s = _internal_mutable_hash();
-  // @@protoc_insertion_point(field_mutable:HashType.hash)
+inline std::string* SyncGetSumTreeReq::mutable_msg_id() {
+  std::string* _s = _internal_mutable_msg_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSumTreeReq.msg_id)
   return _s;
 }
-inline const std::string& HashType::_internal_hash() const {
-  return _impl_.hash_.Get();
+inline const std::string& SyncGetSumTreeReq::_internal_msg_id() const {
+  return _impl_.msg_id_.Get();
 }
-inline void HashType::_internal_set_hash(const std::string& value) {
+inline void SyncGetSumTreeReq::_internal_set_msg_id(const std::string& value) {
   
-  _impl_.hash_.Set(value, GetArenaForAllocation());
+  _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* HashType::_internal_mutable_hash() {
+inline std::string* SyncGetSumTreeReq::_internal_mutable_msg_id() {
   
-  return _impl_.hash_.Mutable(GetArenaForAllocation());
+  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* HashType::release_hash() {
-  // @@protoc_insertion_point(field_release:HashType.hash)
-  return _impl_.hash_.Release();
+inline std::string* SyncGetSumTreeReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumTreeReq.msg_id)
+  return _impl_.msg_id_.Release();
 }
-inline void HashType::set_allocated_hash(std::string* hash) {
-  if (hash != nullptr) {
+inline void SyncGetSumTreeReq::set_allocated_msg_id(std::string* msg_id) {
+  if (msg_id != nullptr) {
     
   } else {
     
   }
-  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.hash_.IsDefault()) {
-    _impl_.hash_.Set("", GetArenaForAllocation());
+  if (_impl_.msg_id_.IsDefault()) {
+    _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:HashType.hash)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumTreeReq.msg_id)
 }
 
-// bool tx_or_block = 2;
-inline void HashType::clear_tx_or_block() {
-  _impl_.tx_or_block_ = false;
+// uint32 level = 3;
+inline void SyncGetSumTreeReq::clear_level() {
+  _impl_.level_ = 0u;
 }
-inline bool HashType::_internal_tx_or_block() const {
-  return _impl_.tx_or_block_;
+inline uint32_t SyncGetSumTreeReq::_internal_level() const {
+  return _impl_.level_;
 }
-inline bool HashType::tx_or_block() const {
-  // @@protoc_insertion_point(field_get:HashType.tx_or_block)
-  return _internal_tx_or_block();
+inline uint32_t SyncGetSumTreeReq::level() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeReq.level)
+  return _internal_level();
 }
-inline void HashType::_internal_set_tx_or_block(bool value) {
+inline void SyncGetSumTreeReq::_internal_set_level(uint32_t value) {
   
-  _impl_.tx_or_block_ = value;
+  _impl_.level_ = value;
 }
-inline void HashType::set_tx_or_block(bool value) {
-  _internal_set_tx_or_block(value);
-  // @@protoc_insertion_point(field_set:HashType.tx_or_block)
+inline void SyncGetSumTreeReq::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeReq.level)
 }
 
-// bytes block_raw = 3;
-inline void HashType::clear_block_raw() {
-  _impl_.block_raw_.ClearToEmpty();
+// uint64 start_index = 4;
+inline void SyncGetSumTreeReq::clear_start_index() {
+  _impl_.start_index_ = uint64_t{0u};
 }
-inline const std::string& HashType::block_raw() const {
-  // @@protoc_insertion_point(field_get:HashType.block_raw)
-  return _internal_block_raw();
+inline uint64_t SyncGetSumTreeReq::_internal_start_index() const {
+  return _impl_.start_index_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void HashType::set_block_raw(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.block_raw_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:HashType.block_raw)
+inline uint64_t SyncGetSumTreeReq::start_index() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeReq.start_index)
+  return _internal_start_index();
 }
-inline std::string* HashType::mutable_block_raw() {
-  std::string* _s = _internal_mutable_block_raw();
-  // @@protoc_insertion_point(field_mutable:HashType.block_raw)
-  return _s;
+inline void SyncGetSumTreeReq::_internal_set_start_index(uint64_t value) {
+  
+  _impl_.start_index_ = value;
 }
-inline const std::string& HashType::_internal_block_raw() const {
-  return _impl_.block_raw_.Get();
+inline void SyncGetSumTreeReq::set_start_index(uint64_t value) {
+  _internal_set_start_index(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeReq.start_index)
 }
-inline void HashType::_internal_set_block_raw(const std::string& value) {
-  
-  _impl_.block_raw_.Set(value, GetArenaForAllocation());
+
+// uint32 count = 5;
+inline void SyncGetSumTreeReq::clear_count() {
+  _impl_.count_ = 0u;
 }
-inline std::string* HashType::_internal_mutable_block_raw() {
+inline uint32_t SyncGetSumTreeReq::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t SyncGetSumTreeReq::count() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeReq.count)
+  return _internal_count();
+}
+inline void SyncGetSumTreeReq::_internal_set_count(uint32_t value) {
   
-  return _impl_.block_raw_.Mutable(GetArenaForAllocation());
+  _impl_.count_ = value;
 }
-inline std::string* HashType::release_block_raw() {
-  // @@protoc_insertion_point(field_release:HashType.block_raw)
-  return _impl_.block_raw_.Release();
+inline void SyncGetSumTreeReq::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeReq.count)
 }
-inline void HashType::set_allocated_block_raw(std::string* block_raw) {
-  if (block_raw != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.block_raw_.SetAllocated(block_raw, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.block_raw_.IsDefault()) {
-    _impl_.block_raw_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:HashType.block_raw)
+
+// uint64 max_height = 6;
+inline void SyncGetSumTreeReq::clear_max_height() {
+  _impl_.max_height_ = uint64_t{0u};
+}
+inline uint64_t SyncGetSumTreeReq::_internal_max_height() const {
+  return _impl_.max_height_;
+}
+inline uint64_t SyncGetSumTreeReq::max_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeReq.max_height)
+  return _internal_max_height();
+}
+inline void SyncGetSumTreeReq::_internal_set_max_height(uint64_t value) {
+  
+  _impl_.max_height_ = value;
+}
+inline void SyncGetSumTreeReq::set_max_height(uint64_t value) {
+  _internal_set_max_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeReq.max_height)
 }
 
 // -------------------------------------------------------------------
 
-// GetBlockByHashReq
+// SyncGetSumTreeAck
 
-// string addr = 1;
-inline void GetBlockByHashReq::clear_addr() {
-  _impl_.addr_.ClearToEmpty();
+// int32 code = 1;
+inline void SyncGetSumTreeAck::clear_code() {
+  _impl_.code_ = 0;
 }
-inline const std::string& GetBlockByHashReq::addr() const {
-  // @@protoc_insertion_point(field_get:GetBlockByHashReq.addr)
-  return _internal_addr();
+inline int32_t SyncGetSumTreeAck::_internal_code() const {
+  return _impl_.code_;
+}
+inline int32_t SyncGetSumTreeAck::code() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeAck.code)
+  return _internal_code();
+}
+inline void SyncGetSumTreeAck::_internal_set_code(int32_t value) {
+  
+  _impl_.code_ = value;
+}
+inline void SyncGetSumTreeAck::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeAck.code)
+}
+
+// string self_node_id = 2;
+inline void SyncGetSumTreeAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetSumTreeAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeAck.self_node_id)
+  return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByHashReq::set_addr(ArgT0&& arg0, ArgT... args) {
+void SyncGetSumTreeAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByHashReq.addr)
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeAck.self_node_id)
 }
-inline std::string* GetBlockByHashReq::mutable_addr() {
-  std::string* _s = _internal_mutable_addr();
-  // @@protoc_insertion_point(field_mutable:GetBlockByHashReq.addr)
+inline std::string* SyncGetSumTreeAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSumTreeAck.self_node_id)
   return _s;
 }
-inline const std::string& GetBlockByHashReq::_internal_addr() const {
-  return _impl_.addr_.Get();
+inline const std::string& SyncGetSumTreeAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline void GetBlockByHashReq::_internal_set_addr(const std::string& value) {
+inline void SyncGetSumTreeAck::_internal_set_self_node_id(const std::string& value) {
   
-  _impl_.addr_.Set(value, GetArenaForAllocation());
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashReq::_internal_mutable_addr() {
+inline std::string* SyncGetSumTreeAck::_internal_mutable_self_node_id() {
   
-  return _impl_.addr_.Mutable(GetArenaForAllocation());
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashReq::release_addr() {
-  // @@protoc_insertion_point(field_release:GetBlockByHashReq.addr)
-  return _impl_.addr_.Release();
+inline std::string* SyncGetSumTreeAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumTreeAck.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void GetBlockByHashReq::set_allocated_addr(std::string* addr) {
-  if (addr != nullptr) {
+inline void SyncGetSumTreeAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
     
   } else {
     
   }
-  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.addr_.IsDefault()) {
-    _impl_.addr_.Set("", GetArenaForAllocation());
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashReq.addr)
-}
-
-// repeated .HashType missingHashs = 2;
-inline int GetBlockByHashReq::_internal_missinghashs_size() const {
-  return _impl_.missinghashs_.size();
-}
-inline int GetBlockByHashReq::missinghashs_size() const {
-  return _internal_missinghashs_size();
-}
-inline void GetBlockByHashReq::clear_missinghashs() {
-  _impl_.missinghashs_.Clear();
-}
-inline ::HashType* GetBlockByHashReq::mutable_missinghashs(int index) {
-  // @@protoc_insertion_point(field_mutable:GetBlockByHashReq.missingHashs)
-  return _impl_.missinghashs_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >*
-GetBlockByHashReq::mutable_missinghashs() {
-  // @@protoc_insertion_point(field_mutable_list:GetBlockByHashReq.missingHashs)
-  return &_impl_.missinghashs_;
-}
-inline const ::HashType& GetBlockByHashReq::_internal_missinghashs(int index) const {
-  return _impl_.missinghashs_.Get(index);
-}
-inline const ::HashType& GetBlockByHashReq::missinghashs(int index) const {
-  // @@protoc_insertion_point(field_get:GetBlockByHashReq.missingHashs)
-  return _internal_missinghashs(index);
-}
-inline ::HashType* GetBlockByHashReq::_internal_add_missinghashs() {
-  return _impl_.missinghashs_.Add();
-}
-inline ::HashType* GetBlockByHashReq::add_missinghashs() {
-  ::HashType* _add = _internal_add_missinghashs();
-  // @@protoc_insertion_point(field_add:GetBlockByHashReq.missingHashs)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >&
-GetBlockByHashReq::missinghashs() const {
-  // @@protoc_insertion_point(field_list:GetBlockByHashReq.missingHashs)
-  return _impl_.missinghashs_;
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumTreeAck.self_node_id)
 }
 
 // string msg_id = 3;
-inline void GetBlockByHashReq::clear_msg_id() {
+inline void SyncGetSumTreeAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& GetBlockByHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:GetBlockByHashReq.msg_id)
+inline const std::string& SyncGetSumTreeAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSumTreeAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByHashReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeAck.msg_id)
 }
-inline std::string* GetBlockByHashReq::mutable_msg_id() {
+inline std::string* SyncGetSumTreeAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:GetBlockByHashReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetSumTreeAck.msg_id)
   return _s;
 }
-inline const std::string& GetBlockByHashReq::_internal_msg_id() const {
+inline const std::string& SyncGetSumTreeAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void GetBlockByHashReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetSumTreeAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashReq::_internal_mutable_msg_id() {
+inline std::string* SyncGetSumTreeAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:GetBlockByHashReq.msg_id)
+inline std::string* SyncGetSumTreeAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSumTreeAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void GetBlockByHashReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetSumTreeAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -9109,193 +13041,368 @@ inline void GetBlockByHashReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSumTreeAck.msg_id)
+}
+
+// uint64 node_block_height = 4;
+inline void SyncGetSumTreeAck::clear_node_block_height() {
+  _impl_.node_block_height_ = uint64_t{0u};
+}
+inline uint64_t SyncGetSumTreeAck::_internal_node_block_height() const {
+  return _impl_.node_block_height_;
+}
+inline uint64_t SyncGetSumTreeAck::node_block_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeAck.node_block_height)
+  return _internal_node_block_height();
+}
+inline void SyncGetSumTreeAck::_internal_set_node_block_height(uint64_t value) {
+  
+  _impl_.node_block_height_ = value;
+}
+inline void SyncGetSumTreeAck::set_node_block_height(uint64_t value) {
+  _internal_set_node_block_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeAck.node_block_height)
+}
+
+// uint32 level = 5;
+inline void SyncGetSumTreeAck::clear_level() {
+  _impl_.level_ = 0u;
+}
+inline uint32_t SyncGetSumTreeAck::_internal_level() const {
+  return _impl_.level_;
+}
+inline uint32_t SyncGetSumTreeAck::level() const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeAck.level)
+  return _internal_level();
+}
+inline void SyncGetSumTreeAck::_internal_set_level(uint32_t value) {
+  
+  _impl_.level_ = value;
+}
+inline void SyncGetSumTreeAck::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:SyncGetSumTreeAck.level)
+}
+
+// repeated .SyncSumTreeNode nodes = 6;
+inline int SyncGetSumTreeAck::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
+}
+inline int SyncGetSumTreeAck::nodes_size() const {
+  return _internal_nodes_size();
+}
+inline void SyncGetSumTreeAck::clear_nodes() {
+  _impl_.nodes_.Clear();
+}
+inline ::SyncSumTreeNode* SyncGetSumTreeAck::mutable_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:SyncGetSumTreeAck.nodes)
+  return _impl_.nodes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumTreeNode >*
+SyncGetSumTreeAck::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:SyncGetSumTreeAck.nodes)
+  return &_impl_.nodes_;
+}
+inline const ::SyncSumTreeNode& SyncGetSumTreeAck::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
+}
+inline const ::SyncSumTreeNode& SyncGetSumTreeAck::nodes(int index) const {
+  // @@protoc_insertion_point(field_get:SyncGetSumTreeAck.nodes)
+  return _internal_nodes(index);
+}
+inline ::SyncSumTreeNode* SyncGetSumTreeAck::_internal_add_nodes() {
+  return _impl_.nodes_.Add();
+}
+inline ::SyncSumTreeNode* SyncGetSumTreeAck::add_nodes() {
+  ::SyncSumTreeNode* _add = _internal_add_nodes();
+  // @@protoc_insertion_point(field_add:SyncGetSumTreeAck.nodes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SyncSumTreeNode >&
+SyncGetSumTreeAck::nodes() const {
+  // @@protoc_insertion_point(field_list:SyncGetSumTreeAck.nodes)
+  return _impl_.nodes_;
+}
+
+// -------------------------------------------------------------------
+
+// SnapshotManifest
+
+// uint64 height = 1;
+inline void SnapshotManifest::clear_height() {
+  _impl_.height_ = uint64_t{0u};
+}
+inline uint64_t SnapshotManifest::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint64_t SnapshotManifest::height() const {
+  // @@protoc_insertion_point(field_get:SnapshotManifest.height)
+  return _internal_height();
+}
+inline void SnapshotManifest::_internal_set_height(uint64_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void SnapshotManifest::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:SnapshotManifest.height)
 }
 
-// -------------------------------------------------------------------
-
-// GetBlockByHashAck
-
-// string addr = 1;
-inline void GetBlockByHashAck::clear_addr() {
-  _impl_.addr_.ClearToEmpty();
+// string chain_hash = 2;
+inline void SnapshotManifest::clear_chain_hash() {
+  _impl_.chain_hash_.ClearToEmpty();
 }
-inline const std::string& GetBlockByHashAck::addr() const {
-  // @@protoc_insertion_point(field_get:GetBlockByHashAck.addr)
-  return _internal_addr();
+inline const std::string& SnapshotManifest::chain_hash() const {
+  // @@protoc_insertion_point(field_get:SnapshotManifest.chain_hash)
+  return _internal_chain_hash();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByHashAck::set_addr(ArgT0&& arg0, ArgT... args) {
+void SnapshotManifest::set_chain_hash(ArgT0&& arg0, ArgT... args) {
  
- _impl_.addr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByHashAck.addr)
+ _impl_.chain_hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SnapshotManifest.chain_hash)
 }
-inline std::string* GetBlockByHashAck::mutable_addr() {
-  std::string* _s = _internal_mutable_addr();
-  // @@protoc_insertion_point(field_mutable:GetBlockByHashAck.addr)
+inline std::string* SnapshotManifest::mutable_chain_hash() {
+  std::string* _s = _internal_mutable_chain_hash();
+  // @@protoc_insertion_point(field_mutable:SnapshotManifest.chain_hash)
   return _s;
 }
-inline const std::string& GetBlockByHashAck::_internal_addr() const {
-  return _impl_.addr_.Get();
+inline const std::string& SnapshotManifest::_internal_chain_hash() const {
+  return _impl_.chain_hash_.Get();
 }
-inline void GetBlockByHashAck::_internal_set_addr(const std::string& value) {
+inline void SnapshotManifest::_internal_set_chain_hash(const std::string& value) {
   
-  _impl_.addr_.Set(value, GetArenaForAllocation());
+  _impl_.chain_hash_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashAck::_internal_mutable_addr() {
+inline std::string* SnapshotManifest::_internal_mutable_chain_hash() {
   
-  return _impl_.addr_.Mutable(GetArenaForAllocation());
+  return _impl_.chain_hash_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashAck::release_addr() {
-  // @@protoc_insertion_point(field_release:GetBlockByHashAck.addr)
-  return _impl_.addr_.Release();
+inline std::string* SnapshotManifest::release_chain_hash() {
+  // @@protoc_insertion_point(field_release:SnapshotManifest.chain_hash)
+  return _impl_.chain_hash_.Release();
 }
-inline void GetBlockByHashAck::set_allocated_addr(std::string* addr) {
-  if (addr != nullptr) {
+inline void SnapshotManifest::set_allocated_chain_hash(std::string* chain_hash) {
+  if (chain_hash != nullptr) {
     
   } else {
     
   }
-  _impl_.addr_.SetAllocated(addr, GetArenaForAllocation());
+  _impl_.chain_hash_.SetAllocated(chain_hash, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.addr_.IsDefault()) {
-    _impl_.addr_.Set("", GetArenaForAllocation());
+  if (_impl_.chain_hash_.IsDefault()) {
+    _impl_.chain_hash_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashAck.addr)
+  // @@protoc_insertion_point(field_set_allocated:SnapshotManifest.chain_hash)
 }
 
-// repeated .HashType blocks = 2;
-inline int GetBlockByHashAck::_internal_blocks_size() const {
-  return _impl_.blocks_.size();
+// repeated string chunk_hashes = 3;
+inline int SnapshotManifest::_internal_chunk_hashes_size() const {
+  return _impl_.chunk_hashes_.size();
 }
-inline int GetBlockByHashAck::blocks_size() const {
-  return _internal_blocks_size();
+inline int SnapshotManifest::chunk_hashes_size() const {
+  return _internal_chunk_hashes_size();
 }
-inline void GetBlockByHashAck::clear_blocks() {
-  _impl_.blocks_.Clear();
+inline void SnapshotManifest::clear_chunk_hashes() {
+  _impl_.chunk_hashes_.Clear();
 }
-inline ::HashType* GetBlockByHashAck::mutable_blocks(int index) {
-  // @@protoc_insertion_point(field_mutable:GetBlockByHashAck.blocks)
-  return _impl_.blocks_.Mutable(index);
+inline std::string* SnapshotManifest::add_chunk_hashes() {
+  std::string* _s = _internal_add_chunk_hashes();
+  // @@protoc_insertion_point(field_add_mutable:SnapshotManifest.chunk_hashes)
+  return _s;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >*
-GetBlockByHashAck::mutable_blocks() {
-  // @@protoc_insertion_point(field_mutable_list:GetBlockByHashAck.blocks)
-  return &_impl_.blocks_;
+inline const std::string& SnapshotManifest::_internal_chunk_hashes(int index) const {
+  return _impl_.chunk_hashes_.Get(index);
 }
-inline const ::HashType& GetBlockByHashAck::_internal_blocks(int index) const {
-  return _impl_.blocks_.Get(index);
+inline const std::string& SnapshotManifest::chunk_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:SnapshotManifest.chunk_hashes)
+  return _internal_chunk_hashes(index);
 }
-inline const ::HashType& GetBlockByHashAck::blocks(int index) const {
-  // @@protoc_insertion_point(field_get:GetBlockByHashAck.blocks)
-  return _internal_blocks(index);
+inline std::string* SnapshotManifest::mutable_chunk_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:SnapshotManifest.chunk_hashes)
+  return _impl_.chunk_hashes_.Mutable(index);
 }
-inline ::HashType* GetBlockByHashAck::_internal_add_blocks() {
-  return _impl_.blocks_.Add();
+inline void SnapshotManifest::set_chunk_hashes(int index, const std::string& value) {
+  _impl_.chunk_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SnapshotManifest.chunk_hashes)
 }
-inline ::HashType* GetBlockByHashAck::add_blocks() {
-  ::HashType* _add = _internal_add_blocks();
-  // @@protoc_insertion_point(field_add:GetBlockByHashAck.blocks)
-  return _add;
+inline void SnapshotManifest::set_chunk_hashes(int index, std::string&& value) {
+  _impl_.chunk_hashes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SnapshotManifest.chunk_hashes)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HashType >&
-GetBlockByHashAck::blocks() const {
-  // @@protoc_insertion_point(field_list:GetBlockByHashAck.blocks)
-  return _impl_.blocks_;
+inline void SnapshotManifest::set_chunk_hashes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.chunk_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SnapshotManifest.chunk_hashes)
+}
+inline void SnapshotManifest::set_chunk_hashes(int index, const char* value, size_t size) {
+  _impl_.chunk_hashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SnapshotManifest.chunk_hashes)
+}
+inline std::string* SnapshotManifest::_internal_add_chunk_hashes() {
+  return _impl_.chunk_hashes_.Add();
+}
+inline void SnapshotManifest::add_chunk_hashes(const std::string& value) {
+  _impl_.chunk_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SnapshotManifest.chunk_hashes)
+}
+inline void SnapshotManifest::add_chunk_hashes(std::string&& value) {
+  _impl_.chunk_hashes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SnapshotManifest.chunk_hashes)
+}
+inline void SnapshotManifest::add_chunk_hashes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.chunk_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SnapshotManifest.chunk_hashes)
+}
+inline void SnapshotManifest::add_chunk_hashes(const char* value, size_t size) {
+  _impl_.chunk_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SnapshotManifest.chunk_hashes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SnapshotManifest::chunk_hashes() const {
+  // @@protoc_insertion_point(field_list:SnapshotManifest.chunk_hashes)
+  return _impl_.chunk_hashes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SnapshotManifest::mutable_chunk_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:SnapshotManifest.chunk_hashes)
+  return &_impl_.chunk_hashes_;
 }
 
-// string msg_id = 3;
-inline void GetBlockByHashAck::clear_msg_id() {
-  _impl_.msg_id_.ClearToEmpty();
+// uint64 key_count = 4;
+inline void SnapshotManifest::clear_key_count() {
+  _impl_.key_count_ = uint64_t{0u};
 }
-inline const std::string& GetBlockByHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:GetBlockByHashAck.msg_id)
-  return _internal_msg_id();
+inline uint64_t SnapshotManifest::_internal_key_count() const {
+  return _impl_.key_count_;
+}
+inline uint64_t SnapshotManifest::key_count() const {
+  // @@protoc_insertion_point(field_get:SnapshotManifest.key_count)
+  return _internal_key_count();
+}
+inline void SnapshotManifest::_internal_set_key_count(uint64_t value) {
+  
+  _impl_.key_count_ = value;
+}
+inline void SnapshotManifest::set_key_count(uint64_t value) {
+  _internal_set_key_count(value);
+  // @@protoc_insertion_point(field_set:SnapshotManifest.key_count)
+}
+
+// uint64 total_bytes = 5;
+inline void SnapshotManifest::clear_total_bytes() {
+  _impl_.total_bytes_ = uint64_t{0u};
+}
+inline uint64_t SnapshotManifest::_internal_total_bytes() const {
+  return _impl_.total_bytes_;
+}
+inline uint64_t SnapshotManifest::total_bytes() const {
+  // @@protoc_insertion_point(field_get:SnapshotManifest.total_bytes)
+  return _internal_total_bytes();
+}
+inline void SnapshotManifest::_internal_set_total_bytes(uint64_t value) {
+  
+  _impl_.total_bytes_ = value;
+}
+inline void SnapshotManifest::set_total_bytes(uint64_t value) {
+  _internal_set_total_bytes(value);
+  // @@protoc_insertion_point(field_set:SnapshotManifest.total_bytes)
+}
+
+// string root = 6;
+inline void SnapshotManifest::clear_root() {
+  _impl_.root_.ClearToEmpty();
+}
+inline const std::string& SnapshotManifest::root() const {
+  // @@protoc_insertion_point(field_get:SnapshotManifest.root)
+  return _internal_root();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetBlockByHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SnapshotManifest::set_root(ArgT0&& arg0, ArgT... args) {
  
- _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetBlockByHashAck.msg_id)
+ _impl_.root_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SnapshotManifest.root)
 }
-inline std::string* GetBlockByHashAck::mutable_msg_id() {
-  std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:GetBlockByHashAck.msg_id)
+inline std::string* SnapshotManifest::mutable_root() {
+  std::string* _s = _internal_mutable_root();
+  // @@protoc_insertion_point(field_mutable:SnapshotManifest.root)
   return _s;
 }
-inline const std::string& GetBlockByHashAck::_internal_msg_id() const {
-  return _impl_.msg_id_.Get();
+inline const std::string& SnapshotManifest::_internal_root() const {
+  return _impl_.root_.Get();
 }
-inline void GetBlockByHashAck::_internal_set_msg_id(const std::string& value) {
+inline void SnapshotManifest::_internal_set_root(const std::string& value) {
   
-  _impl_.msg_id_.Set(value, GetArenaForAllocation());
+  _impl_.root_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashAck::_internal_mutable_msg_id() {
+inline std::string* SnapshotManifest::_internal_mutable_root() {
   
-  return _impl_.msg_id_.Mutable(GetArenaForAllocation());
+  return _impl_.root_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetBlockByHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:GetBlockByHashAck.msg_id)
-  return _impl_.msg_id_.Release();
+inline std::string* SnapshotManifest::release_root() {
+  // @@protoc_insertion_point(field_release:SnapshotManifest.root)
+  return _impl_.root_.Release();
 }
-inline void GetBlockByHashAck::set_allocated_msg_id(std::string* msg_id) {
-  if (msg_id != nullptr) {
+inline void SnapshotManifest::set_allocated_root(std::string* root) {
+  if (root != nullptr) {
     
   } else {
     
   }
-  _impl_.msg_id_.SetAllocated(msg_id, GetArenaForAllocation());
+  _impl_.root_.SetAllocated(root, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.msg_id_.IsDefault()) {
-    _impl_.msg_id_.Set("", GetArenaForAllocation());
+  if (_impl_.root_.IsDefault()) {
+    _impl_.root_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetBlockByHashAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SnapshotManifest.root)
 }
 
 // -------------------------------------------------------------------
 
-// SyncNodeHashReq
+// SyncGetSnapshotManifestReq
 
 // string self_node_id = 1;
-inline void SyncNodeHashReq::clear_self_node_id() {
+inline void SyncGetSnapshotManifestReq::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& SyncNodeHashReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncNodeHashReq.self_node_id)
+inline const std::string& SyncGetSnapshotManifestReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotManifestReq.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncNodeHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotManifestReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncNodeHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotManifestReq.self_node_id)
 }
-inline std::string* SyncNodeHashReq::mutable_self_node_id() {
+inline std::string* SyncGetSnapshotManifestReq::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncNodeHashReq.self_node_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotManifestReq.self_node_id)
   return _s;
 }
-inline const std::string& SyncNodeHashReq::_internal_self_node_id() const {
+inline const std::string& SyncGetSnapshotManifestReq::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void SyncNodeHashReq::_internal_set_self_node_id(const std::string& value) {
+inline void SyncGetSnapshotManifestReq::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashReq::_internal_mutable_self_node_id() {
+inline std::string* SyncGetSnapshotManifestReq::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncNodeHashReq.self_node_id)
+inline std::string* SyncGetSnapshotManifestReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotManifestReq.self_node_id)
   return _impl_.self_node_id_.Release();
 }
-inline void SyncNodeHashReq::set_allocated_self_node_id(std::string* self_node_id) {
+inline void SyncGetSnapshotManifestReq::set_allocated_self_node_id(std::string* self_node_id) {
   if (self_node_id != nullptr) {
     
   } else {
@@ -9307,45 +13414,45 @@ inline void SyncNodeHashReq::set_allocated_self_node_id(std::string* self_node_i
     _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashReq.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotManifestReq.self_node_id)
 }
 
 // string msg_id = 2;
-inline void SyncNodeHashReq::clear_msg_id() {
+inline void SyncGetSnapshotManifestReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncNodeHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncNodeHashReq.msg_id)
+inline const std::string& SyncGetSnapshotManifestReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotManifestReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncNodeHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotManifestReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncNodeHashReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotManifestReq.msg_id)
 }
-inline std::string* SyncNodeHashReq::mutable_msg_id() {
+inline std::string* SyncGetSnapshotManifestReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncNodeHashReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotManifestReq.msg_id)
   return _s;
 }
-inline const std::string& SyncNodeHashReq::_internal_msg_id() const {
+inline const std::string& SyncGetSnapshotManifestReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncNodeHashReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetSnapshotManifestReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashReq::_internal_mutable_msg_id() {
+inline std::string* SyncGetSnapshotManifestReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncNodeHashReq.msg_id)
+inline std::string* SyncGetSnapshotManifestReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotManifestReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void SyncNodeHashReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetSnapshotManifestReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -9357,49 +13464,69 @@ inline void SyncNodeHashReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotManifestReq.msg_id)
 }
 
 // -------------------------------------------------------------------
 
-// SyncNodeHashAck
+// SyncGetSnapshotManifestAck
 
-// string self_node_id = 1;
-inline void SyncNodeHashAck::clear_self_node_id() {
+// int32 code = 1;
+inline void SyncGetSnapshotManifestAck::clear_code() {
+  _impl_.code_ = 0;
+}
+inline int32_t SyncGetSnapshotManifestAck::_internal_code() const {
+  return _impl_.code_;
+}
+inline int32_t SyncGetSnapshotManifestAck::code() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotManifestAck.code)
+  return _internal_code();
+}
+inline void SyncGetSnapshotManifestAck::_internal_set_code(int32_t value) {
+  
+  _impl_.code_ = value;
+}
+inline void SyncGetSnapshotManifestAck::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotManifestAck.code)
+}
+
+// string self_node_id = 2;
+inline void SyncGetSnapshotManifestAck::clear_self_node_id() {
   _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& SyncNodeHashAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:SyncNodeHashAck.self_node_id)
+inline const std::string& SyncGetSnapshotManifestAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotManifestAck.self_node_id)
   return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncNodeHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotManifestAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncNodeHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotManifestAck.self_node_id)
 }
-inline std::string* SyncNodeHashAck::mutable_self_node_id() {
+inline std::string* SyncGetSnapshotManifestAck::mutable_self_node_id() {
   std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:SyncNodeHashAck.self_node_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotManifestAck.self_node_id)
   return _s;
 }
-inline const std::string& SyncNodeHashAck::_internal_self_node_id() const {
+inline const std::string& SyncGetSnapshotManifestAck::_internal_self_node_id() const {
   return _impl_.self_node_id_.Get();
 }
-inline void SyncNodeHashAck::_internal_set_self_node_id(const std::string& value) {
+inline void SyncGetSnapshotManifestAck::_internal_set_self_node_id(const std::string& value) {
   
   _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashAck::_internal_mutable_self_node_id() {
+inline std::string* SyncGetSnapshotManifestAck::_internal_mutable_self_node_id() {
   
   return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:SyncNodeHashAck.self_node_id)
+inline std::string* SyncGetSnapshotManifestAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotManifestAck.self_node_id)
   return _impl_.self_node_id_.Release();
 }
-inline void SyncNodeHashAck::set_allocated_self_node_id(std::string* self_node_id) {
+inline void SyncGetSnapshotManifestAck::set_allocated_self_node_id(std::string* self_node_id) {
   if (self_node_id != nullptr) {
     
   } else {
@@ -9411,45 +13538,45 @@ inline void SyncNodeHashAck::set_allocated_self_node_id(std::string* self_node_i
     _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotManifestAck.self_node_id)
 }
 
-// string msg_id = 2;
-inline void SyncNodeHashAck::clear_msg_id() {
+// string msg_id = 3;
+inline void SyncGetSnapshotManifestAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& SyncNodeHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:SyncNodeHashAck.msg_id)
+inline const std::string& SyncGetSnapshotManifestAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotManifestAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncNodeHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotManifestAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncNodeHashAck.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotManifestAck.msg_id)
 }
-inline std::string* SyncNodeHashAck::mutable_msg_id() {
+inline std::string* SyncGetSnapshotManifestAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:SyncNodeHashAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotManifestAck.msg_id)
   return _s;
 }
-inline const std::string& SyncNodeHashAck::_internal_msg_id() const {
+inline const std::string& SyncGetSnapshotManifestAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void SyncNodeHashAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetSnapshotManifestAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashAck::_internal_mutable_msg_id() {
+inline std::string* SyncGetSnapshotManifestAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:SyncNodeHashAck.msg_id)
+inline std::string* SyncGetSnapshotManifestAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotManifestAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void SyncNodeHashAck::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetSnapshotManifestAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -9461,119 +13588,209 @@ inline void SyncNodeHashAck::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotManifestAck.msg_id)
 }
 
-// string hash = 3;
-inline void SyncNodeHashAck::clear_hash() {
-  _impl_.hash_.ClearToEmpty();
+// uint64 node_block_height = 4;
+inline void SyncGetSnapshotManifestAck::clear_node_block_height() {
+  _impl_.node_block_height_ = uint64_t{0u};
 }
-inline const std::string& SyncNodeHashAck::hash() const {
-  // @@protoc_insertion_point(field_get:SyncNodeHashAck.hash)
-  return _internal_hash();
+inline uint64_t SyncGetSnapshotManifestAck::_internal_node_block_height() const {
+  return _impl_.node_block_height_;
+}
+inline uint64_t SyncGetSnapshotManifestAck::node_block_height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotManifestAck.node_block_height)
+  return _internal_node_block_height();
+}
+inline void SyncGetSnapshotManifestAck::_internal_set_node_block_height(uint64_t value) {
+  
+  _impl_.node_block_height_ = value;
+}
+inline void SyncGetSnapshotManifestAck::set_node_block_height(uint64_t value) {
+  _internal_set_node_block_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotManifestAck.node_block_height)
+}
+
+// .SnapshotManifest manifest = 5;
+inline bool SyncGetSnapshotManifestAck::_internal_has_manifest() const {
+  return this != internal_default_instance() && _impl_.manifest_ != nullptr;
+}
+inline bool SyncGetSnapshotManifestAck::has_manifest() const {
+  return _internal_has_manifest();
+}
+inline void SyncGetSnapshotManifestAck::clear_manifest() {
+  if (GetArenaForAllocation() == nullptr && _impl_.manifest_ != nullptr) {
+    delete _impl_.manifest_;
+  }
+  _impl_.manifest_ = nullptr;
+}
+inline const ::SnapshotManifest& SyncGetSnapshotManifestAck::_internal_manifest() const {
+  const ::SnapshotManifest* p = _impl_.manifest_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SnapshotManifest&>(
+      ::_SnapshotManifest_default_instance_);
+}
+inline const ::SnapshotManifest& SyncGetSnapshotManifestAck::manifest() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotManifestAck.manifest)
+  return _internal_manifest();
+}
+inline void SyncGetSnapshotManifestAck::unsafe_arena_set_allocated_manifest(
+    ::SnapshotManifest* manifest) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.manifest_);
+  }
+  _impl_.manifest_ = manifest;
+  if (manifest) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SyncGetSnapshotManifestAck.manifest)
+}
+inline ::SnapshotManifest* SyncGetSnapshotManifestAck::release_manifest() {
+  
+  ::SnapshotManifest* temp = _impl_.manifest_;
+  _impl_.manifest_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SnapshotManifest* SyncGetSnapshotManifestAck::unsafe_arena_release_manifest() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotManifestAck.manifest)
+  
+  ::SnapshotManifest* temp = _impl_.manifest_;
+  _impl_.manifest_ = nullptr;
+  return temp;
+}
+inline ::SnapshotManifest* SyncGetSnapshotManifestAck::_internal_mutable_manifest() {
+  
+  if (_impl_.manifest_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SnapshotManifest>(GetArenaForAllocation());
+    _impl_.manifest_ = p;
+  }
+  return _impl_.manifest_;
+}
+inline ::SnapshotManifest* SyncGetSnapshotManifestAck::mutable_manifest() {
+  ::SnapshotManifest* _msg = _internal_mutable_manifest();
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotManifestAck.manifest)
+  return _msg;
+}
+inline void SyncGetSnapshotManifestAck::set_allocated_manifest(::SnapshotManifest* manifest) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.manifest_;
+  }
+  if (manifest) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(manifest);
+    if (message_arena != submessage_arena) {
+      manifest = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, manifest, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.manifest_ = manifest;
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotManifestAck.manifest)
+}
+
+// -------------------------------------------------------------------
+
+// SyncGetSnapshotChunkReq
+
+// string self_node_id = 1;
+inline void SyncGetSnapshotChunkReq::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
+}
+inline const std::string& SyncGetSnapshotChunkReq::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkReq.self_node_id)
+  return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SyncNodeHashAck::set_hash(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotChunkReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:SyncNodeHashAck.hash)
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkReq.self_node_id)
 }
-inline std::string* SyncNodeHashAck::mutable_hash() {
-  std::string* _s = _internal_mutable_hash();
-  // @@protoc_insertion_point(field_mutable:SyncNodeHashAck.hash)
+inline std::string* SyncGetSnapshotChunkReq::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotChunkReq.self_node_id)
   return _s;
 }
-inline const std::string& SyncNodeHashAck::_internal_hash() const {
-  return _impl_.hash_.Get();
+inline const std::string& SyncGetSnapshotChunkReq::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline void SyncNodeHashAck::_internal_set_hash(const std::string& value) {
+inline void SyncGetSnapshotChunkReq::_internal_set_self_node_id(const std::string& value) {
   
-  _impl_.hash_.Set(value, GetArenaForAllocation());
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashAck::_internal_mutable_hash() {
+inline std::string* SyncGetSnapshotChunkReq::_internal_mutable_self_node_id() {
   
-  return _impl_.hash_.Mutable(GetArenaForAllocation());
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SyncNodeHashAck::release_hash() {
-  // @@protoc_insertion_point(field_release:SyncNodeHashAck.hash)
-  return _impl_.hash_.Release();
+inline std::string* SyncGetSnapshotChunkReq::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotChunkReq.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void SyncNodeHashAck::set_allocated_hash(std::string* hash) {
-  if (hash != nullptr) {
+inline void SyncGetSnapshotChunkReq::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
     
   } else {
     
   }
-  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.hash_.IsDefault()) {
-    _impl_.hash_.Set("", GetArenaForAllocation());
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:SyncNodeHashAck.hash)
-}
-
-// -------------------------------------------------------------------
-
-// GetCheckSumHashReq
-
-// uint64 height = 1;
-inline void GetCheckSumHashReq::clear_height() {
-  _impl_.height_ = uint64_t{0u};
-}
-inline uint64_t GetCheckSumHashReq::_internal_height() const {
-  return _impl_.height_;
-}
-inline uint64_t GetCheckSumHashReq::height() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashReq.height)
-  return _internal_height();
-}
-inline void GetCheckSumHashReq::_internal_set_height(uint64_t value) {
-  
-  _impl_.height_ = value;
-}
-inline void GetCheckSumHashReq::set_height(uint64_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:GetCheckSumHashReq.height)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotChunkReq.self_node_id)
 }
 
 // string msg_id = 2;
-inline void GetCheckSumHashReq::clear_msg_id() {
+inline void SyncGetSnapshotChunkReq::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& GetCheckSumHashReq::msg_id() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashReq.msg_id)
+inline const std::string& SyncGetSnapshotChunkReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkReq.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetCheckSumHashReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotChunkReq::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetCheckSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkReq.msg_id)
 }
-inline std::string* GetCheckSumHashReq::mutable_msg_id() {
+inline std::string* SyncGetSnapshotChunkReq::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:GetCheckSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotChunkReq.msg_id)
   return _s;
 }
-inline const std::string& GetCheckSumHashReq::_internal_msg_id() const {
+inline const std::string& SyncGetSnapshotChunkReq::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void GetCheckSumHashReq::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetSnapshotChunkReq::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashReq::_internal_mutable_msg_id() {
+inline std::string* SyncGetSnapshotChunkReq::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashReq::release_msg_id() {
-  // @@protoc_insertion_point(field_release:GetCheckSumHashReq.msg_id)
+inline std::string* SyncGetSnapshotChunkReq::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotChunkReq.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void GetCheckSumHashReq::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetSnapshotChunkReq::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -9585,169 +13802,159 @@ inline void GetCheckSumHashReq::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashReq.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotChunkReq.msg_id)
 }
 
-// string self_node_id = 3;
-inline void GetCheckSumHashReq::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// uint64 height = 3;
+inline void SyncGetSnapshotChunkReq::clear_height() {
+  _impl_.height_ = uint64_t{0u};
 }
-inline const std::string& GetCheckSumHashReq::self_node_id() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashReq.self_node_id)
-  return _internal_self_node_id();
+inline uint64_t SyncGetSnapshotChunkReq::_internal_height() const {
+  return _impl_.height_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetCheckSumHashReq::set_self_node_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetCheckSumHashReq.self_node_id)
+inline uint64_t SyncGetSnapshotChunkReq::height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkReq.height)
+  return _internal_height();
 }
-inline std::string* GetCheckSumHashReq::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:GetCheckSumHashReq.self_node_id)
-  return _s;
+inline void SyncGetSnapshotChunkReq::_internal_set_height(uint64_t value) {
+  
+  _impl_.height_ = value;
 }
-inline const std::string& GetCheckSumHashReq::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline void SyncGetSnapshotChunkReq::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkReq.height)
 }
-inline void GetCheckSumHashReq::_internal_set_self_node_id(const std::string& value) {
-  
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+
+// uint32 index = 4;
+inline void SyncGetSnapshotChunkReq::clear_index() {
+  _impl_.index_ = 0u;
 }
-inline std::string* GetCheckSumHashReq::_internal_mutable_self_node_id() {
-  
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+inline uint32_t SyncGetSnapshotChunkReq::_internal_index() const {
+  return _impl_.index_;
 }
-inline std::string* GetCheckSumHashReq::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:GetCheckSumHashReq.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline uint32_t SyncGetSnapshotChunkReq::index() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkReq.index)
+  return _internal_index();
 }
-inline void GetCheckSumHashReq::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashReq.self_node_id)
+inline void SyncGetSnapshotChunkReq::_internal_set_index(uint32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void SyncGetSnapshotChunkReq::set_index(uint32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkReq.index)
 }
 
 // -------------------------------------------------------------------
 
-// GetCheckSumHashAck
+// SyncGetSnapshotChunkAck
 
-// uint64 height = 1;
-inline void GetCheckSumHashAck::clear_height() {
-  _impl_.height_ = uint64_t{0u};
+// int32 code = 1;
+inline void SyncGetSnapshotChunkAck::clear_code() {
+  _impl_.code_ = 0;
 }
-inline uint64_t GetCheckSumHashAck::_internal_height() const {
-  return _impl_.height_;
+inline int32_t SyncGetSnapshotChunkAck::_internal_code() const {
+  return _impl_.code_;
 }
-inline uint64_t GetCheckSumHashAck::height() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.height)
-  return _internal_height();
+inline int32_t SyncGetSnapshotChunkAck::code() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkAck.code)
+  return _internal_code();
 }
-inline void GetCheckSumHashAck::_internal_set_height(uint64_t value) {
+inline void SyncGetSnapshotChunkAck::_internal_set_code(int32_t value) {
   
-  _impl_.height_ = value;
+  _impl_.code_ = value;
 }
-inline void GetCheckSumHashAck::set_height(uint64_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.height)
+inline void SyncGetSnapshotChunkAck::set_code(int32_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkAck.code)
 }
 
-// string hash = 2;
-inline void GetCheckSumHashAck::clear_hash() {
-  _impl_.hash_.ClearToEmpty();
+// string self_node_id = 2;
+inline void SyncGetSnapshotChunkAck::clear_self_node_id() {
+  _impl_.self_node_id_.ClearToEmpty();
 }
-inline const std::string& GetCheckSumHashAck::hash() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.hash)
-  return _internal_hash();
+inline const std::string& SyncGetSnapshotChunkAck::self_node_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkAck.self_node_id)
+  return _internal_self_node_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetCheckSumHashAck::set_hash(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotChunkAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.hash_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.hash)
+ _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkAck.self_node_id)
 }
-inline std::string* GetCheckSumHashAck::mutable_hash() {
-  std::string* _s = _internal_mutable_hash();
-  // @@protoc_insertion_point(field_mutable:GetCheckSumHashAck.hash)
+inline std::string* SyncGetSnapshotChunkAck::mutable_self_node_id() {
+  std::string* _s = _internal_mutable_self_node_id();
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotChunkAck.self_node_id)
   return _s;
 }
-inline const std::string& GetCheckSumHashAck::_internal_hash() const {
-  return _impl_.hash_.Get();
+inline const std::string& SyncGetSnapshotChunkAck::_internal_self_node_id() const {
+  return _impl_.self_node_id_.Get();
 }
-inline void GetCheckSumHashAck::_internal_set_hash(const std::string& value) {
+inline void SyncGetSnapshotChunkAck::_internal_set_self_node_id(const std::string& value) {
   
-  _impl_.hash_.Set(value, GetArenaForAllocation());
+  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashAck::_internal_mutable_hash() {
+inline std::string* SyncGetSnapshotChunkAck::_internal_mutable_self_node_id() {
   
-  return _impl_.hash_.Mutable(GetArenaForAllocation());
+  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashAck::release_hash() {
-  // @@protoc_insertion_point(field_release:GetCheckSumHashAck.hash)
-  return _impl_.hash_.Release();
+inline std::string* SyncGetSnapshotChunkAck::release_self_node_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotChunkAck.self_node_id)
+  return _impl_.self_node_id_.Release();
 }
-inline void GetCheckSumHashAck::set_allocated_hash(std::string* hash) {
-  if (hash != nullptr) {
+inline void SyncGetSnapshotChunkAck::set_allocated_self_node_id(std::string* self_node_id) {
+  if (self_node_id != nullptr) {
     
   } else {
     
   }
-  _impl_.hash_.SetAllocated(hash, GetArenaForAllocation());
+  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.hash_.IsDefault()) {
-    _impl_.hash_.Set("", GetArenaForAllocation());
+  if (_impl_.self_node_id_.IsDefault()) {
+    _impl_.self_node_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashAck.hash)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotChunkAck.self_node_id)
 }
 
 // string msg_id = 3;
-inline void GetCheckSumHashAck::clear_msg_id() {
+inline void SyncGetSnapshotChunkAck::clear_msg_id() {
   _impl_.msg_id_.ClearToEmpty();
 }
-inline const std::string& GetCheckSumHashAck::msg_id() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.msg_id)
+inline const std::string& SyncGetSnapshotChunkAck::msg_id() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkAck.msg_id)
   return _internal_msg_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetCheckSumHashAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotChunkAck::set_msg_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.msg_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkAck.msg_id)
 }
-inline std::string* GetCheckSumHashAck::mutable_msg_id() {
+inline std::string* SyncGetSnapshotChunkAck::mutable_msg_id() {
   std::string* _s = _internal_mutable_msg_id();
-  // @@protoc_insertion_point(field_mutable:GetCheckSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotChunkAck.msg_id)
   return _s;
 }
-inline const std::string& GetCheckSumHashAck::_internal_msg_id() const {
+inline const std::string& SyncGetSnapshotChunkAck::_internal_msg_id() const {
   return _impl_.msg_id_.Get();
 }
-inline void GetCheckSumHashAck::_internal_set_msg_id(const std::string& value) {
+inline void SyncGetSnapshotChunkAck::_internal_set_msg_id(const std::string& value) {
   
   _impl_.msg_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashAck::_internal_mutable_msg_id() {
+inline std::string* SyncGetSnapshotChunkAck::_internal_mutable_msg_id() {
   
   return _impl_.msg_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashAck::release_msg_id() {
-  // @@protoc_insertion_point(field_release:GetCheckSumHashAck.msg_id)
+inline std::string* SyncGetSnapshotChunkAck::release_msg_id() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotChunkAck.msg_id)
   return _impl_.msg_id_.Release();
 }
-inline void GetCheckSumHashAck::set_allocated_msg_id(std::string* msg_id) {
+inline void SyncGetSnapshotChunkAck::set_allocated_msg_id(std::string* msg_id) {
   if (msg_id != nullptr) {
     
   } else {
@@ -9759,77 +13966,97 @@ inline void GetCheckSumHashAck::set_allocated_msg_id(std::string* msg_id) {
     _impl_.msg_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashAck.msg_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotChunkAck.msg_id)
 }
 
-// bool success = 4;
-inline void GetCheckSumHashAck::clear_success() {
-  _impl_.success_ = false;
+// uint64 height = 4;
+inline void SyncGetSnapshotChunkAck::clear_height() {
+  _impl_.height_ = uint64_t{0u};
 }
-inline bool GetCheckSumHashAck::_internal_success() const {
-  return _impl_.success_;
+inline uint64_t SyncGetSnapshotChunkAck::_internal_height() const {
+  return _impl_.height_;
 }
-inline bool GetCheckSumHashAck::success() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.success)
-  return _internal_success();
+inline uint64_t SyncGetSnapshotChunkAck::height() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkAck.height)
+  return _internal_height();
 }
-inline void GetCheckSumHashAck::_internal_set_success(bool value) {
+inline void SyncGetSnapshotChunkAck::_internal_set_height(uint64_t value) {
   
-  _impl_.success_ = value;
+  _impl_.height_ = value;
 }
-inline void GetCheckSumHashAck::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.success)
+inline void SyncGetSnapshotChunkAck::set_height(uint64_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkAck.height)
 }
 
-// string self_node_id = 5;
-inline void GetCheckSumHashAck::clear_self_node_id() {
-  _impl_.self_node_id_.ClearToEmpty();
+// uint32 index = 5;
+inline void SyncGetSnapshotChunkAck::clear_index() {
+  _impl_.index_ = 0u;
 }
-inline const std::string& GetCheckSumHashAck::self_node_id() const {
-  // @@protoc_insertion_point(field_get:GetCheckSumHashAck.self_node_id)
-  return _internal_self_node_id();
+inline uint32_t SyncGetSnapshotChunkAck::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint32_t SyncGetSnapshotChunkAck::index() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkAck.index)
+  return _internal_index();
+}
+inline void SyncGetSnapshotChunkAck::_internal_set_index(uint32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void SyncGetSnapshotChunkAck::set_index(uint32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkAck.index)
+}
+
+// bytes data = 6;
+inline void SyncGetSnapshotChunkAck::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& SyncGetSnapshotChunkAck::data() const {
+  // @@protoc_insertion_point(field_get:SyncGetSnapshotChunkAck.data)
+  return _internal_data();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetCheckSumHashAck::set_self_node_id(ArgT0&& arg0, ArgT... args) {
+void SyncGetSnapshotChunkAck::set_data(ArgT0&& arg0, ArgT... args) {
  
- _impl_.self_node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:GetCheckSumHashAck.self_node_id)
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SyncGetSnapshotChunkAck.data)
 }
-inline std::string* GetCheckSumHashAck::mutable_self_node_id() {
-  std::string* _s = _internal_mutable_self_node_id();
-  // @@protoc_insertion_point(field_mutable:GetCheckSumHashAck.self_node_id)
+inline std::string* SyncGetSnapshotChunkAck::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:SyncGetSnapshotChunkAck.data)
   return _s;
 }
-inline const std::string& GetCheckSumHashAck::_internal_self_node_id() const {
-  return _impl_.self_node_id_.Get();
+inline const std::string& SyncGetSnapshotChunkAck::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void GetCheckSumHashAck::_internal_set_self_node_id(const std::string& value) {
+inline void SyncGetSnapshotChunkAck::_internal_set_data(const std::string& value) {
   
-  _impl_.self_node_id_.Set(value, GetArenaForAllocation());
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashAck::_internal_mutable_self_node_id() {
+inline std::string* SyncGetSnapshotChunkAck::_internal_mutable_data() {
   
-  return _impl_.self_node_id_.Mutable(GetArenaForAllocation());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetCheckSumHashAck::release_self_node_id() {
-  // @@protoc_insertion_point(field_release:GetCheckSumHashAck.self_node_id)
-  return _impl_.self_node_id_.Release();
+inline std::string* SyncGetSnapshotChunkAck::release_data() {
+  // @@protoc_insertion_point(field_release:SyncGetSnapshotChunkAck.data)
+  return _impl_.data_.Release();
 }
-inline void GetCheckSumHashAck::set_allocated_self_node_id(std::string* self_node_id) {
-  if (self_node_id != nullptr) {
+inline void SyncGetSnapshotChunkAck::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  _impl_.self_node_id_.SetAllocated(self_node_id, GetArenaForAllocation());
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.self_node_id_.IsDefault()) {
-    _impl_.self_node_id_.Set("", GetArenaForAllocation());
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:GetCheckSumHashAck.self_node_id)
+  // @@protoc_insertion_point(field_set_allocated:SyncGetSnapshotChunkAck.data)
 }
 
 #ifdef __GNUC__
@@ -9891,6 +14118,28 @@ inline void GetCheckSumHashAck::set_allocated_self_node_id(std::string* self_nod
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
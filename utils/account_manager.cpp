@@ -13,6 +13,7 @@
 #include "../utils/keccak_cryopp.hpp"
 #include "verified_address.h"
 #include "address_cache.h"
+#include "ed25519_batch.h"
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <termios.h>
@@ -1273,50 +1274,19 @@ bool ed25519SignMessage(const std::string &message, EVP_PKEY* pkey, std::string
 
 bool ed25519VerificationMessage(const std::string &message, EVP_PKEY* pkey, const std::string &signature)
 {
-    EVP_MD_CTX *mdctx = NULL;
-    const char *msg = message.c_str();
-    unsigned char *sig = (unsigned char *)signature.data();
-    size_t slen = signature.size();
-    size_t msgLen = strlen(msg);
-
-    if(!(mdctx = EVP_MD_CTX_new())) 
-    {
-        return false;
-    }
-
-    /* Initialize `key` with a public key */
-    if(1 != EVP_DigestVerifyInit(mdctx, NULL, NULL, NULL, pkey)) 
-    {
-        EVP_MD_CTX_free(mdctx);
-        return false;
-    }
-
-    if (1 != EVP_DigestVerify(mdctx, sig, slen ,(const unsigned char *)msg, msgLen)) 
-    {
-        EVP_MD_CTX_free(mdctx);
-        return false;
-    }
-
-    EVP_MD_CTX_free(mdctx);
-    return true;
-
+    return ed25519VerifyWithKey(message, pkey, signature);
 }
 
 bool get_ed_pub_key_by_bytes(const std::string &pubStr, EVP_PKEY* &pKey)
 {
-    //Generate public key from binary string of public key  
-    unsigned char* bufPtr = (unsigned char *)pubStr.data();
-    const unsigned char *pk_str = bufPtr;
-    int lenPtr = pubStr.size();
-    
-    if(lenPtr == 0)
+    if(pubStr.empty())
     {
         ERRORLOG("public key Binary is empty");
         return false;
     }
 
-    EVP_PKEY *peerPubKey = d2i_PUBKEY(NULL, &pk_str, lenPtr);
-
+    //Parsed keys are shared through the cache, the caller still owns one reference
+    EVP_PKEY *peerPubKey = MagicSingleton<Ed25519PubKeyCache>::GetInstance()->Acquire(pubStr);
     if(peerPubKey == nullptr)
     {
         return false;
@@ -0,0 +1,174 @@
+#include "utils/ed25519_batch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <openssl/x509.h>
+
+#include "utils/magic_singleton.h"
+#include "utils/verified_signature_cache.h"
+
+namespace
+{
+    // Below this many signatures the thread start-up costs more than it saves
+    const size_t kParallelThreshold = 64;
+    const size_t kItemsPerWorker = 32;
+}
+
+Ed25519PubKeyCache::~Ed25519PubKeyCache()
+{
+    for (auto &[pub, entry] : _keys)
+    {
+        EVP_PKEY_free(entry.first);
+    }
+}
+
+EVP_PKEY *Ed25519PubKeyCache::Acquire(const std::string &pubStr)
+{
+    if (pubStr.empty())
+    {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto found = _keys.find(pubStr);
+        if (found != _keys.end())
+        {
+            _lru.splice(_lru.begin(), _lru, found->second.second);
+            EVP_PKEY_up_ref(found->second.first);
+            ++_hits;
+            return found->second.first;
+        }
+    }
+    ++_misses;
+
+    const unsigned char *pkStr = reinterpret_cast<const unsigned char *>(pubStr.data());
+    EVP_PKEY *parsed = d2i_PUBKEY(nullptr, &pkStr, pubStr.size());
+    if (parsed == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto found = _keys.find(pubStr);
+    if (found != _keys.end())
+    {
+        // Another thread parsed the same key meanwhile, keep the cached one
+        EVP_PKEY_free(parsed);
+        EVP_PKEY_up_ref(found->second.first);
+        return found->second.first;
+    }
+    _lru.push_front(pubStr);
+    _keys.emplace(pubStr, std::make_pair(parsed, _lru.begin()));
+    while (_keys.size() > kCapacity)
+    {
+        auto evicted = _keys.find(_lru.back());
+        EVP_PKEY_free(evicted->second.first);
+        _keys.erase(evicted);
+        _lru.pop_back();
+    }
+    EVP_PKEY_up_ref(parsed);
+    return parsed;
+}
+
+Ed25519PubKeyCache::Stats Ed25519PubKeyCache::GetStats()
+{
+    Stats stats;
+    stats.hits = _hits;
+    stats.misses = _misses;
+    std::lock_guard<std::mutex> lock(_mutex);
+    stats.entries = _keys.size();
+    return stats;
+}
+
+bool ed25519VerifyWithKey(const std::string &message, EVP_PKEY *pkey, const std::string &signature)
+{
+    if (pkey == nullptr)
+    {
+        return false;
+    }
+
+    // Same message length rule as ed25519VerificationMessage: signed messages are C strings
+    const char *msg = message.c_str();
+    std::string_view signedMessage(msg, strlen(msg));
+
+    unsigned char rawPub[64];
+    size_t rawPubLen = sizeof(rawPub);
+    bool cacheable = EVP_PKEY_get_raw_public_key(pkey, rawPub, &rawPubLen) == 1;
+    std::string_view signer(reinterpret_cast<const char *>(rawPub), cacheable ? rawPubLen : 0);
+    auto verifiedCache = MagicSingleton<VerifiedSignatureCache>::GetInstance();
+    if (cacheable && verifiedCache->Contains(signedMessage, signer, signature))
+    {
+        return true;
+    }
+
+    thread_local std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> mdctx(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+    if (!mdctx)
+    {
+        return false;
+    }
+    EVP_MD_CTX_reset(mdctx.get());
+
+    if (1 != EVP_DigestVerifyInit(mdctx.get(), NULL, NULL, NULL, pkey))
+    {
+        return false;
+    }
+    if (1 != EVP_DigestVerify(mdctx.get(), reinterpret_cast<const unsigned char *>(signature.data()), signature.size(),
+                              reinterpret_cast<const unsigned char *>(signedMessage.data()), signedMessage.size()))
+    {
+        return false;
+    }
+    if (cacheable)
+    {
+        verifiedCache->Insert(signedMessage, signer, signature);
+    }
+    return true;
+}
+
+size_t ed25519BatchVerify(const std::vector<Ed25519VerifyItem> &items, std::vector<char> &valid, size_t maxThreads)
+{
+    valid.assign(items.size(), 0);
+    if (items.empty())
+    {
+        return 0;
+    }
+
+    auto keyCache = MagicSingleton<Ed25519PubKeyCache>::GetInstance();
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t index = next++; index < items.size(); index = next++)
+        {
+            const auto &item = items[index];
+            if (item.signature.empty())
+            {
+                continue;
+            }
+            EVP_PKEY *pkey = keyCache->Acquire(item.pub);
+            valid[index] = ed25519VerifyWithKey(item.message, pkey, item.signature);
+            EVP_PKEY_free(pkey);
+        }
+    };
+
+    size_t workerCount = 1;
+    if (items.size() >= kParallelThreshold)
+    {
+        size_t cores = maxThreads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : maxThreads;
+        workerCount = std::clamp<size_t>(items.size() / kItemsPerWorker, 1, cores);
+    }
+    std::vector<std::future<void>> workers;
+    for (size_t i = 1; i < workerCount; ++i)
+    {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto &future : workers)
+    {
+        future.wait();
+    }
+
+    return std::count(valid.begin(), valid.end(), 0);
+}
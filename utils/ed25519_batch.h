@@ -0,0 +1,96 @@
+/**
+ * *****************************************************************************
+ * @file        ed25519_batch.h
+ * @brief       Batched Ed25519 verification with a shared public key cache
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef UTILS_ED25519_BATCH_HEADER
+#define UTILS_ED25519_BATCH_HEADER
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <openssl/evp.h>
+
+/**
+ * @brief       One signature to verify: the signed message, the DER public key bytes and the signature
+ */
+struct Ed25519VerifyItem
+{
+    std::string message;
+    std::string pub;
+    std::string signature;
+};
+
+/**
+ * @brief       Parsed public keys keyed by their DER bytes.
+ *              Keys are handed out with an extra reference, so callers release
+ *              them with EVP_PKEY_free exactly as they would a freshly parsed key.
+ */
+class Ed25519PubKeyCache
+{
+public:
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t entries = 0;
+    };
+
+    Ed25519PubKeyCache() = default;
+    ~Ed25519PubKeyCache();
+    Ed25519PubKeyCache(Ed25519PubKeyCache &&) = delete;
+    Ed25519PubKeyCache(const Ed25519PubKeyCache &) = delete;
+    Ed25519PubKeyCache &operator=(Ed25519PubKeyCache &&) = delete;
+    Ed25519PubKeyCache &operator=(const Ed25519PubKeyCache &) = delete;
+
+    /**
+     * @brief       Get the parsed key for the public key bytes
+     *
+     * @param       pubStr: DER encoded public key
+     * @return      EVP_PKEY* new reference owned by the caller, nullptr when the bytes do not parse
+     */
+    EVP_PKEY *Acquire(const std::string &pubStr);
+
+    Stats GetStats();
+
+    static constexpr size_t kCapacity = 16384;
+
+private:
+    std::mutex _mutex;
+    std::list<std::string> _lru;
+    std::unordered_map<std::string, std::pair<EVP_PKEY *, std::list<std::string>::iterator>> _keys;
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+};
+
+/**
+ * @brief       Verify a single signature with an already parsed key, reusing a per-thread digest context.
+ *              Signatures found in the VerifiedSignatureCache are accepted without the curve check.
+ *
+ * @param       message: signed message
+ * @param       pkey: public key
+ * @param       signature: signature bytes
+ * @return      true    the signature is valid
+ * @return      false   it is not
+ */
+bool ed25519VerifyWithKey(const std::string &message, EVP_PKEY *pkey, const std::string &signature);
+
+/**
+ * @brief       Verify a batch of signatures across the available cores
+ *
+ * @param       items: signatures to verify
+ * @param       valid: per item outcome, resized to items.size()
+ * @param       maxThreads: upper bound on the worker threads, 0 for one per core
+ * @return      size_t number of invalid signatures
+ */
+size_t ed25519BatchVerify(const std::vector<Ed25519VerifyItem> &items, std::vector<char> &valid, size_t maxThreads = 0);
+
+#endif
@@ -0,0 +1,134 @@
+#include "utils/rotating_bloom_filter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+RotatingBloomFilter::RotatingBloomFilter(size_t capacity, double falsePositiveRate, std::chrono::milliseconds span)
+    : _capacity(std::max<size_t>(capacity, 1)), _span(span)
+{
+    // Optimal size and hash count for the capacity and rate, rounded to whole words
+    double rate = std::min(std::max(falsePositiveRate, 1e-9), 0.5);
+    double bits = -static_cast<double>(_capacity) * std::log(rate) / (std::log(2.0) * std::log(2.0));
+    _bits = (static_cast<size_t>(std::ceil(bits)) + 63) / 64 * 64;
+    _hashes = std::max<size_t>(1, static_cast<size_t>(std::round(static_cast<double>(_bits) / _capacity * std::log(2.0))));
+
+    auto now = std::chrono::steady_clock::now();
+    for (auto &generation : _generations)
+    {
+        generation.words.assign(_bits / 64, 0);
+        generation.started = now;
+    }
+}
+
+bool RotatingBloomFilter::Contains(std::string_view key)
+{
+    uint64_t first = 0;
+    uint64_t second = 0;
+    hash(key, first, second);
+    std::lock_guard<std::mutex> lock(_mutex);
+    rotate();
+    return test(_generations[0], first, second) || test(_generations[1], first, second);
+}
+
+bool RotatingBloomFilter::Insert(std::string_view key)
+{
+    uint64_t first = 0;
+    uint64_t second = 0;
+    hash(key, first, second);
+    std::lock_guard<std::mutex> lock(_mutex);
+    rotate();
+    auto &current = _generations[_current];
+    if (test(current, first, second))
+    {
+        return false;
+    }
+    bool previous = test(_generations[1 - _current], first, second);
+    for (size_t i = 0; i < _hashes; ++i)
+    {
+        uint64_t bit = (first + i * second) % _bits;
+        current.words[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+    ++current.count;
+    return !previous;
+}
+
+double RotatingBloomFilter::EstimatedFalsePositiveRate()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    rotate();
+    return 1 - (1 - fill(_generations[0])) * (1 - fill(_generations[1]));
+}
+
+size_t RotatingBloomFilter::Count()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _generations[0].count + _generations[1].count;
+}
+
+size_t RotatingBloomFilter::MemoryBytes() const
+{
+    return _generations.size() * _bits / 8;
+}
+
+void RotatingBloomFilter::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto now = std::chrono::steady_clock::now();
+    for (auto &generation : _generations)
+    {
+        std::fill(generation.words.begin(), generation.words.end(), 0);
+        generation.count = 0;
+        generation.started = now;
+    }
+}
+
+void RotatingBloomFilter::rotate()
+{
+    auto &current = _generations[_current];
+    auto now = std::chrono::steady_clock::now();
+    if (current.count < _capacity && now - current.started < _span)
+    {
+        return;
+    }
+    _current = 1 - _current;
+    auto &next = _generations[_current];
+    std::fill(next.words.begin(), next.words.end(), 0);
+    next.count = 0;
+    next.started = now;
+}
+
+bool RotatingBloomFilter::test(const Generation &generation, uint64_t first, uint64_t second) const
+{
+    if (generation.count == 0)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < _hashes; ++i)
+    {
+        uint64_t bit = (first + i * second) % _bits;
+        if ((generation.words[bit / 64] & (uint64_t(1) << (bit % 64))) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+double RotatingBloomFilter::fill(const Generation &generation) const
+{
+    // (1 - e^(-kn/m))^k for n keys in m bits with k hashes
+    return std::pow(1 - std::exp(-static_cast<double>(_hashes) * generation.count / _bits), static_cast<double>(_hashes));
+}
+
+void RotatingBloomFilter::hash(std::string_view key, uint64_t &first, uint64_t &second)
+{
+    // Double hashing: the library hash and an FNV-1a hash forced odd so the probes never repeat early
+    first = std::hash<std::string_view>()(key);
+    second = 1469598103934665603ULL;
+    for (unsigned char c : key)
+    {
+        second = (second ^ c) * 1099511628211ULL;
+    }
+    second |= 1;
+}
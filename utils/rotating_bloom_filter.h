@@ -0,0 +1,86 @@
+/**
+ * *****************************************************************************
+ * @file        rotating_bloom_filter.h
+ * @brief       Fixed size bloom filter of recent keys kept in two rotating generations
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef UTILS_ROTATING_BLOOM_FILTER_HEADER
+#define UTILS_ROTATING_BLOOM_FILTER_HEADER
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief       A pair of bloom filters, the current one taking inserts and the previous one still
+ *              answering lookups. When the current filter has taken its capacity or its span has
+ *              passed, it becomes the previous one and the oldest is reset, so a key is remembered
+ *              for one to two generations in constant memory. Lookups may report a key that was never
+ *              inserted at about the configured rate per generation, never the other way round.
+ */
+class RotatingBloomFilter
+{
+public:
+    /**
+     * @param       capacity: keys per generation
+     * @param       falsePositiveRate: false positive rate of one full generation
+     * @param       span: longest time a generation takes inserts
+     */
+    RotatingBloomFilter(size_t capacity, double falsePositiveRate, std::chrono::milliseconds span);
+    ~RotatingBloomFilter() = default;
+    RotatingBloomFilter(RotatingBloomFilter &&) = delete;
+    RotatingBloomFilter(const RotatingBloomFilter &) = delete;
+    RotatingBloomFilter &operator=(RotatingBloomFilter &&) = delete;
+    RotatingBloomFilter &operator=(const RotatingBloomFilter &) = delete;
+
+    bool Contains(std::string_view key);
+
+    /**
+     * @brief       Insert a key
+     *
+     * @return      true    the key was not reported before
+     * @return      false   it was, or is a false positive
+     */
+    bool Insert(std::string_view key);
+
+    /**
+     * @brief       Chance that a key never inserted is reported, from the fill of both generations
+     */
+    double EstimatedFalsePositiveRate();
+
+    /**
+     * @brief       Keys inserted into both generations
+     */
+    size_t Count();
+
+    size_t MemoryBytes() const;
+    void Clear();
+
+private:
+    struct Generation
+    {
+        std::vector<uint64_t> words;
+        size_t count = 0;
+        std::chrono::steady_clock::time_point started;
+    };
+
+    void rotate();
+    bool test(const Generation &generation, uint64_t first, uint64_t second) const;
+    double fill(const Generation &generation) const;
+    static void hash(std::string_view key, uint64_t &first, uint64_t &second);
+
+    std::mutex _mutex;
+    size_t _capacity;
+    std::chrono::milliseconds _span;
+    size_t _bits;
+    size_t _hashes;
+    std::array<Generation, 2> _generations;
+    size_t _current = 0;
+};
+
+#endif
@@ -0,0 +1,334 @@
+#include "utils/tx_lifecycle_tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+    std::atomic<uint64_t> nextInstance{1};
+
+    const char *const kStageNames[] = {"rpcReceipt", "broadcast", "admissionVerify", "mempoolInsert",
+                                       "pack", "blockBroadcast", "blockVerify", "commit"};
+    static_assert(sizeof(kStageNames) / sizeof(kStageNames[0]) == static_cast<size_t>(TxTraceStage::kCount));
+
+    TxTracePercentiles percentiles(std::vector<uint64_t> &values)
+    {
+        TxTracePercentiles result;
+        if (values.empty())
+        {
+            return result;
+        }
+        std::sort(values.begin(), values.end());
+        auto at = [&values](double q) { return values[std::min(values.size() - 1, static_cast<size_t>(q * values.size()))]; };
+        result.count = values.size();
+        result.p50 = at(0.50);
+        result.p90 = at(0.90);
+        result.p99 = at(0.99);
+        result.max = values.back();
+        return result;
+    }
+
+    std::string hexKey(uint64_t key)
+    {
+        static const char kDigits[] = "0123456789abcdef";
+        std::string hex(16, '0');
+        for (int i = 15; i >= 0; --i, key >>= 4)
+        {
+            hex[i] = kDigits[key & 0xf];
+        }
+        return hex;
+    }
+}
+
+const char *TxTraceStageName(TxTraceStage stage)
+{
+    return stage < TxTraceStage::kCount ? kStageNames[static_cast<size_t>(stage)] : "unknown";
+}
+
+thread_local TxLifecycleTracer::LocalRing TxLifecycleTracer::_localRing;
+
+TxLifecycleTracer::LocalRing::~LocalRing()
+{
+    release();
+}
+
+void TxLifecycleTracer::LocalRing::release()
+{
+    if (ring != nullptr)
+    {
+        // Its events stay readable until the next owner overwrites them
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->free.push_back(ring);
+    }
+    instance = 0;
+    ring = nullptr;
+    pool.reset();
+}
+
+TxLifecycleTracer::TxLifecycleTracer() : _instance(nextInstance++), _pool(std::make_shared<RingPool>())
+{
+}
+
+void TxLifecycleTracer::Record(TxTraceStage stage, const std::string &txHash)
+{
+    uint64_t txKey = 0;
+    if (stage >= TxTraceStage::kCount || !key(txHash, txKey))
+    {
+        return;
+    }
+    // sampleEvery is a power of two, the low bits of the hash pick the sample
+    if ((txKey & (_sampleEvery.load(std::memory_order_relaxed) - 1)) != 0)
+    {
+        return;
+    }
+
+    uint64_t time = now();
+    Ring *ring = localRing();
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    Slot &slot = ring->slots[head % kRingSize];
+    slot.key.store(txKey, std::memory_order_relaxed);
+    slot.timeAndStage.store(time << 8 | static_cast<uint8_t>(stage), std::memory_order_relaxed);
+    ring->head.store(head + 1, std::memory_order_release);
+
+    uint64_t windowStart = _windowStart.load(std::memory_order_relaxed);
+    if (time - windowStart >= 1000000 && _windowStart.compare_exchange_strong(windowStart, time))
+    {
+        adapt(time - windowStart);
+    }
+}
+
+std::vector<TxTraceStageSummary> TxLifecycleTracer::Summarize()
+{
+    constexpr size_t kStages = static_cast<size_t>(TxTraceStage::kCount);
+    std::array<std::vector<uint64_t>, kStages> sinceFirst;
+    std::array<std::vector<uint64_t>, kStages> sincePrevious;
+    for (const auto &[_, timeline] : timelines())
+    {
+        uint64_t first = 0;
+        uint64_t previous = 0;
+        for (size_t stage = 0; stage < kStages; ++stage)
+        {
+            uint64_t time = timeline[stage];
+            if (time == 0)
+            {
+                continue;
+            }
+            if (first == 0)
+            {
+                first = time;
+                previous = time;
+                continue;
+            }
+            // Stages are recorded by different threads and may land out of order by a few microseconds
+            sinceFirst[stage].push_back(time > first ? time - first : 0);
+            sincePrevious[stage].push_back(time > previous ? time - previous : 0);
+            previous = std::max(previous, time);
+        }
+    }
+
+    std::vector<TxTraceStageSummary> summaries;
+    for (size_t stage = 0; stage < kStages; ++stage)
+    {
+        summaries.push_back({static_cast<TxTraceStage>(stage), percentiles(sinceFirst[stage]), percentiles(sincePrevious[stage])});
+    }
+    return summaries;
+}
+
+std::string TxLifecycleTracer::ExportChromeTrace(size_t maxTransactions)
+{
+    auto traced = timelines();
+    auto firstTime = [](const Timeline &timeline) {
+        uint64_t first = UINT64_MAX;
+        for (auto time : timeline)
+        {
+            if (time != 0)
+            {
+                first = std::min(first, time);
+            }
+        }
+        return first;
+    };
+    std::sort(traced.begin(), traced.end(), [&firstTime](const auto &a, const auto &b) {
+        return firstTime(a.second) > firstTime(b.second);
+    });
+    traced.resize(std::min(traced.size(), maxTransactions));
+
+    nlohmann::json events = nlohmann::json::array();
+    uint64_t track = 0;
+    for (const auto &[txKey, timeline] : traced)
+    {
+        ++track;
+        std::string name = hexKey(txKey);
+        events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", track}, {"args", {{"name", name}}}});
+
+        std::vector<std::pair<uint64_t, size_t>> stages;
+        for (size_t stage = 0; stage < timeline.size(); ++stage)
+        {
+            if (timeline[stage] != 0)
+            {
+                stages.emplace_back(timeline[stage], stage);
+            }
+        }
+        std::sort(stages.begin(), stages.end());
+        events.push_back({{"name", kStageNames[stages.front().second]}, {"ph", "i"}, {"s", "t"}, {"pid", 1}, {"tid", track},
+                          {"ts", stages.front().first}, {"args", {{"tx", name}}}});
+        // A slice per stage, from the stage before it
+        for (size_t i = 1; i < stages.size(); ++i)
+        {
+            events.push_back({{"name", kStageNames[stages[i].second]}, {"cat", "tx"}, {"ph", "X"}, {"pid", 1}, {"tid", track},
+                              {"ts", stages[i - 1].first}, {"dur", stages[i].first - stages[i - 1].first}, {"args", {{"tx", name}}}});
+        }
+    }
+
+    nlohmann::json trace;
+    trace["traceEvents"] = std::move(events);
+    trace["displayTimeUnit"] = "ms";
+    return trace.dump();
+}
+
+TxTraceStats TxLifecycleTracer::GetStats()
+{
+    TxTraceStats stats;
+    stats.sampleEvery = _sampleEvery.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(_pool->mutex);
+        stats.threads = _pool->rings.size() - _pool->free.size();
+        for (const auto &ring : _pool->rings)
+        {
+            stats.recorded += ring->head.load(std::memory_order_relaxed);
+        }
+    }
+    stats.transactions = timelines().size();
+    return stats;
+}
+
+TxLifecycleTracer::Ring *TxLifecycleTracer::localRing()
+{
+    if (_localRing.instance != _instance)
+    {
+        _localRing.release();
+        std::lock_guard<std::mutex> lock(_pool->mutex);
+        if (_pool->free.empty())
+        {
+            _pool->rings.push_back(std::make_unique<Ring>());
+            _localRing.ring = _pool->rings.back().get();
+        }
+        else
+        {
+            _localRing.ring = _pool->free.back();
+            _pool->free.pop_back();
+        }
+        _localRing.pool = _pool;
+        _localRing.instance = _instance;
+    }
+    return _localRing.ring;
+}
+
+void TxLifecycleTracer::adapt(uint64_t elapsed)
+{
+    uint64_t total = 0;
+    std::lock_guard<std::mutex> lock(_pool->mutex);
+    for (const auto &ring : _pool->rings)
+    {
+        total += ring->head.load(std::memory_order_relaxed);
+    }
+    uint64_t rate = (total - _windowEvents) * 1000000 / std::max<uint64_t>(elapsed, 1);
+    _windowEvents = total;
+
+    uint32_t sampleEvery = _sampleEvery.load(std::memory_order_relaxed);
+    if (rate > kTargetEventsPerSec && sampleEvery < kMaxSampleEvery)
+    {
+        _sampleEvery.store(sampleEvery * 2, std::memory_order_relaxed);
+    }
+    else if (rate < kTargetEventsPerSec / 4 && sampleEvery > 1)
+    {
+        _sampleEvery.store(sampleEvery / 2, std::memory_order_relaxed);
+    }
+}
+
+std::vector<TxLifecycleTracer::Event> TxLifecycleTracer::snapshot()
+{
+    std::vector<Event> events;
+    std::lock_guard<std::mutex> lock(_pool->mutex);
+    for (const auto &ring : _pool->rings)
+    {
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t begin = head > kRingSize ? head - kRingSize : 0;
+        size_t copied = events.size();
+        for (uint64_t i = begin; i < head; ++i)
+        {
+            const Slot &slot = ring->slots[i % kRingSize];
+            uint64_t timeAndStage = slot.timeAndStage.load(std::memory_order_relaxed);
+            events.push_back({slot.key.load(std::memory_order_relaxed), timeAndStage >> 8, static_cast<TxTraceStage>(timeAndStage & 0xff)});
+        }
+
+        // The owner kept writing meanwhile, the slots it reached again may hold torn events
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t after = ring->head.load(std::memory_order_relaxed);
+        uint64_t valid = after > kRingSize ? after - kRingSize : 0;
+        if (valid > begin)
+        {
+            size_t torn = std::min<uint64_t>(valid - begin, head - begin);
+            events.erase(events.begin() + copied, events.begin() + copied + torn);
+        }
+    }
+    return events;
+}
+
+std::vector<std::pair<uint64_t, TxLifecycleTracer::Timeline>> TxLifecycleTracer::timelines()
+{
+    std::unordered_map<uint64_t, Timeline> byKey;
+    for (const auto &event : snapshot())
+    {
+        if (event.stage >= TxTraceStage::kCount)
+        {
+            continue;
+        }
+        // A stage reached more than once, as a block verified again, counts from its first time
+        uint64_t &time = byKey[event.key][static_cast<size_t>(event.stage)];
+        if (time == 0 || event.time < time)
+        {
+            time = event.time;
+        }
+    }
+    return {byKey.begin(), byKey.end()};
+}
+
+bool TxLifecycleTracer::key(const std::string &txHash, uint64_t &key)
+{
+    if (txHash.empty())
+    {
+        return false;
+    }
+    // The leading 16 hex digits of the hash, so exported keys can be matched to the chain
+    key = 0;
+    for (size_t i = 0; i < 16; ++i)
+    {
+        char c = i < txHash.size() ? txHash[i] : '\0';
+        uint64_t digit;
+        if (c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        }
+        else
+        {
+            key = std::hash<std::string>()(txHash);
+            return true;
+        }
+        key = key << 4 | digit;
+    }
+    return true;
+}
+
+uint64_t TxLifecycleTracer::now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,178 @@
+/**
+ * *****************************************************************************
+ * @file        tx_lifecycle_tracer.h
+ * @brief       Sampled per-thread tracing of transactions from submission to block commit
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef UTILS_TX_LIFECYCLE_TRACER_HEADER
+#define UTILS_TX_LIFECYCLE_TRACER_HEADER
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief       Stages in the order a transaction passes them. A node records the stages it takes part in,
+ *              the node receiving the RPC sees the first two, the packager the ones after them.
+ */
+enum class TxTraceStage : uint8_t
+{
+    kRpcReceipt,
+    kBroadcast,
+    kAdmissionVerify,
+    kMempoolInsert,
+    kPack,
+    kBlockBroadcast,
+    kBlockVerify,
+    kCommit,
+    kCount
+};
+
+const char *TxTraceStageName(TxTraceStage stage);
+
+/**
+ * @brief       Latency percentiles in microseconds
+ */
+struct TxTracePercentiles
+{
+    uint64_t count = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t max = 0;
+};
+
+/**
+ * @brief       Latency of reaching a stage, from the first stage recorded for the transaction and from the
+ *              stage recorded just before it
+ */
+struct TxTraceStageSummary
+{
+    TxTraceStage stage;
+    TxTracePercentiles sinceFirst;
+    TxTracePercentiles sincePrevious;
+};
+
+struct TxTraceStats
+{
+    uint64_t recorded = 0;
+    uint32_t sampleEvery = 1;
+    size_t threads = 0;
+    size_t transactions = 0;
+};
+
+/**
+ * @brief       Each recording thread appends to a ring buffer of its own, with relaxed stores and one
+ *              release store of the ring head and no lock, so tracing costs a clock read per event.
+ *              Readers copy the rings and drop the slots overwritten while they copied.
+ *              A transaction is traced when its hash falls in the sample, one in sampleEvery. The hash
+ *              decides, so every stage of a sampled transaction is recorded, on each node that samples it. Once a second
+ *              sampleEvery is doubled while more than kTargetEventsPerSec were recorded and halved back
+ *              while the rate is below a quarter of it.
+ *              Only the last kRingSize events of a thread are kept, summaries cover recent traffic. The ring
+ *              of an exited thread is reused by the next new one, so there are as many rings as threads
+ *              ever recorded at the same time.
+ */
+class TxLifecycleTracer
+{
+public:
+    TxLifecycleTracer();
+    ~TxLifecycleTracer() = default;
+    TxLifecycleTracer(TxLifecycleTracer &&) = delete;
+    TxLifecycleTracer(const TxLifecycleTracer &) = delete;
+    TxLifecycleTracer &operator=(TxLifecycleTracer &&) = delete;
+    TxLifecycleTracer &operator=(const TxLifecycleTracer &) = delete;
+
+    /**
+     * @brief       Record that a transaction reached a stage, if it is sampled
+     *
+     * @param       stage: stage reached
+     * @param       txHash: hex transaction hash
+     */
+    void Record(TxTraceStage stage, const std::string &txHash);
+
+    /**
+     * @brief       Latency percentiles of every stage over the events still in the rings
+     */
+    std::vector<TxTraceStageSummary> Summarize();
+
+    /**
+     * @brief       The most recent traced transactions in the Chrome trace event format, one track per
+     *              transaction and one slice per stage, for chrome://tracing or Perfetto
+     *
+     * @param       maxTransactions: most transactions to export
+     * @return      std::string the trace as JSON
+     */
+    std::string ExportChromeTrace(size_t maxTransactions);
+
+    TxTraceStats GetStats();
+
+    static constexpr size_t kRingSize = 8192;
+    static constexpr uint64_t kTargetEventsPerSec = 20000;
+    static constexpr uint32_t kMaxSampleEvery = 1024;
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> key{0};
+        // Microseconds of the steady clock shifted left by 8, the stage in the low byte
+        std::atomic<uint64_t> timeAndStage{0};
+    };
+
+    struct Ring
+    {
+        std::array<Slot, kRingSize> slots;
+        std::atomic<uint64_t> head{0};
+    };
+
+    struct RingPool
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Ring>> rings;
+        // Rings of exited threads, handed to the next thread that records
+        std::vector<Ring *> free;
+    };
+
+    // The ring of this thread, returned to its pool when the thread exits. The pool is shared so
+    // it outlives the tracer while a thread still holds one of its rings.
+    struct LocalRing
+    {
+        uint64_t instance = 0;
+        Ring *ring = nullptr;
+        std::shared_ptr<RingPool> pool;
+        ~LocalRing();
+        void release();
+    };
+
+    struct Event
+    {
+        uint64_t key;
+        uint64_t time;
+        TxTraceStage stage;
+    };
+
+    using Timeline = std::array<uint64_t, static_cast<size_t>(TxTraceStage::kCount)>;
+
+    Ring *localRing();
+    void adapt(uint64_t elapsed);
+    std::vector<Event> snapshot();
+    std::vector<std::pair<uint64_t, Timeline>> timelines();
+    static bool key(const std::string &txHash, uint64_t &key);
+    static uint64_t now();
+
+    static thread_local LocalRing _localRing;
+
+    const uint64_t _instance;
+    const std::shared_ptr<RingPool> _pool;
+    std::atomic<uint32_t> _sampleEvery{1};
+    std::atomic<uint64_t> _windowStart{0};
+    uint64_t _windowEvents = 0;
+};
+
+#endif
@@ -0,0 +1,77 @@
+#include "utils/verified_signature_cache.h"
+
+#include <functional>
+
+std::string VerifiedSignatureCache::makeKey(std::string_view message, std::string_view signer, std::string_view signature)
+{
+    // Signer and signature have fixed sizes for Ed25519, the lengths keep the key unambiguous for anything else
+    std::string key;
+    key.reserve(message.size() + signer.size() + signature.size() + 2);
+    key.push_back(static_cast<char>(signer.size()));
+    key.append(signer);
+    key.push_back(static_cast<char>(signature.size()));
+    key.append(signature);
+    key.append(message);
+    return key;
+}
+
+VerifiedSignatureCache::Shard &VerifiedSignatureCache::shardFor(const std::string &key)
+{
+    return _shards[std::hash<std::string>{}(key) % kShardCount];
+}
+
+bool VerifiedSignatureCache::Contains(std::string_view message, std::string_view signer, std::string_view signature)
+{
+    ++_lookups;
+    std::string key = makeKey(message, signer, signature);
+    Shard &shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.entries.find(key) == shard.entries.end())
+    {
+        return false;
+    }
+    ++_hits;
+    return true;
+}
+
+void VerifiedSignatureCache::Insert(std::string_view message, std::string_view signer, std::string_view signature)
+{
+    std::string key = makeKey(message, signer, signature);
+    Shard &shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.entries.insert(key).second)
+    {
+        return;
+    }
+    ++_inserts;
+    shard.order.push_back(std::move(key));
+    while (shard.order.size() > kEntriesPerShard)
+    {
+        shard.entries.erase(shard.order.front());
+        shard.order.pop_front();
+    }
+}
+
+void VerifiedSignatureCache::Clear()
+{
+    for (auto &shard : _shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.entries.clear();
+        shard.order.clear();
+    }
+}
+
+VerifiedSignatureCache::Stats VerifiedSignatureCache::GetStats()
+{
+    Stats stats;
+    stats.lookups = _lookups;
+    stats.hits = _hits;
+    stats.inserts = _inserts;
+    for (auto &shard : _shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.entries += shard.entries.size();
+    }
+    return stats;
+}
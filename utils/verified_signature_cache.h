@@ -0,0 +1,90 @@
+/**
+ * *****************************************************************************
+ * @file        verified_signature_cache.h
+ * @brief       Bounded concurrent cache of signatures that have already verified
+ * @date        2026-10-19
+ * @copyright   mm
+ * *****************************************************************************
+ */
+#ifndef UTILS_VERIFIED_SIGNATURE_CACHE_HEADER
+#define UTILS_VERIFIED_SIGNATURE_CACHE_HEADER
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+/**
+ * @brief       Remembers (message, signer, signature) triples that passed Ed25519 verification.
+ *              The same transaction signatures are checked when the transaction is admitted,
+ *              when its block is built, broadcast and synced; only the first check does the
+ *              curve arithmetic. The signed message is the hash of the signed fields, so any
+ *              change to the transaction produces a different entry.
+ */
+class VerifiedSignatureCache
+{
+public:
+    struct Stats
+    {
+        uint64_t lookups = 0;
+        uint64_t hits = 0;
+        uint64_t inserts = 0;
+        uint64_t entries = 0;
+    };
+
+    VerifiedSignatureCache() = default;
+    ~VerifiedSignatureCache() = default;
+    VerifiedSignatureCache(VerifiedSignatureCache &&) = delete;
+    VerifiedSignatureCache(const VerifiedSignatureCache &) = delete;
+    VerifiedSignatureCache &operator=(VerifiedSignatureCache &&) = delete;
+    VerifiedSignatureCache &operator=(const VerifiedSignatureCache &) = delete;
+
+    /**
+     * @brief       Whether the signature has verified before
+     *
+     * @param       message: signed message
+     * @param       signer: raw public key of the signer
+     * @param       signature: signature bytes
+     * @return      true    it verified before
+     * @return      false   it has to be verified
+     */
+    bool Contains(std::string_view message, std::string_view signer, std::string_view signature);
+
+    /**
+     * @brief       Record a signature that verified
+     *
+     * @param       message: signed message
+     * @param       signer: raw public key of the signer
+     * @param       signature: signature bytes
+     */
+    void Insert(std::string_view message, std::string_view signer, std::string_view signature);
+
+    void Clear();
+
+    Stats GetStats();
+
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kEntriesPerShard = 8192;
+
+private:
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_set<std::string> entries;
+        std::deque<std::string> order;
+    };
+
+    static std::string makeKey(std::string_view message, std::string_view signer, std::string_view signature);
+    Shard &shardFor(const std::string &key);
+
+    std::array<Shard, kShardCount> _shards;
+    std::atomic<uint64_t> _lookups{0};
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _inserts{0};
+};
+
+#endif